@@ -31,8 +31,7 @@
 #include "gbench_base.hh"
 #include <memory>
 
-#define MAX_BLOCK_SIZE 32768
-#define MAX_KEY_SIZE   256
+#define MAX_KEY_SIZE 256
 
 // Test blocksizes, append more if needed, size is in bytes
 std::vector<Int64> blocksizes = { 16, 64, 256, 1024, 8192, 16384, 32768 };
@@ -51,21 +50,21 @@ CipherAeadBench(benchmark::State& state,
                   << " is not an AEAD Cipher! exiting this bench!";
         return -1;
     }
-    // Allocate with 512 bit alignment
-    alignas(64) Uint8              vec_in_arr[MAX_BLOCK_SIZE]  = {};
-    alignas(64) Uint8              vec_out_arr[MAX_BLOCK_SIZE] = {};
-    alignas(16) Uint8              tag_buffer[16]              = {};
-    alignas(16) Uint8              key[MAX_KEY_SIZE / 8]       = {};
-    alignas(16) Uint8              iv[16]                      = {};
-    alignas(16) Uint8              ad[16]                      = {};
-    alignas(16) Uint8              tag[16]                     = {};
-    alignas(16) Uint8              tkey[MAX_KEY_SIZE / 8]      = {};
-    alcp::testing::CipherAeadBase* p_cb                        = nullptr;
+    // Dynamic allocation, records can be larger than the stack
+    std::vector<Uint8>             vec_in(cBlockSize);
+    std::vector<Uint8>             vec_out(cBlockSize);
+    alignas(16) Uint8              tag_buffer[16]         = {};
+    alignas(16) Uint8              key[MAX_KEY_SIZE / 8]  = {};
+    alignas(16) Uint8              iv[32]                 = {};
+    alignas(16) Uint8              ad[16]                 = {};
+    alignas(16) Uint8              tag[16]                = {};
+    alignas(16) Uint8              tkey[MAX_KEY_SIZE / 8] = {};
+    alcp::testing::CipherAeadBase* p_cb                   = nullptr;
 
     alcp::testing::alcp_dc_ex_t data;
-    data.m_in      = vec_in_arr;
+    data.m_in      = &(vec_in[0]);
     data.m_inl     = cBlockSize;
-    data.m_out     = vec_out_arr;
+    data.m_out     = &(vec_out[0]);
     data.m_outl    = cBlockSize;
     data.m_iv      = iv;
     data.m_ivl     = 12;
@@ -79,8 +78,11 @@ CipherAeadBench(benchmark::State& state,
 
     alc_cipher_state_t cipherState;
 
-    if (alcpMode == ALC_AES_MODE_SIV) {
+    if (alcpMode == ALC_AES_MODE_SIV || alcpMode == ALC_AEGIS128L
+        || alcpMode == ALC_AEGIS128X2 || alcpMode == ALC_AEGIS128X4) {
         data.m_ivl = 16;
+    } else if (alcpMode == ALC_AEGIS256) {
+        data.m_ivl = 32;
     }
 
     alcp::testing::AlcpCipherAeadBase acb =
@@ -128,8 +130,8 @@ CipherAeadBench(benchmark::State& state,
         if (!p_cb->encrypt(data)) {
             state.SkipWithError("AEAD : BENCH_ENC_FAILURE");
         }
-        data.m_in  = vec_out_arr;
-        data.m_out = vec_in_arr;
+        data.m_in  = &(vec_out[0]);
+        data.m_out = &(vec_in[0]);
         // TAG is the IV
         // cb->init(key, keylen);
         if (alcpMode == ALC_AES_MODE_SIV) {
@@ -140,11 +142,12 @@ CipherAeadBench(benchmark::State& state,
     }
 
     for (auto _ : state) {
-        // For OpenSSL GCM and SIV, Reset needs to be called again since tag
-        // needs to be generated each time
+        // For OpenSSL GCM, SIV and OCB, Reset needs to be called again since
+        // tag needs to be generated each time
         if ((useossl
              && (alcpMode == ALC_AES_MODE_GCM
-                 || alcpMode == ALC_AES_MODE_SIV))) {
+                 || alcpMode == ALC_AES_MODE_SIV
+                 || alcpMode == ALC_AES_MODE_OCB))) {
             if (!p_cb->init(key, keylen)) {
                 state.SkipWithError("GCM: BENCH_RESET_FAILURE");
             }
@@ -554,6 +557,106 @@ BENCH_AES_DECRYPT_SIV_256(benchmark::State& state)
 }
 // END 256 bit keysize
 
+// OCB
+static void
+BENCH_AES_ENCRYPT_OCB_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AES_MODE_OCB, 128));
+}
+
+static void
+BENCH_AES_DECRYPT_OCB_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AES_MODE_OCB, 128));
+}
+
+static void
+BENCH_AES_ENCRYPT_OCB_192(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AES_MODE_OCB, 192));
+}
+
+static void
+BENCH_AES_DECRYPT_OCB_192(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AES_MODE_OCB, 192));
+}
+
+static void
+BENCH_AES_ENCRYPT_OCB_256(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AES_MODE_OCB, 256));
+}
+
+static void
+BENCH_AES_DECRYPT_OCB_256(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AES_MODE_OCB, 256));
+}
+
+// AEGIS
+static void
+BENCH_AEGIS128L_ENCRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AEGIS128L, 128));
+}
+
+static void
+BENCH_AEGIS128L_DECRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AEGIS128L, 128));
+}
+
+static void
+BENCH_AEGIS256_ENCRYPT_256(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AEGIS256, 256));
+}
+
+static void
+BENCH_AEGIS256_DECRYPT_256(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AEGIS256, 256));
+}
+
+static void
+BENCH_AEGIS128X2_ENCRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AEGIS128X2, 128));
+}
+
+static void
+BENCH_AEGIS128X2_DECRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AEGIS128X2, 128));
+}
+
+static void
+BENCH_AEGIS128X4_ENCRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), ENCRYPT, ALC_AEGIS128X4, 128));
+}
+
+static void
+BENCH_AEGIS128X4_DECRYPT_128(benchmark::State& state)
+{
+    benchmark::DoNotOptimize(
+        CipherAeadBench(state, state.range(0), DECRYPT, ALC_AEGIS128X4, 128));
+}
+
 /* Multi-init Benchmarks*/
 #ifdef MULTI_INIT_BENCH
 static void
@@ -694,6 +797,28 @@ AddBenchmarks()
     BENCHMARK(BENCH_AES_DECRYPT_CCM_256)->ArgsProduct({ blocksizes });
     BENCHMARK(BENCH_AES_ENCRYPT_CCM_192)->ArgsProduct({ blocksizes });
     BENCHMARK(BENCH_AES_DECRYPT_CCM_192)->ArgsProduct({ blocksizes });
+    /* IPPCP doesnt have OCB */
+    if (!useipp) {
+        // OCB Benchmarks
+        BENCHMARK(BENCH_AES_ENCRYPT_OCB_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AES_DECRYPT_OCB_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AES_ENCRYPT_OCB_192)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AES_DECRYPT_OCB_192)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AES_ENCRYPT_OCB_256)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AES_DECRYPT_OCB_256)->ArgsProduct({ blocksizes });
+    }
+    /* AEGIS is only available in ALCP */
+    if (!useipp && !useossl) {
+        // AEGIS Benchmarks
+        BENCHMARK(BENCH_AEGIS128L_ENCRYPT_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS128L_DECRYPT_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS256_ENCRYPT_256)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS256_DECRYPT_256)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS128X2_ENCRYPT_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS128X2_DECRYPT_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS128X4_ENCRYPT_128)->ArgsProduct({ blocksizes });
+        BENCHMARK(BENCH_AEGIS128X4_DECRYPT_128)->ArgsProduct({ blocksizes });
+    }
 
 #ifdef MULTI_INIT_BENCH
     //Multi-Init Benchmarks
@@ -100,6 +100,43 @@ void inline Digest_Bench(benchmark::State& state,
     return;
 }
 
+/* number of independent messages per multi-buffer call */
+static constexpr Uint64 cDigestMbJobs = 64;
+
+void inline Digest_Mb_Bench(benchmark::State& state,
+                            alc_digest_mode_t mode,
+                            Uint64            block_size)
+{
+    RngBase                          rb;
+    std::vector<Uint8>               msg;
+    std::vector<Uint8>               digests;
+    std::vector<alc_digest_mb_job_t> jobs(cDigestMbJobs);
+    Uint64                           digest_len = GetDigestLen(mode) / 8;
+
+    /* generate random bytes */
+    msg = rb.genRandomBytes(block_size * cDigestMbJobs);
+    digests.resize(digest_len * cDigestMbJobs);
+
+    for (Uint64 i = 0; i < cDigestMbJobs; i++) {
+        jobs[i].dj_msg       = &(msg[i * block_size]);
+        jobs[i].dj_msgLen    = block_size;
+        jobs[i].dj_digest    = &(digests[i * digest_len]);
+        jobs[i].dj_digestLen = digest_len;
+    }
+
+    for (auto _ : state) {
+        if (alcp_digest_mb(mode, &(jobs[0]), cDigestMbJobs)
+            != ALC_ERROR_NONE) {
+            state.SkipWithError("Error in running digest benchmark:");
+        }
+    }
+    state.counters["Speed(Bytes/s)"] =
+        benchmark::Counter(state.iterations() * block_size * cDigestMbJobs,
+                           benchmark::Counter::kIsRate);
+    state.counters["BlockSize(Bytes)"] = block_size;
+    return;
+}
+
 /* add all your new benchmarks here */
 /* SHA2 benchmarks */
 static void
@@ -134,6 +171,48 @@ BENCH_SHA2_512_256(benchmark::State& state)
     Digest_Bench(state, ALC_SHA2_512_256, state.range(0));
 }
 
+/* multi-buffer MD5, SHA1 and SHA2, ALCP only */
+static void
+BENCH_MD5_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_MD5, state.range(0));
+}
+static void
+BENCH_MD5_SHA1_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_MD5_SHA1, state.range(0));
+}
+static void
+BENCH_SHA1_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA1, state.range(0));
+}
+static void
+BENCH_SHA2_224_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA2_224, state.range(0));
+}
+static void
+BENCH_SHA2_256_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA2_256, state.range(0));
+}
+static void
+BENCH_SHA2_384_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA2_384, state.range(0));
+}
+static void
+BENCH_SHA2_512_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA2_512, state.range(0));
+}
+static void
+BENCH_SHA2_512_256_MB(benchmark::State& state)
+{
+    Digest_Mb_Bench(state, ALC_SHA2_512_256, state.range(0));
+}
+
 /* SHA3 benchmarks */
 static void
 BENCH_SHA3_224(benchmark::State& state)
@@ -185,6 +264,19 @@ AddBenchmarks()
     BENCHMARK(BENCH_SHA2_512_224)->ArgsProduct({ digest_block_sizes });
     BENCHMARK(BENCH_SHA2_512_256)->ArgsProduct({ digest_block_sizes });
 
+    /* multi-buffer digests are only available in ALCP */
+    if (!useipp && !useossl) {
+        BENCHMARK(BENCH_MD5_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_MD5_SHA1_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA1_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA2_224_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA2_256_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA2_384_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA2_512_MB)->ArgsProduct({ digest_block_sizes });
+        BENCHMARK(BENCH_SHA2_512_256_MB)
+            ->ArgsProduct({ digest_block_sizes });
+    }
+
     /* SHA3 is not supported for IPP */
     if (!useipp) {
         BENCHMARK(BENCH_SHA3_224)->ArgsProduct({ digest_block_sizes });
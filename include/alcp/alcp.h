@@ -43,6 +43,12 @@
 
 #include "cipher_segment.h"
 
+#include "cipher_mb.h"
+
+#include "cipher_kw.h"
+
+#include "cipher_key.h"
+
 #include "digest.h"
 
 #include "mac.h"
@@ -69,6 +69,17 @@ typedef enum _alc_cipher_mode
     ALC_AES_MODE_SIV,
     // non-aes aead ciphers
     ALC_CHACHA20_POLY1305,
+    // aes aead ciphers, appended to keep the existing values
+    ALC_AES_MODE_GCM_SIV,
+    ALC_AES_MODE_OCB,
+    // aead ciphers built on the aes round function
+    ALC_AEGIS128L,
+    ALC_AEGIS256,
+    ALC_AEGIS128X2,
+    ALC_AEGIS128X4,
+    // non-aes ciphers with a 24 byte nonce
+    ALC_XCHACHA20,
+    ALC_XCHACHA20_POLY1305,
 
     ALC_AES_MODE_MAX,
 
@@ -113,6 +124,8 @@ typedef struct _alc_cipher_handle
  * memory to be allocated for context </b>
  * @endparblock
  *
+ * @note        The cipher object is constructed inside the context, so
+ * @ref alcp_cipher_request does not allocate memory
  * @return      Size of Context
  */
 ALCP_API_EXPORT Uint64
@@ -160,6 +173,72 @@ alcp_cipher_init(const alc_cipher_handle_p pCipherHandle,
                  const Uint8*              pIv,
                  Uint64                    ivLen);
 
+/**
+ * @brief  Opt-in multi-threaded encrypt/decrypt of long buffers.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_cipher_request is called, it is
+ * meant to be used with CTR and XTS mode.</b>
+ * @endparblock
+ * @note    Buffers of at least two chunks are split into chunks which are
+ * processed by a worker pool owned by the library, @ref alcp_cipher_encrypt
+ * and @ref alcp_cipher_decrypt return once all chunks are done. The output and
+ * the state left in the handle are the same as with the serial path.
+ * @param [in] pCipherHandle Session handle for cipher operation
+ * @param[in] numThreads  Threads to use including the calling one, 1 turns the
+ * parallel path off (the default) and 0 uses every online cpu
+ * @param[in] chunkSize  Bytes per chunk, multiple of 16, 0 for the default of
+ * 128KiB
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_NOT_SUPPORTED for
+ * other modes.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_set_parallelism(const alc_cipher_handle_p pCipherHandle,
+                            Uint32                    numThreads,
+                            Uint64                    chunkSize);
+
+/**
+ * @brief  Move a CTR or ChaCha20 stream to a byte offset.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_cipher_init has set the iv, it is
+ * meant to be used with CTR and ChaCha20.</b>
+ * @endparblock
+ * @note    The offset is counted from the start of the keystream of the iv
+ * given to the last @ref alcp_cipher_init. The counter block holding it is
+ * computed directly, so the next @ref alcp_cipher_encrypt or
+ * @ref alcp_cipher_decrypt produces the same bytes as the matching slice of a
+ * single call over the whole stream. An offset inside a block is handled.
+ * @param [in] pCipherHandle Session handle for cipher operation
+ * @param[in] byteOffset  Offset in bytes from the start of the stream
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_NOT_SUPPORTED for
+ * other modes.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_set_stream_offset(const alc_cipher_handle_p pCipherHandle,
+                              Uint64                    byteOffset);
+
+/**
+ * @brief  Derive the HChaCha20 subkeys of a batch of nonces under one key.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle. It is the subkey derivation of
+ * XChaCha20, meant for callers deriving many subkeys at once.</b>
+ * @endparblock
+ * @note    Several nonces are run at a time in the SIMD lanes of the CPU, the
+ * output is the same as deriving the subkeys one by one.
+ * @param[in]  pKey       Key
+ * @param[in]  keyLen     Key length in bits, 256
+ * @param[in]  pNonces    numNonces nonces of 16 bytes each
+ * @param[in]  numNonces  Number of nonces
+ * @param[out] pSubkeys   numNonces subkeys of 32 bytes each, subkey i is
+ * derived from nonce i
+ * @return   &nbsp; Error Code for the API called.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_hchacha20(const Uint8* pKey,
+                      Uint64       keyLen,
+                      const Uint8* pNonces,
+                      Uint64       numNonces,
+                      Uint8*       pSubkeys);
+
 /**
  * @brief    Encrypt plain text and write it to cipher text with provided
  * handle.
@@ -29,6 +29,7 @@
 #define _ALCP_CIPHER_AEAD_H_ 2
 
 #include "alcp/cipher.h"
+#include "alcp/cipher_key.h"
 #include "alcp/error.h"
 #include "alcp/key.h"
 #include "alcp/macros.h"
@@ -51,6 +52,8 @@ EXTERN_C_BEGIN
  * identify the memory to be allocated for context </b>
  * @endparblock
  *
+ * @note        The cipher object is constructed inside the context, so
+ * @ref alcp_cipher_aead_request does not allocate memory
  * @return      Size of Context
  */
 ALCP_API_EXPORT Uint64
@@ -114,6 +117,15 @@ alcp_cipher_aead_request_with_extState(const alc_cipher_mode_t mode,
  * called. For SIV decrypt, the IV passed should be the tag generated by
  * @ref alcp_cipher_aead_get_tag during encrypt call.</b>
  * @endparblock
+ * @note    GCM-SIV takes a 12 byte nonce. Its tag covers the whole plaintext
+ * before encryption starts, so each message is passed in a single
+ * @ref alcp_cipher_aead_encrypt / @ref alcp_cipher_aead_decrypt call and the
+ * nonce is set again for the next message.
+ * @note    OCB takes a 1 to 15 byte nonce. Every encrypt/decrypt and set_aad
+ * call except the last one has to be a multiple of 16 bytes, and the tag
+ * length has to be set before the first encrypt/decrypt call.
+ * @note    AEGIS-128L and AEGIS-128X take a 128 bit key and a 16 byte nonce,
+ * AEGIS-256 a 256 bit key and a 32 byte nonce. The tag is 16 or 32 bytes.
  * @param [in] pCipherHandle Session handle for future encrypt/decrypt
  *                         operation
  * @param[in] pKey  Key
@@ -131,6 +143,30 @@ alcp_cipher_aead_init(const alc_cipher_handle_p pCipherHandle,
                       const Uint8*              pIv,
                       Uint64                    ivLen);
 
+/**
+ * @brief  AEAD init with a prepared key.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_cipher_aead_request is
+ * called. It replaces @ref alcp_cipher_aead_init when the key is already
+ * expanded, neither the key schedule nor, for GCM, the hash subkey powers
+ * are computed again.</b>
+ * @endparblock
+ * @note    Supported for GCM, CCM and OCB. The handle keeps a reference to
+ * pKey until another key is set or @ref alcp_cipher_aead_finish is called.
+ * @param [in] pCipherHandle Session handle for future encrypt/decrypt
+ *                         operation
+ * @param[in] pKey  Prepared key from @ref alcp_cipher_prepared_key_create
+ * @param[in] pIv  IV/Nonce, may be NULL to set only the key
+ * @param[in] ivLen  iv Length in bytes
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_NOT_SUPPORTED if
+ * the mode of the handle does not support prepared keys.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_init_with_key(const alc_cipher_handle_p       pCipherHandle,
+                               const alc_cipher_prepared_key_p pKey,
+                               const Uint8*                    pIv,
+                               Uint64                          ivLen);
+
 /**
  * @brief    AEAD encryption of plain text and write it to cipher text with
  * provided handle.
@@ -215,6 +251,28 @@ alcp_cipher_aead_get_tag(const alc_cipher_handle_p pCipherHandle,
                          Uint8*                    pOutput,
                          Uint64                    tagLen);
 
+/**
+ * @brief AEAD set the tag received with the message before decryption.
+ * @parblock <br> &nbsp;
+ * <b>This AEAD API is meant specifically for GCM-SIV and has to be called
+ * after @ref alcp_cipher_aead_init and before @ref alcp_cipher_aead_decrypt
+ * </b>
+ * @endparblock
+ * @note    GCM-SIV derives the counter block from the tag, so decryption needs
+ * it up front. @ref alcp_cipher_aead_decrypt verifies it and returns
+ * ALC_ERROR_TAG_MISMATCH, with the output wiped, when it does not match.
+ * @param[in] pCipherHandle Session handle for decrypt operation
+ * @param[in] pTag      Tag received with the ciphertext
+ * @param[in] tagLen    Length of Tag in bytes, 16 for GCM-SIV
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred and handle will be invalid
+ * for future operations
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_set_expected_tag(const alc_cipher_handle_p pCipherHandle,
+                                  const Uint8*              pTag,
+                                  Uint64                    tagLen);
+
 /**
  * @brief AEAD set the tag length.
  * @parblock <br> &nbsp;
@@ -238,6 +296,11 @@ alcp_cipher_aead_set_tag_length(const alc_cipher_handle_p pCipherHandle,
  * <b>This AEAD API is meant specifically for CCM and have to be called after
  * @ref alcp_cipher_aead_request and before @ref alcp_cipher_aead_init </b>
  * @endparblock
+ * @note    Optional when the whole message is passed in a single
+ * @ref alcp_cipher_aead_encrypt / @ref alcp_cipher_aead_decrypt call. It is
+ * required to split the message over several calls, chunks of any size are
+ * accepted and their sum has to match plaintextLength before
+ * @ref alcp_cipher_aead_get_tag.
  * @param[in] pCipherHandle Session handle for encrypt/decrypt operation
  * @param[in] plaintextLength       Length in bytes of plaintext in bytes
  * @return   &nbsp; Error Code for the API called. If alc_error_t
@@ -248,6 +311,93 @@ ALCP_API_EXPORT alc_error_t
 alcp_cipher_aead_set_ccm_plaintext_length(
     const alc_cipher_handle_p pCipherHandle, Uint64 plaintextLength);
 
+/**
+ * @brief  Describes one packet of a batched AEAD seal or open.
+ *
+ * @param ap_iv        IV/Nonce of this packet
+ * @param ap_ivLen     Length of ap_iv in bytes
+ * @param ap_aad       Additional data, may be NULL when ap_aadLen is 0
+ * @param ap_aadLen    Length of ap_aad in bytes
+ * @param ap_in        Plaintext to seal or ciphertext to open
+ * @param ap_out       Output buffer of ap_len bytes, may be the same as ap_in
+ * @param ap_len       Length of ap_in in bytes
+ * @param ap_tag       Tag written by seal, tag to be verified by open
+ * @param ap_tagLen    Length of ap_tag in bytes
+ * @param ap_err       [out] Result of this packet
+ *
+ * @struct alc_aead_packet_t
+ */
+typedef struct _alc_aead_packet
+{
+    const Uint8* ap_iv;
+    Uint64       ap_ivLen;
+    const Uint8* ap_aad;
+    Uint64       ap_aadLen;
+    const Uint8* ap_in;
+    Uint8*       ap_out;
+    Uint64       ap_len;
+    Uint8*       ap_tag;
+    Uint64       ap_tagLen;
+    alc_error_t  ap_err;
+} alc_aead_packet_t, *alc_aead_packet_p;
+
+/**
+ * @brief    AEAD encryption of a batch of packets under the key of the handle.
+ * @parblock <br> &nbsp;
+ * <b>This AEAD API can be called after @ref alcp_cipher_aead_init has set
+ * the key. Every packet carries its own IV, additional data and tag, so no
+ * other call is needed per packet.</b>
+ * @endparblock
+ * @note    Supported for GCM, ChaCha20-Poly1305 and XChaCha20-Poly1305.
+ * GCM: the key schedule and the GHASH key powers are computed once for the
+ * whole batch, and the last blocks of short packets are encrypted together.
+ * ChaCha20-Poly1305: every SIMD lane carries the ChaCha20 and Poly1305
+ * state of a different packet, 8 packets with AVX2 and 16 with AVX-512.
+ * Not available on machines without AVX2.
+ * @note    Packets are validated before any of them is processed, on error
+ * no output is written. ap_tagLen should be 1 to 16 bytes for GCM and 16
+ * bytes for ChaCha20-Poly1305, ap_ivLen 12 bytes for ChaCha20-Poly1305 and
+ * 24 bytes for XChaCha20-Poly1305. GCM without VAES-512 processes one
+ * packet after the other, an error there leaves the packets before the
+ * failing one processed and sets ap_err of the failing one and every later
+ * one.
+ * @note    GCM: the IV set on the handle is not used and the handle has to
+ * be given an IV again by @ref alcp_cipher_aead_init before the next
+ * @ref alcp_cipher_aead_encrypt / @ref alcp_cipher_aead_decrypt call.
+ * ChaCha20-Poly1305 leaves the state of the handle as it is.
+ * @param[in]     pCipherHandle Session handle with the key set
+ * @param[in,out] pPackets      Array of packets
+ * @param[in]     numPackets    Number of packets in pPackets
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_seal_batch(const alc_cipher_handle_p pCipherHandle,
+                            alc_aead_packet_t*        pPackets,
+                            Uint64                    numPackets);
+
+/**
+ * @brief    AEAD decryption and tag verification of a batch of packets under
+ * the key of the handle.
+ * @parblock <br> &nbsp;
+ * <b>This AEAD API can be called after @ref alcp_cipher_aead_init has set
+ * the key, packets are described as in @ref alcp_cipher_aead_seal_batch.
+ * </b>
+ * @endparblock
+ * @note    Every tag is compared in constant time. A packet whose tag does
+ * not match has ap_err set to ALC_ERROR_TAG_MISMATCH and its output zeroed,
+ * the other packets of the batch are still opened.
+ * @param[in]     pCipherHandle Session handle with the key set
+ * @param[in,out] pPackets      Array of packets
+ * @param[in]     numPackets    Number of packets in pPackets
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_TAG_MISMATCH if
+ * the tag of any of the packets did not match.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_open_batch(const alc_cipher_handle_p pCipherHandle,
+                            alc_aead_packet_t*        pPackets,
+                            Uint64                    numPackets);
+
 /**
  * @brief       Release resources allocated by alcp_cipher_aead_request.
  * @parblock <br> &nbsp;
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _ALCP_CIPHER_KEY_H_
+#define _ALCP_CIPHER_KEY_H_ 2
+
+#include "alcp/cipher.h"
+#include "alcp/error.h"
+#include "alcp/macros.h"
+
+EXTERN_C_BEGIN
+
+/**
+ * @defgroup cipher Cipher API
+ * @brief
+ * Cipher is a cryptographic technique used to
+ * secure information by transforming message into a cryptic form that can
+ * only be read by those with the key to decipher it.
+ *  @{
+ */
+
+/**
+ * @brief  Opaque type of a prepared key, comes from the library.
+ *
+ * A prepared key holds the expanded AES round keys and, depending on the
+ * mode, the XTS tweak round keys and the GCM hash subkey powers. It is
+ * read only once created and can be attached to any number of handles on
+ * any number of threads.
+ *
+ * @typedef struct _alc_cipher_prepared_key alc_cipher_prepared_key_t
+ */
+typedef struct _alc_cipher_prepared_key alc_cipher_prepared_key_t;
+typedef alc_cipher_prepared_key_t*      alc_cipher_prepared_key_p;
+
+/**
+ * @brief    Expand a key once, to be shared by many cipher handles.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle. The key returned holds one
+ * reference, which is dropped by @ref alcp_cipher_prepared_key_release.</b>
+ * @endparblock
+ * @note    Supported modes are ECB, CBC, OFB, CTR, CFB, XTS, GCM, CCM and
+ * OCB. A key created for XTS can only be used with XTS handles, a key
+ * created for any other of these modes with any of them but XTS.
+ * @note    For XTS pKey holds the data key followed by the tweak key, as in
+ * @ref alcp_cipher_init.
+ *
+ * @param[in]    mode       cipher mode the key is meant for
+ * @param[in]    pKey       Key
+ * @param[in]    keyLen     key Length in bits (128, 192 or 256)
+ * @param[out]   ppKey      Prepared key
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_NOT_SUPPORTED if
+ * the mode does not support prepared keys.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_prepared_key_create(const alc_cipher_mode_t    mode,
+                                const Uint8*               pKey,
+                                Uint64                     keyLen,
+                                alc_cipher_prepared_key_p* ppKey);
+
+/**
+ * @brief    Take one more reference to a prepared key.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called from any thread, every call has to be matched
+ * by a call to @ref alcp_cipher_prepared_key_release.</b>
+ * @endparblock
+ *
+ * @param[in]    pKey       Prepared key
+ * @return   &nbsp; Error Code for the API called.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_prepared_key_retain(const alc_cipher_prepared_key_p pKey);
+
+/**
+ * @brief    Drop a reference to a prepared key.
+ * @parblock <br> &nbsp;
+ * <b>The key is wiped and freed when the last reference goes, handles it is
+ * attached to hold their own reference so it can be released right after
+ * the last @ref alcp_cipher_init_with_key call.</b>
+ * @endparblock
+ *
+ * @param[in]    pKey       Prepared key
+ * @return            None
+ */
+ALCP_API_EXPORT void
+alcp_cipher_prepared_key_release(const alc_cipher_prepared_key_p pKey);
+
+/**
+ * @brief  Cipher init with a prepared key.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_cipher_request is
+ * called. It replaces @ref alcp_cipher_init when the key is already
+ * expanded, no key schedule is computed.</b>
+ * @endparblock
+ * @note    The handle keeps a reference to pKey until another key is set or
+ * @ref alcp_cipher_finish is called.
+ * @param [in] pCipherHandle Session handle for cipher operation
+ * @param[in] pKey  Prepared key, its length should match the handle
+ * @param[in] pIv  IV/Nonce, may be NULL to set only the key
+ * @param[in] ivLen  iv Length in bytes
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_NOT_SUPPORTED if
+ * the mode of the handle does not support prepared keys.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_init_with_key(const alc_cipher_handle_p       pCipherHandle,
+                          const alc_cipher_prepared_key_p pKey,
+                          const Uint8*                    pIv,
+                          Uint64                          ivLen);
+
+EXTERN_C_END
+
+#endif /* _ALCP_CIPHER_KEY_H_ */
+
+/**
+ * @}
+ */
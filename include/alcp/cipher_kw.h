@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef _ALCP_CIPHER_KW_H_
+#define _ALCP_CIPHER_KW_H_ 2
+
+#include "alcp/cipher.h"
+#include "alcp/error.h"
+#include "alcp/macros.h"
+
+EXTERN_C_BEGIN
+
+/**
+ * @defgroup cipher Cipher API
+ * @brief
+ * Cipher is a cryptographic technique used to
+ * secure information by transforming message into a cryptic form that can
+ * only be read by those with the key to decipher it.
+ *  @{
+ */
+
+/**
+ * @brief  AES key wrap algorithm
+ *
+ * @param ALC_KEY_WRAP_KW      AES Key Wrap, RFC 3394 (NIST SP 800-38F KW)
+ * @param ALC_KEY_WRAP_KWP     AES Key Wrap with Padding, RFC 5649
+ *                             (NIST SP 800-38F KWP)
+ *
+ * @enum alc_key_wrap_mode_t
+ */
+typedef enum _alc_key_wrap_mode
+{
+    ALC_KEY_WRAP_KW = 0,
+    ALC_KEY_WRAP_KWP,
+} alc_key_wrap_mode_t;
+
+/**
+ * @brief  Describes one key to be wrapped or unwrapped.
+ *
+ * @param kj_src       Input, the key to be wrapped or the wrapped key
+ * @param kj_srcLen    Length of kj_src in bytes
+ * @param kj_dst       Output buffer, may be the same as kj_src
+ * @param kj_dstLen    [out] Number of bytes written to kj_dst
+ * @param kj_err       [out] Result of this job
+ *
+ * @struct alc_key_wrap_job_t
+ */
+typedef struct _alc_key_wrap_job
+{
+    const Uint8* kj_src;
+    Uint64       kj_srcLen;
+    Uint8*       kj_dst;
+    Uint64       kj_dstLen;
+    alc_error_t  kj_err;
+} alc_key_wrap_job_t, *alc_key_wrap_job_p;
+
+/**
+ * @brief    Wrap a batch of keys under one key encryption key (KEK).
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle. Every wrap is a serial chain
+ * of AES calls, so independent jobs are interleaved across the AES lanes of
+ * the CPU.</b>
+ * @endparblock
+ * @note    KW: kj_srcLen should be a multiple of 8 bytes and at least 16
+ * bytes, kj_dst should hold kj_srcLen + 8 bytes.
+ * @note    KWP: kj_srcLen should be at least 1 byte, kj_dst should hold
+ * kj_srcLen rounded up to a multiple of 8, plus 8 bytes.
+ * @note    Jobs are validated before any of them is processed, on error no
+ * output is written. A batch with a single job wraps a single key.
+ *
+ * @param[in]       mode       ALC_KEY_WRAP_KW or ALC_KEY_WRAP_KWP
+ * @param[in]       pKek       Key encryption key
+ * @param[in]       kekLen     KEK length in bits (128, 192 or 256)
+ * @param[in,out]   pJobs      Array of jobs
+ * @param[in]       numJobs    Number of jobs in pJobs
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_key_wrap(alc_key_wrap_mode_t mode,
+                     const Uint8*        pKek,
+                     Uint64              kekLen,
+                     alc_key_wrap_job_t* pJobs,
+                     Uint64              numJobs);
+
+/**
+ * @brief    Unwrap a batch of keys wrapped under one key encryption key.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle, jobs are interleaved across
+ * the AES lanes of the CPU as in @ref alcp_cipher_key_wrap.</b>
+ * @endparblock
+ * @note    kj_srcLen should be a multiple of 8 bytes, at least 24 bytes for
+ * KW and at least 16 bytes for KWP. kj_dst should hold kj_srcLen - 8 bytes.
+ * @note    Every job is checked for integrity on its own. A job which fails
+ * the check has kj_err set to ALC_ERROR_TAG_MISMATCH, its output zeroed and
+ * kj_dstLen set to 0, the other jobs of the batch are still unwrapped.
+ *
+ * @param[in]       mode       ALC_KEY_WRAP_KW or ALC_KEY_WRAP_KWP
+ * @param[in]       pKek       Key encryption key
+ * @param[in]       kekLen     KEK length in bits (128, 192 or 256)
+ * @param[in,out]   pJobs      Array of jobs
+ * @param[in]       numJobs    Number of jobs in pJobs
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_TAG_MISMATCH if
+ * any of the jobs failed the integrity check.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_key_unwrap(alc_key_wrap_mode_t mode,
+                       const Uint8*        pKek,
+                       Uint64              kekLen,
+                       alc_key_wrap_job_t* pJobs,
+                       Uint64              numJobs);
+
+EXTERN_C_END
+
+#endif /* _ALCP_CIPHER_KW_H_ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef _ALCP_CIPHER_MB_H_
+#define _ALCP_CIPHER_MB_H_ 2
+
+#include "alcp/cipher.h"
+#include "alcp/cipher_aead.h"
+#include "alcp/cipher_key.h"
+#include "alcp/error.h"
+#include "alcp/macros.h"
+
+EXTERN_C_BEGIN
+
+/**
+ * @defgroup cipher Cipher API
+ * @brief
+ * Cipher is a cryptographic technique used to
+ * secure information by transforming message into a cryptic form that can
+ * only be read by those with the key to decipher it.
+ *  @{
+ */
+
+/**
+ * @brief  Describes one independent stream of a multi-buffer cipher request.
+ *
+ * @param mj_key       Key of the stream
+ * @param mj_keyLen    Key length in bits (128, 192 or 256)
+ * @param mj_iv        16 byte IV of the stream
+ * @param mj_src       Input buffer
+ * @param mj_dst       Output buffer, may be the same as mj_src
+ * @param mj_len       Length of the input/output in bytes
+ *
+ * @struct alc_cipher_mb_job_t
+ */
+typedef struct _alc_cipher_mb_job
+{
+    const Uint8* mj_key;
+    Uint64       mj_keyLen;
+    const Uint8* mj_iv;
+    const Uint8* mj_src;
+    Uint8*       mj_dst;
+    Uint64       mj_len;
+} alc_cipher_mb_job_t, *alc_cipher_mb_job_p;
+
+/**
+ * @brief    Encrypt a batch of independent AES-CBC streams.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle, every job carries its own key
+ * and IV. Streams are interleaved across the AES lanes of the CPU so that
+ * many short or serial CBC streams are encrypted in parallel.</b>
+ * @endparblock
+ * @note    Length of every job should be a multiple of 16 bytes, no padding is
+ * applied. Jobs of zero length are skipped.
+ * @note    Jobs are validated before any of them is processed, on error no
+ * output is written.
+ *
+ * @param[in]    pJobs      Array of jobs
+ * @param[in]    numJobs    Number of jobs in pJobs
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_encrypt_cbc_mb(const alc_cipher_mb_job_t* pJobs, Uint64 numJobs);
+
+/**
+ * @brief  Describes one packet of a multi-key AEAD request.
+ *
+ * @param aj_key       Prepared key of the packet, created for GCM
+ * @param aj_packet    IV, additional data, input, output and tag of the
+ *                     packet, see alc_aead_packet_t
+ *
+ * @struct alc_aead_mb_job_t
+ */
+typedef struct _alc_aead_mb_job
+{
+    alc_cipher_prepared_key_p aj_key;
+    alc_aead_packet_t         aj_packet;
+} alc_aead_mb_job_t, *alc_aead_mb_job_p;
+
+/**
+ * @brief    AES-GCM encryption of a batch of packets, each under its own key.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a cipher handle, every job refers to the
+ * prepared key of its connection and carries its own IV, additional data
+ * and tag. Packets of different keys are interleaved across the 128 bit
+ * lanes of the CPU, every lane with its own round keys, counter and GHASH
+ * state, so that many small packets of many connections fill the AES and
+ * carry-less multiply pipelines.</b>
+ * @endparblock
+ * @note    Without VAES-512 the packets are processed one after the other.
+ * An error there leaves the packets before the failing one processed, the
+ * failing one and every later one have ap_err set to the error.
+ * @note    Keys are created with @ref alcp_cipher_prepared_key_create for
+ * ALC_AES_MODE_GCM and should stay alive until the call returns. Any number
+ * of jobs may share a key.
+ * @note    Jobs are validated before any of them is processed, an invalid
+ * job means no output is written. ap_tagLen should be 1 to 16 bytes.
+ *
+ * @param[in,out] pJobs      Array of jobs
+ * @param[in]     numJobs    Number of jobs in pJobs
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_seal_gcm_mb(alc_aead_mb_job_t* pJobs, Uint64 numJobs);
+
+/**
+ * @brief    AES-GCM decryption and tag verification of a batch of packets,
+ * each under its own key.
+ * @parblock <br> &nbsp;
+ * <b>Jobs are described as in @ref alcp_cipher_aead_seal_gcm_mb.</b>
+ * @endparblock
+ * @note    Every tag is compared in constant time. A packet whose tag does
+ * not match has ap_err set to ALC_ERROR_TAG_MISMATCH and its output zeroed,
+ * the other packets of the batch are still opened.
+ *
+ * @param[in,out] pJobs      Array of jobs
+ * @param[in]     numJobs    Number of jobs in pJobs
+ * @return   &nbsp; Error Code for the API called. ALC_ERROR_TAG_MISMATCH if
+ * the tag of any of the packets did not match.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_open_gcm_mb(alc_aead_mb_job_t* pJobs, Uint64 numJobs);
+
+EXTERN_C_END
+
+#endif /* _ALCP_CIPHER_MB_H_ */
+
+/**
+ * @}
+ */
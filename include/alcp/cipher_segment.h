@@ -143,6 +143,70 @@ alcp_cipher_segment_decrypt_xts(const alc_cipher_handle_p pCipherHandle,
                                 Uint64                    currCipherTextLen,
                                 Uint64                    startBlockNum);
 
+/**
+ * @brief  Describes one sector (data unit) of a batched XTS operation.
+ *
+ * @param xs_dataUnit  Data unit number of the sector, used as the tweak
+ *                     encoded as a 16 byte little endian value
+ * @param xs_src       Input of data unit size bytes
+ * @param xs_dst       Output of data unit size bytes, may be the same as xs_src
+ *
+ * @struct alc_xts_sector_t
+ */
+typedef struct _alc_xts_sector
+{
+    Uint64       xs_dataUnit;
+    const Uint8* xs_src;
+    Uint8*       xs_dst;
+} alc_xts_sector_t, *alc_xts_sector_p;
+
+/**
+ * @brief    Encrypt a batch of sectors with the key of the handle.
+ * @parblock <br> &nbsp;
+ * <b>This XTS specific API should be called only after @ref
+ * alcp_cipher_segment_init has set the key. API is meant to be used with XTS
+ * mode.</b>
+ * @endparblock
+ * @note    Each sector is an independent data unit, its tweak is derived from
+ * xs_dataUnit so the IV of the handle is neither used nor modified. The
+ * initial tweaks of all sectors are computed together.
+ * @note    Error needs to be checked for each call,
+ *           valid only if @ref alcp_is_error (ret) is false
+ * @param[in]    pCipherHandle Session handle for encrypt decrypt operation
+ * @param[in]    pSectors      Array of numSectors sectors
+ * @param[in]    numSectors    Number of sectors
+ * @param[in]    dataUnitSize  Size of every sector in bytes, at least 16
+ * @return   &nbsp; Error Code for the API called.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_segment_encrypt_xts_batch(const alc_cipher_handle_p pCipherHandle,
+                                      const alc_xts_sector_t*   pSectors,
+                                      Uint64                    numSectors,
+                                      Uint64                    dataUnitSize);
+
+/**
+ * @brief    Decrypt a batch of sectors with the key of the handle.
+ * @parblock <br> &nbsp;
+ * <b>This XTS specific API should be called only after @ref
+ * alcp_cipher_segment_init has set the key. API is meant to be used with XTS
+ * mode.</b>
+ * @endparblock
+ * @note    Each sector is an independent data unit, its tweak is derived from
+ * xs_dataUnit so the IV of the handle is neither used nor modified.
+ * @note    Error needs to be checked for each call,
+ *           valid only if @ref alcp_is_error (ret) is false
+ * @param[in]    pCipherHandle Session handle for encrypt decrypt operation
+ * @param[in]    pSectors      Array of numSectors sectors
+ * @param[in]    numSectors    Number of sectors
+ * @param[in]    dataUnitSize  Size of every sector in bytes, at least 16
+ * @return   &nbsp; Error Code for the API called.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_segment_decrypt_xts_batch(const alc_cipher_handle_p pCipherHandle,
+                                      const alc_xts_sector_t*   pSectors,
+                                      Uint64                    numSectors,
+                                      Uint64                    dataUnitSize);
+
 /**
  * @brief       Release resources allocated by alcp_cipher_request.
  * @parblock <br> &nbsp;
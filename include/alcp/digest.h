@@ -136,7 +136,8 @@ typedef struct _alc_digest_handle
  * memory to be allocated for context </b>
  * @endparblock
  *
- *
+ * @note   The digest object is constructed inside the context, so
+ * @ref alcp_digest_request does not allocate memory
  *
  * @return Size of Context
  */
@@ -279,6 +280,55 @@ alcp_digest_shake_squeeze(const alc_digest_handle_p pDigestHandle,
                           Uint8*                    pBuff,
                           Uint64                    size);
 
+/**
+ * @brief  Describes one independent message of a multi-buffer digest request.
+ *
+ * @param dj_msg        Message, may be NULL when dj_msgLen is 0
+ * @param dj_msgLen     Length of the message in bytes
+ * @param dj_digest     Destination buffer for the digest of the message
+ * @param dj_digestLen  Size of dj_digest, should be the digest size of the
+ *                      mode in bytes
+ *
+ * @struct alc_digest_mb_job_t
+ */
+typedef struct _alc_digest_mb_job
+{
+    const Uint8* dj_msg;
+    Uint64       dj_msgLen;
+    Uint8*       dj_digest;
+    Uint64       dj_digestLen;
+} alc_digest_mb_job_t, *alc_digest_mb_job_p;
+
+/**
+ * @brief    Computes the digests of a batch of independent messages.
+ * @parblock <br> &nbsp;
+ * <b>This API does not need a digest handle, every job is a complete
+ * message. Messages are hashed in parallel, one per SIMD lane (8 lanes with
+ * AVX2, 16 with AVX-512, half of that for the 64 bit words of SHA-384 and
+ * SHA-512), and a lane takes the next message as soon as its current one is
+ * done, so that messages of different lengths keep all lanes busy.</b>
+ * @endparblock
+ * @note    Supported modes are ALC_MD5, ALC_SHA1, ALC_MD5_SHA1,
+ * ALC_SHA2_224, ALC_SHA2_256, ALC_SHA2_384, ALC_SHA2_512, ALC_SHA2_512_224
+ * and ALC_SHA2_512_256, ALC_ERROR_NOT_SUPPORTED is returned otherwise.
+ * For ALC_MD5_SHA1 a digest is the MD5 digest followed by the SHA-1 digest.
+ * @note    Jobs are validated before any of them is processed, on error no
+ * digest is written.
+ * @note    Without AVX2, or for SHA-224/256 with SHA-NI but without
+ * AVX-512, the messages are hashed one after the other.
+ *
+ * @param [in]   mode      Digest of every message
+ * @param [in]   pJobs     Array of jobs
+ * @param [in]   numJobs   Number of jobs in pJobs
+ *
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then an error has occurred.
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_digest_mb(alc_digest_mode_t          mode,
+               const alc_digest_mb_job_t* pJobs,
+               Uint64                     numJobs);
+
 EXTERN_C_END
 
 #endif /* _ALCP_DIGEST_H */
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <immintrin.h>
+#include <type_traits>
+
+#include "alcp/cipher/aegis.hh"
+#include "alcp/cipher/aegis_core.hh"
+
+namespace alcp::cipher::aesni::aegis {
+
+using alcp::cipher::aegis::Aegis128LCore;
+
+struct Xmm
+{
+    using T                         = __m128i;
+    static constexpr Uint64 cBytes = 16;
+
+    static inline T load(const Uint8* p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static inline void store(Uint8* p, T a)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+    }
+    static inline T xor_(T a, T b) { return _mm_xor_si128(a, b); }
+    static inline T and_(T a, T b) { return _mm_and_si128(a, b); }
+    static inline T round(T in, T rk) { return _mm_aesenc_si128(in, rk); }
+};
+
+// AEGIS-256 has a single 128 bit lane and six state words
+class Aegis256Core
+{
+    __m128i s0, s1, s2, s3, s4, s5;
+
+    inline __m128i keystream() const
+    {
+        return _mm_xor_si128(_mm_xor_si128(s1, s4),
+                             _mm_xor_si128(s5, _mm_and_si128(s2, s3)));
+    }
+
+  public:
+    static constexpr Uint64 cRate = 16;
+
+    inline void load(const AegisState& st)
+    {
+        s0 = _mm_loadu_si128(st.w);
+        s1 = _mm_loadu_si128(st.w + 1);
+        s2 = _mm_loadu_si128(st.w + 2);
+        s3 = _mm_loadu_si128(st.w + 3);
+        s4 = _mm_loadu_si128(st.w + 4);
+        s5 = _mm_loadu_si128(st.w + 5);
+    }
+
+    inline void store(AegisState& st) const
+    {
+        _mm_storeu_si128(st.w, s0);
+        _mm_storeu_si128(st.w + 1, s1);
+        _mm_storeu_si128(st.w + 2, s2);
+        _mm_storeu_si128(st.w + 3, s3);
+        _mm_storeu_si128(st.w + 4, s4);
+        _mm_storeu_si128(st.w + 5, s5);
+    }
+
+    inline void update(__m128i m)
+    {
+        __m128i t5 = s5;
+        s5         = _mm_aesenc_si128(s4, s5);
+        s4         = _mm_aesenc_si128(s3, s4);
+        s3         = _mm_aesenc_si128(s2, s3);
+        s2         = _mm_aesenc_si128(s1, s2);
+        s1         = _mm_aesenc_si128(s0, s1);
+        s0         = _mm_aesenc_si128(t5, _mm_xor_si128(s0, m));
+    }
+
+    inline void init(const Uint8 key[32], const Uint8 nonce[32])
+    {
+        const __m128i c0 = Xmm::load(alcp::cipher::aegis::cC0);
+        const __m128i c1 = Xmm::load(alcp::cipher::aegis::cC1);
+        const __m128i k0 = Xmm::load(key), k1 = Xmm::load(key + 16);
+        const __m128i kn0 = _mm_xor_si128(k0, Xmm::load(nonce));
+        const __m128i kn1 = _mm_xor_si128(k1, Xmm::load(nonce + 16));
+
+        s0 = kn0;
+        s1 = kn1;
+        s2 = c1;
+        s3 = c0;
+        s4 = _mm_xor_si128(k0, c0);
+        s5 = _mm_xor_si128(k1, c1);
+        for (int r = 0; r < 4; r++) {
+            update(k0);
+            update(k1);
+            update(kn0);
+            update(kn1);
+        }
+    }
+
+    inline void absorb(const Uint8* pIn, Uint64 chunks)
+    {
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate) {
+            update(Xmm::load(pIn));
+        }
+    }
+
+    inline void encrypt(const Uint8* pIn, Uint8* pOut, Uint64 chunks)
+    {
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate, pOut += cRate) {
+            __m128i m = Xmm::load(pIn);
+            Xmm::store(pOut, _mm_xor_si128(m, keystream()));
+            update(m);
+        }
+    }
+
+    inline void decrypt(const Uint8* pIn, Uint8* pOut, Uint64 chunks)
+    {
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate, pOut += cRate) {
+            __m128i m = _mm_xor_si128(Xmm::load(pIn), keystream());
+            Xmm::store(pOut, m);
+            update(m);
+        }
+    }
+
+    inline void keystream(Uint8 z[]) const { Xmm::store(z, keystream()); }
+
+    inline void finalize(Uint64 aadLen,
+                         Uint64 msgLen,
+                         Uint8  tag[],
+                         Uint64 tagLen)
+    {
+        __m128i t = _mm_set_epi64x(msgLen * 8, aadLen * 8);
+        t         = _mm_xor_si128(t, s3);
+        for (int r = 0; r < 7; r++) {
+            update(t);
+        }
+
+        __m128i w0 = _mm_xor_si128(_mm_xor_si128(s0, s1), s2);
+        __m128i w1 = _mm_xor_si128(_mm_xor_si128(s3, s4), s5);
+        if (tagLen == ALCP_AEGIS_TAG_SIZE) {
+            Xmm::store(tag, _mm_xor_si128(w0, w1));
+        } else {
+            Xmm::store(tag, w0);
+            Xmm::store(tag + 16, w1);
+        }
+    }
+};
+
+template<AegisVariant cV>
+using Core =
+    std::conditional_t<cV == AegisVariant::e256,
+                       Aegis256Core,
+                       Aegis128LCore<Xmm, AegisParams<cV>::cLanes>>;
+
+template<AegisVariant cV>
+void
+Init(AegisState& st, const Uint8 key[], const Uint8 nonce[])
+{
+    Core<cV> core;
+    core.init(key, nonce);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Keystream(const AegisState& st, Uint8 z[])
+{
+    Core<cV> core;
+    core.load(st);
+    core.keystream(z);
+}
+
+template<AegisVariant cV>
+void
+Finalize(AegisState& st,
+         Uint64      aadLen,
+         Uint64      msgLen,
+         Uint8       tag[],
+         Uint64      tagLen)
+{
+    Core<cV> core;
+    core.load(st);
+    core.finalize(aadLen, msgLen, tag, tagLen);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Absorb(AegisState& st, const Uint8 pIn[], Uint64 chunks)
+{
+    Core<cV> core;
+    core.load(st);
+    core.absorb(pIn, chunks);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Encrypt(AegisState& st, const Uint8 pIn[], Uint8 pOut[], Uint64 chunks)
+{
+    Core<cV> core;
+    core.load(st);
+    core.encrypt(pIn, pOut, chunks);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Decrypt(AegisState& st, const Uint8 pIn[], Uint8 pOut[], Uint64 chunks)
+{
+    Core<cV> core;
+    core.load(st);
+    core.decrypt(pIn, pOut, chunks);
+    core.store(st);
+}
+
+#define AEGIS_INSTANTIATE(variant)                                             \
+    template void Init<variant>(AegisState&, const Uint8[], const Uint8[]);    \
+    template void Keystream<variant>(const AegisState&, Uint8[]);              \
+    template void Finalize<variant>(                                           \
+        AegisState&, Uint64, Uint64, Uint8[], Uint64);                         \
+    template void Absorb<variant>(AegisState&, const Uint8[], Uint64);         \
+    template void Encrypt<variant>(                                            \
+        AegisState&, const Uint8[], Uint8[], Uint64);                          \
+    template void Decrypt<variant>(                                            \
+        AegisState&, const Uint8[], Uint8[], Uint64);
+
+AEGIS_INSTANTIATE(AegisVariant::e128L)
+AEGIS_INSTANTIATE(AegisVariant::e256)
+AEGIS_INSTANTIATE(AegisVariant::e128X2)
+AEGIS_INSTANTIATE(AegisVariant::e128X4)
+
+} // namespace alcp::cipher::aesni::aegis
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::aesni {
+
+/*
+ * CBC encryption of cCbcMbLanes independent streams, one xmm per stream.
+ * Each stream is serial, but the streams are independent which keeps both
+ * AES units busy.
+ */
+void
+EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    constexpr Uint32 cLanes = cCbcMbLanes;
+
+    __m128i      c[cLanes];
+    const Uint8* p_src[cLanes];
+    Uint8*       p_dst[cLanes];
+
+    UNROLL_8
+    for (Uint32 l = 0; l < cLanes; l++) {
+        c[l]     = lanes.m_iv[l];
+        p_src[l] = lanes.m_pSrc[l];
+        p_dst[l] = lanes.m_pDst[l];
+    }
+
+    for (; blocks > 0; blocks--) {
+        UNROLL_8
+        for (Uint32 l = 0; l < cLanes; l++) {
+            __m128i p =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src[l]));
+            c[l] = _mm_xor_si128(c[l], p);
+            c[l] = _mm_xor_si128(c[l], lanes.m_round_keys[0][l]);
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            UNROLL_8
+            for (Uint32 l = 0; l < cLanes; l++) {
+                c[l] = _mm_aesenc_si128(c[l], lanes.m_round_keys[r][l]);
+            }
+        }
+
+        UNROLL_8
+        for (Uint32 l = 0; l < cLanes; l++) {
+            c[l] = _mm_aesenclast_si128(c[l], lanes.m_round_keys[nRounds][l]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst[l]), c[l]);
+            p_src[l] += lanes.m_step[l];
+            p_dst[l] += lanes.m_step[l];
+        }
+    }
+
+    UNROLL_8
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_iv[l]   = c[l];
+        lanes.m_pSrc[l] = p_src[l];
+        lanes.m_pDst[l] = p_dst[l];
+    }
+}
+
+} // namespace alcp::cipher::aesni
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aesni.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::aesni {
+
+/*
+ * Blocks are independent in ECB, encrypt and decrypt share the same loop and
+ * only differ in the round helpers. len is a multiple of the block size.
+ */
+template<void Aes_1x128(__m128i* pBlk0, const __m128i* pKey, int nRounds),
+         void Aes_4x128(__m128i*       pBlk0,
+                        __m128i*       pBlk1,
+                        __m128i*       pBlk2,
+                        __m128i*       pBlk3,
+                        const __m128i* pKey,
+                        int            nRounds)>
+alc_error_t
+CryptEcb(const Uint8* pSrc,  // ptr to input
+         Uint8*       pDest, // ptr to output
+         Uint64       len,   // message length in bytes
+         const Uint8* pKey,  // ptr to Key
+         int          nRounds)
+{
+    Uint64 blocks    = len / Rijndael::cBlockSize;
+    auto   p_in_128  = reinterpret_cast<const __m128i*>(pSrc);
+    auto   p_out_128 = reinterpret_cast<__m128i*>(pDest);
+    auto   pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+    __m128i a1, a2, a3, a4, a5, a6, a7, a8;
+
+    for (; blocks >= 8; blocks -= 8) {
+        a1 = _mm_loadu_si128(p_in_128);
+        a2 = _mm_loadu_si128(p_in_128 + 1);
+        a3 = _mm_loadu_si128(p_in_128 + 2);
+        a4 = _mm_loadu_si128(p_in_128 + 3);
+        a5 = _mm_loadu_si128(p_in_128 + 4);
+        a6 = _mm_loadu_si128(p_in_128 + 5);
+        a7 = _mm_loadu_si128(p_in_128 + 6);
+        a8 = _mm_loadu_si128(p_in_128 + 7);
+
+        Aes_4x128(&a1, &a2, &a3, &a4, pkey128, nRounds);
+        Aes_4x128(&a5, &a6, &a7, &a8, pkey128, nRounds);
+
+        _mm_storeu_si128(p_out_128, a1);
+        _mm_storeu_si128(p_out_128 + 1, a2);
+        _mm_storeu_si128(p_out_128 + 2, a3);
+        _mm_storeu_si128(p_out_128 + 3, a4);
+        _mm_storeu_si128(p_out_128 + 4, a5);
+        _mm_storeu_si128(p_out_128 + 5, a6);
+        _mm_storeu_si128(p_out_128 + 6, a7);
+        _mm_storeu_si128(p_out_128 + 7, a8);
+
+        p_in_128 += 8;
+        p_out_128 += 8;
+    }
+
+    if (blocks >= 4) {
+        a1 = _mm_loadu_si128(p_in_128);
+        a2 = _mm_loadu_si128(p_in_128 + 1);
+        a3 = _mm_loadu_si128(p_in_128 + 2);
+        a4 = _mm_loadu_si128(p_in_128 + 3);
+
+        Aes_4x128(&a1, &a2, &a3, &a4, pkey128, nRounds);
+
+        _mm_storeu_si128(p_out_128, a1);
+        _mm_storeu_si128(p_out_128 + 1, a2);
+        _mm_storeu_si128(p_out_128 + 2, a3);
+        _mm_storeu_si128(p_out_128 + 3, a4);
+
+        p_in_128 += 4;
+        p_out_128 += 4;
+        blocks -= 4;
+    }
+
+    for (; blocks >= 1; blocks--) {
+        a1 = _mm_loadu_si128(p_in_128);
+        Aes_1x128(&a1, pkey128, nRounds);
+        _mm_storeu_si128(p_out_128, a1);
+
+        p_in_128++;
+        p_out_128++;
+    }
+
+    return ALC_ERROR_NONE;
+}
+
+} // namespace alcp::cipher::aesni
+
+namespace alcp::cipher {
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey128Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesEncrypt, aesni::AesEncrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey192Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesEncrypt, aesni::AesEncrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey256Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesEncrypt, aesni::AesEncrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey128Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesDecrypt, aesni::AesDecrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey192Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesDecrypt, aesni::AesDecrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey256Bit,
+           alcp::utils::CpuCipherFeatures::eAesni>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    return aesni::CryptEcb<aesni::AesDecrypt, aesni::AesDecrypt>(
+        pSrc, pDest, len, pKey, nRounds);
+}
+
+} // namespace alcp::cipher
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_gcm_siv.hh"
+#include "alcp/cipher/aesni.hh"
+#include "alcp/cipher/gmul.hh"
+#include "alcp/utils/copy.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::aesni::gcmsiv {
+
+void
+DeriveKeys(const Uint8 pKeyGenKey[],
+           int         nRounds,
+           const Uint8 nonce[],
+           Uint8       authKey[],
+           Uint8       encKey[])
+{
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKeyGenKey);
+
+    // Block i is LE32(i) || nonce, only the first half of each output is kept
+    alignas(16) Uint8 blk[16] = {};
+    utils::CopyBytes(blk + 4, nonce, ALCP_GCM_SIV_NONCE_SIZE);
+
+    __m128i b0 = _mm_load_si128(reinterpret_cast<const __m128i*>(blk));
+    __m128i b1 = _mm_insert_epi32(b0, 1, 0);
+    __m128i b2 = _mm_insert_epi32(b0, 2, 0);
+    __m128i b3 = _mm_insert_epi32(b0, 3, 0);
+    __m128i b4 = _mm_insert_epi32(b0, 4, 0);
+    __m128i b5 = _mm_insert_epi32(b0, 5, 0);
+
+    AesEncrypt(&b0, &b1, &b2, &b3, pkey128, nRounds);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(authKey),
+                     _mm_unpacklo_epi64(b0, b1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(encKey),
+                     _mm_unpacklo_epi64(b2, b3));
+
+    // 256 bit keys take two more blocks of key material
+    if (nRounds == 14) {
+        AesEncrypt(&b4, &b5, pkey128, nRounds);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(encKey + 16),
+                         _mm_unpacklo_epi64(b4, b5));
+    }
+
+    b0 = b1 = b2 = b3 = b4 = b5 = _mm_setzero_si128();
+}
+
+void
+InitHashPowers(const Uint8 authKey[], __m128i pHtable[], Uint32 count)
+{
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+
+    pHtable[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(authKey));
+    for (Uint32 i = 1; i < count; i++) {
+        gMul(pHtable[i - 1], pHtable[0], pHtable[i], const_factor_128);
+    }
+}
+
+void
+Polyval(const Uint8   pIn[],
+        Uint64        len,
+        const __m128i pHtable[],
+        __m128i&      state)
+{
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+
+    auto    p_in_128 = reinterpret_cast<const __m128i*>(pIn);
+    Uint64  blocks   = len / Rijndael::cBlockSize;
+    Uint64  res      = len % Rijndael::cBlockSize;
+    __m128i a1, a2, a3, a4;
+
+    // Aggregated reduction, the oldest block takes the highest power
+    for (; blocks >= 4; blocks -= 4) {
+        a1 = _mm_loadu_si128(p_in_128);
+        a2 = _mm_loadu_si128(p_in_128 + 1);
+        a3 = _mm_loadu_si128(p_in_128 + 2);
+        a4 = _mm_loadu_si128(p_in_128 + 3);
+
+        a1 = _mm_xor_si128(a1, state);
+        gMul(pHtable[0],
+             pHtable[1],
+             pHtable[2],
+             pHtable[3],
+             a4,
+             a3,
+             a2,
+             a1,
+             state,
+             const_factor_128);
+
+        p_in_128 += 4;
+    }
+
+    for (; blocks != 0; blocks--) {
+        a1    = _mm_loadu_si128(p_in_128);
+        state = _mm_xor_si128(a1, state);
+        gMul(state, pHtable[0], state, const_factor_128);
+        p_in_128++;
+    }
+
+    if (res) {
+        a1 = _mm_setzero_si128();
+        utils::CopyBytes(reinterpret_cast<Uint8*>(&a1),
+                         reinterpret_cast<const Uint8*>(p_in_128),
+                         res);
+        state = _mm_xor_si128(a1, state);
+        gMul(state, pHtable[0], state, const_factor_128);
+    }
+}
+
+void
+GetTag(__m128i       state,
+       const __m128i pHtable[],
+       Uint64        aadLen,
+       Uint64        len,
+       const Uint8   nonce[],
+       const Uint8   pKey[],
+       int           nRounds,
+       Uint8         tag[])
+{
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+    // clears the most significant bit of the last byte
+    const __m128i msb_mask = _mm_set_epi32(0x7fffffff, -1, -1, -1);
+
+    // length block, LE64(aad bits) || LE64(plaintext bits)
+    __m128i a1 = _mm_set_epi64x(len << 3, aadLen << 3);
+    state      = _mm_xor_si128(a1, state);
+    gMul(state, pHtable[0], state, const_factor_128);
+
+    a1 = _mm_setzero_si128();
+    utils::CopyBytes(
+        reinterpret_cast<Uint8*>(&a1), nonce, ALCP_GCM_SIV_NONCE_SIZE);
+    state = _mm_xor_si128(a1, state);
+    state = _mm_and_si128(state, msb_mask);
+
+    AesEncrypt(&state, reinterpret_cast<const __m128i*>(pKey), nRounds);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(tag), state);
+}
+
+void
+CryptCtr32(const Uint8 pIn[],
+           Uint8       pOut[],
+           Uint64      len,
+           const Uint8 pKey[],
+           int         nRounds,
+           const Uint8 counter[])
+{
+    auto p_in_128  = reinterpret_cast<const __m128i*>(pIn);
+    auto p_out_128 = reinterpret_cast<__m128i*>(pOut);
+    auto pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+    // the counter is the first 32 bit little endian word, epi32 add wraps it
+    const __m128i one_x  = _mm_set_epi32(0, 0, 0, 1);
+    const __m128i four_x = _mm_set_epi32(0, 0, 0, 4);
+
+    __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counter));
+    __m128i a1, a2, a3, a4;
+    __m128i b1, b2, b3, b4;
+
+    Uint64 blocks = len / Rijndael::cBlockSize;
+    Uint64 res    = len % Rijndael::cBlockSize;
+
+    for (; blocks >= 4; blocks -= 4) {
+        b1 = c1;
+        b2 = _mm_add_epi32(c1, one_x);
+        b3 = _mm_add_epi32(b2, one_x);
+        b4 = _mm_add_epi32(b3, one_x);
+
+        AesEncrypt(&b1, &b2, &b3, &b4, pkey128, nRounds);
+
+        a1 = _mm_loadu_si128(p_in_128);
+        a2 = _mm_loadu_si128(p_in_128 + 1);
+        a3 = _mm_loadu_si128(p_in_128 + 2);
+        a4 = _mm_loadu_si128(p_in_128 + 3);
+
+        _mm_storeu_si128(p_out_128, _mm_xor_si128(a1, b1));
+        _mm_storeu_si128(p_out_128 + 1, _mm_xor_si128(a2, b2));
+        _mm_storeu_si128(p_out_128 + 2, _mm_xor_si128(a3, b3));
+        _mm_storeu_si128(p_out_128 + 3, _mm_xor_si128(a4, b4));
+
+        c1 = _mm_add_epi32(c1, four_x);
+        p_in_128 += 4;
+        p_out_128 += 4;
+    }
+
+    for (; blocks != 0; blocks--) {
+        b1 = c1;
+        AesEncrypt(&b1, pkey128, nRounds);
+
+        a1 = _mm_loadu_si128(p_in_128);
+        _mm_storeu_si128(p_out_128, _mm_xor_si128(a1, b1));
+
+        c1 = _mm_add_epi32(c1, one_x);
+        p_in_128++;
+        p_out_128++;
+    }
+
+    if (res) {
+        b1 = c1;
+        AesEncrypt(&b1, pkey128, nRounds);
+
+        a1 = _mm_setzero_si128();
+        utils::CopyBytes(reinterpret_cast<Uint8*>(&a1),
+                         reinterpret_cast<const Uint8*>(p_in_128),
+                         res);
+        a1 = _mm_xor_si128(a1, b1);
+        utils::CopyBytes(reinterpret_cast<Uint8*>(p_out_128),
+                         reinterpret_cast<const Uint8*>(&a1),
+                         res);
+    }
+
+    b1 = b2 = b3 = b4 = _mm_setzero_si128();
+}
+
+} // namespace alcp::cipher::aesni::gcmsiv
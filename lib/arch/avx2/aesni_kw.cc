@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/aes_kw.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::aesni {
+
+/*
+ * Key wrap of cKwMbLanes independent keys, one xmm per key. The round keys
+ * are common to all the lanes.
+ */
+template<bool cWrap>
+static inline void
+kwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pKey, int nRounds)
+{
+    constexpr Uint32 cLanes = cKwMbLanes;
+
+    // t is xored big endian into A
+    const __m128i swap = _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8, //
+                                      0, 1, 2, 3, 4, 5, 6, 7);
+    const __m128i one  = _mm_set_epi64x(0, 1);
+
+    __m128i a[cLanes], t[cLanes], b[cLanes];
+    Uint8*  p_r[cLanes];
+
+    auto p_key = reinterpret_cast<const __m128i*>(pKey);
+
+    UNROLL_8
+    for (Uint32 l = 0; l < cLanes; l++) {
+        a[l]   = lanes.m_a[l];
+        t[l]   = lanes.m_t[l];
+        p_r[l] = lanes.m_pR[l];
+    }
+
+    for (; steps > 0; steps--) {
+        __m128i k = _mm_load_si128(p_key);
+
+        UNROLL_8
+        for (Uint32 l = 0; l < cLanes; l++) {
+            __m128i r = _mm_loadl_epi64(reinterpret_cast<__m128i*>(p_r[l]));
+            if constexpr (!cWrap) {
+                a[l] = _mm_xor_si128(a[l], _mm_shuffle_epi8(t[l], swap));
+                t[l] = _mm_sub_epi64(t[l], one);
+            }
+            b[l] = _mm_xor_si128(_mm_unpacklo_epi64(a[l], r), k);
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            k = _mm_load_si128(p_key + r);
+
+            UNROLL_8
+            for (Uint32 l = 0; l < cLanes; l++) {
+                if constexpr (cWrap) {
+                    b[l] = _mm_aesenc_si128(b[l], k);
+                } else {
+                    b[l] = _mm_aesdec_si128(b[l], k);
+                }
+            }
+        }
+
+        k = _mm_load_si128(p_key + nRounds);
+
+        UNROLL_8
+        for (Uint32 l = 0; l < cLanes; l++) {
+            if constexpr (cWrap) {
+                b[l] = _mm_aesenclast_si128(b[l], k);
+                a[l] = _mm_xor_si128(b[l], _mm_shuffle_epi8(t[l], swap));
+                t[l] = _mm_add_epi64(t[l], one);
+            } else {
+                b[l] = _mm_aesdeclast_si128(b[l], k);
+                a[l] = b[l];
+            }
+            _mm_storeh_pd(reinterpret_cast<double*>(p_r[l]),
+                          _mm_castsi128_pd(b[l]));
+            if constexpr (cWrap) {
+                p_r[l] = (p_r[l] == lanes.m_pLast[l]) ? lanes.m_pFirst[l]
+                                                      : p_r[l] + 8;
+            } else {
+                p_r[l] = (p_r[l] == lanes.m_pFirst[l]) ? lanes.m_pLast[l]
+                                                       : p_r[l] - 8;
+            }
+        }
+    }
+
+    UNROLL_8
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_a[l]  = a[l];
+        lanes.m_t[l]  = t[l];
+        lanes.m_pR[l] = p_r[l];
+    }
+}
+
+void
+WrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pEncKey, int nRounds)
+{
+    kwMb<true>(lanes, steps, pEncKey, nRounds);
+}
+
+void
+UnwrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pDecKey, int nRounds)
+{
+    kwMb<false>(lanes, steps, pDecKey, nRounds);
+}
+
+} // namespace alcp::cipher::aesni
@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_ocb.hh"
+#include "alcp/cipher/aesni.hh"
+#include "alcp/utils/copy.hh"
+
+#include <cstring>
+#include <immintrin.h>
+
+namespace alcp::cipher::aesni {
+
+// doubling in GF(2^128) on a big endian block
+static inline void
+doubleBlock(const Uint8 in[], Uint8 out[])
+{
+    Uint8 carry = in[0] >> 7;
+    for (int i = 0; i < 15; i++) {
+        out[i] = (in[i] << 1) | (in[i + 1] >> 7);
+    }
+    out[15] = (in[15] << 1) ^ (carry * 0x87);
+}
+
+static inline Uint64
+ntz(Uint64 n)
+{
+    return __builtin_ctzll(n);
+}
+
+template<void Aes_1x128(__m128i* pBlk0, const __m128i* pKey, int nRounds),
+         OcbOp cOp>
+static inline void
+OcbBlock(const __m128i* p_in_128,
+         __m128i*       p_out_128,
+         __m128i        offset,
+         __m128i&       sum,
+         const __m128i* pkey128,
+         int            nRounds)
+{
+    __m128i a1 = _mm_loadu_si128(p_in_128);
+    if constexpr (cOp == OcbOp::eEncrypt) {
+        sum = _mm_xor_si128(sum, a1);
+    }
+    a1 = _mm_xor_si128(a1, offset);
+    Aes_1x128(&a1, pkey128, nRounds);
+
+    if constexpr (cOp == OcbOp::eHash) {
+        sum = _mm_xor_si128(sum, a1);
+    } else {
+        a1 = _mm_xor_si128(a1, offset);
+        _mm_storeu_si128(p_out_128, a1);
+        if constexpr (cOp == OcbOp::eDecrypt) {
+            sum = _mm_xor_si128(sum, a1);
+        }
+    }
+}
+
+/*
+ * Full blocks, four at a time once the block number is a multiple of four so
+ * that the offsets come straight from the gray table.
+ */
+template<void Aes_1x128(__m128i* pBlk0, const __m128i* pKey, int nRounds),
+         void Aes_4x128(__m128i*       pBlk0,
+                        __m128i*       pBlk1,
+                        __m128i*       pBlk2,
+                        __m128i*       pBlk3,
+                        const __m128i* pKey,
+                        int            nRounds),
+         OcbOp cOp>
+static inline void
+OcbBlocks(const Uint8      pIn[],
+          Uint8            pOut[],
+          Uint64           blocks,
+          const Uint8      pKey[],
+          int              nRounds,
+          const OcbLTable& table,
+          OcbPass&         pass)
+{
+    auto p_in_128  = reinterpret_cast<const __m128i*>(pIn);
+    auto p_out_128 = reinterpret_cast<__m128i*>(pOut);
+    auto pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+    Uint64  idx    = pass.blocks;
+    __m128i offset = pass.offset;
+    __m128i sum    = pass.sum;
+
+    for (; blocks != 0 && (idx % 4) != 0; blocks--) {
+        idx++;
+        offset = _mm_xor_si128(offset, table.l[ntz(idx)]);
+        OcbBlock<Aes_1x128, cOp>(
+            p_in_128, p_out_128, offset, sum, pkey128, nRounds);
+        p_in_128++;
+        if constexpr (cOp != OcbOp::eHash) {
+            p_out_128++;
+        }
+    }
+
+    __m128i a1, a2, a3, a4;
+    __m128i o1, o2, o3, o4;
+
+    for (; blocks >= 4; blocks -= 4) {
+        o1 = _mm_xor_si128(offset, table.gray[1]);
+        o2 = _mm_xor_si128(offset, table.gray[2]);
+        o3 = _mm_xor_si128(offset, table.gray[3]);
+        o4 = _mm_xor_si128(o3, table.l[ntz(idx + 4)]);
+
+        a1 = _mm_loadu_si128(p_in_128);
+        a2 = _mm_loadu_si128(p_in_128 + 1);
+        a3 = _mm_loadu_si128(p_in_128 + 2);
+        a4 = _mm_loadu_si128(p_in_128 + 3);
+
+        if constexpr (cOp == OcbOp::eEncrypt) {
+            sum = _mm_xor_si128(sum, _mm_xor_si128(a1, a2));
+            sum = _mm_xor_si128(sum, _mm_xor_si128(a3, a4));
+        }
+
+        a1 = _mm_xor_si128(a1, o1);
+        a2 = _mm_xor_si128(a2, o2);
+        a3 = _mm_xor_si128(a3, o3);
+        a4 = _mm_xor_si128(a4, o4);
+
+        Aes_4x128(&a1, &a2, &a3, &a4, pkey128, nRounds);
+
+        if constexpr (cOp == OcbOp::eHash) {
+            sum = _mm_xor_si128(sum, _mm_xor_si128(a1, a2));
+            sum = _mm_xor_si128(sum, _mm_xor_si128(a3, a4));
+        } else {
+            a1 = _mm_xor_si128(a1, o1);
+            a2 = _mm_xor_si128(a2, o2);
+            a3 = _mm_xor_si128(a3, o3);
+            a4 = _mm_xor_si128(a4, o4);
+
+            _mm_storeu_si128(p_out_128, a1);
+            _mm_storeu_si128(p_out_128 + 1, a2);
+            _mm_storeu_si128(p_out_128 + 2, a3);
+            _mm_storeu_si128(p_out_128 + 3, a4);
+
+            if constexpr (cOp == OcbOp::eDecrypt) {
+                sum = _mm_xor_si128(sum, _mm_xor_si128(a1, a2));
+                sum = _mm_xor_si128(sum, _mm_xor_si128(a3, a4));
+            }
+            p_out_128 += 4;
+        }
+
+        offset = o4;
+        idx += 4;
+        p_in_128 += 4;
+    }
+
+    for (; blocks != 0; blocks--) {
+        idx++;
+        offset = _mm_xor_si128(offset, table.l[ntz(idx)]);
+        OcbBlock<Aes_1x128, cOp>(
+            p_in_128, p_out_128, offset, sum, pkey128, nRounds);
+        p_in_128++;
+        if constexpr (cOp != OcbOp::eHash) {
+            p_out_128++;
+        }
+    }
+
+    pass.offset = offset;
+    pass.sum    = sum;
+    pass.blocks = idx;
+}
+
+namespace ocb {
+
+    void InitLTable(const Uint8 pKey[], int nRounds, OcbLTable& table)
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // L_* = ENCIPHER(K, zeros(128)), every other entry is a doubling
+        __m128i l_star = _mm_setzero_si128();
+        AesEncrypt(&l_star, pkey128, nRounds);
+        table.lStar = l_star;
+
+        alignas(16) Uint8 prev[16], next[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(prev), l_star);
+        doubleBlock(prev, next);
+        table.lDollar = _mm_load_si128(reinterpret_cast<__m128i*>(next));
+
+        for (int i = 0; i < ALCP_OCB_L_TABLE_SIZE; i++) {
+            doubleBlock(next, prev);
+            table.l[i] = _mm_load_si128(reinterpret_cast<__m128i*>(prev));
+            utils::CopyBytes(next, prev, sizeof(prev));
+        }
+
+        table.gray[0] = _mm_setzero_si128();
+        for (Uint64 j = 1; j < ALCP_OCB_MAX_BATCH; j++) {
+            table.gray[j] = _mm_xor_si128(table.gray[j - 1], table.l[ntz(j)]);
+        }
+
+        memset(prev, 0, sizeof(prev));
+        memset(next, 0, sizeof(next));
+    }
+
+    __m128i InitOffset(const Uint8 pKey[],
+                       int         nRounds,
+                       const Uint8 nonce[],
+                       Uint64      nonceLen,
+                       Uint64      tagLen)
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // num2str(TAGLEN mod 128, 7) || zeros || 1 || N
+        alignas(16) Uint8 blk[16] = {};
+        blk[0]                    = ((tagLen * 8) % 128) << 1;
+        blk[15 - nonceLen] |= 1;
+        utils::CopyBytes(blk + 16 - nonceLen, nonce, nonceLen);
+
+        Uint32 bottom = blk[15] & 0x3f;
+        blk[15] &= 0xc0;
+
+        __m128i k_top = _mm_load_si128(reinterpret_cast<__m128i*>(blk));
+        AesEncrypt(&k_top, pkey128, nRounds);
+
+        // Stretch = Ktop || (Ktop[1..64] xor Ktop[9..72])
+        alignas(16) Uint8 stretch[24];
+        _mm_store_si128(reinterpret_cast<__m128i*>(stretch), k_top);
+        for (int i = 0; i < 8; i++) {
+            stretch[16 + i] = stretch[i] ^ stretch[i + 1];
+        }
+
+        // Offset_0 = Stretch[1+bottom..128+bottom]
+        Uint32 byte_shift = bottom / 8, bit_shift = bottom % 8;
+        for (int i = 0; i < 16; i++) {
+            blk[i] = stretch[i + byte_shift] << bit_shift;
+            if (bit_shift) {
+                blk[i] |= stretch[i + byte_shift + 1] >> (8 - bit_shift);
+            }
+        }
+
+        return _mm_load_si128(reinterpret_cast<__m128i*>(blk));
+    }
+
+    void CryptTail(const Uint8      pIn[],
+                   Uint8            pOut[],
+                   Uint64           len,
+                   bool             isEnc,
+                   const Uint8      pKey[],
+                   int              nRounds,
+                   const OcbLTable& table,
+                   OcbPass&         pass)
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // Pad = ENCIPHER(K, Offset_*), the checksum takes P_* || 1 || 0*
+        pass.offset = _mm_xor_si128(pass.offset, table.lStar);
+        __m128i pad = pass.offset;
+        AesEncrypt(&pad, pkey128, nRounds);
+
+        alignas(16) Uint8 buf[16] = {};
+        utils::CopyBytes(buf, pIn, len);
+        __m128i a1 = _mm_load_si128(reinterpret_cast<__m128i*>(buf));
+        __m128i b1 = _mm_xor_si128(a1, pad);
+        _mm_store_si128(reinterpret_cast<__m128i*>(buf), b1);
+        utils::CopyBytes(pOut, buf, len);
+
+        // plaintext is the input when encrypting, the output when decrypting
+        if (!isEnc) {
+            memset(buf + len, 0, sizeof(buf) - len);
+        } else {
+            _mm_store_si128(reinterpret_cast<__m128i*>(buf), a1);
+        }
+        buf[len] = 0x80;
+        pass.sum = _mm_xor_si128(
+            pass.sum, _mm_load_si128(reinterpret_cast<__m128i*>(buf)));
+
+        memset(buf, 0, sizeof(buf));
+    }
+
+    void HashTail(const Uint8      pIn[],
+                  Uint64           len,
+                  const Uint8      pKey[],
+                  int              nRounds,
+                  const OcbLTable& table,
+                  OcbPass&         pass)
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        alignas(16) Uint8 buf[16] = {};
+        utils::CopyBytes(buf, pIn, len);
+        buf[len] = 0x80;
+
+        pass.offset = _mm_xor_si128(pass.offset, table.lStar);
+        __m128i a1  = _mm_xor_si128(
+            _mm_load_si128(reinterpret_cast<__m128i*>(buf)), pass.offset);
+        AesEncrypt(&a1, pkey128, nRounds);
+        pass.sum = _mm_xor_si128(pass.sum, a1);
+    }
+
+    void GetTag(const OcbPass&   msg,
+                const OcbPass&   aad,
+                const Uint8      pKey[],
+                int              nRounds,
+                const OcbLTable& table,
+                Uint8            tag[],
+                Uint64           tagLen)
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // ENCIPHER(K, Checksum xor Offset xor L_$) xor HASH(K, A)
+        __m128i t = _mm_xor_si128(msg.sum, msg.offset);
+        t         = _mm_xor_si128(t, table.lDollar);
+        AesEncrypt(&t, pkey128, nRounds);
+        t = _mm_xor_si128(t, aad.sum);
+
+        alignas(16) Uint8 buf[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(buf), t);
+        utils::CopyBytes(tag, buf, tagLen);
+        memset(buf, 0, sizeof(buf));
+    }
+
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbBlocks<AesEncrypt, AesEncrypt, OcbOp::eEncrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbBlocks<AesDecrypt, AesDecrypt, OcbOp::eDecrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass)
+    {
+        OcbBlocks<AesEncrypt, AesEncrypt, OcbOp::eHash>(
+            pIn, nullptr, blocks, pKey, nRounds, table, pass);
+    }
+
+} // namespace ocb
+
+} // namespace alcp::cipher::aesni
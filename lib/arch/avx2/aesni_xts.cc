@@ -377,11 +377,13 @@ namespace alcp::cipher { namespace aesni {
             __m128i last_src_text;
             auto    p_last_src_text = reinterpret_cast<Uint8*>(&last_src_text);
 
+            // read the partial source block before it is overwritten, the
+            // source and the destination may be the same buffer
+            utils::CopyBytes(p_last_src_text, p_src8, last_Round_Byte);
             utils::CopyBytes(p_dest8, p_dest8 - 16, last_Round_Byte);
             utils::CopyBytes(p_last_src_text + last_Round_Byte,
                              p_dest8 - 16 + last_Round_Byte,
                              16 - last_Round_Byte);
-            utils::CopyBytes(p_last_src_text, p_src8, last_Round_Byte);
 
             // encrypting the last block
             last_src_text = (last_tweak ^ last_src_text);
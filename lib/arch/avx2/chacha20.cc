@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/chacha20.hh"
+#include "alcp/cipher/chacha20_avx2.hh"
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
+
+#include <cstring>
+#include <immintrin.h>
+
+namespace alcp::cipher::avx2 {
+
+/*
+ * Every register holds one state word of several blocks, lane i belongs to
+ * block i. The rounds are then plain vertical adds, xors and rotates, the
+ * keystream is transposed back to block order when it is xored with the
+ * message.
+ */
+
+// 8 blocks in parallel
+struct Vec256
+{
+    using T = __m256i;
+
+    static constexpr Uint64 cBlocks = 8;
+
+    static inline T add(T a, T b) { return _mm256_add_epi32(a, b); }
+    static inline T xor_(T a, T b) { return _mm256_xor_si256(a, b); }
+    static inline T set1(Uint32 a) { return _mm256_set1_epi32(a); }
+
+    static inline T counters(Uint32 c)
+    {
+        return _mm256_add_epi32(_mm256_set1_epi32(c),
+                                _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+
+    static inline T rotl16(T a)
+    {
+        const T cShuffle = _mm256_setr_epi8(2,  3,  0,  1,  6,  7,  4,  5,
+                                            10, 11, 8,  9,  14, 15, 12, 13,
+                                            2,  3,  0,  1,  6,  7,  4,  5,
+                                            10, 11, 8,  9,  14, 15, 12, 13);
+        return _mm256_shuffle_epi8(a, cShuffle);
+    }
+
+    static inline T rotl8(T a)
+    {
+        const T cShuffle = _mm256_setr_epi8(3,  0,  1,  2,  7,  4,  5,  6,
+                                            11, 8,  9,  10, 15, 12, 13, 14,
+                                            3,  0,  1,  2,  7,  4,  5,  6,
+                                            11, 8,  9,  10, 15, 12, 13, 14);
+        return _mm256_shuffle_epi8(a, cShuffle);
+    }
+
+    template<int N>
+    static inline T rotl(T a)
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(a, N),
+                               _mm256_srli_epi32(a, 32 - N));
+    }
+
+    // 8x8 transpose of words x[0..7], row i is 32 bytes of block i
+    static inline void transpose(const T x[8], T row[8])
+    {
+        T t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+        T t1 = _mm256_unpackhi_epi32(x[0], x[1]);
+        T t2 = _mm256_unpacklo_epi32(x[2], x[3]);
+        T t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+        T t4 = _mm256_unpacklo_epi32(x[4], x[5]);
+        T t5 = _mm256_unpackhi_epi32(x[4], x[5]);
+        T t6 = _mm256_unpacklo_epi32(x[6], x[7]);
+        T t7 = _mm256_unpackhi_epi32(x[6], x[7]);
+
+        T u0 = _mm256_unpacklo_epi64(t0, t2);
+        T u1 = _mm256_unpackhi_epi64(t0, t2);
+        T u2 = _mm256_unpacklo_epi64(t1, t3);
+        T u3 = _mm256_unpackhi_epi64(t1, t3);
+        T u4 = _mm256_unpacklo_epi64(t4, t6);
+        T u5 = _mm256_unpackhi_epi64(t4, t6);
+        T u6 = _mm256_unpacklo_epi64(t5, t7);
+        T u7 = _mm256_unpackhi_epi64(t5, t7);
+
+        row[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+        row[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+        row[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+        row[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+        row[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+        row[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+        row[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+        row[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+    }
+
+    static inline void xorStore(const Uint8* pIn, Uint8* pOut, const T x[16])
+    {
+        T lo[8], hi[8];
+        transpose(x, lo);
+        transpose(x + 8, hi);
+        for (Uint64 i = 0; i < cBlocks; i++) {
+            auto pSrc = reinterpret_cast<const T*>(pIn + i * 64);
+            auto pDst = reinterpret_cast<T*>(pOut + i * 64);
+            _mm256_storeu_si256(
+                pDst, _mm256_xor_si256(_mm256_loadu_si256(pSrc), lo[i]));
+            _mm256_storeu_si256(
+                pDst + 1,
+                _mm256_xor_si256(_mm256_loadu_si256(pSrc + 1), hi[i]));
+        }
+    }
+
+    // as above with block i read from pIn[i] and written to pOut[i]
+    static inline void xorStoreLanes(const Uint8* const pIn[],
+                                     Uint8* const       pOut[],
+                                     const T            x[16])
+    {
+        T lo[8], hi[8];
+        transpose(x, lo);
+        transpose(x + 8, hi);
+        for (Uint64 i = 0; i < cBlocks; i++) {
+            auto pSrc = reinterpret_cast<const T*>(pIn[i]);
+            auto pDst = reinterpret_cast<T*>(pOut[i]);
+            _mm256_storeu_si256(
+                pDst, _mm256_xor_si256(_mm256_loadu_si256(pSrc), lo[i]));
+            _mm256_storeu_si256(
+                pDst + 1,
+                _mm256_xor_si256(_mm256_loadu_si256(pSrc + 1), hi[i]));
+        }
+    }
+};
+
+// 4 blocks in parallel, for the tail
+struct Vec128
+{
+    using T = __m128i;
+
+    static constexpr Uint64 cBlocks = 4;
+
+    static inline T add(T a, T b) { return _mm_add_epi32(a, b); }
+    static inline T xor_(T a, T b) { return _mm_xor_si128(a, b); }
+    static inline T set1(Uint32 a) { return _mm_set1_epi32(a); }
+
+    static inline T counters(Uint32 c)
+    {
+        return _mm_add_epi32(_mm_set1_epi32(c), _mm_setr_epi32(0, 1, 2, 3));
+    }
+
+    static inline T rotl16(T a)
+    {
+        const T cShuffle = _mm_setr_epi8(
+            2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+        return _mm_shuffle_epi8(a, cShuffle);
+    }
+
+    static inline T rotl8(T a)
+    {
+        const T cShuffle = _mm_setr_epi8(
+            3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+        return _mm_shuffle_epi8(a, cShuffle);
+    }
+
+    template<int N>
+    static inline T rotl(T a)
+    {
+        return _mm_or_si128(_mm_slli_epi32(a, N), _mm_srli_epi32(a, 32 - N));
+    }
+
+    // 4x4 transpose of words x[0..3], row i is 16 bytes of block i
+    static inline void transpose(const T x[4], T row[4])
+    {
+        T t0 = _mm_unpacklo_epi32(x[0], x[1]);
+        T t1 = _mm_unpackhi_epi32(x[0], x[1]);
+        T t2 = _mm_unpacklo_epi32(x[2], x[3]);
+        T t3 = _mm_unpackhi_epi32(x[2], x[3]);
+
+        row[0] = _mm_unpacklo_epi64(t0, t2);
+        row[1] = _mm_unpackhi_epi64(t0, t2);
+        row[2] = _mm_unpacklo_epi64(t1, t3);
+        row[3] = _mm_unpackhi_epi64(t1, t3);
+    }
+
+    static inline void xorStore(const Uint8* pIn, Uint8* pOut, const T x[16])
+    {
+        for (Uint64 w = 0; w < 4; w++) {
+            T row[4];
+            transpose(x + w * 4, row);
+            for (Uint64 i = 0; i < cBlocks; i++) {
+                auto pSrc = reinterpret_cast<const T*>(pIn + i * 64) + w;
+                auto pDst = reinterpret_cast<T*>(pOut + i * 64) + w;
+                _mm_storeu_si128(pDst,
+                                 _mm_xor_si128(_mm_loadu_si128(pSrc), row[i]));
+            }
+        }
+    }
+};
+
+template<class V>
+static inline void
+QuarterRound(typename V::T& a,
+             typename V::T& b,
+             typename V::T& c,
+             typename V::T& d)
+{
+    a = V::add(a, b);
+    d = V::rotl16(V::xor_(d, a));
+    c = V::add(c, d);
+    b = V::template rotl<12>(V::xor_(b, c));
+    a = V::add(a, b);
+    d = V::rotl8(V::xor_(d, a));
+    c = V::add(c, d);
+    b = V::template rotl<7>(V::xor_(b, c));
+}
+
+// the 20 rounds of ChaCha20 on every lane
+template<class V>
+static inline void
+Rounds(typename V::T x[16])
+{
+    for (int r = 0; r < 10; r++) {
+        // column round
+        QuarterRound<V>(x[0], x[4], x[8], x[12]);
+        QuarterRound<V>(x[1], x[5], x[9], x[13]);
+        QuarterRound<V>(x[2], x[6], x[10], x[14]);
+        QuarterRound<V>(x[3], x[7], x[11], x[15]);
+        // diagonal round
+        QuarterRound<V>(x[0], x[5], x[10], x[15]);
+        QuarterRound<V>(x[1], x[6], x[11], x[12]);
+        QuarterRound<V>(x[2], x[7], x[8], x[13]);
+        QuarterRound<V>(x[3], x[4], x[9], x[14]);
+    }
+}
+
+// V::cBlocks blocks starting at counter, xored from pIn to pOut
+template<class V>
+static inline void
+ProcessBlocks(const Uint32 state[16],
+              Uint32       counter,
+              const Uint8* pIn,
+              Uint8*       pOut)
+{
+    using T = typename V::T;
+
+    T x[16], s[16];
+    for (int i = 0; i < 16; i++) {
+        s[i] = V::set1(state[i]);
+    }
+    s[12] = V::counters(counter);
+    for (int i = 0; i < 16; i++) {
+        x[i] = s[i];
+    }
+
+    Rounds<V>(x);
+
+    for (int i = 0; i < 16; i++) {
+        x[i] = V::add(x[i], s[i]);
+    }
+    V::xorStore(pIn, pOut, x);
+}
+
+alc_error_t
+ProcessInput(const Uint8 key[],
+             Uint64      keylen,
+             const Uint8 iv[],
+             Uint64      ivlen,
+             const Uint8 plaintext[],
+             Uint8       ciphertext[],
+             Uint64      blocks,
+             int         remBytes)
+{
+    // constants, key, then counter and nonce as given by the iv
+    Uint32 state[16];
+    memcpy(state, Chacha20Constants, 16);
+    memcpy(state + 4, key, 32);
+    memcpy(state + 12, iv, 16);
+
+    Uint32       counter = state[12];
+    const Uint8* p_in    = plaintext;
+    Uint8*       p_out   = ciphertext;
+
+    for (; blocks >= Vec256::cBlocks; blocks -= Vec256::cBlocks) {
+        ProcessBlocks<Vec256>(state, counter, p_in, p_out);
+        counter += Vec256::cBlocks;
+        p_in += Vec256::cBlocks * 64;
+        p_out += Vec256::cBlocks * 64;
+    }
+    if (blocks >= Vec128::cBlocks) {
+        ProcessBlocks<Vec128>(state, counter, p_in, p_out);
+        counter += Vec128::cBlocks;
+        p_in += Vec128::cBlocks * 64;
+        p_out += Vec128::cBlocks * 64;
+        blocks -= Vec128::cBlocks;
+    }
+
+    // less than 4 blocks left, run them through a buffer
+    Uint64 len = blocks * 64 + remBytes;
+    if (len != 0) {
+        alignas(16) Uint8 buf[Vec128::cBlocks * 64] = {};
+        memcpy(buf, p_in, len);
+        ProcessBlocks<Vec128>(state, counter, buf, buf);
+        memcpy(p_out, buf, len);
+        memset(buf, 0, sizeof(buf));
+    }
+    memset(state, 0, sizeof(state));
+
+    return ALC_ERROR_NONE;
+}
+
+// one block per lane, every lane with its own key, counter and nonce
+void
+ChaCha20Mb(ChaChaMbLanes& lanes, Uint64 blocks)
+{
+    using T                 = Vec256::T;
+    constexpr Uint64 cLanes = Vec256::cBlocks;
+
+    auto load = [](const Uint32* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const T*>(p));
+    };
+
+    T s[16];
+    for (int i = 0; i < 4; i++) {
+        s[i] = Vec256::set1(Chacha20Constants[i]);
+    }
+    for (int i = 0; i < 8; i++) {
+        s[4 + i] = load(lanes.m_key[i]);
+    }
+    s[12] = load(lanes.m_counter);
+    for (int i = 0; i < 3; i++) {
+        s[13 + i] = load(lanes.m_nonce[i]);
+    }
+
+    const Uint8* p_in[cLanes];
+    Uint8*       p_out[cLanes];
+    for (Uint64 l = 0; l < cLanes; l++) {
+        p_in[l]  = lanes.m_pSrc[l];
+        p_out[l] = lanes.m_pDst[l];
+    }
+
+    for (Uint64 b = 0; b < blocks; b++) {
+        T x[16];
+        for (int i = 0; i < 16; i++) {
+            x[i] = s[i];
+        }
+        Rounds<Vec256>(x);
+        for (int i = 0; i < 16; i++) {
+            x[i] = Vec256::add(x[i], s[i]);
+        }
+        Vec256::xorStoreLanes(p_in, p_out, x);
+
+        s[12] = Vec256::add(s[12], Vec256::set1(1));
+        for (Uint64 l = 0; l < cLanes; l++) {
+            p_in[l] += lanes.m_step[l];
+            p_out[l] += lanes.m_step[l];
+        }
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<T*>(lanes.m_counter), s[12]);
+    for (Uint64 l = 0; l < cLanes; l++) {
+        lanes.m_pSrc[l] = p_in[l];
+        lanes.m_pDst[l] = p_out[l];
+    }
+}
+
+// HChaCha20 of 8 nonces, lane i takes the nonce at pNonces + 16 * i
+static inline void
+HChaCha20Blocks(const Uint32 key[8], const Uint8* pNonces, Uint8* pSubkeys)
+{
+    using T = Vec256::T;
+
+    T x[16];
+    for (int i = 0; i < 4; i++) {
+        x[i] = Vec256::set1(Chacha20Constants[i]);
+    }
+    for (int i = 0; i < 8; i++) {
+        x[4 + i] = Vec256::set1(key[i]);
+    }
+
+    // row i holds nonce i and nonce i + 4, transposing the 4x4 words of each
+    // 128 bit half leaves word j of nonce i in lane i of x[12 + j]
+    T row[4];
+    for (int i = 0; i < 4; i++) {
+        auto p_nonce = reinterpret_cast<const __m128i*>(pNonces) + i;
+        row[i]       = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(p_nonce)),
+            _mm_loadu_si128(p_nonce + 4),
+            1);
+    }
+    T t0  = _mm256_unpacklo_epi32(row[0], row[1]);
+    T t1  = _mm256_unpackhi_epi32(row[0], row[1]);
+    T t2  = _mm256_unpacklo_epi32(row[2], row[3]);
+    T t3  = _mm256_unpackhi_epi32(row[2], row[3]);
+    x[12] = _mm256_unpacklo_epi64(t0, t2);
+    x[13] = _mm256_unpackhi_epi64(t0, t2);
+    x[14] = _mm256_unpacklo_epi64(t1, t3);
+    x[15] = _mm256_unpackhi_epi64(t1, t3);
+
+    Rounds<Vec256>(x);
+
+    // after the transpose row i is the subkey of lane i
+    T words[8] = { x[0], x[1], x[2], x[3], x[12], x[13], x[14], x[15] };
+    T out[8];
+    Vec256::transpose(words, out);
+    for (Uint64 i = 0; i < Vec256::cBlocks; i++) {
+        _mm256_storeu_si256(reinterpret_cast<T*>(pSubkeys + i * 32), out[i]);
+    }
+}
+
+void
+HChaCha20(const Uint8 key[],
+          const Uint8 nonces[],
+          Uint64      numNonces,
+          Uint8       subkeys[])
+{
+    constexpr Uint64 cLanes = Vec256::cBlocks;
+
+    Uint32 k[8];
+    memcpy(k, key, sizeof(k));
+
+    for (; numNonces >= cLanes; numNonces -= cLanes) {
+        HChaCha20Blocks(k, nonces, subkeys);
+        nonces += cLanes * 16;
+        subkeys += cLanes * 32;
+    }
+
+    // unused lanes run on zero nonces and are dropped
+    if (numNonces != 0) {
+        alignas(32) Uint8 in[cLanes * 16] = {};
+        alignas(32) Uint8 out[cLanes * 32];
+        memcpy(in, nonces, numNonces * 16);
+        HChaCha20Blocks(k, in, out);
+        memcpy(subkeys, out, numNonces * 32);
+        memset(out, 0, sizeof(out));
+    }
+    memset(k, 0, sizeof(k));
+}
+
+} // namespace alcp::cipher::avx2
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/digest/digest_mb.hh"
+#include "alcp/digest/md5_mb_core.hh"
+#include "alcp/digest/sha1_mb_core.hh"
+#include "alcp/digest/sha2_mb_core.hh"
+
+#include <immintrin.h>
+
+namespace alcp::digest::avx2 {
+
+// 8 lanes of 32 bits
+struct DigestVec32x8
+{
+    using T = __m256i;
+
+    static constexpr Uint32 cLanes = 8;
+
+    static inline T load(const Uint32* p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const T*>(p));
+    }
+    static inline void store(Uint32* p, T a)
+    {
+        _mm256_storeu_si256(reinterpret_cast<T*>(p), a);
+    }
+
+    static inline T add(T a, T b) { return _mm256_add_epi32(a, b); }
+    static inline T set1(Uint32 a) { return _mm256_set1_epi32(a); }
+    static inline T xor2(T a, T b) { return _mm256_xor_si256(a, b); }
+    static inline T xor3(T a, T b, T c)
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+    }
+    // (e & f) ^ (~e & g)
+    static inline T ch(T e, T f, T g)
+    {
+        return _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+    }
+    // (a & b) ^ (a & c) ^ (b & c)
+    static inline T maj(T a, T b, T c)
+    {
+        return _mm256_or_si256(_mm256_and_si256(a, b),
+                               _mm256_and_si256(c, _mm256_or_si256(a, b)));
+    }
+    // c ^ (b | ~d)
+    static inline T md5I(T b, T c, T d)
+    {
+        const T cOnes = _mm256_set1_epi32(-1);
+        return _mm256_xor_si256(
+            c, _mm256_or_si256(b, _mm256_xor_si256(d, cOnes)));
+    }
+
+    template<int N>
+    static inline T rotr(T a)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(a, N),
+                               _mm256_slli_epi32(a, 32 - N));
+    }
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm256_srli_epi32(a, N);
+    }
+
+    // r[i] holds 8 words of lane i, afterwards word i of all lanes
+    static inline void transpose(T r[8])
+    {
+        T t[8], u[8];
+        for (int i = 0; i < 8; i += 2) {
+            t[i]     = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        for (int i = 0; i < 8; i += 4) {
+            u[i]     = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+            u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+            u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+            u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        for (int i = 0; i < 4; i++) {
+            r[i]     = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+            r[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+        }
+    }
+
+    static inline void loadBlockLe(const Uint8* const p[], T w[16])
+    {
+        for (int half = 0; half < 2; half++) {
+            T* r = w + 8 * half;
+            for (Uint32 l = 0; l < cLanes; l++) {
+                r[l] = _mm256_loadu_si256(
+                    reinterpret_cast<const T*>(p[l] + 32 * half));
+            }
+            transpose(r);
+        }
+    }
+
+    static inline void loadBlockBe(const Uint8* const p[], T w[16])
+    {
+        const T cBswap = _mm256_setr_epi8(3,  2,  1,  0,  7,  6,  5,  4,
+                                          11, 10, 9,  8,  15, 14, 13, 12,
+                                          3,  2,  1,  0,  7,  6,  5,  4,
+                                          11, 10, 9,  8,  15, 14, 13, 12);
+        loadBlockLe(p, w);
+        for (int i = 0; i < 16; i++) {
+            w[i] = _mm256_shuffle_epi8(w[i], cBswap);
+        }
+    }
+};
+
+// 4 lanes of 64 bits
+struct DigestVec64x4
+{
+    using T = __m256i;
+
+    static constexpr Uint32 cLanes = 4;
+
+    static inline T load(const Uint64* p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const T*>(p));
+    }
+    static inline void store(Uint64* p, T a)
+    {
+        _mm256_storeu_si256(reinterpret_cast<T*>(p), a);
+    }
+
+    static inline T add(T a, T b) { return _mm256_add_epi64(a, b); }
+    static inline T set1(Uint64 a) { return _mm256_set1_epi64x(a); }
+    static inline T xor3(T a, T b, T c)
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+    }
+    static inline T ch(T e, T f, T g) { return DigestVec32x8::ch(e, f, g); }
+    static inline T maj(T a, T b, T c) { return DigestVec32x8::maj(a, b, c); }
+
+    template<int N>
+    static inline T rotr(T a)
+    {
+        return _mm256_or_si256(_mm256_srli_epi64(a, N),
+                               _mm256_slli_epi64(a, 64 - N));
+    }
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm256_srli_epi64(a, N);
+    }
+
+    // r[i] holds 4 words of lane i, afterwards word i of all lanes
+    static inline void transpose(T r[4])
+    {
+        T t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+        T t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+        T t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+        T t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+
+        r[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        r[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        r[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        r[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+
+    static inline void loadBlockBe(const Uint8* const p[], T w[16])
+    {
+        const T cBswap = _mm256_setr_epi8(7,  6,  5,  4,  3,  2,  1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8,
+                                          7,  6,  5,  4,  3,  2,  1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8);
+        for (int q = 0; q < 4; q++) {
+            T* r = w + 4 * q;
+            for (Uint32 l = 0; l < cLanes; l++) {
+                r[l] = _mm256_loadu_si256(
+                    reinterpret_cast<const T*>(p[l] + 32 * q));
+            }
+            transpose(r);
+            for (int i = 0; i < 4; i++) {
+                r[i] = _mm256_shuffle_epi8(r[i], cBswap);
+            }
+        }
+    }
+};
+
+void
+Md5Mb(Md5MbLanes& lanes, Uint64 blocks)
+{
+    md5mb::Blocks<DigestVec32x8>(lanes, blocks);
+}
+
+void
+Sha1Mb(Sha1MbLanes& lanes, Uint64 blocks)
+{
+    sha1mb::Blocks<DigestVec32x8>(lanes, blocks);
+}
+
+void
+Sha256Mb(Sha256MbLanes& lanes, Uint64 blocks)
+{
+    sha2mb::Blocks<DigestVec32x8, sha2mb::Sha256Params>(lanes, blocks);
+}
+
+void
+Sha512Mb(Sha512MbLanes& lanes, Uint64 blocks)
+{
+    sha2mb::Blocks<DigestVec64x4, sha2mb::Sha512Params>(lanes, blocks);
+}
+
+} // namespace alcp::digest::avx2
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
+#include "alcp/cipher/poly1305_mb_core.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::avx2 {
+
+// 4 lanes of 64 bits
+struct PolyVec256
+{
+    using T = __m256i;
+
+    static constexpr Uint32 cLanes = 4;
+
+    static inline T load(const Uint64* p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const T*>(p));
+    }
+    static inline void store(Uint64* p, T a)
+    {
+        _mm256_storeu_si256(reinterpret_cast<T*>(p), a);
+    }
+
+    static inline T add(T a, T b) { return _mm256_add_epi64(a, b); }
+    static inline T and_(T a, T b) { return _mm256_and_si256(a, b); }
+    static inline T or_(T a, T b) { return _mm256_or_si256(a, b); }
+    static inline T mul(T a, T b) { return _mm256_mul_epu32(a, b); }
+    static inline T set1(Uint64 a) { return _mm256_set1_epi64x(a); }
+
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm256_srli_epi64(a, N);
+    }
+    template<int N>
+    static inline T slli(T a)
+    {
+        return _mm256_slli_epi64(a, N);
+    }
+
+    // a holds the blocks of lanes 0 and 2, b those of lanes 1 and 3
+    static inline void loadBlocks(const Uint8* const p[], T& lo, T& hi)
+    {
+        auto load128 = [&](int l) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[l]));
+        };
+        T a = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(load128(0)), load128(2), 1);
+        T b = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(load128(1)), load128(3), 1);
+        lo = _mm256_unpacklo_epi64(a, b);
+        hi = _mm256_unpackhi_epi64(a, b);
+    }
+};
+
+void
+Poly1305Mb(Poly1305MbLanes& lanes, Uint64 blocks)
+{
+    poly1305mb::Blocks<PolyVec256, cChaChaPolyMbLanes>(lanes, blocks);
+}
+
+} // namespace alcp::cipher::avx2
@@ -28,6 +28,7 @@
 
 #include "alcp/digest/shani.hh"
 #include "config.h"
+#include <utility>
 #include <x86intrin.h>
 
 // number of vectors needed to accomodate an input chunk
@@ -175,4 +176,82 @@ namespace alcp::digest { namespace shani {
         return ALC_ERROR_NONE;
     }
 
+    /*
+     * Four SHA-1 rounds of group G (rounds 4G..4G+3). msg[G % 4] holds the
+     * message words of the group, the other three are advanced towards the
+     * words of the following groups. e[G % 2] picks up e of the group, the
+     * other one keeps abcd for the next group.
+     */
+    template<int G>
+    inline static void sha1Rounds(__m128i& abcd, __m128i e[2], __m128i msg[4])
+    {
+        constexpr int cCur = G % 2;
+
+        if constexpr (G == 0) {
+            e[cCur] = _mm_add_epi32(e[cCur], msg[0]);
+        } else {
+            e[cCur] = _mm_sha1nexte_epu32(e[cCur], msg[G % 4]);
+        }
+        e[1 - cCur] = abcd;
+        if constexpr (G >= 3 && G <= 18) {
+            msg[(G + 1) % 4] = _mm_sha1msg2_epu32(msg[(G + 1) % 4], msg[G % 4]);
+        }
+        abcd = _mm_sha1rnds4_epu32(abcd, e[cCur], G / 5);
+        if constexpr (G >= 1 && G <= 16) {
+            msg[(G + 3) % 4] = _mm_sha1msg1_epu32(msg[(G + 3) % 4], msg[G % 4]);
+        }
+        if constexpr (G >= 2 && G <= 17) {
+            msg[(G + 2) % 4] = _mm_xor_si128(msg[(G + 2) % 4], msg[G % 4]);
+        }
+    }
+
+    template<int... G>
+    inline static void sha1Block(__m128i& abcd,
+                                 __m128i  e[2],
+                                 __m128i  msg[4],
+                                 std::integer_sequence<int, G...>)
+    {
+        (sha1Rounds<G>(abcd, e, msg), ...);
+    }
+
+    alc_error_t ShaUpdate1(Uint32* pHash, const Uint8* pSrc, Uint64 src_len)
+    {
+        const __m128i shuf_mask =
+            _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+        // a in the highest lane, e in the highest lane of its own vector
+        __m128i abcd = _mm_loadu_si128((const __m128i*)pHash);
+        abcd         = _mm_shuffle_epi32(abcd, 0x1B);
+        __m128i e0   = _mm_set_epi32(pHash[4], 0, 0, 0);
+
+        while (src_len >= 64) {
+            __m128i abcd_save = abcd;
+            __m128i e0_save   = e0;
+            __m128i e[2]      = { e0, e0 };
+            __m128i msg[4];
+
+            UNROLL_4 for (size_t i = 0; i < 4; i++)
+            {
+                msg[i] = _mm_lddqu_si128(
+                    (const __m128i*)(&pSrc[sizeof(__m128i) * i]));
+                msg[i] = _mm_shuffle_epi8(msg[i], shuf_mask);
+            }
+
+            sha1Block(abcd, e, msg, std::make_integer_sequence<int, 20>{});
+
+            // e[0] holds abcd from before the last group
+            e0   = _mm_sha1nexte_epu32(e[0], e0_save);
+            abcd = _mm_add_epi32(abcd, abcd_save);
+
+            pSrc += 64;
+            src_len -= 64;
+        }
+
+        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+        _mm_storeu_si128((__m128i*)pHash, abcd);
+        pHash[4] = _mm_extract_epi32(e0, 3);
+
+        return ALC_ERROR_NONE;
+    }
+
 }} // namespace alcp::digest::shani
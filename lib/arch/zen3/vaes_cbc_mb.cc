@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes {
+
+static inline __m256i
+loadLanes(const Uint8* pLo, const Uint8* pHi)
+{
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pLo));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pHi));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static inline void
+storeLanes(Uint8* pLo, Uint8* pHi, __m256i a)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pLo),
+                     _mm256_castsi256_si128(a));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pHi),
+                     _mm256_extracti128_si256(a, 1));
+}
+
+/*
+ * CBC encryption of cCbcMbLanes independent streams, two streams per ymm.
+ */
+void
+EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    constexpr Uint32 cLanes = cCbcMbLanes;
+    constexpr Uint32 cRegs  = cLanes / 2;
+
+    __m256i      c[cRegs];
+    const Uint8* p_src[cLanes];
+    Uint8*       p_dst[cLanes];
+
+    auto p_iv = reinterpret_cast<const __m256i*>(lanes.m_iv);
+
+    UNROLL_8
+    for (Uint32 i = 0; i < cRegs; i++) {
+        c[i] = _mm256_load_si256(p_iv + i);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        p_src[l] = lanes.m_pSrc[l];
+        p_dst[l] = lanes.m_pDst[l];
+    }
+
+    for (; blocks > 0; blocks--) {
+        auto p_key = reinterpret_cast<const __m256i*>(lanes.m_round_keys[0]);
+
+        UNROLL_8
+        for (Uint32 i = 0; i < cRegs; i++) {
+            __m256i p = loadLanes(p_src[2 * i], p_src[2 * i + 1]);
+            c[i]      = _mm256_xor_si256(c[i], p);
+            c[i]      = _mm256_xor_si256(c[i], _mm256_load_si256(p_key + i));
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            p_key = reinterpret_cast<const __m256i*>(lanes.m_round_keys[r]);
+
+            UNROLL_8
+            for (Uint32 i = 0; i < cRegs; i++) {
+                c[i] =
+                    _mm256_aesenc_epi128(c[i], _mm256_load_si256(p_key + i));
+            }
+        }
+
+        p_key = reinterpret_cast<const __m256i*>(lanes.m_round_keys[nRounds]);
+
+        UNROLL_8
+        for (Uint32 i = 0; i < cRegs; i++) {
+            c[i] =
+                _mm256_aesenclast_epi128(c[i], _mm256_load_si256(p_key + i));
+            storeLanes(p_dst[2 * i], p_dst[2 * i + 1], c[i]);
+        }
+
+        for (Uint32 l = 0; l < cLanes; l++) {
+            p_src[l] += lanes.m_step[l];
+            p_dst[l] += lanes.m_step[l];
+        }
+    }
+
+    auto p_iv_out = reinterpret_cast<__m256i*>(lanes.m_iv);
+
+    UNROLL_8
+    for (Uint32 i = 0; i < cRegs; i++) {
+        _mm256_store_si256(p_iv_out + i, c[i]);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_pSrc[l] = p_src[l];
+        lanes.m_pDst[l] = p_dst[l];
+    }
+}
+
+} // namespace alcp::cipher::vaes
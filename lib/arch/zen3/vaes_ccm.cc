@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_ccm.hh"
+#include "alcp/types.hh"
+#include "alcp/utils/copy.hh"
+
+#include "avx256.hh"
+#include "vaes.hh"
+#include "vaes_avx256_core.hh"
+
+#include <cstring>
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes {
+
+/*
+ * Single block rounds for the CBC-MAC chain. The round keys are the ones
+ * already broadcast for the CTR lanes, only the low 128 bits are used.
+ */
+static inline void
+AesEncryptNoLoad_1x128Rounds10(__m128i& a, const sKeys& keys)
+{
+    const sKeys10Rounds& k = keys.data.keys10;
+
+    a = _mm_xor_si128(a, _mm256_castsi256_si128(k.key_256_0));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_1));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_2));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_3));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_4));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_5));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_6));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_7));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_8));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_9));
+    a = _mm_aesenclast_si128(a, _mm256_castsi256_si128(k.key_256_10));
+}
+
+static inline void
+AesEncryptNoLoad_1x128Rounds12(__m128i& a, const sKeys& keys)
+{
+    const sKeys12Rounds& k = keys.data.keys12;
+
+    a = _mm_xor_si128(a, _mm256_castsi256_si128(k.key_256_0));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_1));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_2));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_3));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_4));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_5));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_6));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_7));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_8));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_9));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_10));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_11));
+    a = _mm_aesenclast_si128(a, _mm256_castsi256_si128(k.key_256_12));
+}
+
+static inline void
+AesEncryptNoLoad_1x128Rounds14(__m128i& a, const sKeys& keys)
+{
+    const sKeys14Rounds& k = keys.data.keys14;
+
+    a = _mm_xor_si128(a, _mm256_castsi256_si128(k.key_256_0));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_1));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_2));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_3));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_4));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_5));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_6));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_7));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_8));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_9));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_10));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_11));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_12));
+    a = _mm_aesenc_si128(a, _mm256_castsi256_si128(k.key_256_13));
+    a = _mm_aesenclast_si128(a, _mm256_castsi256_si128(k.key_256_14));
+}
+
+// CBC-MAC over the two blocks held in a ymm, lower lane first
+template<void AesEncNoLoad_1x128(__m128i& a, const sKeys& keys)>
+static inline void
+CbcMac2(__m128i& cmac, const __m256i& blk, const sKeys& keys)
+{
+    cmac = _mm_xor_si128(cmac, _mm256_castsi256_si128(blk));
+    AesEncNoLoad_1x128(cmac, keys);
+    cmac = _mm_xor_si128(cmac, _mm256_extracti128_si256(blk, 1));
+    AesEncNoLoad_1x128(cmac, keys);
+}
+
+/*
+ * CTR keystream for two blocks per ymm, eight blocks per iteration, while the
+ * serial CBC-MAC chain runs on xmm over the same data. The two have no
+ * dependency on each other so the CTR rounds hide in the MAC latency.
+ *
+ * Counter lanes are kept with the 32 bit big endian counter byte swapped, so
+ * a plain epi32 add increments them. Like aesni::ccm the counter wraps in 32
+ * bits and a trailing partial block does not advance it.
+ */
+template<void AesEncNoLoad_1x128(__m128i& a, const sKeys& keys),
+         void AesEncNoLoad_1x256(__m256i& a, const sKeys& keys),
+         void AesEncNoLoad_4x256(
+             __m256i& a, __m256i& b, __m256i& c, __m256i& d, const sKeys& keys),
+         void alcp_load_key_ymm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_ymm(sKeys& keys),
+         bool cIsEncrypt>
+static inline CCM_ERROR
+CryptCcm(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+{
+    auto p_in_256  = reinterpret_cast<const __m256i*>(pinp);
+    auto p_out_256 = reinterpret_cast<__m256i*>(pout);
+
+    const __m128i swap_ctr_128 =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12);
+    const __m256i swap_ctr = _mm256_broadcastsi128_si256(swap_ctr_128);
+    const __m256i two_x    = _mm256_set_epi32(2, 0, 0, 0, 2, 0, 0, 0);
+
+    __m128i cmac = _mm_load_si128(reinterpret_cast<__m128i*>(ccm_data->cmac));
+    __m128i nonce =
+        _mm_load_si128(reinterpret_cast<__m128i*>(ccm_data->nonce));
+
+    // Lanes hold counter + 0, 1
+    __m256i ctr =
+        _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(nonce), swap_ctr);
+    ctr = _mm256_add_epi32(ctr, _mm256_set_epi32(1, 0, 0, 0, 0, 0, 0, 0));
+
+    __m256i a1, a2, a3, a4;
+    __m256i c1, c2, c3, c4;
+
+    sKeys keys;
+    alcp_load_key_ymm(reinterpret_cast<const __m128i*>(ccm_data->key), keys);
+
+    for (; len >= 128; len -= 128) {
+        c1  = ctr;
+        c2  = _mm256_add_epi32(c1, two_x);
+        c3  = _mm256_add_epi32(c2, two_x);
+        c4  = _mm256_add_epi32(c3, two_x);
+        ctr = _mm256_add_epi32(c4, two_x);
+
+        alcp_shuffle_epi8(c1, c2, c3, c4, swap_ctr, c1, c2, c3, c4);
+
+        AesEncNoLoad_4x256(c1, c2, c3, c4, keys);
+
+        alcp_loadu_4values(p_in_256, a1, a2, a3, a4);
+
+        if constexpr (cIsEncrypt) {
+            // MAC over plaintext
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a1, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a2, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a3, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a4, keys);
+        }
+
+        alcp_xor_4values(c1, c2, c3, c4, a1, a2, a3, a4);
+
+        if constexpr (!cIsEncrypt) {
+            // MAC over recovered plaintext
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a1, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a2, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a3, keys);
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a4, keys);
+        }
+
+        alcp_storeu_4values(p_out_256, a1, a2, a3, a4);
+
+        p_in_256 += 4;
+        p_out_256 += 4;
+    }
+
+    for (; len >= 32; len -= 32) {
+        c1  = _mm256_shuffle_epi8(ctr, swap_ctr);
+        ctr = _mm256_add_epi32(ctr, two_x);
+        AesEncNoLoad_1x256(c1, keys);
+
+        a1 = alcp_loadu(p_in_256);
+        if constexpr (cIsEncrypt) {
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a1, keys);
+        }
+        a1 = _mm256_xor_si256(a1, c1);
+        if constexpr (!cIsEncrypt) {
+            CbcMac2<AesEncNoLoad_1x128>(cmac, a1, keys);
+        }
+        alcp_storeu(p_out_256, a1);
+
+        p_in_256++;
+        p_out_256++;
+    }
+
+    nonce = _mm256_castsi256_si128(ctr);
+    if (len) {
+        // At most one full block and a partial one, staged through a zeroed
+        // buffer so the CBC-MAC sees the zero padding it needs.
+        alignas(32) Uint8 buf[32] = {};
+
+        utils::CopyBytes(buf, reinterpret_cast<const Uint8*>(p_in_256), len);
+        a1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(buf));
+
+        c1 = _mm256_shuffle_epi8(ctr, swap_ctr);
+        AesEncNoLoad_1x256(c1, keys);
+        c1 = _mm256_xor_si256(a1, c1);
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(buf), c1);
+        utils::CopyBytes(reinterpret_cast<Uint8*>(p_out_256), buf, len);
+        if constexpr (!cIsEncrypt) {
+            memset(buf + len, 0, sizeof(buf) - len);
+            a1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(buf));
+        }
+
+        cmac = _mm_xor_si128(cmac, _mm256_castsi256_si128(a1));
+        AesEncNoLoad_1x128(cmac, keys);
+        if (len > 16) {
+            cmac = _mm_xor_si128(cmac, _mm256_extracti128_si256(a1, 1));
+            AesEncNoLoad_1x128(cmac, keys);
+        }
+        memset(buf, 0, sizeof(buf));
+
+        // Only the full blocks consume a counter
+        nonce = _mm_add_epi32(
+            nonce, _mm_set_epi32(static_cast<int>(len / 16), 0, 0, 0));
+    }
+    nonce = _mm_shuffle_epi8(nonce, swap_ctr_128);
+
+    // Copy the current state of cmac and nonce back to memory.
+    _mm_store_si128(reinterpret_cast<__m128i*>(ccm_data->cmac), cmac);
+    _mm_store_si128(reinterpret_cast<__m128i*>(ccm_data->nonce), nonce);
+
+    alcp_clear_keys_ymm(keys);
+    return CCM_ERROR::NO_ERROR;
+}
+
+namespace ccm {
+
+    CCM_ERROR
+    Encrypt(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+    {
+        switch (ccm_data->rounds) {
+            case 10:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds10,
+                                AesEncryptNoLoad_1x256Rounds10,
+                                AesEncryptNoLoad_4x256Rounds10,
+                                alcp_load_key_ymm_10rounds,
+                                alcp_clear_keys_ymm_10rounds,
+                                true>(ccm_data, pinp, pout, len);
+            case 12:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds12,
+                                AesEncryptNoLoad_1x256Rounds12,
+                                AesEncryptNoLoad_4x256Rounds12,
+                                alcp_load_key_ymm_12rounds,
+                                alcp_clear_keys_ymm_12rounds,
+                                true>(ccm_data, pinp, pout, len);
+            default:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds14,
+                                AesEncryptNoLoad_1x256Rounds14,
+                                AesEncryptNoLoad_4x256Rounds14,
+                                alcp_load_key_ymm_14rounds,
+                                alcp_clear_keys_ymm_14rounds,
+                                true>(ccm_data, pinp, pout, len);
+        }
+    }
+
+    CCM_ERROR
+    Decrypt(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+    {
+        switch (ccm_data->rounds) {
+            case 10:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds10,
+                                AesEncryptNoLoad_1x256Rounds10,
+                                AesEncryptNoLoad_4x256Rounds10,
+                                alcp_load_key_ymm_10rounds,
+                                alcp_clear_keys_ymm_10rounds,
+                                false>(ccm_data, pinp, pout, len);
+            case 12:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds12,
+                                AesEncryptNoLoad_1x256Rounds12,
+                                AesEncryptNoLoad_4x256Rounds12,
+                                alcp_load_key_ymm_12rounds,
+                                alcp_clear_keys_ymm_12rounds,
+                                false>(ccm_data, pinp, pout, len);
+            default:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds14,
+                                AesEncryptNoLoad_1x256Rounds14,
+                                AesEncryptNoLoad_4x256Rounds14,
+                                alcp_load_key_ymm_14rounds,
+                                alcp_clear_keys_ymm_14rounds,
+                                false>(ccm_data, pinp, pout, len);
+        }
+    }
+
+} // namespace ccm
+
+} // namespace alcp::cipher::vaes
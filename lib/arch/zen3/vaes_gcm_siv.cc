@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstring>
+#include <immintrin.h>
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_gcm_siv.hh"
+#include "alcp/cipher/gmul.hh"
+#include "alcp/utils/copy.hh"
+#include "avx256.hh"
+#include "avx256_gmul.hh"
+
+#include "vaes.hh"
+#include "vaes_avx256_core.hh"
+
+#include "alcp/types.hh"
+
+namespace alcp::cipher::vaes {
+
+// Lanes hold H^top, H^(top-1), lowest lane first
+static inline __m256i
+loadHashPowers(const __m128i pHtable[], int top)
+{
+    return _mm256_set_m128i(pHtable[top - 2], pHtable[top - 1]);
+}
+
+/*
+ * Reduce the Karatsuba components of both lanes into the POLYVAL state, kept
+ * in the lowest lane.
+ */
+static inline void
+polyvalReduce(__m256i&      z0,
+              __m256i&      z1,
+              __m256i&      z2,
+              __m256i&      state,
+              const __m256i const_factor)
+{
+    __m128i z0_or_low  = amd256_horizontal_sum128(z0);
+    __m128i z2_or_high = amd256_horizontal_sum128(z2);
+    __m128i z1_128     = amd256_horizontal_sum128(z1);
+
+    aesni::computeKaratsubaMul(z0_or_low, z1_128, z2_or_high);
+    __m256i z2z0 = _mm256_set_m128i(z2_or_high, z0_or_low);
+    montgomeryReduction(z2z0, state, const_factor);
+}
+
+template<void AesEncNoLoad_1x256(__m256i& a, const sKeys& keys),
+         void AesEncNoLoad_4x256(
+             __m256i& a, __m256i& b, __m256i& c, __m256i& d, const sKeys& keys),
+         void alcp_load_key_ymm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_ymm(sKeys& keys)>
+static inline void
+CryptCtr32(const Uint8    pIn[],
+           Uint8          pOut[],
+           Uint64         len,
+           const __m128i* pkey128,
+           const Uint8    counter[])
+{
+    auto p_in_256  = reinterpret_cast<const __m256i*>(pIn);
+    auto p_out_256 = reinterpret_cast<__m256i*>(pOut);
+
+    // little endian 32 bit counter in the first word of each lane
+    const __m256i two_x   = _mm256_setr_epi32(2, 0, 0, 0, 2, 0, 0, 0);
+    const __m256i four_x  = _mm256_add_epi32(two_x, two_x);
+    const __m256i six_x   = _mm256_add_epi32(four_x, two_x);
+    const __m256i eight_x = _mm256_add_epi32(four_x, four_x);
+
+    __m256i c1 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(counter)));
+    c1 = _mm256_add_epi32(c1, _mm256_setr_epi32(0, 0, 0, 0, 1, 0, 0, 0));
+
+    __m256i a1, a2, a3, a4;
+    __m256i b1, b2, b3, b4;
+
+    sKeys keys{};
+    alcp_load_key_ymm(pkey128, keys);
+
+    for (; len >= 128; len -= 128) {
+        b1 = c1;
+        b2 = _mm256_add_epi32(c1, two_x);
+        b3 = _mm256_add_epi32(c1, four_x);
+        b4 = _mm256_add_epi32(c1, six_x);
+
+        AesEncNoLoad_4x256(b1, b2, b3, b4, keys);
+
+        a1 = _mm256_loadu_si256(p_in_256);
+        a2 = _mm256_loadu_si256(p_in_256 + 1);
+        a3 = _mm256_loadu_si256(p_in_256 + 2);
+        a4 = _mm256_loadu_si256(p_in_256 + 3);
+
+        _mm256_storeu_si256(p_out_256, _mm256_xor_si256(a1, b1));
+        _mm256_storeu_si256(p_out_256 + 1, _mm256_xor_si256(a2, b2));
+        _mm256_storeu_si256(p_out_256 + 2, _mm256_xor_si256(a3, b3));
+        _mm256_storeu_si256(p_out_256 + 3, _mm256_xor_si256(a4, b4));
+
+        c1 = _mm256_add_epi32(c1, eight_x);
+        p_in_256 += 4;
+        p_out_256 += 4;
+    }
+
+    for (; len >= 32; len -= 32) {
+        b1 = c1;
+        AesEncNoLoad_1x256(b1, keys);
+
+        a1 = _mm256_loadu_si256(p_in_256);
+        _mm256_storeu_si256(p_out_256, _mm256_xor_si256(a1, b1));
+
+        c1 = _mm256_add_epi32(c1, two_x);
+        p_in_256++;
+        p_out_256++;
+    }
+
+    if (len) {
+        alignas(32) Uint8 buf[32] = {};
+
+        b1 = c1;
+        AesEncNoLoad_1x256(b1, keys);
+
+        utils::CopyBytes(buf, reinterpret_cast<const Uint8*>(p_in_256), len);
+        a1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(buf));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(buf),
+                           _mm256_xor_si256(a1, b1));
+        utils::CopyBytes(reinterpret_cast<Uint8*>(p_out_256), buf, len);
+        memset(buf, 0, sizeof(buf));
+    }
+
+    alcp_clear_keys_ymm(keys);
+}
+
+namespace gcmsiv {
+
+    void Polyval(const Uint8   pIn[],
+                 Uint64        len,
+                 const __m128i pHtable[],
+                 __m128i&      state)
+    {
+        const __m256i const_factor = _mm256_set_epi64x(
+            0xC200000000000000, 0x1, 0xC200000000000000, 0x1);
+
+        auto    p_in_256  = reinterpret_cast<const __m256i*>(pIn);
+        __m256i state_256 = _mm256_castsi128_si256(state);
+        __m256i z0, z1, z2;
+        __m256i a, b, c, d;
+
+        // H^2:H^1 serve the last two blocks of every step
+        __m256i h21 = loadHashPowers(pHtable, 2);
+
+        if (len >= 128) {
+            __m256i h87 = loadHashPowers(pHtable, 8);
+            __m256i h65 = loadHashPowers(pHtable, 6);
+            __m256i h43 = loadHashPowers(pHtable, 4);
+
+            // 8 blocks aggregated in one reduction
+            for (; len >= 128; len -= 128) {
+                a = _mm256_loadu_si256(p_in_256);
+                b = _mm256_loadu_si256(p_in_256 + 1);
+                c = _mm256_loadu_si256(p_in_256 + 2);
+                d = _mm256_loadu_si256(p_in_256 + 3);
+
+                amd256xorLast128bit(a, state_256);
+
+                computeKaratsubaComponents(h87, a, z0, z1, z2);
+                computeKaratsubaComponentsAccumulate(h65, b, z0, z1, z2);
+                computeKaratsubaComponentsAccumulate(h43, c, z0, z1, z2);
+                computeKaratsubaComponentsAccumulate(h21, d, z0, z1, z2);
+
+                polyvalReduce(z0, z1, z2, state_256, const_factor);
+                p_in_256 += 4;
+            }
+        }
+
+        for (; len >= 32; len -= 32) {
+            a = _mm256_loadu_si256(p_in_256);
+            amd256xorLast128bit(a, state_256);
+
+            computeKaratsubaComponents(h21, a, z0, z1, z2);
+            polyvalReduce(z0, z1, z2, state_256, const_factor);
+            p_in_256++;
+        }
+
+        if (len) {
+            // zero padded tail of 1 or 2 blocks, a single block only takes H
+            alignas(32) Uint8 buf[32] = {};
+            __m256i           h_tail    = h21;
+            if (len <= 16) {
+                h_tail = _mm256_set_m128i(_mm_setzero_si128(), pHtable[0]);
+            }
+
+            utils::CopyBytes(
+                buf, reinterpret_cast<const Uint8*>(p_in_256), len);
+            a = _mm256_load_si256(reinterpret_cast<const __m256i*>(buf));
+            amd256xorLast128bit(a, state_256);
+
+            computeKaratsubaComponents(h_tail, a, z0, z1, z2);
+            polyvalReduce(z0, z1, z2, state_256, const_factor);
+        }
+
+        state = _mm256_castsi256_si128(state_256);
+    }
+
+    void CryptCtr32(const Uint8 pIn[],
+                    Uint8       pOut[],
+                    Uint64      len,
+                    const Uint8 pKey[],
+                    int         nRounds,
+                    const Uint8 counter[])
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // GCM-SIV is only defined for 128 and 256 bit keys
+        if (nRounds == 10) {
+            vaes::CryptCtr32<AesEncryptNoLoad_1x256Rounds10,
+                             AesEncryptNoLoad_4x256Rounds10,
+                             alcp_load_key_ymm_10rounds,
+                             alcp_clear_keys_ymm_10rounds>(
+                pIn, pOut, len, pkey128, counter);
+        } else {
+            vaes::CryptCtr32<AesEncryptNoLoad_1x256Rounds14,
+                             AesEncryptNoLoad_4x256Rounds14,
+                             alcp_load_key_ymm_14rounds,
+                             alcp_clear_keys_ymm_14rounds>(
+                pIn, pOut, len, pkey128, counter);
+        }
+    }
+
+} // namespace gcmsiv
+
+} // namespace alcp::cipher::vaes
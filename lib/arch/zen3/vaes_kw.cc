@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/aes_kw.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes {
+
+static inline __m256i
+loadR(Uint8* const pR[2])
+{
+    __m256i r = _mm256_castsi128_si256(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[0])));
+    return _mm256_inserti128_si256(
+        r, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[1])), 1);
+}
+
+// high 64 bits of every 128-bit lane of b to R[i]
+static inline void
+storeR(Uint8* const pR[2], __m256i b)
+{
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[0]),
+                  _mm_castsi128_pd(_mm256_castsi256_si128(b)));
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[1]),
+                  _mm_castsi128_pd(_mm256_extracti128_si256(b, 1)));
+}
+
+/*
+ * Key wrap of cKwMbLanes independent keys, two keys per ymm.
+ */
+template<bool cWrap>
+static inline void
+kwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pKey, int nRounds)
+{
+    constexpr Uint32 cLanes = cKwMbLanes;
+    constexpr Uint32 cRegs  = cLanes / 2;
+
+    // t is xored big endian into A
+    const __m256i swap = _mm256_broadcastsi128_si256(_mm_set_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 0, 1, 2, 3, 4, 5, 6, 7));
+    const __m256i one  = _mm256_set_epi64x(0, 1, 0, 1);
+
+    __m256i a[cRegs], t[cRegs], b[cRegs];
+    Uint8*  p_r[cLanes];
+
+    auto p_key = reinterpret_cast<const __m128i*>(pKey);
+    auto p_a   = reinterpret_cast<__m256i*>(lanes.m_a);
+    auto p_t   = reinterpret_cast<__m256i*>(lanes.m_t);
+
+    UNROLL_8
+    for (Uint32 i = 0; i < cRegs; i++) {
+        a[i] = _mm256_load_si256(p_a + i);
+        t[i] = _mm256_load_si256(p_t + i);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        p_r[l] = lanes.m_pR[l];
+    }
+
+    for (; steps > 0; steps--) {
+        __m256i k = _mm256_broadcastsi128_si256(_mm_load_si128(p_key));
+
+        UNROLL_8
+        for (Uint32 i = 0; i < cRegs; i++) {
+            __m256i r = loadR(&p_r[2 * i]);
+            if constexpr (!cWrap) {
+                a[i] = _mm256_xor_si256(a[i], _mm256_shuffle_epi8(t[i], swap));
+                t[i] = _mm256_sub_epi64(t[i], one);
+            }
+            b[i] = _mm256_xor_si256(_mm256_unpacklo_epi64(a[i], r), k);
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            k = _mm256_broadcastsi128_si256(_mm_load_si128(p_key + r));
+
+            UNROLL_8
+            for (Uint32 i = 0; i < cRegs; i++) {
+                if constexpr (cWrap) {
+                    b[i] = _mm256_aesenc_epi128(b[i], k);
+                } else {
+                    b[i] = _mm256_aesdec_epi128(b[i], k);
+                }
+            }
+        }
+
+        k = _mm256_broadcastsi128_si256(_mm_load_si128(p_key + nRounds));
+
+        UNROLL_8
+        for (Uint32 i = 0; i < cRegs; i++) {
+            if constexpr (cWrap) {
+                b[i] = _mm256_aesenclast_epi128(b[i], k);
+                a[i] = _mm256_xor_si256(b[i], _mm256_shuffle_epi8(t[i], swap));
+                t[i] = _mm256_add_epi64(t[i], one);
+            } else {
+                b[i] = _mm256_aesdeclast_epi128(b[i], k);
+                a[i] = b[i];
+            }
+            storeR(&p_r[2 * i], b[i]);
+        }
+
+        for (Uint32 l = 0; l < cLanes; l++) {
+            if constexpr (cWrap) {
+                p_r[l] = (p_r[l] == lanes.m_pLast[l]) ? lanes.m_pFirst[l]
+                                                      : p_r[l] + 8;
+            } else {
+                p_r[l] = (p_r[l] == lanes.m_pFirst[l]) ? lanes.m_pLast[l]
+                                                       : p_r[l] - 8;
+            }
+        }
+    }
+
+    UNROLL_8
+    for (Uint32 i = 0; i < cRegs; i++) {
+        _mm256_store_si256(p_a + i, a[i]);
+        _mm256_store_si256(p_t + i, t[i]);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_pR[l] = p_r[l];
+    }
+}
+
+void
+WrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pEncKey, int nRounds)
+{
+    kwMb<true>(lanes, steps, pEncKey, nRounds);
+}
+
+void
+UnwrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pDecKey, int nRounds)
+{
+    kwMb<false>(lanes, steps, pDecKey, nRounds);
+}
+
+} // namespace alcp::cipher::vaes
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_ocb.hh"
+#include "alcp/types.hh"
+
+#include "avx256.hh"
+#include "vaes.hh"
+#include "vaes_avx256_core.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes {
+
+// blocks per step, four ymm of two blocks
+constexpr Uint64 cOcbBatch = 8;
+
+static inline Uint64
+ntz(Uint64 n)
+{
+    return __builtin_ctzll(n);
+}
+
+template<OcbOp cOp>
+static inline void
+aesniBlocks(const Uint8      pIn[],
+            Uint8            pOut[],
+            Uint64           blocks,
+            const Uint8      pKey[],
+            int              nRounds,
+            const OcbLTable& table,
+            OcbPass&         pass)
+{
+    if constexpr (cOp == OcbOp::eEncrypt) {
+        aesni::ocb::Encrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+    } else if constexpr (cOp == OcbOp::eDecrypt) {
+        aesni::ocb::Decrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+    } else {
+        aesni::ocb::Hash(pIn, blocks, pKey, nRounds, table, pass);
+    }
+}
+
+/*
+ * 8 blocks per step once the block number is a multiple of 8, the offsets are
+ * the broadcast offset xored with gray[1..7] and, for the last block,
+ * L_ntz(n). Leading blocks up to that alignment and the trailing partial step
+ * run on AES-NI.
+ */
+template<void AesNoLoad_4x256(
+             __m256i& a, __m256i& b, __m256i& c, __m256i& d, const sKeys& keys),
+         void alcp_load_key_ymm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_ymm(sKeys& keys),
+         OcbOp cOp>
+static inline void
+OcbBlocks(const Uint8      pIn[],
+          Uint8            pOut[],
+          Uint64           blocks,
+          const Uint8      pKey[],
+          int              nRounds,
+          const OcbLTable& table,
+          OcbPass&         pass)
+{
+    Uint64 lead = (cOcbBatch - pass.blocks % cOcbBatch) % cOcbBatch;
+    lead        = lead < blocks ? lead : blocks;
+    if (lead) {
+        aesniBlocks<cOp>(pIn, pOut, lead, pKey, nRounds, table, pass);
+        blocks -= lead;
+        pIn += lead * Rijndael::cBlockSize;
+        if constexpr (cOp != OcbOp::eHash) {
+            pOut += lead * Rijndael::cBlockSize;
+        }
+    }
+
+    if (blocks >= cOcbBatch) {
+        auto p_in_256  = reinterpret_cast<const __m256i*>(pIn);
+        auto p_out_256 = reinterpret_cast<__m256i*>(pOut);
+        auto pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+        Uint64  idx    = pass.blocks;
+        __m128i offset = pass.offset;
+        __m256i sum    = _mm256_setzero_si256();
+
+        const __m256i g1 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(&table.gray[1]));
+        const __m256i g2 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(&table.gray[3]));
+        const __m256i g3 = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(&table.gray[5]));
+        const __m256i g4 = _mm256_broadcastsi128_si256(table.gray[7]);
+
+        __m256i a1, a2, a3, a4;
+        __m256i o1, o2, o3, o4;
+
+        sKeys keys{};
+        alcp_load_key_ymm(pkey128, keys);
+
+        for (; blocks >= cOcbBatch; blocks -= cOcbBatch) {
+            __m256i off = _mm256_broadcastsi128_si256(offset);
+            o1          = _mm256_xor_si256(off, g1);
+            o2          = _mm256_xor_si256(off, g2);
+            o3          = _mm256_xor_si256(off, g3);
+            o4          = _mm256_xor_si256(
+                _mm256_xor_si256(off, g4),
+                _mm256_inserti128_si256(
+                    _mm256_setzero_si256(), table.l[ntz(idx + cOcbBatch)], 1));
+
+            alcp_loadu_4values(p_in_256, a1, a2, a3, a4);
+            if constexpr (cOp == OcbOp::eEncrypt) {
+                sum = _mm256_xor_si256(sum, _mm256_xor_si256(a1, a2));
+                sum = _mm256_xor_si256(sum, _mm256_xor_si256(a3, a4));
+            }
+            alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+
+            AesNoLoad_4x256(a1, a2, a3, a4, keys);
+
+            if constexpr (cOp == OcbOp::eHash) {
+                sum = _mm256_xor_si256(sum, _mm256_xor_si256(a1, a2));
+                sum = _mm256_xor_si256(sum, _mm256_xor_si256(a3, a4));
+            } else {
+                alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+                alcp_storeu_4values(p_out_256, a1, a2, a3, a4);
+                if constexpr (cOp == OcbOp::eDecrypt) {
+                    sum = _mm256_xor_si256(sum, _mm256_xor_si256(a1, a2));
+                    sum = _mm256_xor_si256(sum, _mm256_xor_si256(a3, a4));
+                }
+                p_out_256 += 4;
+            }
+
+            offset = _mm256_extracti128_si256(o4, 1);
+            idx += cOcbBatch;
+            p_in_256 += 4;
+        }
+
+        alcp_clear_keys_ymm(keys);
+
+        pass.offset = offset;
+        pass.sum    = _mm_xor_si128(
+            pass.sum,
+            _mm_xor_si128(_mm256_castsi256_si128(sum),
+                          _mm256_extracti128_si256(sum, 1)));
+        pass.blocks = idx;
+
+        pIn = reinterpret_cast<const Uint8*>(p_in_256);
+        if constexpr (cOp != OcbOp::eHash) {
+            pOut = reinterpret_cast<Uint8*>(p_out_256);
+        }
+    }
+
+    if (blocks) {
+        aesniBlocks<cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+}
+
+template<OcbOp cOp>
+static inline void
+OcbCrypt(const Uint8      pIn[],
+         Uint8            pOut[],
+         Uint64           blocks,
+         const Uint8      pKey[],
+         int              nRounds,
+         const OcbLTable& table,
+         OcbPass&         pass)
+{
+    constexpr bool cDec = (cOp == OcbOp::eDecrypt);
+
+    switch (nRounds) {
+        case 10:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x256Rounds10
+                           : AesEncryptNoLoad_4x256Rounds10,
+                      alcp_load_key_ymm_10rounds,
+                      alcp_clear_keys_ymm_10rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+        case 12:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x256Rounds12
+                           : AesEncryptNoLoad_4x256Rounds12,
+                      alcp_load_key_ymm_12rounds,
+                      alcp_clear_keys_ymm_12rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+        default:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x256Rounds14
+                           : AesEncryptNoLoad_4x256Rounds14,
+                      alcp_load_key_ymm_14rounds,
+                      alcp_clear_keys_ymm_14rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+    }
+}
+
+namespace ocb {
+
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eEncrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eDecrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eHash>(
+            pIn, nullptr, blocks, pKey, nRounds, table, pass);
+    }
+
+} // namespace ocb
+
+} // namespace alcp::cipher::vaes
@@ -347,13 +347,20 @@ EncryptXtsKernel(const Uint8* pSrc,
     }
 
     if (extra_bytes_in_message_block) {
-        utils::CopyBytes(p_dest8 + (16 * blocks),
-                         p_dest8 + (16 * (blocks - 1)),
-                         extra_bytes_in_message_block);
         __m256i stealed_text, tweak_1;
         auto    p_stealed_text8 = reinterpret_cast<Uint8*>(&stealed_text);
         auto    p_tweak_8       = reinterpret_cast<Uint8*>(&tweak_1);
 
+        // read the partial source block before it is overwritten, the source
+        // and the destination may be the same buffer
+        utils::CopyBytes(p_stealed_text8,
+                         p_src8 + (16 * blocks),
+                         extra_bytes_in_message_block);
+
+        utils::CopyBytes(p_dest8 + (16 * blocks),
+                         p_dest8 + (16 * (blocks - 1)),
+                         extra_bytes_in_message_block);
+
         utils::CopyBytes(p_tweak_8, p_lastTweak8, 16);
 
         utils::CopyBytes(p_stealed_text8 + extra_bytes_in_message_block,
@@ -361,10 +368,6 @@ EncryptXtsKernel(const Uint8* pSrc,
                              + (extra_bytes_in_message_block),
                          (16 - extra_bytes_in_message_block));
 
-        utils::CopyBytes(p_stealed_text8,
-                         p_src8 + (16 * blocks),
-                         extra_bytes_in_message_block);
-
         stealed_text = (tweak_1 ^ stealed_text);
         AesEnc_1x256(&stealed_text, p_key128, nRounds);
         stealed_text = (tweak_1 ^ stealed_text);
@@ -727,14 +730,21 @@ DecryptXtsKernel(const Uint8* pSrc,
     }
 
     if (extra_bytes_in_message_block) {
+        __m256i stealed_text, tweak_1;
+        Uint8*  p_stealed_text = reinterpret_cast<Uint8*>(&stealed_text);
+        Uint8*  p_tweak_1      = reinterpret_cast<Uint8*>(&tweak_1);
+
+        // read the partial source block before it is overwritten, the source
+        // and the destination may be the same buffer
+        utils::CopyBytes(p_stealed_text,
+                         p_src8 + ((16 * (blocks))),
+                         (extra_bytes_in_message_block));
+
         /* FIXME: there is an array out-of-bounds reported by gcc14.1 in this
          * memcpy operation. Fix TBD */
         utils::CopyBytes(p_dest8 + (16 * blocks),
                          p_dest8 + (16 * (blocks - 1)),
                          extra_bytes_in_message_block);
-        __m256i stealed_text, tweak_1;
-        Uint8*  p_stealed_text = reinterpret_cast<Uint8*>(&stealed_text);
-        Uint8*  p_tweak_1      = reinterpret_cast<Uint8*>(&tweak_1);
 
         utils::CopyBytes(p_tweak_1, p_lastTweak8 + ((16 * (blocks))), (16));
 
@@ -743,10 +753,6 @@ DecryptXtsKernel(const Uint8* pSrc,
             p_dest8 + (extra_bytes_in_message_block + (16 * (blocks - 1))),
             (16 - extra_bytes_in_message_block));
 
-        utils::CopyBytes(p_stealed_text,
-                         p_src8 + ((16 * (blocks))),
-                         (extra_bytes_in_message_block));
-
         stealed_text = (tweak_1 ^ stealed_text);
         AesDec_1x256(&stealed_text, p_key128, nRounds);
         stealed_text = (tweak_1 ^ stealed_text);
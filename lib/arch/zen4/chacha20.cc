@@ -27,6 +27,7 @@
  */
 
 #include "alcp/cipher/chacha20.hh"
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
 #include "alcp/cipher/chacha20_zen4.hh"
 
 #include <cstring>
@@ -662,4 +663,181 @@ ProcessInput(const Uint8  key[],
     return ALC_ERROR_NONE;
 }
 
+// 4x4 transpose of the words in every 128 bit lane
+inline void
+Transpose4x4Lanes(__m512i& a, __m512i& b, __m512i& c, __m512i& d)
+{
+    __m512i t0 = _mm512_unpacklo_epi32(a, b);
+    __m512i t1 = _mm512_unpackhi_epi32(a, b);
+    __m512i t2 = _mm512_unpacklo_epi32(c, d);
+    __m512i t3 = _mm512_unpackhi_epi32(c, d);
+    a          = _mm512_unpacklo_epi64(t0, t2);
+    b          = _mm512_unpackhi_epi64(t0, t2);
+    c          = _mm512_unpacklo_epi64(t1, t3);
+    d          = _mm512_unpackhi_epi64(t1, t3);
+}
+
+// 4x4 transpose of the 128 bit lanes, lane j of a, b, c and d become a, b,
+// c and d of the j-th result
+inline void
+Transpose128Lanes(__m512i& a, __m512i& b, __m512i& c, __m512i& d)
+{
+    __m512i t0 = _mm512_shuffle_i32x4(a, b, 0x44);
+    __m512i t1 = _mm512_shuffle_i32x4(a, b, 0xee);
+    __m512i t2 = _mm512_shuffle_i32x4(c, d, 0x44);
+    __m512i t3 = _mm512_shuffle_i32x4(c, d, 0xee);
+    a          = _mm512_shuffle_i32x4(t0, t2, 0x88);
+    b          = _mm512_shuffle_i32x4(t0, t2, 0xdd);
+    c          = _mm512_shuffle_i32x4(t1, t3, 0x88);
+    d          = _mm512_shuffle_i32x4(t1, t3, 0xdd);
+}
+
+// one block per lane, every lane with its own key, counter and nonce
+void
+ChaCha20Mb(ChaChaMbLanes& lanes, Uint64 blocks)
+{
+    constexpr Uint64 cLanes = cChaChaPolyMbLanes;
+
+    __m512i s[16];
+    SetChacha2016BlockParallelConstants(s[0], s[1], s[2], s[3]);
+    for (int i = 0; i < 8; i++) {
+        s[4 + i] = _mm512_loadu_si512(lanes.m_key[i]);
+    }
+    s[12] = _mm512_loadu_si512(lanes.m_counter);
+    for (int i = 0; i < 3; i++) {
+        s[13 + i] = _mm512_loadu_si512(lanes.m_nonce[i]);
+    }
+
+    const Uint8* p_in[cLanes];
+    Uint8*       p_out[cLanes];
+    for (Uint64 l = 0; l < cLanes; l++) {
+        p_in[l]  = lanes.m_pSrc[l];
+        p_out[l] = lanes.m_pDst[l];
+    }
+
+    for (Uint64 b = 0; b < blocks; b++) {
+        __m512i x[16];
+        for (int i = 0; i < 16; i++) {
+            x[i] = s[i];
+        }
+        for (int i = 0; i < 10; i++) {
+            RoundFunction(x[0], x[4], x[8], x[12]);
+            RoundFunction(x[1], x[5], x[9], x[13]);
+            RoundFunction(x[2], x[6], x[10], x[14]);
+            RoundFunction(x[3], x[7], x[11], x[15]);
+
+            RoundFunction(x[0], x[5], x[10], x[15]);
+            RoundFunction(x[1], x[6], x[11], x[12]);
+            RoundFunction(x[2], x[7], x[8], x[13]);
+            RoundFunction(x[3], x[4], x[9], x[14]);
+        }
+        for (int i = 0; i < 16; i++) {
+            x[i] = _mm512_add_epi32(x[i], s[i]);
+        }
+
+        // after the word transposes 128 bit lane j of x[4w + k] holds words
+        // 4w..4w+3 of block 4j + k, the lane transpose of x[k], x[4 + k],
+        // x[8 + k] and x[12 + k] then gives the whole blocks k, 4 + k, 8 + k
+        // and 12 + k
+        for (int w = 0; w < 16; w += 4) {
+            Transpose4x4Lanes(x[w], x[w + 1], x[w + 2], x[w + 3]);
+        }
+        for (int k = 0; k < 4; k++) {
+            Transpose128Lanes(x[k], x[4 + k], x[8 + k], x[12 + k]);
+            for (int j = 0; j < 4; j++) {
+                Uint64  l  = 4 * j + k;
+                __m512i in = _mm512_loadu_si512(p_in[l]);
+                _mm512_storeu_si512(p_out[l],
+                                    _mm512_xor_si512(in, x[4 * j + k]));
+            }
+        }
+
+        s[12] = _mm512_add_epi32(s[12], _mm512_set1_epi32(1));
+        for (Uint64 l = 0; l < cLanes; l++) {
+            p_in[l] += lanes.m_step[l];
+            p_out[l] += lanes.m_step[l];
+        }
+    }
+
+    _mm512_storeu_si512(lanes.m_counter, s[12]);
+    for (Uint64 l = 0; l < cLanes; l++) {
+        lanes.m_pSrc[l] = p_in[l];
+        lanes.m_pDst[l] = p_out[l];
+    }
+}
+
+// HChaCha20 of 16 nonces, lane i takes the nonce at pNonces + 16 * i
+inline void
+HChaCha20Blocks16(const Uint8 key[], const Uint8* pNonces, Uint8* pSubkeys)
+{
+    __m512i s[16];
+
+    SetChacha2016BlockParallelConstants(s[0], s[1], s[2], s[3]);
+    SetChacha2016BlockParallelKey(
+        key, s[4], s[5], s[6], s[7], s[8], s[9], s[10], s[11]);
+
+    // s[12 + m] holds nonces 4m..4m+3, after the lane transpose lane j of
+    // s[12 + r] is nonce 4j + r and the word transpose puts word w of nonce
+    // i in lane i of s[12 + w]
+    auto p_nonce = reinterpret_cast<const __m512i*>(pNonces);
+    for (int m = 0; m < 4; m++) {
+        s[12 + m] = _mm512_loadu_si512(p_nonce + m);
+    }
+    Transpose128Lanes(s[12], s[13], s[14], s[15]);
+    Transpose4x4Lanes(s[12], s[13], s[14], s[15]);
+
+    for (int i = 0; i < 10; i++) {
+        RoundFunction(s[0], s[4], s[8], s[12]);
+        RoundFunction(s[1], s[5], s[9], s[13]);
+        RoundFunction(s[2], s[6], s[10], s[14]);
+        RoundFunction(s[3], s[7], s[11], s[15]);
+
+        RoundFunction(s[0], s[5], s[10], s[15]);
+        RoundFunction(s[1], s[6], s[11], s[12]);
+        RoundFunction(s[2], s[7], s[8], s[13]);
+        RoundFunction(s[3], s[4], s[9], s[14]);
+    }
+
+    // lane j of s[r] (s[12 + r]) is now the first (second) half of subkey
+    // 4j + r, pair the halves up and store two subkeys per 256 bits
+    Transpose4x4Lanes(s[0], s[1], s[2], s[3]);
+    Transpose4x4Lanes(s[12], s[13], s[14], s[15]);
+    auto p_out = reinterpret_cast<__m256i*>(pSubkeys);
+    for (int r = 0; r < 4; r++) {
+        __m512i lo = _mm512_shuffle_i32x4(s[r], s[12 + r], 0x44);
+        __m512i hi = _mm512_shuffle_i32x4(s[r], s[12 + r], 0xee);
+        lo         = _mm512_shuffle_i32x4(lo, lo, 0xd8);
+        hi         = _mm512_shuffle_i32x4(hi, hi, 0xd8);
+        _mm256_storeu_si256(p_out + r, _mm512_castsi512_si256(lo));
+        _mm256_storeu_si256(p_out + 4 + r, _mm512_extracti64x4_epi64(lo, 1));
+        _mm256_storeu_si256(p_out + 8 + r, _mm512_castsi512_si256(hi));
+        _mm256_storeu_si256(p_out + 12 + r, _mm512_extracti64x4_epi64(hi, 1));
+    }
+}
+
+void
+HChaCha20(const Uint8 key[],
+          const Uint8 nonces[],
+          Uint64      numNonces,
+          Uint8       subkeys[])
+{
+    constexpr Uint64 cLanes = 16;
+
+    for (; numNonces >= cLanes; numNonces -= cLanes) {
+        HChaCha20Blocks16(key, nonces, subkeys);
+        nonces += cLanes * 16;
+        subkeys += cLanes * 32;
+    }
+
+    // unused lanes run on zero nonces and are dropped
+    if (numNonces != 0) {
+        alignas(64) Uint8 in[cLanes * 16] = {};
+        alignas(64) Uint8 out[cLanes * 32];
+        memcpy(in, nonces, numNonces * 16);
+        HChaCha20Blocks16(key, in, out);
+        memcpy(subkeys, out, numNonces * 32);
+        memset(out, 0, sizeof(out));
+    }
+}
+
 } // namespace alcp::cipher::zen4
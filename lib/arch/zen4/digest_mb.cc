@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/digest/digest_mb.hh"
+#include "alcp/digest/md5_mb_core.hh"
+#include "alcp/digest/sha1_mb_core.hh"
+#include "alcp/digest/sha2_mb_core.hh"
+
+#include <immintrin.h>
+
+namespace alcp::digest::zen4 {
+
+// 16 lanes of 32 bits
+struct DigestVec32x16
+{
+    using T = __m512i;
+
+    static constexpr Uint32 cLanes = 16;
+
+    static inline T load(const Uint32* p) { return _mm512_loadu_si512(p); }
+    static inline void store(Uint32* p, T a) { _mm512_storeu_si512(p, a); }
+
+    static inline T add(T a, T b) { return _mm512_add_epi32(a, b); }
+    static inline T set1(Uint32 a) { return _mm512_set1_epi32(a); }
+    static inline T xor2(T a, T b) { return _mm512_xor_si512(a, b); }
+    static inline T xor3(T a, T b, T c)
+    {
+        return _mm512_ternarylogic_epi32(a, b, c, 0x96);
+    }
+    // (e & f) ^ (~e & g)
+    static inline T ch(T e, T f, T g)
+    {
+        return _mm512_ternarylogic_epi32(e, f, g, 0xca);
+    }
+    // (a & b) ^ (a & c) ^ (b & c)
+    static inline T maj(T a, T b, T c)
+    {
+        return _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+    }
+    // c ^ (b | ~d)
+    static inline T md5I(T b, T c, T d)
+    {
+        return _mm512_ternarylogic_epi32(b, c, d, 0x39);
+    }
+
+    template<int N>
+    static inline T rotr(T a)
+    {
+        return _mm512_ror_epi32(a, N);
+    }
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm512_srli_epi32(a, N);
+    }
+
+    // r[i] holds 16 words of lane i, afterwards word i of all lanes
+    static inline void transpose(T r[16])
+    {
+        T t[16], u[16];
+        for (int i = 0; i < 16; i += 2) {
+            t[i]     = _mm512_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm512_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        // every 128 bit lane of u[i] holds one word of 4 lanes
+        for (int i = 0; i < 16; i += 4) {
+            u[i]     = _mm512_unpacklo_epi64(t[i], t[i + 2]);
+            u[i + 1] = _mm512_unpackhi_epi64(t[i], t[i + 2]);
+            u[i + 2] = _mm512_unpacklo_epi64(t[i + 1], t[i + 3]);
+            u[i + 3] = _mm512_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        // 4x4 transpose of the 128 bit lanes
+        for (int i = 0; i < 4; i++) {
+            T ab_lo = _mm512_shuffle_i32x4(u[i], u[i + 4], 0x44);
+            T ab_hi = _mm512_shuffle_i32x4(u[i], u[i + 4], 0xee);
+            T cd_lo = _mm512_shuffle_i32x4(u[i + 8], u[i + 12], 0x44);
+            T cd_hi = _mm512_shuffle_i32x4(u[i + 8], u[i + 12], 0xee);
+
+            r[i]      = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0x88);
+            r[i + 4]  = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0xdd);
+            r[i + 8]  = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0x88);
+            r[i + 12] = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0xdd);
+        }
+    }
+
+    static inline void loadBlockLe(const Uint8* const p[], T w[16])
+    {
+        for (Uint32 l = 0; l < cLanes; l++) {
+            w[l] = _mm512_loadu_si512(p[l]);
+        }
+        transpose(w);
+    }
+
+    static inline void loadBlockBe(const Uint8* const p[], T w[16])
+    {
+        const T cBswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+        loadBlockLe(p, w);
+        for (int i = 0; i < 16; i++) {
+            w[i] = _mm512_shuffle_epi8(w[i], cBswap);
+        }
+    }
+};
+
+// 8 lanes of 64 bits
+struct DigestVec64x8
+{
+    using T = __m512i;
+
+    static constexpr Uint32 cLanes = 8;
+
+    static inline T load(const Uint64* p) { return _mm512_loadu_si512(p); }
+    static inline void store(Uint64* p, T a) { _mm512_storeu_si512(p, a); }
+
+    static inline T add(T a, T b) { return _mm512_add_epi64(a, b); }
+    static inline T set1(Uint64 a) { return _mm512_set1_epi64(a); }
+    static inline T xor3(T a, T b, T c)
+    {
+        return _mm512_ternarylogic_epi64(a, b, c, 0x96);
+    }
+    // (e & f) ^ (~e & g)
+    static inline T ch(T e, T f, T g)
+    {
+        return _mm512_ternarylogic_epi64(e, f, g, 0xca);
+    }
+    // (a & b) ^ (a & c) ^ (b & c)
+    static inline T maj(T a, T b, T c)
+    {
+        return _mm512_ternarylogic_epi64(a, b, c, 0xe8);
+    }
+
+    template<int N>
+    static inline T rotr(T a)
+    {
+        return _mm512_ror_epi64(a, N);
+    }
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm512_srli_epi64(a, N);
+    }
+
+    // r[i] holds 8 words of lane i, afterwards word i of all lanes
+    static inline void transpose(T r[8])
+    {
+        T t[8];
+        // every 128 bit lane of t[i] holds one word of 2 lanes
+        for (int i = 0; i < 8; i += 2) {
+            t[i]     = _mm512_unpacklo_epi64(r[i], r[i + 1]);
+            t[i + 1] = _mm512_unpackhi_epi64(r[i], r[i + 1]);
+        }
+        // 4x4 transpose of the 128 bit lanes
+        for (int i = 0; i < 2; i++) {
+            T ab_lo = _mm512_shuffle_i64x2(t[i], t[i + 2], 0x44);
+            T ab_hi = _mm512_shuffle_i64x2(t[i], t[i + 2], 0xee);
+            T cd_lo = _mm512_shuffle_i64x2(t[i + 4], t[i + 6], 0x44);
+            T cd_hi = _mm512_shuffle_i64x2(t[i + 4], t[i + 6], 0xee);
+
+            r[i]     = _mm512_shuffle_i64x2(ab_lo, cd_lo, 0x88);
+            r[i + 2] = _mm512_shuffle_i64x2(ab_lo, cd_lo, 0xdd);
+            r[i + 4] = _mm512_shuffle_i64x2(ab_hi, cd_hi, 0x88);
+            r[i + 6] = _mm512_shuffle_i64x2(ab_hi, cd_hi, 0xdd);
+        }
+    }
+
+    static inline void loadBlockBe(const Uint8* const p[], T w[16])
+    {
+        const T cBswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+        for (int half = 0; half < 2; half++) {
+            T* r = w + 8 * half;
+            for (Uint32 l = 0; l < cLanes; l++) {
+                r[l] = _mm512_loadu_si512(p[l] + 64 * half);
+            }
+            transpose(r);
+            for (int i = 0; i < 8; i++) {
+                r[i] = _mm512_shuffle_epi8(r[i], cBswap);
+            }
+        }
+    }
+};
+
+void
+Md5Mb(Md5MbLanes& lanes, Uint64 blocks)
+{
+    md5mb::Blocks<DigestVec32x16>(lanes, blocks);
+}
+
+void
+Sha1Mb(Sha1MbLanes& lanes, Uint64 blocks)
+{
+    sha1mb::Blocks<DigestVec32x16>(lanes, blocks);
+}
+
+void
+Sha256Mb(Sha256MbLanes& lanes, Uint64 blocks)
+{
+    sha2mb::Blocks<DigestVec32x16, sha2mb::Sha256Params>(lanes, blocks);
+}
+
+void
+Sha512Mb(Sha512MbLanes& lanes, Uint64 blocks)
+{
+    sha2mb::Blocks<DigestVec64x8, sha2mb::Sha512Params>(lanes, blocks);
+}
+
+} // namespace alcp::digest::zen4
@@ -45,6 +45,28 @@ whereas MSVC still expects `const char* ` */
 
 namespace alcp::cipher::vaes512 {
 
+/*
+ * Whole multiples of 4 blocks, with the powers of H given by the caller so
+ * that they are computed once for many messages under the same key.
+ */
+void
+encryptGcmBulk(const Uint8*   pInputText,
+               Uint8*         pOutputText,
+               Uint64         blocks,
+               const Uint8*   pKey,
+               const int      nRounds,
+               alc_gcm_ctx_t* gcmCtx,
+               const __m512i* pHashSubkeyTable);
+
+void
+decryptGcmBulk(const Uint8*   pInputText,
+               Uint8*         pOutputText,
+               Uint64         blocks,
+               const Uint8*   pKey,
+               const int      nRounds,
+               alc_gcm_ctx_t* gcmCtx,
+               const __m512i* pHashSubkeyTable);
+
 // dynamic Unrolling
 int inline dynamicUnroll(Uint64 blocks)
 {
@@ -0,0 +1,407 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_gcm.hh"
+#include "alcp/cipher/aesni.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/cipher/gmul.hh"
+#include "alcp/utils/compare.hh"
+#include "alcp/utils/copy.hh"
+#include "avx512.hh"
+#include "avx512_gmul.hh"
+
+#include "vaes_avx512.hh"
+#include "vaes_avx512_core.hh"
+#include "vaes_gcm.hh"
+
+#include "alcp/types.hh"
+
+/*
+ * Batched GCM seal/open of many packets under one key.
+ *
+ * H and its powers are computed once for the batch. Long packets run their
+ * whole multiples of 4 blocks through the regular zmm kernels. What is left
+ * of them, short packets as a whole, and E(J0) are queued, and the counter
+ * blocks queued by up to cBatchPackets packets are encrypted together so
+ * that short packets still fill the AES pipelines. The GHASH of each tail,
+ * with the additional data of short packets and the length block, is then
+ * a single aggregated multiplication with H^16..H^1.
+ */
+
+namespace alcp::cipher::vaes512 {
+
+// packets whose tails share the AES passes
+static constexpr Uint64 cBatchPackets = 16;
+// blocks hashed by one aggregated multiplication
+static constexpr Uint64 cTailHashBlocks = 16;
+// packets with fewer whole blocks are done without the bulk kernels
+static constexpr Uint64 cMinBulkBlocks = cTailHashBlocks - 1;
+
+struct GcmBatchTail
+{
+    __m128i m_gHash;     // GHASH state after the bulk, byte reversed
+    __m128i m_tagMask;   // E(J0) when it is not in the queue
+    Uint64  m_bulkBytes; // bytes done by the bulk kernels
+    Uint64  m_aadBlocks; // additional data blocks left to the tail GHASH
+    Uint64  m_j0;        // index of E(J0) in the queue
+    Uint64  m_ks;        // index of the first tail keystream block
+    bool    m_j0Queued;
+};
+
+static inline __mmask16
+bytesMask(Uint64 n)
+{
+    return static_cast<__mmask16>((1ULL << n) - 1);
+}
+
+// H = E(K, 0), byte reversed and multiplied by x as the kernels expect it
+static inline __m128i
+hashSubKey(const __m128i* pkey128, int nRounds)
+{
+    const __m128i reverse_mask_128 =
+        _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    __m128i hash_subKey_128 = _mm_setzero_si128();
+    aesni::AesEncrypt(hash_subKey_128, pkey128, nRounds);
+    hash_subKey_128 = _mm_shuffle_epi8(hash_subKey_128, reverse_mask_128);
+    aesni::HashSubKeyLeftByOne(hash_subKey_128);
+    return hash_subKey_128;
+}
+
+template<void AesEncNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void AesEncNoLoad_1x512(__m512i& a, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys)>
+static inline void
+encryptQueue(__m128i queue[], Uint64 numBlocks, const __m128i* pkey128)
+{
+    auto   p_512  = reinterpret_cast<__m512i*>(queue);
+    Uint64 num512 = (numBlocks + 3) / 4;
+
+    sKeys keys{};
+    alcp_load_key_zmm(pkey128, keys);
+
+    for (; num512 >= 4; num512 -= 4, p_512 += 4) {
+        __m512i a1 = _mm512_load_si512(p_512);
+        __m512i a2 = _mm512_load_si512(p_512 + 1);
+        __m512i a3 = _mm512_load_si512(p_512 + 2);
+        __m512i a4 = _mm512_load_si512(p_512 + 3);
+
+        AesEncNoLoad_4x512(a1, a2, a3, a4, keys);
+
+        _mm512_store_si512(p_512, a1);
+        _mm512_store_si512(p_512 + 1, a2);
+        _mm512_store_si512(p_512 + 2, a3);
+        _mm512_store_si512(p_512 + 3, a4);
+    }
+    for (; num512 != 0; num512--, p_512++) {
+        __m512i a1 = _mm512_load_si512(p_512);
+        AesEncNoLoad_1x512(a1, keys);
+        _mm512_store_si512(p_512, a1);
+    }
+
+    alcp_clear_keys_zmm(keys);
+}
+
+template<void AesEncNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void AesEncNoLoad_1x512(__m512i& a, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys)>
+static alc_error_t
+gcmBatch(alc_aead_packet_t* pPackets,
+         Uint64             numPackets,
+         const Uint8*       pKey,
+         int                nRounds,
+         bool               isEncrypt)
+{
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+    const __m128i reverse_mask_128 =
+        _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i swap_ctr =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12);
+    const __m128i one_lo_128       = _mm_set_epi32(1, 0, 0, 0);
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+    const __m256i const_factor_256 =
+        _mm256_set_epi64x(0xC200000000000000, 0x1, 0xC200000000000000, 0x1);
+    const __m512i reverse_mask_512 =
+        _mm512_broadcast_i32x4(reverse_mask_128);
+
+    // H and its powers once for the whole batch
+    alc_gcm_ctx_t gcmCtx{};
+    __m128i       hash_subKey_128 = hashSubKey(pkey128, nRounds);
+
+    gcmCtx.m_hash_subKey_128  = hash_subKey_128;
+    gcmCtx.m_reverse_mask_128 = reverse_mask_128;
+
+    _alc_cipher_gcm_key_data_t keyData;
+    auto pTable = reinterpret_cast<__m512i*>(keyData.m_hashSubkeyTable);
+    computeHashSubKeys(
+        MAX_NUM_512_BLKS, hash_subKey_128, pTable, const_factor_128);
+
+    // E(J0) and at most cTailHashBlocks - 1 keystream blocks per packet
+    alignas(64) __m128i queue[cBatchPackets * cTailHashBlocks];
+    GcmBatchTail        tails[cBatchPackets];
+    alc_error_t         err = ALC_ERROR_NONE;
+
+    for (Uint64 first = 0; first < numPackets; first += cBatchPackets) {
+        Uint64 count  = std::min(cBatchPackets, numPackets - first);
+        Uint64 queued = 0;
+
+        // bulk of every packet, queue the counter blocks of the tails
+        for (Uint64 p = 0; p < count; p++) {
+            alc_aead_packet_t& pkt = pPackets[first + p];
+            GcmBatchTail&      t   = tails[p];
+            __m128i            ctr;
+
+            if (pkt.ap_ivLen == 12) {
+                __m128i iv = _mm_setzero_si128();
+                utils::CopyBytes(&iv, pkt.ap_iv, 12);
+                t.m_j0Queued    = true;
+                t.m_j0          = queued;
+                queue[queued++] = _mm_insert_epi32(iv, 0x1000000, 3);
+                ctr             = _mm_insert_epi32(iv, 0x2000000, 3);
+                ctr             = _mm_shuffle_epi8(ctr, swap_ctr);
+            } else {
+                __m128i h = _mm_setzero_si128();
+                aesni::InitGcm(pKey,
+                               nRounds,
+                               pkt.ap_iv,
+                               pkt.ap_ivLen,
+                               h,
+                               t.m_tagMask,
+                               ctr,
+                               reverse_mask_128);
+                t.m_j0Queued = false;
+            }
+
+            Uint64 blocks   = pkt.ap_len / Rijndael::cBlockSize;
+            Uint64 bulk     = blocks < cMinBulkBlocks ? 0 : blocks & ~3ULL;
+            Uint64 rem      = pkt.ap_len - bulk * Rijndael::cBlockSize;
+            Uint64 num_tail = (rem + 15) / Rijndael::cBlockSize;
+            Uint64 num_aad  = (pkt.ap_aadLen + 15) / Rijndael::cBlockSize;
+
+            // additional data of a short packet goes with its tail
+            __m128i gHash_128 = _mm_setzero_si128();
+            if (bulk == 0 && num_aad + num_tail < cTailHashBlocks) {
+                t.m_aadBlocks = num_aad;
+            } else {
+                t.m_aadBlocks = 0;
+                aesni::processAdditionalDataGcm(pkt.ap_aad,
+                                                pkt.ap_aadLen,
+                                                gHash_128,
+                                                hash_subKey_128,
+                                                reverse_mask_128);
+            }
+
+            if (bulk) {
+                gcmCtx.m_counter_128 = ctr;
+                gcmCtx.m_gHash_128   = gHash_128;
+                if (isEncrypt) {
+                    encryptGcmBulk(pkt.ap_in,
+                                   pkt.ap_out,
+                                   bulk,
+                                   pKey,
+                                   nRounds,
+                                   &gcmCtx,
+                                   pTable);
+                } else {
+                    decryptGcmBulk(pkt.ap_in,
+                                   pkt.ap_out,
+                                   bulk,
+                                   pKey,
+                                   nRounds,
+                                   &gcmCtx,
+                                   pTable);
+                }
+                ctr       = gcmCtx.m_counter_128;
+                gHash_128 = gcmCtx.m_gHash_128;
+            }
+
+            t.m_gHash     = gHash_128;
+            t.m_bulkBytes = bulk * Rijndael::cBlockSize;
+            t.m_ks        = queued;
+
+            for (Uint64 i = 0; i < num_tail; i++) {
+                queue[queued++] = _mm_shuffle_epi8(ctr, swap_ctr);
+                ctr             = _mm_add_epi32(ctr, one_lo_128);
+            }
+        }
+
+        for (Uint64 i = queued; i % 4; i++) {
+            queue[i] = _mm_setzero_si128();
+        }
+        encryptQueue<AesEncNoLoad_4x512,
+                     AesEncNoLoad_1x512,
+                     alcp_load_key_zmm,
+                     alcp_clear_keys_zmm>(queue, queued, pkey128);
+
+        // tails, then the GHASH of the tail and the length block in one go
+        for (Uint64 p = 0; p < count; p++) {
+            alc_aead_packet_t&  pkt = pPackets[first + p];
+            const GcmBatchTail& t   = tails[p];
+
+            const Uint8* p_in     = pkt.ap_in + t.m_bulkBytes;
+            Uint8*       p_out    = pkt.ap_out + t.m_bulkBytes;
+            Uint64       rem      = pkt.ap_len - t.m_bulkBytes;
+            Uint64       num_tail = (rem + 15) / Rijndael::cBlockSize;
+
+            // right aligned so that the length block meets H^1
+            __m128i blks[cTailHashBlocks] = {};
+            Uint64  num_blks = t.m_aadBlocks + num_tail + 1;
+            Uint64  top      = cTailHashBlocks - num_blks;
+
+            for (Uint64 i = 0; i < t.m_aadBlocks; i++) {
+                Uint64 n = std::min(pkt.ap_aadLen - i * 16, (Uint64)16);
+                blks[top + i] =
+                    _mm_maskz_loadu_epi8(bytesMask(n), pkt.ap_aad + i * 16);
+            }
+
+            __m128i* p_blks = blks + top + t.m_aadBlocks;
+            for (Uint64 i = 0; i < num_tail; i++) {
+                __mmask16 mask = bytesMask(std::min(rem - i * 16, (Uint64)16));
+
+                __m128i a1 = _mm_maskz_loadu_epi8(mask, p_in + i * 16);
+                __m128i b1 = _mm_xor_si128(a1, queue[t.m_ks + i]);
+                _mm_mask_storeu_epi8(p_out + i * 16, mask, b1);
+
+                p_blks[i] = isEncrypt ? _mm_maskz_mov_epi8(mask, b1) : a1;
+            }
+
+            __m128i lengths =
+                _mm_set_epi64x(pkt.ap_aadLen << 3, pkt.ap_len << 3);
+            blks[cTailHashBlocks - 1] =
+                _mm_shuffle_epi8(lengths, reverse_mask_128);
+            blks[top] = _mm_xor_si128(
+                blks[top], _mm_shuffle_epi8(t.m_gHash, reverse_mask_128));
+
+            auto    p_512 = reinterpret_cast<const __m512i*>(blks);
+            __m512i res   = _mm512_setzero_si512();
+            if (num_blks <= 8) {
+                gMulR(pTable[0],
+                      pTable[1],
+                      _mm512_loadu_si512(p_512 + 2),
+                      _mm512_loadu_si512(p_512 + 3),
+                      reverse_mask_512,
+                      res,
+                      const_factor_256);
+            } else {
+                gMulR(pTable[0],
+                      pTable[1],
+                      pTable[2],
+                      pTable[3],
+                      _mm512_loadu_si512(p_512),
+                      _mm512_loadu_si512(p_512 + 1),
+                      _mm512_loadu_si512(p_512 + 2),
+                      _mm512_loadu_si512(p_512 + 3),
+                      reverse_mask_512,
+                      res,
+                      const_factor_256);
+            }
+
+            __m128i tagMask = t.m_j0Queued ? queue[t.m_j0] : t.m_tagMask;
+            __m128i tag_128 = _mm_shuffle_epi8(_mm512_castsi512_si128(res),
+                                               reverse_mask_128);
+            tag_128         = _mm_xor_si128(tag_128, tagMask);
+
+            Uint8 tag[ALCP_GCM_TAG_MAX_SIZE];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(tag), tag_128);
+
+            pkt.ap_err = ALC_ERROR_NONE;
+            if (isEncrypt) {
+                utils::CopyBytes(pkt.ap_tag, tag, pkt.ap_tagLen);
+            } else if (!utils::CompareConstTime(
+                           tag, pkt.ap_tag, pkt.ap_tagLen)) {
+                if (pkt.ap_len) {
+                    memset(pkt.ap_out, 0, pkt.ap_len);
+                }
+                pkt.ap_err = ALC_ERROR_TAG_MISMATCH;
+                err        = ALC_ERROR_TAG_MISMATCH;
+            }
+            memset(tag, 0, sizeof(tag));
+        }
+    }
+
+    // clear keystream and tag masks
+    memset(queue, 0, sizeof(queue));
+    memset(tails, 0, sizeof(tails));
+
+    return err;
+}
+
+alc_error_t
+cryptGcmBatch(alc_aead_packet_t* pPackets,
+              Uint64             numPackets,
+              const Uint8*       pKey,
+              int                nRounds,
+              bool               isEncrypt)
+{
+    switch (nRounds) {
+        case 10:
+            return gcmBatch<AesEncryptNoLoad_4x512Rounds10,
+                            AesEncryptNoLoad_1x512Rounds10,
+                            alcp_load_key_zmm_10rounds,
+                            alcp_clear_keys_zmm_10rounds>(
+                pPackets, numPackets, pKey, nRounds, isEncrypt);
+        case 12:
+            return gcmBatch<AesEncryptNoLoad_4x512Rounds12,
+                            AesEncryptNoLoad_1x512Rounds12,
+                            alcp_load_key_zmm_12rounds,
+                            alcp_clear_keys_zmm_12rounds>(
+                pPackets, numPackets, pKey, nRounds, isEncrypt);
+        default:
+            return gcmBatch<AesEncryptNoLoad_4x512Rounds14,
+                            AesEncryptNoLoad_1x512Rounds14,
+                            alcp_load_key_zmm_14rounds,
+                            alcp_clear_keys_zmm_14rounds>(
+                pPackets, numPackets, pKey, nRounds, isEncrypt);
+    }
+}
+
+void
+computeGcmHashTable(const Uint8* pKey, int nRounds, Uint64* pTable)
+{
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+
+    auto    pkey128         = reinterpret_cast<const __m128i*>(pKey);
+    __m128i hash_subKey_128 = hashSubKey(pkey128, nRounds);
+
+    computeHashSubKeys(MAX_NUM_512_BLKS,
+                       hash_subKey_128,
+                       reinterpret_cast<__m512i*>(pTable),
+                       const_factor_128);
+}
+
+} // namespace alcp::cipher::vaes512
@@ -74,7 +74,8 @@ Uint64 inline gcmBlk_512_enc(const __m512i* p_in_x,
                              int            nRounds,
                              // gcm specific params
                              alc_gcm_ctx_t* gcmCtx,
-                             int            remBytes)
+                             int            remBytes,
+                             const __m512i* pHashSubkeyTable = nullptr)
 {
     __m512i c1;
 #if !ALWAYS_COMPUTE
@@ -140,6 +141,17 @@ Uint64 inline gcmBlk_512_enc(const __m512i* p_in_x,
     __m512i  hashSubkeyTableStack[MAX_NUM_512_BLKS]{};
     __m512i* pHashSubkeyTableLocal = hashSubkeyTableStack;
 
+    if (pHashSubkeyTable == nullptr) {
+        pHashSubkeyTable = gcmCtx->m_pHashSubkeyTable_shared;
+    }
+    if (pHashSubkeyTable != nullptr) {
+        // caller has computed the powers of H once for many messages
+        for (int i = 0; i < num_512_blks; i++) {
+            pHashSubkeyTableLocal[i] = pHashSubkeyTable[i];
+        }
+        num_512_blks = 0;
+    }
+
 #if ALWAYS_COMPUTE
     if (num_512_blks) {
         getPrecomputedTable(updateCounter,
@@ -670,4 +682,66 @@ encryptGcm256(const Uint8*   pInputText,  // ptr to inputText
     return err;
 }
 
+void
+encryptGcmBulk(const Uint8*   pInputText,
+               Uint8*         pOutputText,
+               Uint64         blocks,
+               const Uint8*   pKey,
+               const int      nRounds,
+               alc_gcm_ctx_t* gcmCtx,
+               const __m512i* pHashSubkeyTable)
+{
+    auto p_in_512  = reinterpret_cast<const __m512i*>(pInputText);
+    auto p_out_512 = reinterpret_cast<__m512i*>(pOutputText);
+    auto pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+    switch (nRounds) {
+        case 10:
+            gcmBlk_512_enc<AesEncryptNoLoad_4x512Rounds10,
+                           AesEncryptNoLoad_2x512Rounds10,
+                           AesEncryptNoLoad_1x512Rounds10,
+                           alcp_load_key_zmm_10rounds,
+                           alcp_clear_keys_zmm_10rounds>(p_in_512,
+                                                         p_out_512,
+                                                         blocks,
+                                                         0,
+                                                         pkey128,
+                                                         nRounds,
+                                                         gcmCtx,
+                                                         0,
+                                                         pHashSubkeyTable);
+            break;
+        case 12:
+            gcmBlk_512_enc<AesEncryptNoLoad_4x512Rounds12,
+                           AesEncryptNoLoad_2x512Rounds12,
+                           AesEncryptNoLoad_1x512Rounds12,
+                           alcp_load_key_zmm_12rounds,
+                           alcp_clear_keys_zmm_12rounds>(p_in_512,
+                                                         p_out_512,
+                                                         blocks,
+                                                         0,
+                                                         pkey128,
+                                                         nRounds,
+                                                         gcmCtx,
+                                                         0,
+                                                         pHashSubkeyTable);
+            break;
+        default:
+            gcmBlk_512_enc<AesEncryptNoLoad_4x512Rounds14,
+                           AesEncryptNoLoad_2x512Rounds14,
+                           AesEncryptNoLoad_1x512Rounds14,
+                           alcp_load_key_zmm_14rounds,
+                           alcp_clear_keys_zmm_14rounds>(p_in_512,
+                                                         p_out_512,
+                                                         blocks,
+                                                         0,
+                                                         pkey128,
+                                                         nRounds,
+                                                         gcmCtx,
+                                                         0,
+                                                         pHashSubkeyTable);
+            break;
+    }
+}
+
 } // namespace alcp::cipher::vaes512
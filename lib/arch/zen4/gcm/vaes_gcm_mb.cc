@@ -0,0 +1,562 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/cipher/aesni.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/cipher/gmul.hh"
+#include "alcp/cipher/prepared_key.hh"
+#include "alcp/utils/compare.hh"
+#include "alcp/utils/copy.hh"
+#include "avx512_gmul.hh"
+
+#include "alcp/types.hh"
+
+/*
+ * Multi-key GCM: every 128 bit lane of a zmm carries a packet of its own
+ * connection. The round keys of the lanes are kept transposed as in
+ * AesMbLanes, so one load gives a round key to four lanes, and every lane
+ * has its own counter, hash subkey and GHASH state, which gMulParallel4
+ * advances four lanes at a time.
+ *
+ * Packets are processed in groups. E(J0) and the partial last block of
+ * every packet go through one CTR pass, the additional data through one
+ * GHASH pass, the whole blocks through the stitched CTR + GHASH pass and
+ * the last partial block with the length block through a final GHASH
+ * pass. A lane takes the next job of the pass as soon as its current one
+ * drains, so short and long packets share the passes.
+ */
+
+namespace alcp::cipher::vaes512 {
+
+// packets whose jobs share the passes
+static constexpr Uint64 cGcmMbGroupSize = 32;
+
+struct alignas(64) GcmMbLanes
+{
+    AesMbLanes m_aes;                  // m_iv is the byte swapped counter
+    __m128i    m_hashKey[cMbMaxLanes]; // H << 1, byte reversed
+    __m128i    m_gHash[cMbMaxLanes];   // byte reversed
+};
+
+struct GcmMbPacket
+{
+    const __m128i* m_pRoundKeys;
+    int            m_nRounds;
+    __m128i        m_hashKey;
+    __m128i        m_counter;     // first message block, byte swapped
+    __m128i        m_tailCounter; // last partial block, byte swapped
+    __m128i        m_j0;          // byte swapped
+    __m128i        m_gHash;
+    __m128i        m_tagMask;     // E(J0)
+    bool           m_j0Queued;
+    alignas(16) Uint8 m_tail[16];
+    alignas(16) Uint8 m_aadTail[16];
+    // zero padded last partial block of the ciphertext and the lengths
+    alignas(16) Uint8 m_hashTail[32];
+};
+
+// up to two runs of blocks of one packet, the second one is only hashed
+struct GcmMbJob
+{
+    GcmMbPacket* m_pPkt;
+    __m128i*     m_pCounter;
+    const Uint8* m_pSrc[2];
+    Uint8*       m_pDst;
+    Uint64       m_blocks[2];
+};
+
+typedef void (*GcmMbKernel)(GcmMbLanes& lanes, Uint64 blocks, int nRounds);
+
+static inline __m512i
+loadLanes(const Uint8* const pSrc[4])
+{
+    __m512i a = _mm512_castsi128_si512(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[0])));
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[1])), 1);
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[2])), 2);
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[3])), 3);
+    return a;
+}
+
+static inline void
+storeLanes(Uint8* const pDst[4], __m512i a)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[0]),
+                     _mm512_castsi512_si128(a));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[1]),
+                     _mm512_extracti32x4_epi32(a, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[2]),
+                     _mm512_extracti32x4_epi32(a, 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[3]),
+                     _mm512_extracti32x4_epi32(a, 3));
+}
+
+/*
+ * cCtr: xor the keystream of the lane counters into the input.
+ * cHash: GHASH the output (cHashOutput) or the input into the lane state.
+ */
+template<bool cCtr, bool cHash, bool cHashOutput>
+static inline void
+gcmMb(GcmMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    constexpr Uint32 cLanes = cGcmMbLanes;
+    constexpr Uint32 cRegs  = cLanes / 4;
+
+    const __m512i swap_ctr = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12));
+    const __m512i reverse_mask_512 = _mm512_broadcast_i32x4(
+        _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    const __m512i one_lo_512 =
+        _mm512_broadcast_i32x4(_mm_set_epi32(1, 0, 0, 0));
+    const __m512i const_factor_512 =
+        _mm512_broadcast_i32x4(_mm_set_epi64x(0xC200000000000000, 0x1));
+
+    __m512i      ctr[cRegs], hash_key[cRegs], g_hash[cRegs];
+    const Uint8* p_src[cLanes];
+    Uint8*       p_dst[cLanes];
+
+    auto p_ctr  = reinterpret_cast<__m512i*>(lanes.m_aes.m_iv);
+    auto p_hkey = reinterpret_cast<const __m512i*>(lanes.m_hashKey);
+    auto p_hash = reinterpret_cast<__m512i*>(lanes.m_gHash);
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        ctr[i]      = _mm512_load_si512(p_ctr + i);
+        hash_key[i] = _mm512_load_si512(p_hkey + i);
+        g_hash[i]   = _mm512_load_si512(p_hash + i);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        p_src[l] = lanes.m_aes.m_pSrc[l];
+        p_dst[l] = lanes.m_aes.m_pDst[l];
+    }
+
+    for (; blocks > 0; blocks--) {
+        __m512i in[cRegs], out[cRegs];
+
+        UNROLL_4
+        for (Uint32 i = 0; i < cRegs; i++) {
+            in[i] = loadLanes(&p_src[4 * i]);
+        }
+
+        if constexpr (cCtr) {
+            auto p_key =
+                reinterpret_cast<const __m512i*>(lanes.m_aes.m_round_keys[0]);
+
+            UNROLL_4
+            for (Uint32 i = 0; i < cRegs; i++) {
+                out[i] = _mm512_xor_si512(_mm512_shuffle_epi8(ctr[i], swap_ctr),
+                                          _mm512_load_si512(p_key + i));
+                ctr[i] = _mm512_add_epi32(ctr[i], one_lo_512);
+            }
+
+            for (int r = 1; r < nRounds; r++) {
+                p_key = reinterpret_cast<const __m512i*>(
+                    lanes.m_aes.m_round_keys[r]);
+
+                UNROLL_4
+                for (Uint32 i = 0; i < cRegs; i++) {
+                    out[i] = _mm512_aesenc_epi128(
+                        out[i], _mm512_load_si512(p_key + i));
+                }
+            }
+
+            p_key = reinterpret_cast<const __m512i*>(
+                lanes.m_aes.m_round_keys[nRounds]);
+
+            UNROLL_4
+            for (Uint32 i = 0; i < cRegs; i++) {
+                out[i] = _mm512_aesenclast_epi128(
+                    out[i], _mm512_load_si512(p_key + i));
+                out[i] = _mm512_xor_si512(out[i], in[i]);
+                storeLanes(&p_dst[4 * i], out[i]);
+            }
+        }
+
+        if constexpr (cHash) {
+            UNROLL_4
+            for (Uint32 i = 0; i < cRegs; i++) {
+                __m512i c = cHashOutput ? out[i] : in[i];
+                c         = _mm512_xor_si512(
+                    g_hash[i], _mm512_shuffle_epi8(c, reverse_mask_512));
+                gMulParallel4(g_hash[i], c, hash_key[i], const_factor_512);
+            }
+        }
+
+        for (Uint32 l = 0; l < cLanes; l++) {
+            p_src[l] += lanes.m_aes.m_step[l];
+            p_dst[l] += lanes.m_aes.m_step[l];
+        }
+    }
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        _mm512_store_si512(p_ctr + i, ctr[i]);
+        _mm512_store_si512(p_hash + i, g_hash[i]);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_aes.m_pSrc[l] = p_src[l];
+        lanes.m_aes.m_pDst[l] = p_dst[l];
+    }
+}
+
+static void
+ctrMb(GcmMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    gcmMb<true, false, false>(lanes, blocks, nRounds);
+}
+
+static void
+ghashMb(GcmMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    gcmMb<false, true, false>(lanes, blocks, nRounds);
+}
+
+static void
+encryptGcmMb(GcmMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    gcmMb<true, true, true>(lanes, blocks, nRounds);
+}
+
+static void
+decryptGcmMb(GcmMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    gcmMb<true, true, false>(lanes, blocks, nRounds);
+}
+
+/*
+ * Job manager: a lane takes the next job with nRounds rounds (any job when
+ * nRounds is 0) as soon as its current job drains, the counter and the
+ * GHASH state of a drained lane go back to the packet. The kernel is run
+ * for the blocks left in the shortest active lane.
+ */
+static void
+gcmMbPass(GcmMbKernel kernel, GcmMbJob jobs[], Uint64 numJobs, int nRounds)
+{
+    GcmMbLanes        lanes;
+    GcmMbJob*         cur[cGcmMbLanes]         = {};
+    Uint32            seg[cGcmMbLanes]         = {};
+    Uint64            blocks_left[cGcmMbLanes] = {};
+    alignas(16) Uint8 scratch[16]              = {};
+    Uint64            next                     = 0;
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    for (;;) {
+        Uint64 min_blocks = 0;
+
+        for (Uint32 l = 0; l < cGcmMbLanes; l++) {
+            while (blocks_left[l] == 0) {
+                GcmMbJob* job = cur[l];
+
+                if (job != nullptr && seg[l] == 0 && job->m_blocks[1] != 0) {
+                    seg[l]                = 1;
+                    lanes.m_aes.m_pSrc[l] = job->m_pSrc[1];
+                    lanes.m_aes.m_pDst[l] = scratch;
+                    blocks_left[l]        = job->m_blocks[1];
+                    continue;
+                }
+                if (job != nullptr) {
+                    job->m_pPkt->m_gHash = lanes.m_gHash[l];
+                    if (job->m_pCounter != nullptr) {
+                        *job->m_pCounter = lanes.m_aes.m_iv[l];
+                    }
+                    cur[l] = nullptr;
+                }
+
+                while (next < numJobs
+                       && ((jobs[next].m_blocks[0] == 0
+                            && jobs[next].m_blocks[1] == 0)
+                           || (nRounds != 0
+                               && jobs[next].m_pPkt->m_nRounds != nRounds))) {
+                    next++;
+                }
+                if (next == numJobs) {
+                    lanes.m_aes.m_pSrc[l] = scratch;
+                    lanes.m_aes.m_pDst[l] = scratch;
+                    lanes.m_aes.m_step[l] = 0;
+                    break;
+                }
+
+                job                = &jobs[next++];
+                GcmMbPacket* p_pkt = job->m_pPkt;
+                if (nRounds != 0) {
+                    for (int r = 0; r <= nRounds; r++) {
+                        lanes.m_aes.m_round_keys[r][l] = _mm_loadu_si128(
+                            p_pkt->m_pRoundKeys + r);
+                    }
+                }
+                if (job->m_pCounter != nullptr) {
+                    lanes.m_aes.m_iv[l] = *job->m_pCounter;
+                }
+                lanes.m_hashKey[l]    = p_pkt->m_hashKey;
+                lanes.m_gHash[l]      = p_pkt->m_gHash;
+                lanes.m_aes.m_pSrc[l] = job->m_pSrc[0];
+                lanes.m_aes.m_pDst[l] = job->m_pDst;
+                lanes.m_aes.m_step[l] = Rijndael::cBlockSize;
+                blocks_left[l]        = job->m_blocks[0];
+                seg[l]                = 0;
+                cur[l]                = job;
+            }
+            if (blocks_left[l] != 0
+                && (min_blocks == 0 || blocks_left[l] < min_blocks)) {
+                min_blocks = blocks_left[l];
+            }
+        }
+
+        if (min_blocks == 0) {
+            break;
+        }
+
+        kernel(lanes, min_blocks, nRounds);
+
+        for (Uint32 l = 0; l < cGcmMbLanes; l++) {
+            if (blocks_left[l] != 0) {
+                blocks_left[l] -= min_blocks;
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+}
+
+// the passes over jobs of every key size
+static void
+gcmMbPasses(GcmMbKernel kernel, GcmMbJob jobs[], Uint64 numJobs)
+{
+    for (int rounds : { 10, 12, 14 }) {
+        gcmMbPass(kernel, jobs, numJobs, rounds);
+    }
+}
+
+static alc_error_t
+gcmMbGroup(alc_aead_mb_job_t* pJobs,
+           Uint64             numJobs,
+           GcmMbPacket        pkts[],
+           bool               isEncrypt)
+{
+    const __m128i reverse_mask_128 =
+        _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i swap_ctr =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12);
+
+    GcmMbJob jobs[2 * cGcmMbGroupSize] = {};
+    Uint64   num_jobs                  = 0;
+
+    for (Uint64 p = 0; p < numJobs; p++) {
+        const alc_aead_packet_t& pkt = pJobs[p].aj_packet;
+        auto p_key = reinterpret_cast<const PreparedKey*>(pJobs[p].aj_key);
+        GcmMbPacket& s = pkts[p];
+
+        s.m_nRounds    = static_cast<int>(p_key->getKeyLen() / 32 + 6);
+        s.m_pRoundKeys =
+            reinterpret_cast<const __m128i*>(p_key->getEncryptKeys());
+        s.m_gHash = _mm_setzero_si128();
+
+        // H^1 is the last lane of the first entry of the table
+        const __m512i* p_table = p_key->getHashSubkeyTable();
+        if (p_table != nullptr) {
+            s.m_hashKey = _mm512_extracti32x4_epi32(p_table[0], 3);
+        } else {
+            s.m_hashKey = _mm_setzero_si128();
+            aesni::AesEncrypt(s.m_hashKey, s.m_pRoundKeys, s.m_nRounds);
+            s.m_hashKey = _mm_shuffle_epi8(s.m_hashKey, reverse_mask_128);
+            aesni::HashSubKeyLeftByOne(s.m_hashKey);
+        }
+
+        if (pkt.ap_ivLen == 12) {
+            __m128i iv = _mm_setzero_si128();
+            utils::CopyBytes(&iv, pkt.ap_iv, 12);
+            // J0 = iv || 1, the message starts at iv || 2
+            s.m_j0 = _mm_shuffle_epi8(_mm_insert_epi32(iv, 0x1000000, 3),
+                                      swap_ctr);
+            s.m_counter = _mm_shuffle_epi8(
+                _mm_insert_epi32(iv, 0x2000000, 3), swap_ctr);
+            s.m_tagMask  = _mm_setzero_si128();
+            s.m_j0Queued = true;
+        } else {
+            __m128i h = _mm_setzero_si128();
+            aesni::InitGcm(reinterpret_cast<const Uint8*>(s.m_pRoundKeys),
+                           s.m_nRounds,
+                           pkt.ap_iv,
+                           pkt.ap_ivLen,
+                           h,
+                           s.m_tagMask,
+                           s.m_counter,
+                           reverse_mask_128);
+            s.m_j0Queued = false;
+        }
+
+        Uint64 full = pkt.ap_len / Rijndael::cBlockSize;
+        Uint64 rem  = pkt.ap_len % Rijndael::cBlockSize;
+
+        s.m_tailCounter = _mm_add_epi32(
+            s.m_counter, _mm_set_epi32(static_cast<int>(full), 0, 0, 0));
+
+        memset(s.m_tail, 0, sizeof(s.m_tail));
+        if (rem != 0) {
+            memcpy(s.m_tail, pkt.ap_in + full * Rijndael::cBlockSize, rem);
+        }
+        memset(s.m_hashTail, 0, sizeof(s.m_hashTail));
+        if (!isEncrypt) {
+            memcpy(s.m_hashTail, s.m_tail, rem);
+        }
+        __m128i lengths = _mm_shuffle_epi8(
+            _mm_set_epi64x(pkt.ap_aadLen << 3, pkt.ap_len << 3),
+            reverse_mask_128);
+        _mm_store_si128(reinterpret_cast<__m128i*>(s.m_hashTail + 16), lengths);
+
+        Uint64 aad_rem = pkt.ap_aadLen % Rijndael::cBlockSize;
+        memset(s.m_aadTail, 0, sizeof(s.m_aadTail));
+        if (aad_rem != 0) {
+            memcpy(s.m_aadTail, pkt.ap_aad + pkt.ap_aadLen - aad_rem, aad_rem);
+        }
+
+        if (s.m_j0Queued) {
+            auto p_mask = reinterpret_cast<Uint8*>(&s.m_tagMask);
+            jobs[num_jobs++] = { &s, &s.m_j0, { p_mask, nullptr }, p_mask,
+                                 { 1, 0 } };
+        }
+        if (rem != 0) {
+            jobs[num_jobs++] = { &s, &s.m_tailCounter, { s.m_tail, nullptr },
+                                 s.m_tail, { 1, 0 } };
+        }
+    }
+
+    // E(J0) and the partial last blocks
+    gcmMbPasses(ctrMb, jobs, num_jobs);
+
+    for (Uint64 p = 0; p < numJobs; p++) {
+        const alc_aead_packet_t& pkt  = pJobs[p].aj_packet;
+        GcmMbPacket&             s    = pkts[p];
+        Uint64                   full = pkt.ap_len / Rijndael::cBlockSize;
+        Uint64                   rem  = pkt.ap_len % Rijndael::cBlockSize;
+
+        if (rem != 0) {
+            memcpy(pkt.ap_out + full * Rijndael::cBlockSize, s.m_tail, rem);
+            if (isEncrypt) {
+                memcpy(s.m_hashTail, s.m_tail, rem);
+            }
+        }
+        jobs[p] = { &s,
+                    nullptr,
+                    { pkt.ap_aad, s.m_aadTail },
+                    nullptr,
+                    { pkt.ap_aadLen / Rijndael::cBlockSize,
+                      (pkt.ap_aadLen % Rijndael::cBlockSize) != 0 ? 1ULL
+                                                                  : 0ULL } };
+    }
+
+    // additional data
+    gcmMbPass(ghashMb, jobs, numJobs, 0);
+
+    for (Uint64 p = 0; p < numJobs; p++) {
+        const alc_aead_packet_t& pkt = pJobs[p].aj_packet;
+        GcmMbPacket&             s   = pkts[p];
+
+        jobs[p] = { &s,
+                    &s.m_counter,
+                    { pkt.ap_in, nullptr },
+                    pkt.ap_out,
+                    { pkt.ap_len / Rijndael::cBlockSize, 0 } };
+    }
+
+    // whole blocks, CTR and GHASH stitched
+    gcmMbPasses(isEncrypt ? encryptGcmMb : decryptGcmMb, jobs, numJobs);
+
+    for (Uint64 p = 0; p < numJobs; p++) {
+        const alc_aead_packet_t& pkt = pJobs[p].aj_packet;
+        GcmMbPacket&             s   = pkts[p];
+        Uint64                   rem = pkt.ap_len % Rijndael::cBlockSize;
+
+        jobs[p] = { &s,
+                    nullptr,
+                    { rem != 0 ? s.m_hashTail : s.m_hashTail + 16, nullptr },
+                    nullptr,
+                    { rem != 0 ? 2ULL : 1ULL, 0 } };
+    }
+
+    // partial last block and lengths
+    gcmMbPass(ghashMb, jobs, numJobs, 0);
+
+    alc_error_t err = ALC_ERROR_NONE;
+    for (Uint64 p = 0; p < numJobs; p++) {
+        alc_aead_packet_t& pkt = pJobs[p].aj_packet;
+        GcmMbPacket&       s   = pkts[p];
+
+        __m128i tag_128 = _mm_shuffle_epi8(s.m_gHash, reverse_mask_128);
+        tag_128         = _mm_xor_si128(tag_128, s.m_tagMask);
+
+        Uint8 tag[ALCP_GCM_TAG_MAX_SIZE];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(tag), tag_128);
+
+        pkt.ap_err = ALC_ERROR_NONE;
+        if (isEncrypt) {
+            utils::CopyBytes(pkt.ap_tag, tag, pkt.ap_tagLen);
+        } else if (!utils::CompareConstTime(tag, pkt.ap_tag, pkt.ap_tagLen)) {
+            if (pkt.ap_len) {
+                memset(pkt.ap_out, 0, pkt.ap_len);
+            }
+            pkt.ap_err = ALC_ERROR_TAG_MISMATCH;
+            err        = ALC_ERROR_TAG_MISMATCH;
+        }
+        memset(tag, 0, sizeof(tag));
+    }
+
+    return err;
+}
+
+alc_error_t
+CryptGcmMb(alc_aead_mb_job_t* pJobs, Uint64 numJobs, bool isEncrypt)
+{
+    GcmMbPacket pkts[cGcmMbGroupSize];
+    alc_error_t err = ALC_ERROR_NONE;
+
+    for (Uint64 first = 0; first < numJobs; first += cGcmMbGroupSize) {
+        Uint64 count = std::min(cGcmMbGroupSize, numJobs - first);
+
+        if (gcmMbGroup(pJobs + first, count, pkts, isEncrypt)
+            != ALC_ERROR_NONE) {
+            err = ALC_ERROR_TAG_MISMATCH;
+        }
+    }
+
+    // clear keystream, tag masks and the partial blocks
+    memset(pkts, 0, sizeof(pkts));
+
+    return err;
+}
+
+} // namespace alcp::cipher::vaes512
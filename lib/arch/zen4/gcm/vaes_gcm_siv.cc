@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <immintrin.h>
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_gcm_siv.hh"
+#include "alcp/cipher/gmul.hh"
+#include "avx512.hh"
+#include "avx512_gmul.hh"
+
+#include "vaes_avx512.hh"
+#include "vaes_avx512_core.hh"
+
+#include "alcp/types.hh"
+
+namespace alcp::cipher::vaes512 {
+
+// Lanes hold H^top, H^(top-1), H^(top-2), H^(top-3), lowest lane first
+static inline __m512i
+loadHashPowers(const __m128i pHtable[], int top)
+{
+    __m512i h = _mm512_castsi128_si512(pHtable[top - 1]);
+    h         = _mm512_inserti32x4(h, pHtable[top - 2], 1);
+    h         = _mm512_inserti32x4(h, pHtable[top - 3], 2);
+    return _mm512_inserti32x4(h, pHtable[top - 4], 3);
+}
+
+/*
+ * Reduce the Karatsuba components of all four lanes into the POLYVAL state,
+ * kept in the lowest lane.
+ */
+static inline void
+polyvalReduce(__m512i&      z0_512,
+              __m512i&      z1_512,
+              __m512i&      z2_512,
+              __m512i&      state,
+              const __m256i const_factor_256)
+{
+    __m128i z0_or_low  = amd512_horizontal_sum128(z0_512);
+    __m128i z2_or_high = amd512_horizontal_sum128(z2_512);
+    __m128i z1         = amd512_horizontal_sum128(z1_512);
+
+    aesni::computeKaratsubaMul(z0_or_low, z1, z2_or_high);
+    __m256i z2z0 = _mm256_set_m128i(z2_or_high, z0_or_low);
+    montgomeryReduction(z2z0, state, const_factor_256);
+}
+
+template<void AesEncNoLoad_1x512(__m512i& a, const sKeys& keys),
+         void AesEncNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys)>
+static inline void
+CryptCtr32(const Uint8    pIn[],
+           Uint8          pOut[],
+           Uint64         len,
+           const __m128i* pkey128,
+           const Uint8    counter[])
+{
+    auto p_in_512  = reinterpret_cast<const __m512i*>(pIn);
+    auto p_out_512 = reinterpret_cast<__m512i*>(pOut);
+
+    // little endian 32 bit counter in the first word of each lane
+    const __m512i four_x =
+        _mm512_setr_epi32(4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0);
+    const __m512i eight_x = _mm512_add_epi32(four_x, four_x);
+    const __m512i twelve_x = _mm512_add_epi32(eight_x, four_x);
+    const __m512i sixteen_x = _mm512_add_epi32(eight_x, eight_x);
+
+    __m512i c1 = _mm512_broadcast_i32x4(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(counter)));
+    c1 = _mm512_add_epi32(
+        c1, _mm512_setr_epi32(0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0));
+
+    __m512i a1, a2, a3, a4;
+    __m512i b1, b2, b3, b4;
+
+    sKeys keys{};
+    alcp_load_key_zmm(pkey128, keys);
+
+    for (; len >= 256; len -= 256) {
+        b1 = c1;
+        b2 = _mm512_add_epi32(c1, four_x);
+        b3 = _mm512_add_epi32(c1, eight_x);
+        b4 = _mm512_add_epi32(c1, twelve_x);
+
+        AesEncNoLoad_4x512(b1, b2, b3, b4, keys);
+
+        a1 = _mm512_loadu_si512(p_in_512);
+        a2 = _mm512_loadu_si512(p_in_512 + 1);
+        a3 = _mm512_loadu_si512(p_in_512 + 2);
+        a4 = _mm512_loadu_si512(p_in_512 + 3);
+
+        _mm512_storeu_si512(p_out_512, _mm512_xor_si512(a1, b1));
+        _mm512_storeu_si512(p_out_512 + 1, _mm512_xor_si512(a2, b2));
+        _mm512_storeu_si512(p_out_512 + 2, _mm512_xor_si512(a3, b3));
+        _mm512_storeu_si512(p_out_512 + 3, _mm512_xor_si512(a4, b4));
+
+        c1 = _mm512_add_epi32(c1, sixteen_x);
+        p_in_512 += 4;
+        p_out_512 += 4;
+    }
+
+    for (; len >= 64; len -= 64) {
+        b1 = c1;
+        AesEncNoLoad_1x512(b1, keys);
+
+        a1 = _mm512_loadu_si512(p_in_512);
+        _mm512_storeu_si512(p_out_512, _mm512_xor_si512(a1, b1));
+
+        c1 = _mm512_add_epi32(c1, four_x);
+        p_in_512++;
+        p_out_512++;
+    }
+
+    if (len) {
+        __mmask64 mask = (1ULL << len) - 1;
+
+        b1 = c1;
+        AesEncNoLoad_1x512(b1, keys);
+
+        a1 = _mm512_maskz_loadu_epi8(mask, p_in_512);
+        _mm512_mask_storeu_epi8(p_out_512, mask, _mm512_xor_si512(a1, b1));
+    }
+
+    alcp_clear_keys_zmm(keys);
+}
+
+namespace gcmsiv {
+
+    void Polyval(const Uint8   pIn[],
+                 Uint64        len,
+                 const __m128i pHtable[],
+                 __m128i&      state)
+    {
+        const __m256i const_factor_256 = _mm256_set_epi64x(
+            0xC200000000000000, 0x1, 0xC200000000000000, 0x1);
+
+        auto    p_in_512 = reinterpret_cast<const __m512i*>(pIn);
+        __m512i state_512 = _mm512_castsi128_si512(state);
+        __m512i z0_512, z1_512, z2_512;
+        __m512i a, b, c, d;
+
+        // H^4..H^1 serve the last four blocks of every step
+        __m512i h4321 = loadHashPowers(pHtable, 4);
+
+        if (len >= 256) {
+            __m512i h16 = loadHashPowers(pHtable, 16);
+            __m512i h12 = loadHashPowers(pHtable, 12);
+            __m512i h8  = loadHashPowers(pHtable, 8);
+
+            // 16 blocks aggregated in one reduction
+            for (; len >= 256; len -= 256) {
+                a = _mm512_loadu_si512(p_in_512);
+                b = _mm512_loadu_si512(p_in_512 + 1);
+                c = _mm512_loadu_si512(p_in_512 + 2);
+                d = _mm512_loadu_si512(p_in_512 + 3);
+
+                amd512xorLast128bit(a, state_512);
+
+                computeKaratsubaComponents(h16, a, z0_512, z1_512, z2_512);
+                computeKaratsubaComponentsAccumulate(
+                    h12, b, z0_512, z1_512, z2_512);
+                computeKaratsubaComponentsAccumulate(
+                    h8, c, z0_512, z1_512, z2_512);
+                computeKaratsubaComponentsAccumulate(
+                    h4321, d, z0_512, z1_512, z2_512);
+
+                polyvalReduce(
+                    z0_512, z1_512, z2_512, state_512, const_factor_256);
+                p_in_512 += 4;
+            }
+        }
+
+        for (; len >= 64; len -= 64) {
+            a = _mm512_loadu_si512(p_in_512);
+            amd512xorLast128bit(a, state_512);
+
+            computeKaratsubaComponents(h4321, a, z0_512, z1_512, z2_512);
+            polyvalReduce(z0_512, z1_512, z2_512, state_512, const_factor_256);
+            p_in_512++;
+        }
+
+        if (len) {
+            // zero padded tail of 1 to 4 blocks, the missing lanes get zero
+            // powers so they drop out of the sum
+            Uint64            blocks    = (len + 15) / 16;
+            alignas(64) __m128i h[4] = {};
+            for (Uint64 i = 0; i < blocks; i++) {
+                h[i] = pHtable[blocks - 1 - i];
+            }
+            __m512i h_tail = _mm512_load_si512(h);
+
+            a = _mm512_maskz_loadu_epi8((1ULL << len) - 1, p_in_512);
+            amd512xorLast128bit(a, state_512);
+
+            computeKaratsubaComponents(h_tail, a, z0_512, z1_512, z2_512);
+            polyvalReduce(z0_512, z1_512, z2_512, state_512, const_factor_256);
+        }
+
+        state = _mm512_castsi512_si128(state_512);
+    }
+
+    void CryptCtr32(const Uint8 pIn[],
+                    Uint8       pOut[],
+                    Uint64      len,
+                    const Uint8 pKey[],
+                    int         nRounds,
+                    const Uint8 counter[])
+    {
+        auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+        // GCM-SIV is only defined for 128 and 256 bit keys
+        if (nRounds == 10) {
+            vaes512::CryptCtr32<AesEncryptNoLoad_1x512Rounds10,
+                                AesEncryptNoLoad_4x512Rounds10,
+                                alcp_load_key_zmm_10rounds,
+                                alcp_clear_keys_zmm_10rounds>(
+                pIn, pOut, len, pkey128, counter);
+        } else {
+            vaes512::CryptCtr32<AesEncryptNoLoad_1x512Rounds14,
+                                AesEncryptNoLoad_4x512Rounds14,
+                                alcp_load_key_zmm_14rounds,
+                                alcp_clear_keys_zmm_14rounds>(
+                pIn, pOut, len, pkey128, counter);
+        }
+    }
+
+} // namespace gcmsiv
+
+} // namespace alcp::cipher::vaes512
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
+#include "alcp/cipher/poly1305_mb_core.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::zen4 {
+
+// 8 lanes of 64 bits
+struct PolyVec512
+{
+    using T = __m512i;
+
+    static constexpr Uint32 cLanes = 8;
+
+    static inline T load(const Uint64* p) { return _mm512_loadu_si512(p); }
+    static inline void store(Uint64* p, T a) { _mm512_storeu_si512(p, a); }
+
+    static inline T add(T a, T b) { return _mm512_add_epi64(a, b); }
+    static inline T and_(T a, T b) { return _mm512_and_si512(a, b); }
+    static inline T or_(T a, T b) { return _mm512_or_si512(a, b); }
+    static inline T mul(T a, T b) { return _mm512_mul_epu32(a, b); }
+    static inline T set1(Uint64 a) { return _mm512_set1_epi64(a); }
+
+    template<int N>
+    static inline T srli(T a)
+    {
+        return _mm512_srli_epi64(a, N);
+    }
+    template<int N>
+    static inline T slli(T a)
+    {
+        return _mm512_slli_epi64(a, N);
+    }
+
+    // a holds the blocks of the even lanes, b those of the odd lanes
+    static inline void loadBlocks(const Uint8* const p[], T& lo, T& hi)
+    {
+        auto load128 = [&](int l) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p[l]));
+        };
+        T a = _mm512_castsi128_si512(load128(0));
+        T b = _mm512_castsi128_si512(load128(1));
+        a   = _mm512_inserti32x4(a, load128(2), 1);
+        b   = _mm512_inserti32x4(b, load128(3), 1);
+        a   = _mm512_inserti32x4(a, load128(4), 2);
+        b   = _mm512_inserti32x4(b, load128(5), 2);
+        a   = _mm512_inserti32x4(a, load128(6), 3);
+        b   = _mm512_inserti32x4(b, load128(7), 3);
+        lo  = _mm512_unpacklo_epi64(a, b);
+        hi  = _mm512_unpackhi_epi64(a, b);
+    }
+};
+
+void
+Poly1305Mb(Poly1305MbLanes& lanes, Uint64 blocks)
+{
+    poly1305mb::Blocks<PolyVec512, cChaChaPolyMbLanes>(lanes, blocks);
+}
+
+} // namespace alcp::cipher::zen4
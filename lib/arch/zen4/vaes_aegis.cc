@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <immintrin.h>
+
+#include "alcp/cipher/aegis.hh"
+#include "alcp/cipher/aegis_core.hh"
+
+namespace alcp::cipher::vaes512::aegis {
+
+using alcp::cipher::aegis::Aegis128LCore;
+
+// the four AEGIS-128X4 lanes of a state word fill one zmm
+struct Zmm
+{
+    using T                         = __m512i;
+    static constexpr Uint64 cBytes = 64;
+
+    static inline T    load(const Uint8* p) { return _mm512_loadu_si512(p); }
+    static inline void store(Uint8* p, T a) { _mm512_storeu_si512(p, a); }
+    static inline T    xor_(T a, T b) { return _mm512_xor_si512(a, b); }
+    static inline T    and_(T a, T b) { return _mm512_and_si512(a, b); }
+    static inline T round(T in, T rk) { return _mm512_aesenc_epi128(in, rk); }
+};
+
+using Core = Aegis128LCore<Zmm, AegisParams<AegisVariant::e128X4>::cLanes>;
+
+template<AegisVariant cV>
+void
+Absorb(AegisState& st, const Uint8 pIn[], Uint64 chunks)
+{
+    static_assert(cV == AegisVariant::e128X4);
+    Core core;
+    core.load(st);
+    core.absorb(pIn, chunks);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Encrypt(AegisState& st, const Uint8 pIn[], Uint8 pOut[], Uint64 chunks)
+{
+    static_assert(cV == AegisVariant::e128X4);
+    Core core;
+    core.load(st);
+    core.encrypt(pIn, pOut, chunks);
+    core.store(st);
+}
+
+template<AegisVariant cV>
+void
+Decrypt(AegisState& st, const Uint8 pIn[], Uint8 pOut[], Uint64 chunks)
+{
+    static_assert(cV == AegisVariant::e128X4);
+    Core core;
+    core.load(st);
+    core.decrypt(pIn, pOut, chunks);
+    core.store(st);
+}
+
+template void
+Absorb<AegisVariant::e128X4>(AegisState&, const Uint8[], Uint64);
+template void
+Encrypt<AegisVariant::e128X4>(AegisState&, const Uint8[], Uint8[], Uint64);
+template void
+Decrypt<AegisVariant::e128X4>(AegisState&, const Uint8[], Uint8[], Uint64);
+
+} // namespace alcp::cipher::vaes512::aegis
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes512 {
+
+static inline __m512i
+loadLanes(const Uint8* const pSrc[4])
+{
+    __m512i a = _mm512_castsi128_si512(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[0])));
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[1])), 1);
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[2])), 2);
+    a = _mm512_inserti32x4(
+        a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc[3])), 3);
+    return a;
+}
+
+static inline void
+storeLanes(Uint8* const pDst[4], __m512i a)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[0]),
+                     _mm512_castsi512_si128(a));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[1]),
+                     _mm512_extracti32x4_epi32(a, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[2]),
+                     _mm512_extracti32x4_epi32(a, 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst[3]),
+                     _mm512_extracti32x4_epi32(a, 3));
+}
+
+/*
+ * CBC encryption of cCbcMbLanes independent streams, four streams per zmm.
+ */
+void
+EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds)
+{
+    constexpr Uint32 cLanes = cCbcMbLanes;
+    constexpr Uint32 cRegs  = cLanes / 4;
+
+    __m512i      c[cRegs];
+    const Uint8* p_src[cLanes];
+    Uint8*       p_dst[cLanes];
+
+    auto p_iv = reinterpret_cast<const __m512i*>(lanes.m_iv);
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        c[i] = _mm512_load_si512(p_iv + i);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        p_src[l] = lanes.m_pSrc[l];
+        p_dst[l] = lanes.m_pDst[l];
+    }
+
+    for (; blocks > 0; blocks--) {
+        auto p_key = reinterpret_cast<const __m512i*>(lanes.m_round_keys[0]);
+
+        UNROLL_4
+        for (Uint32 i = 0; i < cRegs; i++) {
+            __m512i p = loadLanes(&p_src[4 * i]);
+            c[i]      = _mm512_ternarylogic_epi64(
+                c[i], p, _mm512_load_si512(p_key + i), 0x96);
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            p_key = reinterpret_cast<const __m512i*>(lanes.m_round_keys[r]);
+
+            UNROLL_4
+            for (Uint32 i = 0; i < cRegs; i++) {
+                c[i] =
+                    _mm512_aesenc_epi128(c[i], _mm512_load_si512(p_key + i));
+            }
+        }
+
+        p_key = reinterpret_cast<const __m512i*>(lanes.m_round_keys[nRounds]);
+
+        UNROLL_4
+        for (Uint32 i = 0; i < cRegs; i++) {
+            c[i] =
+                _mm512_aesenclast_epi128(c[i], _mm512_load_si512(p_key + i));
+            storeLanes(&p_dst[4 * i], c[i]);
+        }
+
+        for (Uint32 l = 0; l < cLanes; l++) {
+            p_src[l] += lanes.m_step[l];
+            p_dst[l] += lanes.m_step[l];
+        }
+    }
+
+    auto p_iv_out = reinterpret_cast<__m512i*>(lanes.m_iv);
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        _mm512_store_si512(p_iv_out + i, c[i]);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_pSrc[l] = p_src[l];
+        lanes.m_pDst[l] = p_dst[l];
+    }
+}
+
+} // namespace alcp::cipher::vaes512
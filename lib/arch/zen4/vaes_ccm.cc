@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/base.hh"
+
+#include <cstdint>
+#include <immintrin.h>
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_ccm.hh"
+#include "avx512.hh"
+
+#include "vaes_avx512.hh"
+#include "vaes_avx512_core.hh"
+
+namespace alcp::cipher::vaes512 {
+
+/*
+ * Single block rounds for the CBC-MAC chain. The round keys are the ones
+ * already broadcast for the CTR lanes, only the low 128 bits are used.
+ */
+static inline void
+AesEncryptNoLoad_1x128Rounds10(__m128i& a, const sKeys& keys)
+{
+    const sKeys10Rounds& k = keys.data.keys10;
+
+    a = _mm_xor_si128(a, _mm512_castsi512_si128(k.key_512_0));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_1));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_2));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_3));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_4));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_5));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_6));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_7));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_8));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_9));
+    a = _mm_aesenclast_si128(a, _mm512_castsi512_si128(k.key_512_10));
+}
+
+static inline void
+AesEncryptNoLoad_1x128Rounds12(__m128i& a, const sKeys& keys)
+{
+    const sKeys12Rounds& k = keys.data.keys12;
+
+    a = _mm_xor_si128(a, _mm512_castsi512_si128(k.key_512_0));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_1));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_2));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_3));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_4));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_5));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_6));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_7));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_8));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_9));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_10));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_11));
+    a = _mm_aesenclast_si128(a, _mm512_castsi512_si128(k.key_512_12));
+}
+
+static inline void
+AesEncryptNoLoad_1x128Rounds14(__m128i& a, const sKeys& keys)
+{
+    const sKeys14Rounds& k = keys.data.keys14;
+
+    a = _mm_xor_si128(a, _mm512_castsi512_si128(k.key_512_0));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_1));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_2));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_3));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_4));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_5));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_6));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_7));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_8));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_9));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_10));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_11));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_12));
+    a = _mm_aesenc_si128(a, _mm512_castsi512_si128(k.key_512_13));
+    a = _mm_aesenclast_si128(a, _mm512_castsi512_si128(k.key_512_14));
+}
+
+// CBC-MAC over the four blocks held in a zmm, lowest lane first
+template<void AesEncNoLoad_1x128(__m128i& a, const sKeys& keys)>
+static inline void
+CbcMac4(__m128i& cmac, const __m512i& blk, const sKeys& keys)
+{
+    cmac = _mm_xor_si128(cmac, _mm512_castsi512_si128(blk));
+    AesEncNoLoad_1x128(cmac, keys);
+    cmac = _mm_xor_si128(cmac, _mm512_extracti32x4_epi32(blk, 1));
+    AesEncNoLoad_1x128(cmac, keys);
+    cmac = _mm_xor_si128(cmac, _mm512_extracti32x4_epi32(blk, 2));
+    AesEncNoLoad_1x128(cmac, keys);
+    cmac = _mm_xor_si128(cmac, _mm512_extracti32x4_epi32(blk, 3));
+    AesEncNoLoad_1x128(cmac, keys);
+}
+
+/*
+ * CTR keystream for four blocks per zmm, sixteen blocks per iteration, while
+ * the serial CBC-MAC chain runs on xmm over the same data. The two have no
+ * dependency on each other so the CTR rounds hide in the MAC latency.
+ *
+ * Counter lanes are kept with the 32 bit big endian counter byte swapped, so
+ * a plain epi32 add increments them. Like aesni::ccm the counter wraps in 32
+ * bits and a trailing partial block does not advance it.
+ */
+template<void AesEncNoLoad_1x128(__m128i& a, const sKeys& keys),
+         void AesEncNoLoad_1x512(__m512i& a, const sKeys& keys),
+         void AesEncNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys),
+         bool cIsEncrypt>
+static inline CCM_ERROR
+CryptCcm(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+{
+    auto p_in_512  = reinterpret_cast<const __m512i*>(pinp);
+    auto p_out_512 = reinterpret_cast<__m512i*>(pout);
+
+    const __m128i swap_ctr_128 =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12);
+    const __m512i swap_ctr = _mm512_broadcast_i32x4(swap_ctr_128);
+    const __m512i four_x =
+        _mm512_set_epi32(4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0);
+
+    __m128i cmac = _mm_load_si128(reinterpret_cast<__m128i*>(ccm_data->cmac));
+    __m128i nonce =
+        _mm_load_si128(reinterpret_cast<__m128i*>(ccm_data->nonce));
+
+    // Lanes hold counter + 0, 1, 2, 3
+    __m512i ctr = _mm512_shuffle_epi8(_mm512_broadcast_i32x4(nonce), swap_ctr);
+    ctr         = _mm512_add_epi32(
+        ctr, _mm512_set_epi32(3, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0));
+
+    __m512i a1, a2, a3, a4;
+    __m512i c1, c2, c3, c4;
+
+    sKeys keys;
+    alcp_load_key_zmm(reinterpret_cast<const __m128i*>(ccm_data->key), keys);
+
+    for (; len >= 256; len -= 256) {
+        c1  = ctr;
+        c2  = _mm512_add_epi32(c1, four_x);
+        c3  = _mm512_add_epi32(c2, four_x);
+        c4  = _mm512_add_epi32(c3, four_x);
+        ctr = _mm512_add_epi32(c4, four_x);
+
+        c1 = _mm512_shuffle_epi8(c1, swap_ctr);
+        c2 = _mm512_shuffle_epi8(c2, swap_ctr);
+        c3 = _mm512_shuffle_epi8(c3, swap_ctr);
+        c4 = _mm512_shuffle_epi8(c4, swap_ctr);
+
+        AesEncNoLoad_4x512(c1, c2, c3, c4, keys);
+
+        alcp_loadu_4values(p_in_512, a1, a2, a3, a4);
+
+        if constexpr (cIsEncrypt) {
+            // MAC over plaintext
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a1, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a2, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a3, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a4, keys);
+        }
+
+        a1 = _mm512_xor_si512(a1, c1);
+        a2 = _mm512_xor_si512(a2, c2);
+        a3 = _mm512_xor_si512(a3, c3);
+        a4 = _mm512_xor_si512(a4, c4);
+
+        if constexpr (!cIsEncrypt) {
+            // MAC over recovered plaintext
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a1, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a2, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a3, keys);
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a4, keys);
+        }
+
+        alcp_storeu_4values(p_out_512, a1, a2, a3, a4);
+
+        p_in_512 += 4;
+        p_out_512 += 4;
+    }
+
+    for (; len >= 64; len -= 64) {
+        c1  = _mm512_shuffle_epi8(ctr, swap_ctr);
+        ctr = _mm512_add_epi32(ctr, four_x);
+        AesEncNoLoad_1x512(c1, keys);
+
+        a1 = alcp_loadu(p_in_512);
+        if constexpr (cIsEncrypt) {
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a1, keys);
+        }
+        a1 = _mm512_xor_si512(a1, c1);
+        if constexpr (!cIsEncrypt) {
+            CbcMac4<AesEncNoLoad_1x128>(cmac, a1, keys);
+        }
+        alcp_storeu(p_out_512, a1);
+
+        p_in_512++;
+        p_out_512++;
+    }
+
+    nonce = _mm512_castsi512_si128(ctr);
+    if (len) {
+        // Up to three full blocks and a partial one, bytes past len are zero
+        // which is exactly the padding CBC-MAC needs.
+        __mmask64 mask   = (1ULL << len) - 1;
+        Uint64    blocks = (len + 15) / 16;
+
+        c1 = _mm512_shuffle_epi8(ctr, swap_ctr);
+        AesEncNoLoad_1x512(c1, keys);
+
+        a1 = _mm512_maskz_loadu_epi8(mask, p_in_512);
+        c1 = _mm512_xor_si512(a1, c1);
+        _mm512_mask_storeu_epi8(p_out_512, mask, c1);
+        if constexpr (!cIsEncrypt) {
+            a1 = _mm512_maskz_mov_epi8(mask, c1);
+        }
+
+        for (Uint64 i = 0; i < blocks; i++) {
+            cmac = _mm_xor_si128(cmac, _mm512_castsi512_si128(a1));
+            AesEncNoLoad_1x128(cmac, keys);
+            a1 = _mm512_alignr_epi64(a1, a1, 2);
+        }
+
+        // Only the full blocks consume a counter
+        nonce = _mm_add_epi32(
+            nonce, _mm_set_epi32(static_cast<int>(len / 16), 0, 0, 0));
+    }
+    nonce = _mm_shuffle_epi8(nonce, swap_ctr_128);
+
+    // Copy the current state of cmac and nonce back to memory.
+    _mm_store_si128(reinterpret_cast<__m128i*>(ccm_data->cmac), cmac);
+    _mm_store_si128(reinterpret_cast<__m128i*>(ccm_data->nonce), nonce);
+
+    alcp_clear_keys_zmm(keys);
+    return CCM_ERROR::NO_ERROR;
+}
+
+namespace ccm {
+
+    CCM_ERROR
+    Encrypt(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+    {
+        switch (ccm_data->rounds) {
+            case 10:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds10,
+                                AesEncryptNoLoad_1x512Rounds10,
+                                AesEncryptNoLoad_4x512Rounds10,
+                                alcp_load_key_zmm_10rounds,
+                                alcp_clear_keys_zmm_10rounds,
+                                true>(ccm_data, pinp, pout, len);
+            case 12:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds12,
+                                AesEncryptNoLoad_1x512Rounds12,
+                                AesEncryptNoLoad_4x512Rounds12,
+                                alcp_load_key_zmm_12rounds,
+                                alcp_clear_keys_zmm_12rounds,
+                                true>(ccm_data, pinp, pout, len);
+            default:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds14,
+                                AesEncryptNoLoad_1x512Rounds14,
+                                AesEncryptNoLoad_4x512Rounds14,
+                                alcp_load_key_zmm_14rounds,
+                                alcp_clear_keys_zmm_14rounds,
+                                true>(ccm_data, pinp, pout, len);
+        }
+    }
+
+    CCM_ERROR
+    Decrypt(ccm_data_t* ccm_data, const Uint8 pinp[], Uint8 pout[], Uint64 len)
+    {
+        switch (ccm_data->rounds) {
+            case 10:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds10,
+                                AesEncryptNoLoad_1x512Rounds10,
+                                AesEncryptNoLoad_4x512Rounds10,
+                                alcp_load_key_zmm_10rounds,
+                                alcp_clear_keys_zmm_10rounds,
+                                false>(ccm_data, pinp, pout, len);
+            case 12:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds12,
+                                AesEncryptNoLoad_1x512Rounds12,
+                                AesEncryptNoLoad_4x512Rounds12,
+                                alcp_load_key_zmm_12rounds,
+                                alcp_clear_keys_zmm_12rounds,
+                                false>(ccm_data, pinp, pout, len);
+            default:
+                return CryptCcm<AesEncryptNoLoad_1x128Rounds14,
+                                AesEncryptNoLoad_1x512Rounds14,
+                                AesEncryptNoLoad_4x512Rounds14,
+                                alcp_load_key_zmm_14rounds,
+                                alcp_clear_keys_zmm_14rounds,
+                                false>(ccm_data, pinp, pout, len);
+        }
+    }
+
+} // namespace ccm
+
+} // namespace alcp::cipher::vaes512
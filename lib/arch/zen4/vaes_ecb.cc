@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/base.hh"
+
+#include <cstdint>
+#include <immintrin.h>
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "avx512.hh"
+
+#include "vaes_avx512.hh"
+#include "vaes_avx512_core.hh"
+
+namespace alcp::cipher::vaes512 {
+
+/*
+ * Blocks are independent in ECB, encrypt and decrypt share the same loop and
+ * only differ in the round helpers. len is a multiple of the block size.
+ */
+template<void AesNoLoad_1x512(__m512i& a, const sKeys& keys),
+         void AesNoLoad_2x512(__m512i& a, __m512i& b, const sKeys& keys),
+         void AesNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys)>
+alc_error_t inline CryptEcb(const Uint8* pSrc, // ptr to input
+                            Uint8*       pDest, // ptr to output
+                            Uint64       len,   // message length in bytes
+                            const Uint8* pKey   // ptr to Key
+)
+{
+    Uint64 blocks    = len / Rijndael::cBlockSize;
+    auto   pkey128   = reinterpret_cast<const __m128i*>(pKey);
+    auto   p_in_512  = reinterpret_cast<const __m512i*>(pSrc);
+    auto   p_out_512 = reinterpret_cast<__m512i*>(pDest);
+
+    __m512i a1, a2, a3, a4, a5, a6, a7, a8;
+
+    sKeys keys;
+    alcp_load_key_zmm(pkey128, keys);
+
+    // two independent 4x512 chains keep both AES pipes busy
+    for (; blocks >= 32; blocks -= 32) {
+        alcp_loadu_4values(p_in_512, a1, a2, a3, a4);
+        alcp_loadu_4values(p_in_512 + 4, a5, a6, a7, a8);
+
+        AesNoLoad_4x512(a1, a2, a3, a4, keys);
+        AesNoLoad_4x512(a5, a6, a7, a8, keys);
+
+        alcp_storeu_4values(p_out_512, a1, a2, a3, a4);
+        alcp_storeu_4values(p_out_512 + 4, a5, a6, a7, a8);
+
+        p_in_512 += 8;
+        p_out_512 += 8;
+    }
+
+    if (blocks >= 16) {
+        alcp_loadu_4values(p_in_512, a1, a2, a3, a4);
+        AesNoLoad_4x512(a1, a2, a3, a4, keys);
+        alcp_storeu_4values(p_out_512, a1, a2, a3, a4);
+
+        p_in_512 += 4;
+        p_out_512 += 4;
+        blocks -= 16;
+    }
+
+    if (blocks >= 8) {
+        alcp_loadu_2values(p_in_512, a1, a2);
+        AesNoLoad_2x512(a1, a2, keys);
+        alcp_storeu_2values(p_out_512, a1, a2);
+
+        p_in_512 += 2;
+        p_out_512 += 2;
+        blocks -= 8;
+    }
+
+    if (blocks >= 4) {
+        a1 = alcp_loadu(p_in_512);
+        AesNoLoad_1x512(a1, keys);
+        alcp_storeu(p_out_512, a1);
+
+        p_in_512++;
+        p_out_512++;
+        blocks -= 4;
+    }
+
+    if (blocks) {
+        // 1 to 3 blocks left, two 64 bit elements per block
+        __mmask8 mask = static_cast<__mmask8>((1U << (blocks * 2)) - 1);
+
+        a1 = _mm512_maskz_loadu_epi64(mask, p_in_512);
+        AesNoLoad_1x512(a1, keys);
+        _mm512_mask_storeu_epi64(p_out_512, mask, a1);
+    }
+
+    alcp_clear_keys_zmm(keys);
+    return ALC_ERROR_NONE;
+}
+
+} // namespace alcp::cipher::vaes512
+
+namespace alcp::cipher {
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey128Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesEncryptNoLoad_1x512Rounds10,
+                    AesEncryptNoLoad_2x512Rounds10,
+                    AesEncryptNoLoad_4x512Rounds10,
+                    alcp_load_key_zmm_10rounds,
+                    alcp_clear_keys_zmm_10rounds>(pSrc, pDest, len, pKey);
+}
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey192Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesEncryptNoLoad_1x512Rounds12,
+                    AesEncryptNoLoad_2x512Rounds12,
+                    AesEncryptNoLoad_4x512Rounds12,
+                    alcp_load_key_zmm_12rounds,
+                    alcp_clear_keys_zmm_12rounds>(pSrc, pDest, len, pKey);
+}
+
+template<>
+alc_error_t
+EncryptEcb<alcp::cipher::CipherKeyLen::eKey256Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesEncryptNoLoad_1x512Rounds14,
+                    AesEncryptNoLoad_2x512Rounds14,
+                    AesEncryptNoLoad_4x512Rounds14,
+                    alcp_load_key_zmm_14rounds,
+                    alcp_clear_keys_zmm_14rounds>(pSrc, pDest, len, pKey);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey128Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesDecryptNoLoad_1x512Rounds10,
+                    AesDecryptNoLoad_2x512Rounds10,
+                    AesDecryptNoLoad_4x512Rounds10,
+                    alcp_load_key_zmm_10rounds,
+                    alcp_clear_keys_zmm_10rounds>(pSrc, pDest, len, pKey);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey192Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesDecryptNoLoad_1x512Rounds12,
+                    AesDecryptNoLoad_2x512Rounds12,
+                    AesDecryptNoLoad_4x512Rounds12,
+                    alcp_load_key_zmm_12rounds,
+                    alcp_clear_keys_zmm_12rounds>(pSrc, pDest, len, pKey);
+}
+
+template<>
+alc_error_t
+DecryptEcb<alcp::cipher::CipherKeyLen::eKey256Bit,
+           alcp::utils::CpuCipherFeatures::eVaes512>(
+    const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, int nRounds)
+{
+    using namespace vaes512;
+    return CryptEcb<AesDecryptNoLoad_1x512Rounds14,
+                    AesDecryptNoLoad_2x512Rounds14,
+                    AesDecryptNoLoad_4x512Rounds14,
+                    alcp_load_key_zmm_14rounds,
+                    alcp_clear_keys_zmm_14rounds>(pSrc, pDest, len, pKey);
+}
+
+} // namespace alcp::cipher
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/aes_kw.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher::vaes512 {
+
+static inline __m512i
+loadR(Uint8* const pR[4])
+{
+    __m512i r = _mm512_castsi128_si512(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[0])));
+    r = _mm512_inserti32x4(
+        r, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[1])), 1);
+    r = _mm512_inserti32x4(
+        r, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[2])), 2);
+    r = _mm512_inserti32x4(
+        r, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pR[3])), 3);
+    return r;
+}
+
+// high 64 bits of every 128-bit lane of b to R[i]
+static inline void
+storeR(Uint8* const pR[4], __m512i b)
+{
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[0]),
+                  _mm_castsi128_pd(_mm512_castsi512_si128(b)));
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[1]),
+                  _mm_castsi128_pd(_mm512_extracti32x4_epi32(b, 1)));
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[2]),
+                  _mm_castsi128_pd(_mm512_extracti32x4_epi32(b, 2)));
+    _mm_storeh_pd(reinterpret_cast<double*>(pR[3]),
+                  _mm_castsi128_pd(_mm512_extracti32x4_epi32(b, 3)));
+}
+
+/*
+ * Key wrap of cKwMbLanes independent keys, four keys per zmm.
+ */
+template<bool cWrap>
+static inline void
+kwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pKey, int nRounds)
+{
+    constexpr Uint32 cLanes = cKwMbLanes;
+    constexpr Uint32 cRegs  = cLanes / 4;
+
+    // t is xored big endian into A
+    const __m512i swap = _mm512_broadcast_i32x4(_mm_set_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 0, 1, 2, 3, 4, 5, 6, 7));
+    const __m512i one  = _mm512_set_epi64(0, 1, 0, 1, 0, 1, 0, 1);
+
+    __m512i a[cRegs], t[cRegs], b[cRegs];
+    Uint8*  p_r[cLanes];
+
+    auto p_key = reinterpret_cast<const __m128i*>(pKey);
+    auto p_a   = reinterpret_cast<__m512i*>(lanes.m_a);
+    auto p_t   = reinterpret_cast<__m512i*>(lanes.m_t);
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        a[i] = _mm512_load_si512(p_a + i);
+        t[i] = _mm512_load_si512(p_t + i);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        p_r[l] = lanes.m_pR[l];
+    }
+
+    for (; steps > 0; steps--) {
+        __m512i k = _mm512_broadcast_i32x4(_mm_load_si128(p_key));
+
+        UNROLL_4
+        for (Uint32 i = 0; i < cRegs; i++) {
+            __m512i r = loadR(&p_r[4 * i]);
+            if constexpr (!cWrap) {
+                a[i] = _mm512_xor_si512(a[i], _mm512_shuffle_epi8(t[i], swap));
+                t[i] = _mm512_sub_epi64(t[i], one);
+            }
+            b[i] = _mm512_xor_si512(_mm512_unpacklo_epi64(a[i], r), k);
+        }
+
+        for (int r = 1; r < nRounds; r++) {
+            k = _mm512_broadcast_i32x4(_mm_load_si128(p_key + r));
+
+            UNROLL_4
+            for (Uint32 i = 0; i < cRegs; i++) {
+                if constexpr (cWrap) {
+                    b[i] = _mm512_aesenc_epi128(b[i], k);
+                } else {
+                    b[i] = _mm512_aesdec_epi128(b[i], k);
+                }
+            }
+        }
+
+        k = _mm512_broadcast_i32x4(_mm_load_si128(p_key + nRounds));
+
+        UNROLL_4
+        for (Uint32 i = 0; i < cRegs; i++) {
+            if constexpr (cWrap) {
+                b[i] = _mm512_aesenclast_epi128(b[i], k);
+                a[i] = _mm512_xor_si512(b[i], _mm512_shuffle_epi8(t[i], swap));
+                t[i] = _mm512_add_epi64(t[i], one);
+            } else {
+                b[i] = _mm512_aesdeclast_epi128(b[i], k);
+                a[i] = b[i];
+            }
+            storeR(&p_r[4 * i], b[i]);
+        }
+
+        for (Uint32 l = 0; l < cLanes; l++) {
+            if constexpr (cWrap) {
+                p_r[l] = (p_r[l] == lanes.m_pLast[l]) ? lanes.m_pFirst[l]
+                                                      : p_r[l] + 8;
+            } else {
+                p_r[l] = (p_r[l] == lanes.m_pFirst[l]) ? lanes.m_pLast[l]
+                                                       : p_r[l] - 8;
+            }
+        }
+    }
+
+    UNROLL_4
+    for (Uint32 i = 0; i < cRegs; i++) {
+        _mm512_store_si512(p_a + i, a[i]);
+        _mm512_store_si512(p_t + i, t[i]);
+    }
+    for (Uint32 l = 0; l < cLanes; l++) {
+        lanes.m_pR[l] = p_r[l];
+    }
+}
+
+void
+WrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pEncKey, int nRounds)
+{
+    kwMb<true>(lanes, steps, pEncKey, nRounds);
+}
+
+void
+UnwrapKwMb(AesKwLanes& lanes, Uint64 steps, const Uint8* pDecKey, int nRounds)
+{
+    kwMb<false>(lanes, steps, pDecKey, nRounds);
+}
+
+} // namespace alcp::cipher::vaes512
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/aes_ocb.hh"
+#include "alcp/types.hh"
+
+#include <immintrin.h>
+
+#include "avx512.hh"
+#include "vaes_avx512.hh"
+#include "vaes_avx512_core.hh"
+
+namespace alcp::cipher::vaes512 {
+
+static inline Uint64
+ntz(Uint64 n)
+{
+    return __builtin_ctzll(n);
+}
+
+// 64 bit lane mask of the zmm holding blocks 4k+1 .. 4k+4 out of n blocks
+static inline __mmask8
+laneMask(Uint64 n, Uint64 k)
+{
+    if (n >= 4 * k + 4) {
+        return 0xff;
+    }
+    if (n <= 4 * k) {
+        return 0;
+    }
+    return static_cast<__mmask8>((1U << ((n - 4 * k) * 2)) - 1);
+}
+
+static inline __m128i
+foldSum(__m512i sum)
+{
+    __m256i s = _mm256_xor_si256(_mm512_castsi512_si256(sum),
+                                 _mm512_extracti64x4_epi64(sum, 1));
+    return _mm_xor_si128(_mm256_castsi256_si128(s),
+                         _mm256_extracti128_si256(s, 1));
+}
+
+/*
+ * 16 blocks per step. Once the block number is a multiple of 16 the offsets of
+ * a step are the broadcast offset xored with the gray table, only the last
+ * block of a full step depends on the block number. Leading blocks that
+ * reach that alignment run on AES-NI, the trailing partial step is masked.
+ */
+template<void AesNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys),
+         OcbOp cOp>
+static inline void
+OcbBlocks(const Uint8      pIn[],
+          Uint8            pOut[],
+          Uint64           blocks,
+          const Uint8      pKey[],
+          int              nRounds,
+          const OcbLTable& table,
+          OcbPass&         pass)
+{
+    Uint64 lead = (ALCP_OCB_MAX_BATCH - pass.blocks % ALCP_OCB_MAX_BATCH)
+                  % ALCP_OCB_MAX_BATCH;
+    lead = lead < blocks ? lead : blocks;
+    if (lead) {
+        if constexpr (cOp == OcbOp::eEncrypt) {
+            aesni::ocb::Encrypt(pIn, pOut, lead, pKey, nRounds, table, pass);
+        } else if constexpr (cOp == OcbOp::eDecrypt) {
+            aesni::ocb::Decrypt(pIn, pOut, lead, pKey, nRounds, table, pass);
+        } else {
+            aesni::ocb::Hash(pIn, lead, pKey, nRounds, table, pass);
+        }
+        blocks -= lead;
+        pIn += lead * Rijndael::cBlockSize;
+        if constexpr (cOp != OcbOp::eHash) {
+            pOut += lead * Rijndael::cBlockSize;
+        }
+    }
+    if (blocks == 0) {
+        return;
+    }
+
+    auto p_in_512  = reinterpret_cast<const __m512i*>(pIn);
+    auto p_out_512 = reinterpret_cast<__m512i*>(pOut);
+    auto pkey128   = reinterpret_cast<const __m128i*>(pKey);
+
+    Uint64  idx    = pass.blocks;
+    __m128i offset = pass.offset;
+    __m512i sum    = _mm512_setzero_si512();
+
+    // gray[1..15], the last lane is patched with L_ntz(n) for full steps
+    const __m512i g1 = _mm512_loadu_si512(&table.gray[1]);
+    const __m512i g2 = _mm512_loadu_si512(&table.gray[5]);
+    const __m512i g3 = _mm512_loadu_si512(&table.gray[9]);
+    __m512i       g4 = _mm512_loadu_si512(&table.gray[12]);
+    g4 = _mm512_shuffle_i64x2(g4, g4, _MM_SHUFFLE(3, 3, 2, 1));
+
+    __m512i a1, a2, a3, a4;
+    __m512i o1, o2, o3, o4;
+
+    sKeys keys{};
+    alcp_load_key_zmm(pkey128, keys);
+
+    for (; blocks >= ALCP_OCB_MAX_BATCH; blocks -= ALCP_OCB_MAX_BATCH) {
+        __m512i off = _mm512_broadcast_i32x4(offset);
+        o1          = _mm512_xor_si512(off, g1);
+        o2          = _mm512_xor_si512(off, g2);
+        o3          = _mm512_xor_si512(off, g3);
+        o4          = _mm512_xor_si512(off, g4);
+        o4          = _mm512_mask_xor_epi64(
+            o4,
+            0xc0,
+            o4,
+            _mm512_broadcast_i32x4(table.l[ntz(idx + ALCP_OCB_MAX_BATCH)]));
+
+        alcp_loadu_4values(p_in_512, a1, a2, a3, a4);
+        if constexpr (cOp == OcbOp::eEncrypt) {
+            sum = _mm512_ternarylogic_epi64(sum, a1, a2, 0x96);
+            sum = _mm512_ternarylogic_epi64(sum, a3, a4, 0x96);
+        }
+        alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+
+        AesNoLoad_4x512(a1, a2, a3, a4, keys);
+
+        if constexpr (cOp == OcbOp::eHash) {
+            sum = _mm512_ternarylogic_epi64(sum, a1, a2, 0x96);
+            sum = _mm512_ternarylogic_epi64(sum, a3, a4, 0x96);
+        } else {
+            alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+            alcp_storeu_4values(p_out_512, a1, a2, a3, a4);
+            if constexpr (cOp == OcbOp::eDecrypt) {
+                sum = _mm512_ternarylogic_epi64(sum, a1, a2, 0x96);
+                sum = _mm512_ternarylogic_epi64(sum, a3, a4, 0x96);
+            }
+            p_out_512 += 4;
+        }
+
+        offset = _mm512_extracti32x4_epi32(o4, 3);
+        idx += ALCP_OCB_MAX_BATCH;
+        p_in_512 += 4;
+    }
+
+    if (blocks) {
+        // 1 to 15 blocks, unused lanes are masked out of the sum
+        __mmask8 m1 = laneMask(blocks, 0), m2 = laneMask(blocks, 1);
+        __mmask8 m3 = laneMask(blocks, 2), m4 = laneMask(blocks, 3);
+
+        __m512i off = _mm512_broadcast_i32x4(offset);
+        o1          = _mm512_xor_si512(off, g1);
+        o2          = _mm512_xor_si512(off, g2);
+        o3          = _mm512_xor_si512(off, g3);
+        o4          = _mm512_xor_si512(off, g4);
+
+        a1 = _mm512_maskz_loadu_epi64(m1, p_in_512);
+        a2 = _mm512_maskz_loadu_epi64(m2, p_in_512 + 1);
+        a3 = _mm512_maskz_loadu_epi64(m3, p_in_512 + 2);
+        a4 = _mm512_maskz_loadu_epi64(m4, p_in_512 + 3);
+        if constexpr (cOp == OcbOp::eEncrypt) {
+            sum = _mm512_ternarylogic_epi64(sum, a1, a2, 0x96);
+            sum = _mm512_ternarylogic_epi64(sum, a3, a4, 0x96);
+        }
+        alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+
+        AesNoLoad_4x512(a1, a2, a3, a4, keys);
+
+        if constexpr (cOp != OcbOp::eHash) {
+            alcp_xor_4values(o1, o2, o3, o4, a1, a2, a3, a4);
+            _mm512_mask_storeu_epi64(p_out_512, m1, a1);
+            _mm512_mask_storeu_epi64(p_out_512 + 1, m2, a2);
+            _mm512_mask_storeu_epi64(p_out_512 + 2, m3, a3);
+            _mm512_mask_storeu_epi64(p_out_512 + 3, m4, a4);
+        }
+        if constexpr (cOp != OcbOp::eEncrypt) {
+            sum = _mm512_mask_xor_epi64(sum, m1, sum, a1);
+            sum = _mm512_mask_xor_epi64(sum, m2, sum, a2);
+            sum = _mm512_mask_xor_epi64(sum, m3, sum, a3);
+            sum = _mm512_mask_xor_epi64(sum, m4, sum, a4);
+        }
+
+        offset = _mm_xor_si128(offset, table.gray[blocks]);
+        idx += blocks;
+    }
+
+    alcp_clear_keys_zmm(keys);
+
+    pass.offset = offset;
+    pass.sum    = _mm_xor_si128(pass.sum, foldSum(sum));
+    pass.blocks = idx;
+}
+
+template<OcbOp cOp>
+static inline void
+OcbCrypt(const Uint8      pIn[],
+         Uint8            pOut[],
+         Uint64           blocks,
+         const Uint8      pKey[],
+         int              nRounds,
+         const OcbLTable& table,
+         OcbPass&         pass)
+{
+    constexpr bool cDec = (cOp == OcbOp::eDecrypt);
+
+    switch (nRounds) {
+        case 10:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x512Rounds10
+                           : AesEncryptNoLoad_4x512Rounds10,
+                      alcp_load_key_zmm_10rounds,
+                      alcp_clear_keys_zmm_10rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+        case 12:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x512Rounds12
+                           : AesEncryptNoLoad_4x512Rounds12,
+                      alcp_load_key_zmm_12rounds,
+                      alcp_clear_keys_zmm_12rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+        default:
+            OcbBlocks<cDec ? AesDecryptNoLoad_4x512Rounds14
+                           : AesEncryptNoLoad_4x512Rounds14,
+                      alcp_load_key_zmm_14rounds,
+                      alcp_clear_keys_zmm_14rounds,
+                      cOp>(pIn, pOut, blocks, pKey, nRounds, table, pass);
+            break;
+    }
+}
+
+namespace ocb {
+
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eEncrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eDecrypt>(
+            pIn, pOut, blocks, pKey, nRounds, table, pass);
+    }
+
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass)
+    {
+        OcbCrypt<OcbOp::eHash>(
+            pIn, nullptr, blocks, pKey, nRounds, table, pass);
+    }
+
+} // namespace ocb
+
+} // namespace alcp::cipher::vaes512
@@ -371,16 +371,20 @@ EncryptXtsAvx512(const Uint8* pSrc,
     Uint8* p_dest8      = reinterpret_cast<Uint8*>(p_dest512);
     auto   p_src8       = reinterpret_cast<const Uint8*>(p_src512);
 
-    utils::CopyBytes(
-        reinterpret_cast<Uint8*>(p_dest512),
-        reinterpret_cast<__m512i*>(reinterpret_cast<Uint8*>(p_dest512) - 16),
-        extra_bytes_in_message_block);
 #if 1
     if (extra_bytes_in_message_block) {
         __m512i stealed_text, temp_tweak;
         Uint8*  p_stealed_text = reinterpret_cast<Uint8*>(&stealed_text);
         Uint8*  p_temp_tweak   = reinterpret_cast<Uint8*>(&temp_tweak);
 
+        // read the partial source block before it is overwritten, the source
+        // and the destination may be the same buffer
+        utils::CopyBytes(p_stealed_text,
+                         p_src8 + ((16 * (blocks))),
+                         (extra_bytes_in_message_block));
+
+        utils::CopyBytes(p_dest8, p_dest8 - 16, extra_bytes_in_message_block);
+
         utils::CopyBytes(p_temp_tweak, p_lastTweak8, (16));
 
         utils::CopyBytes(
@@ -388,10 +392,6 @@ EncryptXtsAvx512(const Uint8* pSrc,
             (p_dest8 - 16)+ (extra_bytes_in_message_block + 16 *blocks),
             (16 - extra_bytes_in_message_block));
 
-        utils::CopyBytes(p_stealed_text,
-                         p_src8 + ((16 * (blocks))),
-                         (extra_bytes_in_message_block));
-
         stealed_text = _mm512_xor_epi64(temp_tweak, stealed_text);
         AesEnc_1x512(&stealed_text, p_key128, nRounds);
         stealed_text = _mm512_xor_epi64(temp_tweak, stealed_text);
@@ -761,14 +761,20 @@ DecryptXtsAvx512(const Uint8* pSrc,
     // CipherText Stealing
     if (extra_bytes_in_message_block) {
 
-        utils::CopyBytes(p_dest8 + (16 * blocks),
-                         p_dest8 + (16 * (blocks - 1)),
-                         extra_bytes_in_message_block);
-
         __m512i stealed_text, tweak_1;
         Uint8*  p_stealed_text = reinterpret_cast<Uint8*>(&stealed_text);
         Uint8*  p_tweak_1      = reinterpret_cast<Uint8*>(&tweak_1);
 
+        // read the partial source block before it is overwritten, the source
+        // and the destination may be the same buffer
+        utils::CopyBytes(p_stealed_text,
+                         p_src8 + ((16 * (blocks))),
+                         (extra_bytes_in_message_block));
+
+        utils::CopyBytes(p_dest8 + (16 * blocks),
+                         p_dest8 + (16 * (blocks - 1)),
+                         extra_bytes_in_message_block);
+
         utils::CopyBytes(p_tweak_1, p_lastTweak8 + ((16 * (blocks))), (16));
 
         utils::CopyBytes(
@@ -776,10 +782,6 @@ DecryptXtsAvx512(const Uint8* pSrc,
             p_dest8 + (extra_bytes_in_message_block + (16 * (blocks - 1))),
             (16 - extra_bytes_in_message_block));
 
-        utils::CopyBytes(p_stealed_text,
-                         p_src8 + ((16 * (blocks))),
-                         (extra_bytes_in_message_block));
-
         stealed_text = _mm512_xor_epi64(tweak_1, stealed_text);
         AesDec_1x512(&stealed_text, p_key128, nRounds);
         stealed_text = _mm512_xor_epi64(tweak_1, stealed_text);
@@ -32,6 +32,7 @@
 
 #include "alcp/capi/cipher/ctx.hh"
 #include "alcp/capi/defs.hh"
+#include "alcp/cipher/chacha20.hh"
 
 using namespace alcp::cipher;
 
@@ -40,7 +41,7 @@ EXTERN_C_BEGIN
 Uint64
 alcp_cipher_context_size()
 {
-    Uint64 size = sizeof(Context);
+    Uint64 size = cContextSize;
 #ifdef ALCP_ENABLE_DEBUG_LOGGING
     ALCP_DEBUG_LOG(LOG_DBG, "CtxSize %6ld", size);
 #endif
@@ -75,6 +76,8 @@ static CipherMode
 getCipherMode(const alc_cipher_mode_t mode)
 {
     switch (mode) {
+        case ALC_AES_MODE_ECB:
+            return CipherMode::eAesECB;
         case ALC_AES_MODE_CBC:
             return CipherMode::eAesCBC;
         case ALC_AES_MODE_OFB:
@@ -87,6 +90,8 @@ getCipherMode(const alc_cipher_mode_t mode)
             return CipherMode::eAesXTS;
         case ALC_CHACHA20:
             return CipherMode::eCHACHA20;
+        case ALC_XCHACHA20:
+            return CipherMode::eXCHACHA20;
         default:
             return CipherMode::eCipherModeNone;
     }
@@ -110,10 +115,10 @@ alcp_cipher_request(const alc_cipher_mode_t mode,
 
     ALCP_ZERO_LEN_ERR_RET(keyLen, err);
 
-    auto alcpCipher       = new CipherFactory<iCipher>;
-    ctx->m_cipher_factory = static_cast<void*>(alcpCipher);
+    CipherFactory<iCipher> factory;
+    factory.setStorage(ctx->storage(), cContextStorageSize);
 
-    auto aead = alcpCipher->create(getCipherMode(mode), getKeyLen(keyLen));
+    auto aead = factory.create(getCipherMode(mode), getKeyLen(keyLen));
 
     if (aead == nullptr) {
         printf("\n cipher algo create failed");
@@ -214,6 +219,78 @@ alcp_cipher_init(const alc_cipher_handle_p pCipherHandle,
     return err;
 }
 
+alc_error_t
+alcp_cipher_set_parallelism(const alc_cipher_handle_p pCipherHandle,
+                            Uint32                    numThreads,
+                            Uint64                    chunkSize)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(
+        LOG_DBG, "NumThreads %6d,ChunkSize %6ld", numThreads, chunkSize);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipher*>(ctx->m_cipher);
+    err    = i->setParallelism(numThreads, chunkSize);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_set_stream_offset(const alc_cipher_handle_p pCipherHandle,
+                              Uint64                    byteOffset)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "ByteOffset %6ld", byteOffset);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipher*>(ctx->m_cipher);
+    err    = i->setStreamOffset(byteOffset);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_hchacha20(const Uint8* pKey,
+                      Uint64       keyLen,
+                      const Uint8* pNonces,
+                      Uint64       numNonces,
+                      Uint8*       pSubkeys)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "KeyLen %6ld,NumNonces %6ld", keyLen, numNonces);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+    ALCP_BAD_PTR_ERR_RET(pNonces, err);
+    ALCP_BAD_PTR_ERR_RET(pSubkeys, err);
+    ALCP_ZERO_LEN_ERR_RET(numNonces, err);
+
+    err = HChaCha20(pKey, keyLen, pNonces, numNonces, pSubkeys);
+
+    return err;
+}
+
 void
 alcp_cipher_finish(const alc_cipher_handle_p pCipherHandle)
 {
@@ -227,12 +304,7 @@ alcp_cipher_finish(const alc_cipher_handle_p pCipherHandle)
     if (ctx->destructed == 1) {
         return;
     }
-    auto alcpCipher =
-        static_cast<CipherFactory<iCipher>*>(ctx->m_cipher_factory);
-
-    if (alcpCipher != nullptr) {
-        delete alcpCipher;
-    }
+    CipherFactory<iCipher>::destroy(static_cast<iCipher*>(ctx->m_cipher));
 
     ctx->~Context();
 }
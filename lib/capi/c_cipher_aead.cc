@@ -33,6 +33,7 @@
 
 #include "alcp/capi/cipher/ctx.hh"
 #include "alcp/capi/defs.hh"
+#include "alcp/cipher/prepared_key.hh"
 
 using namespace alcp::cipher;
 
@@ -41,7 +42,7 @@ EXTERN_C_BEGIN
 Uint64
 alcp_cipher_aead_context_size()
 {
-    Uint64 size = sizeof(Context);
+    Uint64 size = cContextSize;
 #ifdef ALCP_ENABLE_DEBUG_LOGGING
     ALCP_DEBUG_LOG(LOG_DBG, "CtxSize %6ld", size);
 #endif
@@ -70,8 +71,22 @@ getCipherAeadMode(const alc_cipher_mode_t mode)
             return CipherMode::eAesCCM;
         case ALC_AES_MODE_SIV:
             return CipherMode::eAesSIV;
+        case ALC_AES_MODE_GCM_SIV:
+            return CipherMode::eAesGCMSIV;
+        case ALC_AES_MODE_OCB:
+            return CipherMode::eAesOCB;
+        case ALC_AEGIS128L:
+            return CipherMode::eAEGIS128L;
+        case ALC_AEGIS256:
+            return CipherMode::eAEGIS256;
+        case ALC_AEGIS128X2:
+            return CipherMode::eAEGIS128X2;
+        case ALC_AEGIS128X4:
+            return CipherMode::eAEGIS128X4;
         case ALC_CHACHA20_POLY1305:
             return CipherMode::eCHACHA20_POLY1305;
+        case ALC_XCHACHA20_POLY1305:
+            return CipherMode::eXCHACHA20_POLY1305;
         default:
             return CipherMode::eCipherModeNone;
     }
@@ -95,10 +110,10 @@ alcp_cipher_aead_request(const alc_cipher_mode_t mode,
 
     ALCP_ZERO_LEN_ERR_RET(keyLen, err);
 
-    auto alcpCipher       = new CipherFactory<iCipherAead>;
-    ctx->m_cipher_factory = static_cast<void*>(alcpCipher);
+    CipherFactory<iCipherAead> factory;
+    factory.setStorage(ctx->storage(), cContextStorageSize);
 
-    auto aead = alcpCipher->create(getCipherAeadMode(mode), getKeyLen(keyLen));
+    auto aead = factory.create(getCipherAeadMode(mode), getKeyLen(keyLen));
     if (aead == nullptr) {
         printf("\n cipher algo create failed");
         return ALC_ERROR_GENERIC;
@@ -124,11 +139,11 @@ alcp_cipher_aead_request_with_extState(const alc_cipher_mode_t mode,
 
     ALCP_ZERO_LEN_ERR_RET(keyLen, err);
 
-    auto alcpCipher       = new CipherFactory<iCipherAead>;
-    ctx->m_cipher_factory = static_cast<void*>(alcpCipher);
+    CipherFactory<iCipherAead> factory;
+    factory.setStorage(ctx->storage(), cContextStorageSize);
     // printf("\n aead request cipherstate %p ", (void*)pCipherState);
 
-    auto aead = alcpCipher->create(
+    auto aead = factory.create(
         getCipherAeadMode(mode), getKeyLen(keyLen), pCipherState);
     if (aead == nullptr) {
         printf("\n cipher algo create failed");
@@ -229,6 +244,35 @@ alcp_cipher_aead_init(const alc_cipher_handle_p pCipherHandle,
     return err;
 }
 
+alc_error_t
+alcp_cipher_aead_init_with_key(const alc_cipher_handle_p       pCipherHandle,
+                               const alc_cipher_prepared_key_p pKey,
+                               const Uint8*                    pIv,
+                               Uint64                          ivLen)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "IVLen %6ld", ivLen);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipherAead*>(ctx->m_cipher);
+
+    err = i->initWithKey(
+        reinterpret_cast<const PreparedKey*>(pKey), pIv, ivLen);
+
+    return err;
+}
+
 alc_error_t
 alcp_cipher_aead_set_aad(const alc_cipher_handle_p pCipherHandle,
                          const Uint8*              pInput,
@@ -289,6 +333,36 @@ alcp_cipher_aead_get_tag(const alc_cipher_handle_p pCipherHandle,
     return err;
 }
 
+alc_error_t
+alcp_cipher_aead_set_expected_tag(const alc_cipher_handle_p pCipherHandle,
+                                  const Uint8*              pTag,
+                                  Uint64                    tagLen)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "TagLen %6ld", tagLen);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+
+    ALCP_BAD_PTR_ERR_RET(pTag, err);
+
+    ALCP_ZERO_LEN_ERR_RET(tagLen, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipherAead*>(ctx->m_cipher);
+
+    err = i->setExpectedTag(pTag, tagLen);
+
+    return err;
+}
+
 alc_error_t
 alcp_cipher_aead_set_tag_length(const alc_cipher_handle_p pCipherHandle,
                                 Uint64                    tagLen)
@@ -335,6 +409,57 @@ alcp_cipher_aead_set_ccm_plaintext_length(
     return err;
 }
 
+static alc_error_t
+aeadBatch(const alc_cipher_handle_p pCipherHandle,
+          alc_aead_packet_t*        pPackets,
+          Uint64                    numPackets,
+          bool                      isEncrypt)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "NumPackets %6ld", numPackets);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+
+    ALCP_BAD_PTR_ERR_RET(pPackets, err);
+
+    ALCP_ZERO_LEN_ERR_RET(numPackets, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipherAead*>(ctx->m_cipher);
+
+    if (isEncrypt) {
+        err = i->sealBatch(pPackets, numPackets);
+    } else {
+        err = i->openBatch(pPackets, numPackets);
+    }
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_aead_seal_batch(const alc_cipher_handle_p pCipherHandle,
+                            alc_aead_packet_t*        pPackets,
+                            Uint64                    numPackets)
+{
+    return aeadBatch(pCipherHandle, pPackets, numPackets, true);
+}
+
+alc_error_t
+alcp_cipher_aead_open_batch(const alc_cipher_handle_p pCipherHandle,
+                            alc_aead_packet_t*        pPackets,
+                            Uint64                    numPackets)
+{
+    return aeadBatch(pCipherHandle, pPackets, numPackets, false);
+}
+
 void
 alcp_cipher_aead_finish(const alc_cipher_handle_p pCipherHandle)
 {
@@ -351,12 +476,8 @@ alcp_cipher_aead_finish(const alc_cipher_handle_p pCipherHandle)
     if (ctx->destructed == 1) {
         return;
     }
-    auto alcpCipher =
-        static_cast<CipherFactory<iCipherAead>*>(ctx->m_cipher_factory);
-
-    if (alcpCipher != nullptr) {
-        delete alcpCipher;
-    }
+    CipherFactory<iCipherAead>::destroy(
+        static_cast<iCipherAead*>(ctx->m_cipher));
 
     // ctx->finish(ctx);
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/alcp.hh"
+#include "alcp/cipher.hh"
+#include "alcp/cipher_key.h"
+
+#include "alcp/capi/cipher/ctx.hh"
+#include "alcp/capi/defs.hh"
+#include "alcp/cipher/prepared_key.hh"
+
+using namespace alcp::cipher;
+
+EXTERN_C_BEGIN
+
+static CipherMode
+getPreparedKeyMode(const alc_cipher_mode_t mode)
+{
+    switch (mode) {
+        case ALC_AES_MODE_ECB:
+            return CipherMode::eAesECB;
+        case ALC_AES_MODE_CBC:
+            return CipherMode::eAesCBC;
+        case ALC_AES_MODE_OFB:
+            return CipherMode::eAesOFB;
+        case ALC_AES_MODE_CTR:
+            return CipherMode::eAesCTR;
+        case ALC_AES_MODE_CFB:
+            return CipherMode::eAesCFB;
+        case ALC_AES_MODE_XTS:
+            return CipherMode::eAesXTS;
+        case ALC_AES_MODE_GCM:
+            return CipherMode::eAesGCM;
+        case ALC_AES_MODE_CCM:
+            return CipherMode::eAesCCM;
+        case ALC_AES_MODE_OCB:
+            return CipherMode::eAesOCB;
+        default:
+            return CipherMode::eCipherModeNone;
+    }
+}
+
+alc_error_t
+alcp_cipher_prepared_key_create(const alc_cipher_mode_t    mode,
+                                const Uint8*               pKey,
+                                Uint64                     keyLen,
+                                alc_cipher_prepared_key_p* ppKey)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "KeyLen %6ld", keyLen);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+    ALCP_BAD_PTR_ERR_RET(ppKey, err);
+    ALCP_ZERO_LEN_ERR_RET(keyLen, err);
+
+    PreparedKey* p_key = nullptr;
+
+    err = PreparedKey::create(getPreparedKeyMode(mode), pKey, keyLen, &p_key);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    *ppKey = reinterpret_cast<alc_cipher_prepared_key_p>(p_key);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_prepared_key_retain(const alc_cipher_prepared_key_p pKey)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_INFO);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+
+    reinterpret_cast<const PreparedKey*>(pKey)->retain();
+
+    return err;
+}
+
+void
+alcp_cipher_prepared_key_release(const alc_cipher_prepared_key_p pKey)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_INFO);
+#endif
+    if (pKey == nullptr)
+        return;
+
+    reinterpret_cast<const PreparedKey*>(pKey)->release();
+}
+
+alc_error_t
+alcp_cipher_init_with_key(const alc_cipher_handle_p       pCipherHandle,
+                          const alc_cipher_prepared_key_p pKey,
+                          const Uint8*                    pIv,
+                          Uint64                          ivLen)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "IVLen %6ld", ivLen);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+
+    auto i = static_cast<iCipher*>(ctx->m_cipher);
+
+    err = i->initWithKey(
+        reinterpret_cast<const PreparedKey*>(pKey), pIv, ivLen);
+
+    return err;
+}
+
+EXTERN_C_END
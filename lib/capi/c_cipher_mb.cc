@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/alcp.hh"
+#include "alcp/cipher_mb.h"
+
+#include "alcp/capi/defs.hh"
+#include "alcp/cipher/aes_mb.hh"
+
+using namespace alcp::cipher;
+
+EXTERN_C_BEGIN
+
+alc_error_t
+alcp_cipher_encrypt_cbc_mb(const alc_cipher_mb_job_t* pJobs, Uint64 numJobs)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "NumJobs %6ld", numJobs);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pJobs, err);
+    ALCP_ZERO_LEN_ERR_RET(numJobs, err);
+
+    err = EncryptCbcMb(pJobs, numJobs);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_aead_seal_gcm_mb(alc_aead_mb_job_t* pJobs, Uint64 numJobs)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "NumJobs %6ld", numJobs);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pJobs, err);
+    ALCP_ZERO_LEN_ERR_RET(numJobs, err);
+
+    err = CryptGcmMb(pJobs, numJobs, true);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_aead_open_gcm_mb(alc_aead_mb_job_t* pJobs, Uint64 numJobs)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "NumJobs %6ld", numJobs);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pJobs, err);
+    ALCP_ZERO_LEN_ERR_RET(numJobs, err);
+
+    err = CryptGcmMb(pJobs, numJobs, false);
+
+    return err;
+}
+
+EXTERN_C_END
@@ -78,10 +78,10 @@ alcp_cipher_segment_request(const alc_cipher_mode_t mode,
 
     ALCP_ZERO_LEN_ERR_RET(keyLen, err);
 
-    auto alcpCipher       = new CipherFactory<iCipherSeg>;
-    ctx->m_cipher_factory = static_cast<void*>(alcpCipher);
+    CipherFactory<iCipherSeg> factory;
+    factory.setStorage(ctx->storage(), cContextStorageSize);
 
-    auto aead = alcpCipher->create(getCipherMode(mode), getKeyLen(keyLen));
+    auto aead = factory.create(getCipherMode(mode), getKeyLen(keyLen));
 
     if (aead == nullptr) {
         printf("\n cipher algo create failed");
@@ -188,6 +188,66 @@ alcp_cipher_segment_decrypt_xts(const alc_cipher_handle_p pCipherHandle,
     return err;
 }
 
+alc_error_t
+alcp_cipher_segment_encrypt_xts_batch(const alc_cipher_handle_p pCipherHandle,
+                                      const alc_xts_sector_t*   pSectors,
+                                      Uint64                    numSectors,
+                                      Uint64                    dataUnitSize)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(
+        LOG_DBG, "NumSectors %6ld,DataUnitSize %6ld", numSectors, dataUnitSize);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pSectors, err);
+
+    ALCP_ZERO_LEN_ERR_RET(numSectors, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+    auto i = static_cast<iCipherSeg*>(ctx->m_cipher);
+    err    = i->encryptSectors(pSectors, numSectors, dataUnitSize);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_segment_decrypt_xts_batch(const alc_cipher_handle_p pCipherHandle,
+                                      const alc_xts_sector_t*   pSectors,
+                                      Uint64                    numSectors,
+                                      Uint64                    dataUnitSize)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(
+        LOG_DBG, "NumSectors %6ld,DataUnitSize %6ld", numSectors, dataUnitSize);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pSectors, err);
+
+    ALCP_ZERO_LEN_ERR_RET(numSectors, err);
+
+    auto ctx = static_cast<Context*>(pCipherHandle->ch_context);
+    if (ctx->destructed == 1) {
+        return ALC_ERROR_BAD_STATE;
+    }
+
+    ALCP_BAD_PTR_ERR_RET(ctx->m_cipher, err);
+    auto i = static_cast<iCipherSeg*>(ctx->m_cipher);
+    err    = i->decryptSectors(pSectors, numSectors, dataUnitSize);
+
+    return err;
+}
+
 void
 alcp_cipher_segment_finish(const alc_cipher_handle_p pCipherHandle)
 {
@@ -201,12 +261,7 @@ alcp_cipher_segment_finish(const alc_cipher_handle_p pCipherHandle)
     if (ctx->destructed == 1) {
         return;
     }
-    auto alcpCipher =
-        static_cast<CipherFactory<iCipherSeg>*>(ctx->m_cipher_factory);
-
-    if (alcpCipher != nullptr) {
-        delete alcpCipher;
-    }
+    CipherFactory<iCipherSeg>::destroy(static_cast<iCipherSeg*>(ctx->m_cipher));
 
     ctx->~Context();
 }
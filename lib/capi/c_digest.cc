@@ -32,6 +32,7 @@
 #include "alcp/capi/defs.hh"
 #include "alcp/capi/digest/builder.hh"
 #include "alcp/capi/digest/ctx.hh"
+#include "alcp/digest/digest_mb.hh"
 
 using namespace alcp;
 
@@ -40,7 +41,7 @@ EXTERN_C_BEGIN
 Uint64
 alcp_digest_context_size()
 {
-    Uint64 size = sizeof(digest::Context);
+    Uint64 size = digest::cContextSize;
 #ifdef ALCP_ENABLE_DEBUG_LOGGING
     ALCP_DEBUG_LOG(LOG_DBG, "CtxSize %6ld", size);
 #endif
@@ -191,4 +192,22 @@ alcp_digest_context_copy(const alc_digest_handle_p pSrcHandle,
     return err;
 }
 
+alc_error_t
+alcp_digest_mb(alc_digest_mode_t          mode,
+               const alc_digest_mb_job_t* pJobs,
+               Uint64                     numJobs)
+{
+#ifdef ALCP_ENABLE_DEBUG_LOGGING
+    ALCP_DEBUG_LOG(LOG_DBG, "NumJobs %6ld", numJobs);
+#endif
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pJobs, err);
+    ALCP_ZERO_LEN_ERR_RET(numJobs, err);
+
+    err = digest::DigestMb(mode, pJobs, numJobs);
+
+    return err;
+}
+
 EXTERN_C_END
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aegis.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace alcp::cipher {
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+static inline void
+aegisAbsorb(AegisState& st, const Uint8 pIn[], Uint64 chunks)
+{
+    constexpr bool cMultiLane =
+        cV == AegisVariant::e128X2 || cV == AegisVariant::e128X4;
+
+    if constexpr (cV == AegisVariant::e128X4
+                  && arch == CpuCipherFeatures::eVaes512) {
+        vaes512::aegis::Absorb<cV>(st, pIn, chunks);
+    } else if constexpr (cMultiLane
+                         && (arch == CpuCipherFeatures::eVaes512
+                             || arch == CpuCipherFeatures::eVaes256)) {
+        vaes::aegis::Absorb<cV>(st, pIn, chunks);
+    } else {
+        aesni::aegis::Absorb<cV>(st, pIn, chunks);
+    }
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch, bool cEnc>
+static inline void
+aegisCrypt(AegisState& st, const Uint8 pIn[], Uint8 pOut[], Uint64 chunks)
+{
+    constexpr bool cMultiLane =
+        cV == AegisVariant::e128X2 || cV == AegisVariant::e128X4;
+
+    if constexpr (cV == AegisVariant::e128X4
+                  && arch == CpuCipherFeatures::eVaes512) {
+        if constexpr (cEnc) {
+            vaes512::aegis::Encrypt<cV>(st, pIn, pOut, chunks);
+        } else {
+            vaes512::aegis::Decrypt<cV>(st, pIn, pOut, chunks);
+        }
+    } else if constexpr (cMultiLane
+                         && (arch == CpuCipherFeatures::eVaes512
+                             || arch == CpuCipherFeatures::eVaes256)) {
+        if constexpr (cEnc) {
+            vaes::aegis::Encrypt<cV>(st, pIn, pOut, chunks);
+        } else {
+            vaes::aegis::Decrypt<cV>(st, pIn, pOut, chunks);
+        }
+    } else {
+        if constexpr (cEnc) {
+            aesni::aegis::Encrypt<cV>(st, pIn, pOut, chunks);
+        } else {
+            aesni::aegis::Decrypt<cV>(st, pIn, pOut, chunks);
+        }
+    }
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+AegisT<cV, arch>::~AegisT()
+{
+    memset(&m_state, 0, sizeof(m_state));
+    memset(m_key, 0, sizeof(m_key));
+    memset(m_buf, 0, sizeof(m_buf));
+    memset(m_ks, 0, sizeof(m_ks));
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::init(const Uint8* pKey,
+                       Uint64       keyLen,
+                       const Uint8* pIv,
+                       Uint64       ivLen)
+{
+    // key and nonce lengths are fixed by the variant
+    if (pKey != nullptr && keyLen != 0) {
+        if (keyLen != Params::cKeyLen * 8) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+        memcpy(m_key, pKey, Params::cKeyLen);
+        m_isKeySet = true;
+    }
+    if (pIv != nullptr && ivLen != 0) {
+        if (ivLen != Params::cNonceLen) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+        memcpy(m_nonce, pIv, Params::cNonceLen);
+        m_isIvSet = true;
+    }
+
+    if (m_isKeySet && m_isIvSet) {
+        aesni::aegis::Init<cV>(m_state, m_key, m_nonce);
+    }
+    m_bufLen    = 0;
+    m_aadLen    = 0;
+    m_msgLen    = 0;
+    m_isAadDone = false;
+    m_isDone    = false;
+
+    return ALC_ERROR_NONE;
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::setAad(const Uint8* pInput, Uint64 aadLen)
+{
+    if (!m_isKeySet || !m_isIvSet || m_isAadDone || m_isDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (aadLen == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    m_aadLen += aadLen;
+
+    if (m_bufLen) {
+        Uint64 n = std::min(Params::cRate - m_bufLen, aadLen);
+        memcpy(m_buf + m_bufLen, pInput, n);
+        m_bufLen += n;
+        pInput += n;
+        aadLen -= n;
+        if (m_bufLen < Params::cRate) {
+            return ALC_ERROR_NONE;
+        }
+        aesni::aegis::Absorb<cV>(m_state, m_buf, 1);
+        m_bufLen = 0;
+    }
+
+    Uint64 chunks = aadLen / Params::cRate;
+    if (chunks) {
+        aegisAbsorb<cV, arch>(m_state, pInput, chunks);
+    }
+    m_bufLen = aadLen % Params::cRate;
+    memcpy(m_buf, pInput + chunks * Params::cRate, m_bufLen);
+
+    return ALC_ERROR_NONE;
+}
+
+// AAD and message are padded separately, the first message byte closes the AAD
+template<AegisVariant cV, CpuCipherFeatures arch>
+void
+AegisT<cV, arch>::startMessage()
+{
+    if (m_isAadDone) {
+        return;
+    }
+    if (m_bufLen) {
+        memset(m_buf + m_bufLen, 0, Params::cRate - m_bufLen);
+        aesni::aegis::Absorb<cV>(m_state, m_buf, 1);
+        m_bufLen = 0;
+    }
+    m_isAadDone = true;
+}
+
+/*
+ * A chunk which is not complete yet is encrypted right away with the
+ * keystream of the current state, its plaintext is kept until the chunk is
+ * complete and can update the state.
+ */
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::crypt(const Uint8* pInput,
+                        Uint8*       pOutput,
+                        Uint64       len,
+                        bool         isEnc)
+{
+    if (!m_isKeySet || !m_isIvSet || m_isDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (len == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr || pOutput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    startMessage();
+    m_msgLen += len;
+
+    auto partial = [&](Uint64 n) {
+        for (Uint64 i = 0; i < n; i++) {
+            Uint8 in            = pInput[i];
+            Uint8 out           = in ^ m_ks[m_bufLen + i];
+            m_buf[m_bufLen + i] = isEnc ? in : out;
+            pOutput[i]          = out;
+        }
+        m_bufLen += n;
+        pInput += n;
+        pOutput += n;
+        len -= n;
+    };
+
+    if (m_bufLen) {
+        partial(std::min(Params::cRate - m_bufLen, len));
+        if (m_bufLen < Params::cRate) {
+            return ALC_ERROR_NONE;
+        }
+        aesni::aegis::Absorb<cV>(m_state, m_buf, 1);
+        m_bufLen = 0;
+    }
+
+    Uint64 chunks = len / Params::cRate;
+    if (chunks) {
+        if (isEnc) {
+            aegisCrypt<cV, arch, true>(m_state, pInput, pOutput, chunks);
+        } else {
+            aegisCrypt<cV, arch, false>(m_state, pInput, pOutput, chunks);
+        }
+        pInput += chunks * Params::cRate;
+        pOutput += chunks * Params::cRate;
+        len -= chunks * Params::cRate;
+    }
+
+    if (len) {
+        aesni::aegis::Keystream<cV>(m_state, m_ks);
+        partial(len);
+    }
+
+    return ALC_ERROR_NONE;
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::encrypt(const Uint8* pInput, Uint8* pOutput, Uint64 len)
+{
+    return crypt(pInput, pOutput, len, true);
+}
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::decrypt(const Uint8* pInput, Uint8* pOutput, Uint64 len)
+{
+    return crypt(pInput, pOutput, len, false);
+}
+
+// Like GCM, decryption returns the computed tag and the caller compares it
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::getTag(Uint8* pTag, Uint64 tagLen)
+{
+    if (pTag == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (!m_isKeySet || !m_isIvSet || m_isDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (tagLen != ALCP_AEGIS_TAG_SIZE && tagLen != ALCP_AEGIS_TAG_SIZE_LONG) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    startMessage();
+    if (m_bufLen) {
+        memset(m_buf + m_bufLen, 0, Params::cRate - m_bufLen);
+        aesni::aegis::Absorb<cV>(m_state, m_buf, 1);
+        m_bufLen = 0;
+    }
+    aesni::aegis::Finalize<cV>(m_state, m_aadLen, m_msgLen, pTag, tagLen);
+    m_isDone = true;
+
+    return ALC_ERROR_NONE;
+}
+
+// both tag lengths are produced by the same finalization, nothing to store
+template<AegisVariant cV, CpuCipherFeatures arch>
+alc_error_t
+AegisT<cV, arch>::setTagLength(Uint64 tagLen)
+{
+    if (tagLen != ALCP_AEGIS_TAG_SIZE && tagLen != ALCP_AEGIS_TAG_SIZE_LONG) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    return ALC_ERROR_NONE;
+}
+
+// single lane variants gain nothing from wider registers
+template class AegisT<AegisVariant::e128L, CpuCipherFeatures::eAesni>;
+template class AegisT<AegisVariant::e256, CpuCipherFeatures::eAesni>;
+
+template class AegisT<AegisVariant::e128X2, CpuCipherFeatures::eVaes256>;
+template class AegisT<AegisVariant::e128X2, CpuCipherFeatures::eAesni>;
+
+template class AegisT<AegisVariant::e128X4, CpuCipherFeatures::eVaes512>;
+template class AegisT<AegisVariant::e128X4, CpuCipherFeatures::eVaes256>;
+template class AegisT<AegisVariant::e128X4, CpuCipherFeatures::eAesni>;
+
+} // namespace alcp::cipher
@@ -28,6 +28,8 @@
 
 #include "alcp/cipher/aes.hh"
 #include "alcp/cipher/aesni.hh"
+#include "alcp/cipher/prepared_key.hh"
+#include "alcp/utils/thread_pool.hh"
 
 namespace alcp::cipher {
 
@@ -42,6 +44,7 @@ Aes::setKey(const Uint8* pKey, const Uint64 keyLen)
         return ALC_ERROR_INVALID_SIZE;
     }
 
+    releasePreparedKey();
     Rijndael::initRijndael(pKey, keyLen);
     getKey();
     m_isKeySet_aes = 1; // FIXME: use enum instead
@@ -59,12 +62,65 @@ Aes::setKey(const Uint8* pKey, Uint8* pExpKey, const Uint64 keyLen)
         return ALC_ERROR_INVALID_SIZE;
     }
 
+    releasePreparedKey();
     Rijndael::initRijndael(pKey, pExpKey, keyLen);
     getKey();
     m_isKeySet_aes = 1; // FIXME: use enum instead
     return e;
 }
 
+alc_error_t
+Aes::setPreparedKey(const PreparedKey* pKey)
+{
+    if (pKey == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    // XTS keys come with a tweak key, every other mode uses the same
+    // schedule
+    bool isXtsKey = pKey->getMode() == CipherMode::eAesXTS;
+    if (isXtsKey != (m_mode == CipherMode::eAesXTS)) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    // keyLen should be same as keyLen used during create call
+    if (pKey->getKeyLen() != m_keyLen_in_bytes_aes * 8ULL) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    pKey->retain();
+    releasePreparedKey();
+    m_pPreparedKey = pKey;
+
+    Rijndael::setExpandedKeys(
+        pKey->getEncryptKeys(), pKey->getDecryptKeys(), pKey->getKeyLen());
+    getKey();
+    m_isKeySet_aes = 1;
+    return ALC_ERROR_NONE;
+}
+
+void
+Aes::releasePreparedKey()
+{
+    if (m_pPreparedKey != nullptr) {
+        m_pPreparedKey->release();
+        m_pPreparedKey = nullptr;
+    }
+}
+
+alc_error_t
+Aes::setParallel(Uint32 numThreads, Uint64 chunkSize)
+{
+    if (chunkSize % Rijndael::cBlockSize) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    m_numThreads = numThreads ? numThreads : utils::ThreadPool::getMaxThreads();
+    m_chunkSize  = chunkSize ? chunkSize : cParallelChunkSize;
+
+    return ALC_ERROR_NONE;
+}
+
 alc_error_t
 Aes::setIv(const Uint8* pIv, const Uint64 ivLen)
 {
@@ -129,7 +185,8 @@ Aes::setKey(const Uint8* pUserKey, Uint64 len)
 alc_error_t
 Aes::setMode(CipherMode mode)
 {
-    if ((mode <= CipherMode::eAesCBC) || (mode >= CipherMode::eCipherModeMax)) {
+    if ((mode == CipherMode::eCipherModeNone)
+        || (mode >= CipherMode::eCipherModeMax)) {
         // InvalidMode("aes mode not supported")
         return ALC_ERROR_NOT_SUPPORTED;
     }
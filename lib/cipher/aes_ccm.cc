@@ -28,6 +28,7 @@
 
 #include "alcp/cipher/aes_ccm.hh"
 
+#include <algorithm>
 #include <immintrin.h>
 #include <sstream>
 #include <string.h>
@@ -70,11 +71,6 @@ Ccm::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
         m_ccm_data.rounds    = cRounds;
     }
 
-#ifdef CCM_MULTI_UPDATE
-    if (ivLen != 0 && (m_is_plaintext_len_set == false)) {
-        return ALC_ERROR_BAD_STATE;
-    }
-#endif
     if (ivLen != 0 && m_tagLen != 0) {
         if (ivLen < 7 || ivLen > 13) {
             // s = status::InvalidValue(
@@ -95,15 +91,29 @@ Ccm::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
             m_ccm_data.cmac, m_ccm_data.cmac + sizeof(m_ccm_data.cmac), 0);
         m_ccm_data.nonce[0] = (static_cast<Uint8>(q - 1) & 7)
                               | static_cast<Uint8>(((t - 2) / 2) & 7) << 3;
-
-#ifdef CCM_MULTI_UPDATE
-        setIv(&(m_ccm_data), pIv, ivLen, m_plainTextLength);
-#endif
     }
+    // Length, nonce and AAD go into B0 when the first update arrives, as
+    // without setPlainTextLength() the length is only known then.
     m_ccm_data.blocks = 0;
+    m_is_started      = false;
+    m_updatedLength   = 0;
+    m_carryLen        = 0;
     return ALC_ERROR_NONE;
 }
 
+alc_error_t
+Ccm::initWithKey(const PreparedKey* pKey, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = setPreparedKey(pKey);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    m_ccm_data.key    = m_cipher_key_data.m_enc_key;
+    m_ccm_data.rounds = m_nrounds;
+
+    return init(nullptr, 0, pIv, ivLen);
+}
+
 alc_error_t
 copyTag(ccm_data_t* ctx, Uint8 ptag[], Uint64 tagLen)
 {
@@ -128,81 +138,124 @@ copyTag(ccm_data_t* ctx, Uint8 ptag[], Uint64 tagLen)
     return ALC_ERROR_NONE;
 }
 
+alc_error_t
+Ccm::startMessage(Uint64 len)
+{
+    alc_error_t err = setIv(&m_ccm_data, m_iv_aes, m_ivLen_aes, len);
+    if (alcp_is_error(err)) {
+        return err;
+    }
+    // Accelerate with AESNI
+    CCM_ERROR ccm_err = aesni::ccm::SetAad(
+        &m_ccm_data, m_additionalData, m_additionalDataLen, len);
+    switch (ccm_err) {
+        case CCM_ERROR::LEN_MISMATCH:
+            // CryptFailed("Length of plainText mismatch!")
+            return ALC_ERROR_INVALID_DATA;
+        case CCM_ERROR::DATA_OVERFLOW:
+            // CryptFailed("Overload of plaintext. Please reduce it!"
+            return ALC_ERROR_INVALID_DATA;
+        default:
+            break;
+    }
+    m_is_started = true;
+    return ALC_ERROR_NONE;
+}
+
+void
+Ccm::flushCarry()
+{
+    alignas(16) Uint8 scratch[16];
+
+    // Partial final block, kernel pads it with zeros for the CBC-MAC
+    m_cryptFn(&m_ccm_data, m_carry, scratch, m_carryLen);
+    memset(scratch, 0, sizeof(scratch));
+    memset(m_carry, 0, sizeof(m_carry));
+    m_carryLen = 0;
+}
+
 // FIXME: nRounds needs to be constexpr to be more efficient
 alc_error_t
 Ccm::cryptUpdate(const Uint8 pInput[],
                  Uint8       pOutput[],
                  Uint64      dataLen,
-                 bool        isEncrypt)
+                 CcmCryptFn  cryptFn)
 {
+    alc_error_t err = ALC_ERROR_NONE;
 
-#ifdef CCM_MULTI_UPDATE
     if (!m_ccm_data.key) {
         // InvalidValue : Key has to be set before update
         return ALC_ERROR_BAD_STATE;
     }
-#endif
-    alc_error_t err = ALC_ERROR_NONE;
     if ((pInput == NULL) || (pOutput == NULL)) {
         // InvalidValue: "Input or Output Null Pointer!"
         return ALC_ERROR_INVALID_ARG;
     }
 
-#ifndef CCM_MULTI_UPDATE
-    const Uint8* p_keys  = getEncryptKeys();
-    const Uint32 cRounds = m_nrounds;
-    m_ccm_data.key       = p_keys;
-    m_ccm_data.rounds    = cRounds;
-
-    // Below Operations has to be done in order
-    err = setIv(&m_ccm_data, m_iv_aes, m_ivLen_aes, dataLen);
-#endif
-    // Accelerate with AESNI
-    if (m_updatedLength == 0) {
-        aesni::ccm::SetAad(&m_ccm_data,
-                           m_additionalData,
-                           m_additionalDataLen,
-                           m_plainTextLength);
-    }
-    if (isEncrypt) {
-        CCM_ERROR ccm_err =
-            aesni::ccm::Encrypt(&m_ccm_data, pInput, pOutput, dataLen);
-        switch (ccm_err) {
-            case CCM_ERROR::LEN_MISMATCH:
-                // EncryptFailed("Length of plainText mismatch!")
-                err = ALC_ERROR_INVALID_DATA;
-                break;
-            case CCM_ERROR::DATA_OVERFLOW:
-                // EncryptFailed("Overload of plaintext. Please reduce it!"
-                err = ALC_ERROR_INVALID_DATA;
-                break;
-            default:
-                break;
-        }
-    } else {
-        CCM_ERROR ccm_err =
-            aesni::ccm::Decrypt(&m_ccm_data, pInput, pOutput, dataLen);
-        switch (ccm_err) {
-            // DecryptFailed("Length of plainText mismatch!")
-            case CCM_ERROR::LEN_MISMATCH:
-                err = ALC_ERROR_INVALID_DATA;
-                break;
-            default:
-                break;
+    if (!m_is_started) {
+        // Without a preset length the whole message comes in this call
+        if (!m_is_plaintext_len_set) {
+            m_plainTextLength = dataLen;
         }
+        err = startMessage(m_plainTextLength);
+    }
+    if (!alcp_is_error(err) && dataLen > m_plainTextLength - m_updatedLength) {
+        // CryptFailed("More data than the agreed plaintext length!")
+        err = ALC_ERROR_INVALID_DATA;
     }
     if (alcp_is_error(err)) {
-        // Burn everything
+        // Burn everything, the announced length went with the message
         memset(m_ccm_data.nonce, 0, 16);
         memset(m_ccm_data.cmac, 0, 16);
         memset(pOutput, 0, dataLen);
+        m_is_plaintext_len_set = false;
+        m_plainTextLength      = 0;
         return err;
     }
-#ifdef CCM_MULTI_UPDATE
-    if (!alcp_is_error(err)) {
-        m_updatedLength += dataLen;
+    m_cryptFn = cryptFn;
+    m_updatedLength += dataLen;
+
+    alignas(16) Uint8 scratch[16];
+    Uint64            len = dataLen;
+
+    if (m_carryLen) {
+        Uint64 used = m_carryLen;
+        Uint64 n    = std::min(len, sizeof(m_carry) - used);
+
+        utils::CopyBytes(m_carry + used, pInput, n);
+        m_carryLen += n;
+        if (m_carryLen == sizeof(m_carry)) {
+            // Block complete, MAC it and move the counter on
+            cryptFn(&m_ccm_data, m_carry, scratch, sizeof(m_carry));
+            m_carryLen = 0;
+        } else {
+            // Still partial, keystream from a throwaway copy of the state
+            ccm_data_t tmp = m_ccm_data;
+            cryptFn(&tmp, m_carry, scratch, m_carryLen);
+            memset(tmp.cmac, 0, sizeof(tmp.cmac));
+        }
+        utils::CopyBytes(pOutput, scratch + used, n);
+        pInput += n;
+        pOutput += n;
+        len -= n;
+    }
+
+    Uint64 tail = len % sizeof(m_carry);
+    if (len - tail) {
+        cryptFn(&m_ccm_data, pInput, pOutput, len - tail);
     }
-#endif
+
+    if (tail) {
+        utils::CopyBytes(m_carry, pInput + len - tail, tail);
+        m_carryLen = tail;
+
+        ccm_data_t tmp = m_ccm_data;
+        cryptFn(&tmp, m_carry, scratch, tail);
+        memset(tmp.cmac, 0, sizeof(tmp.cmac));
+        utils::CopyBytes(pOutput + len - tail, scratch, tail);
+    }
+    memset(scratch, 0, sizeof(scratch));
+
     return err;
 }
 
@@ -214,9 +267,6 @@ Ccm::setIv(ccm_data_t* ccm_data,
 {
     unsigned int q;
     Uint64       len = dataLen;
-#ifdef CCM_MULTI_UPDATE
-    len = m_plainTextLength;
-#endif
 
     if (ccm_data == nullptr || pIv == nullptr) {
         // InvalidValue("Null Pointer is not expected!")
@@ -288,13 +338,7 @@ alc_error_t
 CcmHash::getTag(Uint8* pOutput, Uint64 tagLen)
 {
     alc_error_t err = ALC_ERROR_NONE;
-#ifdef CCM_MULTI_UPDATE
-    // Check if total updated data so far has exceeded the preestablished
-    // plaintext Length. This check is here rather than in encrypt/decrypt
-    // to allow multiupdate calls in benchmarking.
-    if (m_updatedLength > m_plainTextLength) {
-        return ALC_ERROR_INVALID_DATA;
-    }
+
     if (tagLen < 4 || tagLen > 16 || tagLen == 0) {
         // InvalidValue("Tag length is not what we agreed upon during start!")
         return ALC_ERROR_INVALID_ARG;
@@ -304,27 +348,35 @@ CcmHash::getTag(Uint8* pOutput, Uint64 tagLen)
         // InvalidValue("Tag length is unknown!, need to agree on tag before
         // hand!")
         return ALC_ERROR_BAD_STATE;
-
-    } else {
-        aesni::ccm::Finalize(&m_ccm_data);
-        err = copyTag(&m_ccm_data, pOutput, tagLen);
     }
-    return err;
-#else
-    if (tagLen < 4 || tagLen > 16 || tagLen == 0) {
-        // InvalidValue("Tag length is not what we agreed upon during start!")
-        return ALC_ERROR_INVALID_ARG;
+    if (!m_is_started) {
+        // No update was made, message is AAD only
+        if (!m_ccm_data.key) {
+            return ALC_ERROR_BAD_STATE;
+        }
+        if (!m_is_plaintext_len_set) {
+            m_plainTextLength = 0;
+        }
+        err = startMessage(m_plainTextLength);
+        if (alcp_is_error(err)) {
+            return err;
+        }
     }
-    // If tagLen is 0 that means something seriously went south
-    if (m_tagLen != 0) {
-        err = copyTag(&m_ccm_data, pOutput, tagLen);
-    } else {
-        // InvalidValue("Tag length is unknown!, need to agree on tag before
-        // hand!")
-        return ALC_ERROR_BAD_STATE;
+    // All of the agreed plaintext has to be processed before the tag
+    if (m_updatedLength != m_plainTextLength) {
+        return ALC_ERROR_INVALID_DATA;
     }
+    if (m_carryLen) {
+        flushCarry();
+    }
+    aesni::ccm::Finalize(&m_ccm_data);
+    err = copyTag(&m_ccm_data, pOutput, tagLen);
+
+    // An announced length only holds for the message it was set for
+    m_is_plaintext_len_set = false;
+    m_plainTextLength      = 0;
+
     return err;
-#endif
 }
 
 // Aead class definitions
@@ -341,7 +393,13 @@ CcmT<keyLenBits, arch>::encrypt(const Uint8* pInput, Uint8* pOutput, Uint64 len)
         printf("\nError: Key or Iv not set \n");
         return ALC_ERROR_BAD_STATE;
     }
-    err = Ccm::cryptUpdate(pInput, pOutput, len, 1);
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, vaes512::ccm::Encrypt);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, vaes::ccm::Encrypt);
+    } else {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, aesni::ccm::Encrypt);
+    }
     return err;
 }
 
@@ -355,7 +413,13 @@ CcmT<keyLenBits, arch>::decrypt(const Uint8* pInput, Uint8* pOutput, Uint64 len)
         printf("\nError: Key or Iv not set \n");
         return ALC_ERROR_BAD_STATE;
     }
-    err = Ccm::cryptUpdate(pInput, pOutput, len, 0);
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, vaes512::ccm::Decrypt);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, vaes::ccm::Decrypt);
+    } else {
+        err = Ccm::cryptUpdate(pInput, pOutput, len, aesni::ccm::Decrypt);
+    }
     return err;
 }
 
@@ -366,4 +430,17 @@ template class CcmT<alcp::cipher::CipherKeyLen::eKey192Bit,
 template class CcmT<alcp::cipher::CipherKeyLen::eKey256Bit,
                     CpuCipherFeatures::eAesni>;
 
+template class CcmT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                    CpuCipherFeatures::eVaes256>;
+template class CcmT<alcp::cipher::CipherKeyLen::eKey192Bit,
+                    CpuCipherFeatures::eVaes256>;
+template class CcmT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                    CpuCipherFeatures::eVaes256>;
+template class CcmT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                    CpuCipherFeatures::eVaes512>;
+template class CcmT<alcp::cipher::CipherKeyLen::eKey192Bit,
+                    CpuCipherFeatures::eVaes512>;
+template class CcmT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                    CpuCipherFeatures::eVaes512>;
+
 } // namespace alcp::cipher
\ No newline at end of file
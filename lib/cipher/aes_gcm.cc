@@ -31,6 +31,7 @@
 #include "alcp/utils/compare.hh"
 //
 #include "alcp/cipher/aes_gcm.hh"
+#include "alcp/cipher/prepared_key.hh"
 #include "alcp/utils/cpuid.hh"
 
 #include <immintrin.h>
@@ -54,6 +55,7 @@ Gcm::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
         if (err != ALC_ERROR_NONE) {
             return err;
         }
+        m_gcm_ctx.m_pHashSubkeyTable_shared = nullptr;
     }
 
     if (pIv != NULL && ivLen != 0) {
@@ -84,6 +86,21 @@ Gcm::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
     return err;
 }
 
+alc_error_t
+Gcm::initWithKey(const PreparedKey* pKey, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = setPreparedKey(pKey);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    m_gcm_ctx.m_update_counter = 0; // reset counter
+
+    // powers of H are not recomputed by every update
+    m_gcm_ctx.m_pHashSubkeyTable_shared = pKey->getHashSubkeyTable();
+
+    return Gcm::init(nullptr, 0, pIv, ivLen);
+}
+
 // authentication api implementation
 alc_error_t
 GcmAuth::setAad(const Uint8* pInput, Uint64 aadLen)
@@ -362,6 +379,110 @@ GcmT<keyLenBits, arch>::encrypt(const Uint8* pInput, Uint8* pOutput, Uint64 len)
     return ALC_ERROR_NOT_SUPPORTED;
 }
 
+// every packet is checked before any output is written
+static alc_error_t
+validatePackets(const alc_aead_packet_t* pPackets, Uint64 numPackets)
+{
+    for (Uint64 i = 0; i < numPackets; i++) {
+        const alc_aead_packet_t& pkt = pPackets[i];
+
+        if (pkt.ap_iv == nullptr || pkt.ap_tag == nullptr
+            || (pkt.ap_aad == nullptr && pkt.ap_aadLen != 0)
+            || ((pkt.ap_in == nullptr || pkt.ap_out == nullptr)
+                && pkt.ap_len != 0)) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (pkt.ap_ivLen == 0 || pkt.ap_ivLen > MAX_CIPHER_IV_SIZE
+            || pkt.ap_tagLen == 0 || pkt.ap_tagLen > ALCP_GCM_TAG_MAX_SIZE) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+GcmT<keyLenBits, arch>::cryptBatch(alc_aead_packet_t* pPackets,
+                                   Uint64             numPackets,
+                                   bool               isEncrypt)
+{
+    if (!m_isKeySet_aes) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    alc_error_t err = validatePackets(pPackets, numPackets);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        return vaes512::cryptGcmBatch(pPackets,
+                                      numPackets,
+                                      m_cipher_key_data.m_enc_key,
+                                      getRounds(),
+                                      isEncrypt);
+    }
+
+    // one packet after the other through the single message path
+    alc_error_t result = ALC_ERROR_NONE;
+    for (Uint64 i = 0; i < numPackets; i++) {
+        alc_aead_packet_t& pkt = pPackets[i];
+        Uint8              tag[ALCP_GCM_TAG_MAX_SIZE];
+
+        err = Gcm::init(nullptr, 0, pkt.ap_iv, pkt.ap_ivLen);
+        if (err == ALC_ERROR_NONE) {
+            err = setAad(pkt.ap_aad, pkt.ap_aadLen);
+        }
+        if (err == ALC_ERROR_NONE && pkt.ap_len != 0) {
+            err = isEncrypt ? encrypt(pkt.ap_in, pkt.ap_out, pkt.ap_len)
+                            : decrypt(pkt.ap_in, pkt.ap_out, pkt.ap_len);
+        }
+        if (err == ALC_ERROR_NONE) {
+            err = getTag(tag, pkt.ap_tagLen);
+        }
+        if (err != ALC_ERROR_NONE) {
+            memset(tag, 0, sizeof(tag));
+            // earlier packets are done, this one and the rest are not
+            for (Uint64 j = i; j < numPackets; j++) {
+                pPackets[j].ap_err = err;
+            }
+            return err;
+        }
+
+        pkt.ap_err = ALC_ERROR_NONE;
+        if (isEncrypt) {
+            utils::CopyBytes(pkt.ap_tag, tag, pkt.ap_tagLen);
+        } else if (!utils::CompareConstTime(tag, pkt.ap_tag, pkt.ap_tagLen)) {
+            if (pkt.ap_len != 0) {
+                memset(pkt.ap_out, 0, pkt.ap_len);
+            }
+            pkt.ap_err = ALC_ERROR_TAG_MISMATCH;
+            result     = ALC_ERROR_TAG_MISMATCH;
+        }
+        memset(tag, 0, sizeof(tag));
+    }
+
+    return result;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+GcmT<keyLenBits, arch>::sealBatch(alc_aead_packet_t* pPackets,
+                                  Uint64             numPackets)
+{
+    return cryptBatch(pPackets, numPackets, true);
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+GcmT<keyLenBits, arch>::openBatch(alc_aead_packet_t* pPackets,
+                                  Uint64             numPackets)
+{
+    return cryptBatch(pPackets, numPackets, false);
+}
+
 template class GcmT<alcp::cipher::CipherKeyLen::eKey128Bit,
                     CpuCipherFeatures::eVaes512>;
 template class GcmT<alcp::cipher::CipherKeyLen::eKey192Bit,
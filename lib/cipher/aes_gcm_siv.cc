@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_gcm_siv.hh"
+#include "alcp/utils/compare.hh"
+#include "alcp/utils/copy.hh"
+
+#include <cstring>
+
+namespace alcp::cipher {
+
+GcmSiv::~GcmSiv()
+{
+    memset(m_keyGenKey, 0, sizeof(m_keyGenKey));
+    memset(m_hTable, 0, sizeof(m_hTable));
+    memset(m_tag, 0, sizeof(m_tag));
+    memset(m_expectedTag, 0, sizeof(m_expectedTag));
+}
+
+alc_error_t
+GcmSiv::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    if (pKey != nullptr && keyLen != 0) {
+        err = setKey(pKey, keyLen);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+        // Keep the key generating key, the Aes schedule gets replaced by the
+        // per nonce encryption key
+        m_keyGenRounds = m_nrounds;
+        utils::CopyBytes(m_keyGenKey,
+                         m_cipher_key_data.m_enc_key,
+                         (m_keyGenRounds + 1) * Rijndael::cBlockSize);
+        m_isKeyGenSet  = true;
+        m_isKeySet_aes = 0;
+    }
+
+    if (pIv != nullptr && ivLen != 0) {
+        if (ivLen != ALCP_GCM_SIV_NONCE_SIZE) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+        err = setIv(pIv, ivLen);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+
+    if (m_isKeyGenSet && m_ivState_aes) {
+        err = deriveKeys();
+    }
+
+    return err;
+}
+
+alc_error_t
+GcmSiv::deriveKeys()
+{
+    alignas(16) Uint8 auth_key[16]                   = {};
+    alignas(16) Uint8 enc_key[Rijndael::cMaxKeySize] = {};
+
+    aesni::gcmsiv::DeriveKeys(
+        m_keyGenKey, m_keyGenRounds, m_iv_aes, auth_key, enc_key);
+
+    alc_error_t err = setKey(enc_key, m_keyLen_in_bytes_aes * 8);
+    aesni::gcmsiv::InitHashPowers(auth_key, m_hTable, m_hashPowers);
+
+    memset(auth_key, 0, sizeof(auth_key));
+    memset(enc_key, 0, sizeof(enc_key));
+
+    // fresh message
+    m_polyval          = _mm_setzero_si128();
+    m_aadLen           = 0;
+    m_dataLen          = 0;
+    m_isMsgDone        = false;
+    m_isExpectedTagSet = false;
+
+    return err;
+}
+
+void
+GcmSiv::computeTag(Uint64 len)
+{
+    aesni::gcmsiv::GetTag(m_polyval,
+                          m_hTable,
+                          m_aadLen,
+                          len,
+                          m_iv_aes,
+                          m_cipher_key_data.m_enc_key,
+                          m_nrounds,
+                          m_tag);
+    m_polyval = _mm_setzero_si128();
+}
+
+void
+GcmSiv::getCounter(const Uint8 tag[], Uint8 counter[]) const
+{
+    utils::CopyBytes(counter, tag, ALCP_GCM_SIV_TAG_SIZE);
+    counter[ALCP_GCM_SIV_TAG_SIZE - 1] |= 0x80;
+}
+
+// authentication api implementation
+alc_error_t
+GcmSivAuth::setAad(const Uint8* pInput, Uint64 aadLen)
+{
+    if (!m_isKeySet_aes || m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (aadLen == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    // Each call is zero padded to a block, only the last call may be partial
+    if ((m_aadLen % Rijndael::cBlockSize) != 0) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (aadLen > ALCP_GCM_SIV_MAX_LEN - m_aadLen) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    aesni::gcmsiv::Polyval(pInput, aadLen, m_hTable, m_polyval);
+    m_aadLen += aadLen;
+
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+GcmSivAuth::getTag(Uint8* pTag, Uint64 tagLen)
+{
+    if (pTag == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (tagLen != ALCP_GCM_SIV_TAG_SIZE) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    if (!m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    utils::CopyBytes(pTag, m_tag, ALCP_GCM_SIV_TAG_SIZE);
+
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+GcmSivAuth::setTagLength(Uint64 tagLen)
+{
+    if (tagLen != ALCP_GCM_SIV_TAG_SIZE) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+GcmSivAuth::setExpectedTag(const Uint8* pTag, Uint64 tagLen)
+{
+    if (pTag == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (tagLen != ALCP_GCM_SIV_TAG_SIZE) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    utils::CopyBytes(m_expectedTag, pTag, ALCP_GCM_SIV_TAG_SIZE);
+    m_isExpectedTagSet = true;
+
+    return ALC_ERROR_NONE;
+}
+
+// number of hash key powers the arch kernel aggregates per reduction
+template<CpuCipherFeatures arch>
+static constexpr Uint32
+hashPowers()
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        return vaes512::gcmsiv::cHashPowers;
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        return vaes::gcmsiv::cHashPowers;
+    } else {
+        return aesni::gcmsiv::cHashPowers;
+    }
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+GcmSivT<keyLenBits, arch>::GcmSivT()
+    : GcmSivAuth((static_cast<Uint32>(keyLenBits)) / 8, hashPowers<arch>())
+{
+}
+
+template<CpuCipherFeatures arch>
+static inline void
+polyval(const Uint8 pIn[], Uint64 len, const __m128i pHtable[], __m128i& state)
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        vaes512::gcmsiv::Polyval(pIn, len, pHtable, state);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        vaes::gcmsiv::Polyval(pIn, len, pHtable, state);
+    } else {
+        aesni::gcmsiv::Polyval(pIn, len, pHtable, state);
+    }
+}
+
+template<CpuCipherFeatures arch>
+static inline void
+cryptCtr32(const Uint8 pIn[],
+           Uint8       pOut[],
+           Uint64      len,
+           const Uint8 pKey[],
+           int         nRounds,
+           const Uint8 counter[])
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        vaes512::gcmsiv::CryptCtr32(pIn, pOut, len, pKey, nRounds, counter);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        vaes::gcmsiv::CryptCtr32(pIn, pOut, len, pKey, nRounds, counter);
+    } else {
+        aesni::gcmsiv::CryptCtr32(pIn, pOut, len, pKey, nRounds, counter);
+    }
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+GcmSivT<keyLenBits, arch>::encrypt(const Uint8* pInput,
+                                   Uint8*       pOutput,
+                                   Uint64       len)
+{
+    if (!m_isKeySet_aes || m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if ((pInput == nullptr || pOutput == nullptr) && len != 0) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (len > ALCP_GCM_SIV_MAX_LEN) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    m_isEnc_aes = ALCP_ENC;
+
+    // The tag covers the whole plaintext and is the initial counter block
+    polyval<arch>(pInput, len, m_hTable, m_polyval);
+    computeTag(len);
+
+    alignas(16) Uint8 counter[ALCP_GCM_SIV_TAG_SIZE];
+    getCounter(m_tag, counter);
+    cryptCtr32<arch>(
+        pInput, pOutput, len, m_cipher_key_data.m_enc_key, m_nrounds, counter);
+
+    m_dataLen   = len;
+    m_isMsgDone = true;
+
+    return ALC_ERROR_NONE;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+GcmSivT<keyLenBits, arch>::decrypt(const Uint8* pInput,
+                                   Uint8*       pOutput,
+                                   Uint64       len)
+{
+    if (!m_isKeySet_aes || m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    // decryption runs from the received tag
+    if (!m_isExpectedTagSet) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if ((pInput == nullptr || pOutput == nullptr) && len != 0) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (len > ALCP_GCM_SIV_MAX_LEN) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    m_isEnc_aes = ALCP_DEC;
+
+    alignas(16) Uint8 counter[ALCP_GCM_SIV_TAG_SIZE];
+    getCounter(m_expectedTag, counter);
+    cryptCtr32<arch>(
+        pInput, pOutput, len, m_cipher_key_data.m_enc_key, m_nrounds, counter);
+
+    polyval<arch>(pOutput, len, m_hTable, m_polyval);
+    computeTag(len);
+
+    m_dataLen   = len;
+    m_isMsgDone = true;
+
+    if (utils::CompareConstTime(m_tag, m_expectedTag, ALCP_GCM_SIV_TAG_SIZE)
+        == 0) {
+        // never release unauthenticated plaintext
+        memset(pOutput, 0, len);
+        return ALC_ERROR_TAG_MISMATCH;
+    }
+
+    return ALC_ERROR_NONE;
+}
+
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                       CpuCipherFeatures::eVaes512>;
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                       CpuCipherFeatures::eVaes512>;
+
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                       CpuCipherFeatures::eVaes256>;
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                       CpuCipherFeatures::eVaes256>;
+
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                       CpuCipherFeatures::eAesni>;
+template class GcmSivT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                       CpuCipherFeatures::eAesni>;
+
+} // namespace alcp::cipher
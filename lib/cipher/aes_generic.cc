@@ -32,11 +32,81 @@
 #include "alcp/cipher/cipher_wrapper.hh"
 
 #include "alcp/utils/cpuid.hh"
+#include "alcp/utils/thread_pool.hh"
+
+#include <algorithm>
 
 using alcp::utils::CpuId;
 
 namespace alcp::cipher {
 
+// advances the low 64 bits (big endian) of a counter block, with the same
+// wrap around as the ctr kernels
+static inline void
+ctrAdvance(Uint8 counter[16], Uint64 blocks)
+{
+    for (int i = 15; i >= 8 && blocks != 0; i--) {
+        Uint64 sum = counter[i] + (blocks & 0xff);
+        counter[i] = static_cast<Uint8>(sum);
+        blocks     = (blocks >> 8) + (sum >> 8);
+    }
+}
+
+alc_error_t
+AesGenericInit::init(const Uint8* pKey,
+                     Uint64       keyLen,
+                     const Uint8* pIv,
+                     Uint64       ivLen)
+{
+    alc_error_t err = Aes::init(pKey, keyLen, pIv, ivLen);
+    if (err == ALC_ERROR_NONE) {
+        startStream(pIv, ivLen);
+    }
+    return err;
+}
+
+alc_error_t
+AesGenericInit::initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen)
+{
+    alc_error_t err = setPreparedKey(pKey);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    err = Aes::init(nullptr, 0, pIv, ivLen);
+    if (err == ALC_ERROR_NONE) {
+        startStream(pIv, ivLen);
+    }
+    return err;
+}
+
+void
+AesGenericInit::startStream(const Uint8* pIv, Uint64 ivLen)
+{
+    if (pIv != nullptr && ivLen != 0) {
+        utils::CopyBytes(m_ctrStart, m_iv_aes, sizeof(m_ctrStart));
+        m_ctrSkip = 0;
+    }
+}
+
+alc_error_t
+AesGenericInit::seekCtr(Uint64 byteOffset)
+{
+    if (!m_ivState_aes) {
+        return ALC_ERROR_BAD_STATE;
+    }
+
+    // counter block holding byteOffset, reached without running the cipher
+    utils::CopyBytes(m_iv_aes, m_ctrStart, sizeof(m_ctrStart));
+    m_pIv_aes = m_iv_aes;
+    ctrAdvance(m_pIv_aes, byteOffset / Rijndael::cBlockSize);
+    m_ctrSkip = byteOffset % Rijndael::cBlockSize;
+
+    return ALC_ERROR_NONE;
+}
+
 // WIP
 template<alcp::cipher::CipherMode       mode,
          alcp::cipher::CipherKeyLen     keyLenBits,
@@ -57,6 +127,7 @@ AesGenericCiphersT<mode, keyLenBits, arch>::encrypt(const Uint8* pinput,
     }
 
     /*
+        eAesECB,
         eAesCBC,
         eAesOFB,
         eAesCTR,
@@ -69,6 +140,16 @@ AesGenericCiphersT<mode, keyLenBits, arch>::encrypt(const Uint8* pinput,
     constexpr alcp::cipher::CipherMode cMode = mode;
 
     switch (cMode) {
+        case CipherMode::eAesECB:
+            if (len % Rijndael::cBlockSize) {
+                return ALC_ERROR_INVALID_SIZE;
+            }
+            err = EncryptEcb<keyLenBits, arch>(pinput,
+                                               pOutput,
+                                               len,
+                                               m_cipher_key_data.m_enc_key,
+                                               getRounds());
+            break;
         case CipherMode::eAesCBC:
             err = aesni::EncryptCbc(pinput,
                                     pOutput,
@@ -86,28 +167,7 @@ AesGenericCiphersT<mode, keyLenBits, arch>::encrypt(const Uint8* pinput,
                                     m_pIv_aes);
             break;
         case CipherMode::eAesCTR:
-            if constexpr (arch == CpuCipherFeatures::eVaes512) {
-                err = CryptCtr<keyLenBits, arch>(pinput,
-                                                 pOutput,
-                                                 len,
-                                                 m_cipher_key_data.m_enc_key,
-                                                 getRounds(),
-                                                 m_pIv_aes);
-            } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
-                err = vaes::CryptCtr(pinput,
-                                     pOutput,
-                                     len,
-                                     m_cipher_key_data.m_enc_key,
-                                     getRounds(),
-                                     m_pIv_aes);
-            } else if constexpr (arch == CpuCipherFeatures::eAesni) {
-                err = aesni::CryptCtr(pinput,
-                                      pOutput,
-                                      len,
-                                      m_cipher_key_data.m_enc_key,
-                                      getRounds(),
-                                      m_pIv_aes);
-            }
+            err = cryptCtrStream(pinput, pOutput, len);
             break;
         case CipherMode::eAesCFB:
             err = aesni::EncryptCfb(pinput,
@@ -149,6 +209,16 @@ AesGenericCiphersT<mode, keyLenBits, arch>::decrypt(const Uint8* pinput,
     constexpr alcp::cipher::CipherMode cMode = mode;
 
     switch (cMode) {
+        case CipherMode::eAesECB:
+            if (len % Rijndael::cBlockSize) {
+                return ALC_ERROR_INVALID_SIZE;
+            }
+            err = DecryptEcb<keyLenBits, arch>(pinput,
+                                               pOutput,
+                                               len,
+                                               m_cipher_key_data.m_dec_key,
+                                               getRounds());
+            break;
         case CipherMode::eAesCBC:
             err = alcp::cipher::tDecryptCbc<keyLenBits, arch>(
                 pinput, pOutput, len, m_cipher_key_data.m_dec_key, m_pIv_aes);
@@ -164,28 +234,7 @@ AesGenericCiphersT<mode, keyLenBits, arch>::decrypt(const Uint8* pinput,
             break;
 
         case CipherMode::eAesCTR:
-            if constexpr (arch == CpuCipherFeatures::eVaes512) {
-                err = CryptCtr<keyLenBits, arch>(pinput,
-                                                 pOutput,
-                                                 len,
-                                                 m_cipher_key_data.m_enc_key,
-                                                 getRounds(),
-                                                 m_pIv_aes);
-            } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
-                err = vaes::CryptCtr(pinput,
-                                     pOutput,
-                                     len,
-                                     m_cipher_key_data.m_enc_key,
-                                     getRounds(),
-                                     m_pIv_aes);
-            } else if constexpr (arch == CpuCipherFeatures::eAesni) {
-                err = aesni::CryptCtr(pinput,
-                                      pOutput,
-                                      len,
-                                      m_cipher_key_data.m_enc_key,
-                                      getRounds(),
-                                      m_pIv_aes);
-            }
+            err = cryptCtrStream(pinput, pOutput, len);
             break;
 
         case CipherMode::eAesCFB:
@@ -204,13 +253,183 @@ AesGenericCiphersT<mode, keyLenBits, arch>::decrypt(const Uint8* pinput,
     return err;
 }
 
+template<alcp::cipher::CipherMode       mode,
+         alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+AesGenericCiphersT<mode, keyLenBits, arch>::cryptCtr(const Uint8* pinput,
+                                                     Uint8*       pOutput,
+                                                     Uint64       len,
+                                                     Uint8*       pIv)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        err = CryptCtr<keyLenBits, arch>(pinput,
+                                         pOutput,
+                                         len,
+                                         m_cipher_key_data.m_enc_key,
+                                         getRounds(),
+                                         pIv);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        err = vaes::CryptCtr(pinput,
+                             pOutput,
+                             len,
+                             m_cipher_key_data.m_enc_key,
+                             getRounds(),
+                             pIv);
+    } else if constexpr (arch == CpuCipherFeatures::eAesni) {
+        err = aesni::CryptCtr(pinput,
+                              pOutput,
+                              len,
+                              m_cipher_key_data.m_enc_key,
+                              getRounds(),
+                              pIv);
+    }
+    return err;
+}
+
+template<alcp::cipher::CipherMode       mode,
+         alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+AesGenericCiphersT<mode, keyLenBits, arch>::cryptCtrStream(const Uint8* pinput,
+                                                           Uint8*       pOutput,
+                                                           Uint64       len)
+{
+    if (m_ctrSkip == 0) {
+        if (isParallel(len)) {
+            return cryptCtrParallel(pinput, pOutput, len);
+        }
+        return cryptCtr(pinput, pOutput, len, m_pIv_aes);
+    }
+
+    // the stream starts inside a counter block, finish that block on its own
+    // so that the rest is whole blocks for the wide kernel loops
+    Uint64 skip = m_ctrSkip;
+    Uint64 head = std::min(len, Rijndael::cBlockSize - skip);
+
+    __attribute__((aligned(16))) Uint8 block[16] = {};
+    __attribute__((aligned(16))) Uint8 seek[16];
+
+    utils::CopyBytes(seek, m_pIv_aes, sizeof(seek));
+    utils::CopyBytes(block + skip, pinput, head);
+    alc_error_t err = cryptCtr(block, block, sizeof(block), m_pIv_aes);
+    utils::CopyBytes(pOutput, block + skip, head);
+
+#ifndef AES_MULTI_UPDATE
+    // the kernels leave the counter alone, step past the partial block here
+    ctrAdvance(m_pIv_aes, 1);
+#endif
+
+    Uint64 rest = len - head;
+    if (err == ALC_ERROR_NONE && rest != 0) {
+        if (isParallel(rest)) {
+            err = cryptCtrParallel(pinput + head, pOutput + head, rest);
+        } else {
+            err = cryptCtr(pinput + head, pOutput + head, rest, m_pIv_aes);
+        }
+    }
+
+#ifdef AES_MULTI_UPDATE
+    // a short call ends inside the same block, the next one resumes there
+    if (skip + head < Rijndael::cBlockSize) {
+        utils::CopyBytes(m_pIv_aes, seek, sizeof(seek));
+        m_ctrSkip = skip + head;
+    } else {
+        m_ctrSkip = 0;
+    }
+#else
+    // every call starts again from the seek position
+    utils::CopyBytes(m_pIv_aes, seek, sizeof(seek));
+#endif
+    memset(block, 0, sizeof(block));
+    memset(seek, 0, sizeof(seek));
+
+    return err;
+}
+
+template<alcp::cipher::CipherMode       mode,
+         alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+AesGenericCiphersT<mode, keyLenBits, arch>::cryptCtrParallel(
+    const Uint8* pinput, Uint8* pOutput, Uint64 len)
+{
+    Uint64 chunkSize = m_chunkSize;
+    Uint64 numChunks = (len + chunkSize - 1) / chunkSize;
+
+    __attribute__((aligned(16))) Uint8 lastCounter[16];
+
+    // every chunk but the last is whole blocks, chunk i starts at counter
+    // iv + i * chunkSize / 16
+    auto task = [&](Uint64 i) {
+        __attribute__((aligned(16))) Uint8 counter[16];
+        Uint8* pCounter = (i == numChunks - 1) ? lastCounter : counter;
+        Uint64 offset   = i * chunkSize;
+
+        utils::CopyBytes(pCounter, m_pIv_aes, sizeof(counter));
+        ctrAdvance(pCounter, offset / Rijndael::cBlockSize);
+
+        alc_error_t err = cryptCtr(pinput + offset,
+                                   pOutput + offset,
+                                   std::min(chunkSize, len - offset),
+                                   pCounter);
+        memset(counter, 0, sizeof(counter));
+        return err;
+    };
+
+    alc_error_t err =
+        utils::ThreadPool::getInstance().run(numChunks, m_numThreads, task);
+
+#ifdef AES_MULTI_UPDATE
+    // the kernels carry the counter over to the next call, leave the iv where
+    // the serial path would
+    utils::CopyBytes(m_pIv_aes, lastCounter, sizeof(lastCounter));
+#endif
+    memset(lastCounter, 0, sizeof(lastCounter));
+
+    return err;
+}
+
 #if 1
 
 /*
+    eAesECB,
     eAesCBC,
     eAesOFB,
     eAesCTR,
     eAesCFB,*/
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey128Bit,
+                                  CpuCipherFeatures::eVaes512>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey192Bit,
+                                  CpuCipherFeatures::eVaes512>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey256Bit,
+                                  CpuCipherFeatures::eVaes512>;
+
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey128Bit,
+                                  CpuCipherFeatures::eVaes256>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey192Bit,
+                                  CpuCipherFeatures::eVaes256>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey256Bit,
+                                  CpuCipherFeatures::eVaes256>;
+
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey128Bit,
+                                  CpuCipherFeatures::eAesni>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey192Bit,
+                                  CpuCipherFeatures::eAesni>;
+template class AesGenericCiphersT<CipherMode::eAesECB,
+                                  alcp::cipher::CipherKeyLen::eKey256Bit,
+                                  CpuCipherFeatures::eAesni>;
+
+/* eAesCBC */
 template class AesGenericCiphersT<CipherMode::eAesCBC,
                                   alcp::cipher::CipherKeyLen::eKey128Bit,
                                   CpuCipherFeatures::eVaes512>;
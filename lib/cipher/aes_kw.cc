@@ -0,0 +1,382 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/aes_kw.hh"
+#include "alcp/cipher/rijndael.hh"
+
+#include <cstring>
+
+namespace alcp::cipher {
+
+typedef void (*KwKernel)(AesKwLanes&  lanes,
+                         Uint64       steps,
+                         const Uint8* pKey,
+                         int          nRounds);
+
+static constexpr Uint64 cSemiBlock = 8;
+
+// RFC 3394 2.2.3.1 default IV
+static const Uint8 cKwIv[cSemiBlock] = { 0xa6, 0xa6, 0xa6, 0xa6,
+                                         0xa6, 0xa6, 0xa6, 0xa6 };
+
+// RFC 5649 3, the alternative IV is this constant followed by the 32-bit
+// big endian message length indicator
+static const Uint8 cKwpAivMsb[4] = { 0xa6, 0x59, 0x59, 0xa6 };
+
+static bool
+isValidKek(const Uint8* pKek, Uint64 kekLen)
+{
+    return pKek != nullptr
+           && (kekLen == 128 || kekLen == 192 || kekLen == 256);
+}
+
+static alc_error_t
+validateJobs(alc_key_wrap_mode_t       mode,
+             bool                      wrap,
+             const alc_key_wrap_job_t* pJobs,
+             Uint64                    numJobs)
+{
+    for (Uint64 i = 0; i < numJobs; i++) {
+        const alc_key_wrap_job_t& job = pJobs[i];
+
+        if (job.kj_src == nullptr || job.kj_dst == nullptr) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+
+        Uint64 len = job.kj_srcLen;
+        bool   ok  = false;
+        if (wrap && mode == ALC_KEY_WRAP_KW) {
+            ok = len >= 2 * cSemiBlock && (len % cSemiBlock) == 0;
+        } else if (wrap) {
+            // message length indicator is 32 bits
+            ok = len >= 1 && len <= 0xffffffffULL;
+        } else if (mode == ALC_KEY_WRAP_KW) {
+            ok = len >= 3 * cSemiBlock && (len % cSemiBlock) == 0;
+        } else {
+            ok = len >= 2 * cSemiBlock && (len % cSemiBlock) == 0;
+        }
+        if (!ok) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * Lane setup, n is the number of 64-bit blocks of R. R lives in the output
+ * buffer, A and t in the lane.
+ */
+static Uint64
+startWrap(AesKwLanes&         lanes,
+          Uint32              l,
+          alc_key_wrap_mode_t mode,
+          alc_key_wrap_job_t& job)
+{
+    Uint64 len = job.kj_srcLen;
+    Uint64 n   = (len + cSemiBlock - 1) / cSemiBlock;
+    Uint8* p_r = job.kj_dst + cSemiBlock;
+    Uint8  a[cSemiBlock];
+
+    memmove(p_r, job.kj_src, len);
+    if (mode == ALC_KEY_WRAP_KW) {
+        memcpy(a, cKwIv, cSemiBlock);
+    } else {
+        memset(p_r + len, 0, n * cSemiBlock - len);
+        memcpy(a, cKwpAivMsb, sizeof(cKwpAivMsb));
+        a[4] = static_cast<Uint8>(len >> 24);
+        a[5] = static_cast<Uint8>(len >> 16);
+        a[6] = static_cast<Uint8>(len >> 8);
+        a[7] = static_cast<Uint8>(len);
+    }
+
+    lanes.m_a[l]      = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a));
+    lanes.m_pFirst[l] = p_r;
+    lanes.m_pLast[l]  = p_r + (n - 1) * cSemiBlock;
+    lanes.m_pR[l]     = p_r;
+
+    // KWP of a single block is one AES call on AIV | P, a step with t = 0
+    if (n == 1) {
+        lanes.m_t[l] = _mm_setzero_si128();
+        return 1;
+    }
+    lanes.m_t[l] = _mm_cvtsi64_si128(1);
+    return 6 * n;
+}
+
+static void
+finishWrap(AesKwLanes& lanes, Uint32 l, alc_key_wrap_job_t& job)
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(job.kj_dst), lanes.m_a[l]);
+
+    job.kj_dstLen = lanes.m_pLast[l] + cSemiBlock - job.kj_dst;
+    job.kj_err    = ALC_ERROR_NONE;
+}
+
+static Uint64
+startUnwrap(AesKwLanes&         lanes,
+            Uint32              l,
+            alc_key_wrap_mode_t mode,
+            alc_key_wrap_job_t& job)
+{
+    Uint64 n   = job.kj_srcLen / cSemiBlock - 1;
+    Uint8* p_r = job.kj_dst;
+
+    // A first, the output may overlap the input
+    lanes.m_a[l] =
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(job.kj_src));
+    memmove(p_r, job.kj_src + cSemiBlock, n * cSemiBlock);
+
+    lanes.m_pFirst[l] = p_r;
+    lanes.m_pLast[l]  = p_r + (n - 1) * cSemiBlock;
+    lanes.m_pR[l]     = lanes.m_pLast[l];
+
+    if (mode == ALC_KEY_WRAP_KWP && n == 1) {
+        lanes.m_t[l] = _mm_setzero_si128();
+        return 1;
+    }
+    lanes.m_t[l] = _mm_cvtsi64_si128(6 * n);
+    return 6 * n;
+}
+
+static void
+finishUnwrap(AesKwLanes&         lanes,
+             Uint32              l,
+             alc_key_wrap_mode_t mode,
+             alc_key_wrap_job_t& job)
+{
+    Uint8* p_out = lanes.m_pFirst[l];
+    Uint64 len   = lanes.m_pLast[l] + cSemiBlock - p_out;
+    Uint8  a[cSemiBlock];
+    Uint8  diff = 0;
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(a), lanes.m_a[l]);
+
+    if (mode == ALC_KEY_WRAP_KW) {
+        for (Uint64 i = 0; i < cSemiBlock; i++) {
+            diff |= a[i] ^ cKwIv[i];
+        }
+    } else {
+        for (Uint64 i = 0; i < sizeof(cKwpAivMsb); i++) {
+            diff |= a[i] ^ cKwpAivMsb[i];
+        }
+        Uint64 mli = (Uint64(a[4]) << 24) | (Uint64(a[5]) << 16)
+                     | (Uint64(a[6]) << 8) | Uint64(a[7]);
+
+        // the padding is less than a block and has to be zero
+        if (mli + cSemiBlock <= len || mli > len) {
+            diff |= 1;
+        } else {
+            for (Uint64 i = mli; i < len; i++) {
+                diff |= p_out[i];
+            }
+            len = mli;
+        }
+    }
+
+    if (diff != 0) {
+        memset(p_out, 0, lanes.m_pLast[l] + cSemiBlock - p_out);
+        job.kj_dstLen = 0;
+        job.kj_err    = ALC_ERROR_TAG_MISMATCH;
+        return;
+    }
+    job.kj_dstLen = len;
+    job.kj_err    = ALC_ERROR_NONE;
+}
+
+/*
+ * Job manager, same scheme as the multi-buffer CBC: a lane picks the next
+ * job as soon as its current one is done and the kernel is run for the
+ * number of steps left in the shortest active lane.
+ */
+static alc_error_t
+kwMbRun(alc_key_wrap_mode_t mode,
+        bool                wrap,
+        KwKernel            kernel,
+        Uint32              numLanes,
+        const Uint8*        pKey,
+        int                 nRounds,
+        alc_key_wrap_job_t* pJobs,
+        Uint64              numJobs)
+{
+    alignas(16) Uint8 scratch[cMbMaxLanes][cSemiBlock] = {};
+    Uint64            steps_left[cMbMaxLanes]          = {};
+    Uint64            job_of[cMbMaxLanes]              = {};
+    Uint64            next                             = 0;
+    alc_error_t       err                              = ALC_ERROR_NONE;
+
+    AesKwLanes lanes;
+    memset(&lanes, 0, sizeof(lanes));
+
+    for (;;) {
+        Uint64 min_steps = 0;
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (steps_left[l] == 0) {
+                if (next == numJobs) {
+                    lanes.m_pR[l]     = scratch[l];
+                    lanes.m_pFirst[l] = scratch[l];
+                    lanes.m_pLast[l]  = scratch[l];
+                    continue;
+                }
+                job_of[l] = next++;
+                if (wrap) {
+                    steps_left[l] = startWrap(lanes, l, mode, pJobs[job_of[l]]);
+                } else {
+                    steps_left[l] =
+                        startUnwrap(lanes, l, mode, pJobs[job_of[l]]);
+                }
+            }
+            if (min_steps == 0 || steps_left[l] < min_steps) {
+                min_steps = steps_left[l];
+            }
+        }
+
+        if (min_steps == 0) {
+            break;
+        }
+
+        kernel(lanes, min_steps, pKey, nRounds);
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (steps_left[l] == 0) {
+                continue;
+            }
+            steps_left[l] -= min_steps;
+            if (steps_left[l] != 0) {
+                continue;
+            }
+            alc_key_wrap_job_t& job = pJobs[job_of[l]];
+            if (wrap) {
+                finishWrap(lanes, l, job);
+            } else {
+                finishUnwrap(lanes, l, mode, job);
+                if (job.kj_err != ALC_ERROR_NONE) {
+                    err = job.kj_err;
+                }
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    return err;
+}
+
+static alc_error_t
+kwMb(alc_key_wrap_mode_t mode,
+     bool                wrap,
+     const Uint8*        pKek,
+     Uint64              kekLen,
+     alc_key_wrap_job_t* pJobs,
+     Uint64              numJobs,
+     CpuCipherFeatures   arch)
+{
+    if (pJobs == nullptr || !isValidKek(pKek, kekLen)
+        || (mode != ALC_KEY_WRAP_KW && mode != ALC_KEY_WRAP_KWP)) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    alc_error_t err = validateJobs(mode, wrap, pJobs, numJobs);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    KwKernel kernel    = nullptr;
+    Uint32   num_lanes = 0;
+    switch (arch) {
+        case CpuCipherFeatures::eVaes512:
+            kernel    = wrap ? vaes512::WrapKwMb : vaes512::UnwrapKwMb;
+            num_lanes = vaes512::cKwMbLanes;
+            break;
+        case CpuCipherFeatures::eVaes256:
+            kernel    = wrap ? vaes::WrapKwMb : vaes::UnwrapKwMb;
+            num_lanes = vaes::cKwMbLanes;
+            break;
+        case CpuCipherFeatures::eAesni:
+            kernel    = wrap ? aesni::WrapKwMb : aesni::UnwrapKwMb;
+            num_lanes = aesni::cKwMbLanes;
+            break;
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    Rijndael kek;
+    kek.setKey(pKek, static_cast<int>(kekLen));
+
+    return kwMbRun(mode,
+                   wrap,
+                   kernel,
+                   num_lanes,
+                   wrap ? kek.getEncryptKeys() : kek.getDecryptKeys(),
+                   static_cast<int>(kek.getRounds()),
+                   pJobs,
+                   numJobs);
+}
+
+alc_error_t
+WrapKeys(alc_key_wrap_mode_t mode,
+         const Uint8*        pKek,
+         Uint64              kekLen,
+         alc_key_wrap_job_t* pJobs,
+         Uint64              numJobs,
+         CpuCipherFeatures   arch)
+{
+    return kwMb(mode, true, pKek, kekLen, pJobs, numJobs, arch);
+}
+
+alc_error_t
+UnwrapKeys(alc_key_wrap_mode_t mode,
+           const Uint8*        pKek,
+           Uint64              kekLen,
+           alc_key_wrap_job_t* pJobs,
+           Uint64              numJobs,
+           CpuCipherFeatures   arch)
+{
+    return kwMb(mode, false, pKek, kekLen, pJobs, numJobs, arch);
+}
+
+alc_error_t
+WrapKeys(alc_key_wrap_mode_t mode,
+         const Uint8*        pKek,
+         Uint64              kekLen,
+         alc_key_wrap_job_t* pJobs,
+         Uint64              numJobs)
+{
+    return WrapKeys(mode, pKek, kekLen, pJobs, numJobs, getMbCpuFeature());
+}
+
+alc_error_t
+UnwrapKeys(alc_key_wrap_mode_t mode,
+           const Uint8*        pKek,
+           Uint64              kekLen,
+           alc_key_wrap_job_t* pJobs,
+           Uint64              numJobs)
+{
+    return UnwrapKeys(mode, pKek, kekLen, pJobs, numJobs, getMbCpuFeature());
+}
+
+} // namespace alcp::cipher
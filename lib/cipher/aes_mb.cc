@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher.hh"
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/cipher/prepared_key.hh"
+#include "alcp/utils/cpuid.hh"
+
+#include <cstring>
+
+namespace alcp::cipher {
+
+using utils::CpuId;
+
+typedef void (*MbKernel)(AesMbLanes& lanes, Uint64 blocks, int nRounds);
+
+static int
+getRounds(Uint64 keyLen)
+{
+    switch (keyLen) {
+        case 128:
+            return 10;
+        case 192:
+            return 12;
+        case 256:
+            return 14;
+        default:
+            return 0;
+    }
+}
+
+static alc_error_t
+validateJobs(const alc_cipher_mb_job_t* pJobs, Uint64 numJobs)
+{
+    for (Uint64 i = 0; i < numJobs; i++) {
+        const alc_cipher_mb_job_t& job = pJobs[i];
+
+        if (job.mj_len == 0) {
+            continue;
+        }
+        if (job.mj_key == nullptr || job.mj_iv == nullptr
+            || job.mj_src == nullptr || job.mj_dst == nullptr) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (getRounds(job.mj_keyLen) == 0
+            || (job.mj_len % Rijndael::cBlockSize) != 0) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * Job manager: every lane picks the next pending job of the same key size
+ * as soon as its current job drains. The kernel is always run for the
+ * number of blocks left in the shortest active lane, so no lane ever
+ * overruns its buffer.
+ */
+static void
+cbcEncryptMbPass(AesMbLanes&                lanes,
+                 Uint32                     numLanes,
+                 MbKernel                   kernel,
+                 const alc_cipher_mb_job_t* pJobs,
+                 Uint64                     numJobs,
+                 int                        nRounds)
+{
+    alignas(16) Uint8 enc_key[Rijndael::cMaxKeySize
+                              * (Rijndael::cMaxRounds + 2)] = {};
+    alignas(16) Uint8 scratch[cMbMaxLanes][Rijndael::cBlockSize] = {};
+    Uint64            blocks_left[cMbMaxLanes]                   = {};
+    Uint64            next                                       = 0;
+
+    auto p_key128 = reinterpret_cast<const __m128i*>(enc_key);
+
+    for (;;) {
+        Uint64 min_blocks = 0;
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (blocks_left[l] == 0) {
+                while (next < numJobs
+                       && (pJobs[next].mj_len == 0
+                           || getRounds(pJobs[next].mj_keyLen) != nRounds)) {
+                    next++;
+                }
+                if (next == numJobs) {
+                    lanes.m_pSrc[l] = scratch[l];
+                    lanes.m_pDst[l] = scratch[l];
+                    lanes.m_step[l] = 0;
+                    continue;
+                }
+
+                const alc_cipher_mb_job_t& job = pJobs[next++];
+
+                aesni::ExpandTweakKeys(job.mj_key, enc_key, nRounds);
+                for (int r = 0; r <= nRounds; r++) {
+                    lanes.m_round_keys[r][l] = _mm_load_si128(p_key128 + r);
+                }
+                lanes.m_iv[l] = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(job.mj_iv));
+                lanes.m_pSrc[l] = job.mj_src;
+                lanes.m_pDst[l] = job.mj_dst;
+                lanes.m_step[l] = Rijndael::cBlockSize;
+                blocks_left[l]  = job.mj_len / Rijndael::cBlockSize;
+            }
+            if (min_blocks == 0 || blocks_left[l] < min_blocks) {
+                min_blocks = blocks_left[l];
+            }
+        }
+
+        if (min_blocks == 0) {
+            break;
+        }
+
+        kernel(lanes, min_blocks, nRounds);
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (blocks_left[l] != 0) {
+                blocks_left[l] -= min_blocks;
+            }
+        }
+    }
+
+    memset(enc_key, 0, sizeof(enc_key));
+}
+
+alc_error_t
+EncryptCbcMb(const alc_cipher_mb_job_t* pJobs,
+             Uint64                     numJobs,
+             CpuCipherFeatures          arch)
+{
+    if (pJobs == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    alc_error_t err = validateJobs(pJobs, numJobs);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    MbKernel kernel    = nullptr;
+    Uint32   num_lanes = 0;
+    switch (arch) {
+        case CpuCipherFeatures::eVaes512:
+            kernel    = vaes512::EncryptCbcMb;
+            num_lanes = vaes512::cCbcMbLanes;
+            break;
+        case CpuCipherFeatures::eVaes256:
+            kernel    = vaes::EncryptCbcMb;
+            num_lanes = vaes::cCbcMbLanes;
+            break;
+        case CpuCipherFeatures::eAesni:
+            kernel    = aesni::EncryptCbcMb;
+            num_lanes = aesni::cCbcMbLanes;
+            break;
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    AesMbLanes lanes;
+    memset(&lanes, 0, sizeof(lanes));
+
+    // nRounds is uniform across the lanes of a kernel call
+    for (int rounds : { 10, 12, 14 }) {
+        cbcEncryptMbPass(lanes, num_lanes, kernel, pJobs, numJobs, rounds);
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    return err;
+}
+
+// every job is checked before any output is written
+static alc_error_t
+validateGcmJobs(const alc_aead_mb_job_t* pJobs, Uint64 numJobs)
+{
+    for (Uint64 i = 0; i < numJobs; i++) {
+        const alc_aead_packet_t& pkt = pJobs[i].aj_packet;
+        auto p_key = reinterpret_cast<const PreparedKey*>(pJobs[i].aj_key);
+
+        if (p_key == nullptr || p_key->getMode() != CipherMode::eAesGCM
+            || pkt.ap_iv == nullptr || pkt.ap_tag == nullptr
+            || (pkt.ap_aad == nullptr && pkt.ap_aadLen != 0)
+            || ((pkt.ap_in == nullptr || pkt.ap_out == nullptr)
+                && pkt.ap_len != 0)) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (pkt.ap_ivLen == 0 || pkt.ap_ivLen > MAX_CIPHER_IV_SIZE
+            || pkt.ap_tagLen == 0 || pkt.ap_tagLen > ALCP_GCM_TAG_MAX_SIZE) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * Without the per lane GHASH of the zmm kernels every packet goes through the
+ * single message path of its key size, on top of the prepared key of the
+ * packet as GcmT::cryptBatch() does.
+ */
+static alc_error_t
+cryptGcmSerial(alc_aead_mb_job_t* pJobs,
+               Uint64             numJobs,
+               bool               isEncrypt,
+               CpuCipherFeatures  arch)
+{
+    // one cipher per key size, the key is attached for every packet
+    CipherFactory<iCipherAead> factory[3];
+    iCipherAead*               p_gcm[3] = {};
+    alc_error_t                result   = ALC_ERROR_NONE;
+
+    for (Uint64 i = 0; i < numJobs; i++) {
+        const PreparedKey* p_key =
+            reinterpret_cast<const PreparedKey*>(pJobs[i].aj_key);
+        alc_aead_packet_t& pkt = pJobs[i].aj_packet;
+        Uint64             k   = (p_key->getKeyLen() - 128) / 64;
+        alc_error_t        err = ALC_ERROR_NONE;
+
+        if (p_gcm[k] == nullptr) {
+            p_gcm[k] = factory[k].create(
+                CipherMode::eAesGCM,
+                static_cast<CipherKeyLen>(p_key->getKeyLen()),
+                arch);
+        }
+        if (p_gcm[k] == nullptr) {
+            err = ALC_ERROR_NOT_SUPPORTED;
+        } else {
+            err = p_gcm[k]->initWithKey(p_key, pkt.ap_iv, pkt.ap_ivLen);
+        }
+        if (err == ALC_ERROR_NONE) {
+            err = isEncrypt ? p_gcm[k]->sealBatch(&pkt, 1)
+                            : p_gcm[k]->openBatch(&pkt, 1);
+        }
+        if (err == ALC_ERROR_TAG_MISMATCH) {
+            result = err;
+        } else if (err != ALC_ERROR_NONE) {
+            // earlier packets are done, this one and the rest are not
+            for (Uint64 j = i; j < numJobs; j++) {
+                pJobs[j].aj_packet.ap_err = err;
+            }
+            return err;
+        }
+    }
+
+    return result;
+}
+
+alc_error_t
+CryptGcmMb(alc_aead_mb_job_t* pJobs,
+           Uint64             numJobs,
+           bool               isEncrypt,
+           CpuCipherFeatures  arch)
+{
+    if (pJobs == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    alc_error_t err = validateGcmJobs(pJobs, numJobs);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    switch (arch) {
+        case CpuCipherFeatures::eVaes512:
+            return vaes512::CryptGcmMb(pJobs, numJobs, isEncrypt);
+        case CpuCipherFeatures::eVaes256:
+        case CpuCipherFeatures::eAesni:
+            return cryptGcmSerial(pJobs, numJobs, isEncrypt, arch);
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
+    }
+}
+
+CpuCipherFeatures
+getMbCpuFeature()
+{
+    CpuCipherFeatures arch = CpuCipherFeatures::eReference;
+
+    if (CpuId::cpuHasAesni() && CpuId::cpuHasAvx2()) {
+        arch = CpuCipherFeatures::eAesni;
+
+        if (CpuId::cpuHasVaes()) {
+            arch = CpuCipherFeatures::eVaes256;
+
+            if (CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_F)
+                && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_DQ)
+                && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_BW)) {
+                arch = CpuCipherFeatures::eVaes512;
+            }
+        }
+    }
+
+    return arch;
+}
+
+alc_error_t
+EncryptCbcMb(const alc_cipher_mb_job_t* pJobs, Uint64 numJobs)
+{
+    return EncryptCbcMb(pJobs, numJobs, getMbCpuFeature());
+}
+
+alc_error_t
+CryptGcmMb(alc_aead_mb_job_t* pJobs, Uint64 numJobs, bool isEncrypt)
+{
+    return CryptGcmMb(pJobs, numJobs, isEncrypt, getMbCpuFeature());
+}
+
+} // namespace alcp::cipher
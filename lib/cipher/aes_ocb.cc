@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_ocb.hh"
+#include "alcp/utils/copy.hh"
+
+#include <cstring>
+
+namespace alcp::cipher {
+
+Ocb::~Ocb()
+{
+    memset(&m_lTable, 0, sizeof(m_lTable));
+    memset(&m_msg, 0, sizeof(m_msg));
+    memset(&m_aad, 0, sizeof(m_aad));
+}
+
+alc_error_t
+Ocb::init(const Uint8* pKey, Uint64 keyLen, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    if (pKey != nullptr && keyLen != 0) {
+        err = setKey(pKey, keyLen);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+        aesni::ocb::InitLTable(
+            m_cipher_key_data.m_enc_key, m_nrounds, m_lTable);
+    }
+
+    if (pIv != nullptr && ivLen != 0) {
+        err = setIv(pIv, ivLen);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+
+    // a new key or nonce starts a new message
+    m_msg.offset  = _mm_setzero_si128();
+    m_msg.sum     = _mm_setzero_si128();
+    m_msg.blocks  = 0;
+    m_aad.offset  = _mm_setzero_si128();
+    m_aad.sum     = _mm_setzero_si128();
+    m_aad.blocks  = 0;
+    m_dataLen     = 0;
+    m_isOffsetSet = false;
+    m_isMsgDone   = false;
+    m_isAadDone   = false;
+
+    return err;
+}
+
+alc_error_t
+Ocb::initWithKey(const PreparedKey* pKey, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = setPreparedKey(pKey);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    aesni::ocb::InitLTable(m_cipher_key_data.m_enc_key, m_nrounds, m_lTable);
+
+    return init(nullptr, 0, pIv, ivLen);
+}
+
+void
+Ocb::setOffset()
+{
+    if (!m_isOffsetSet) {
+        m_msg.offset = aesni::ocb::InitOffset(m_cipher_key_data.m_enc_key,
+                                              m_nrounds,
+                                              m_iv_aes,
+                                              m_ivLen_aes,
+                                              m_tagLen);
+        m_isOffsetSet = true;
+    }
+}
+
+// authentication api implementation
+alc_error_t
+OcbAuth::getTag(Uint8* pTag, Uint64 tagLen)
+{
+    if (pTag == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (!m_isKeySet_aes || !m_ivState_aes) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    // the tag length is part of the nonce encoding
+    if (tagLen != m_tagLen) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    setOffset();
+    aesni::ocb::GetTag(m_msg,
+                       m_aad,
+                       m_cipher_key_data.m_enc_key,
+                       m_nrounds,
+                       m_lTable,
+                       pTag,
+                       tagLen);
+    m_isMsgDone = true;
+    m_isAadDone = true;
+
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+OcbAuth::setTagLength(Uint64 tagLen)
+{
+    if (tagLen == 0 || tagLen > ALCP_OCB_TAG_SIZE) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    // Offset_0 already depends on the old length
+    if (m_isOffsetSet) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    m_tagLen = tagLen;
+
+    return ALC_ERROR_NONE;
+}
+
+template<CpuCipherFeatures arch, bool cEnc>
+static inline void
+ocbBlocks(const Uint8      pIn[],
+          Uint8            pOut[],
+          Uint64           blocks,
+          const Uint8      pKey[],
+          int              nRounds,
+          const OcbLTable& table,
+          OcbPass&         pass)
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        if constexpr (cEnc) {
+            vaes512::ocb::Encrypt(
+                pIn, pOut, blocks, pKey, nRounds, table, pass);
+        } else {
+            vaes512::ocb::Decrypt(
+                pIn, pOut, blocks, pKey, nRounds, table, pass);
+        }
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        if constexpr (cEnc) {
+            vaes::ocb::Encrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+        } else {
+            vaes::ocb::Decrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+        }
+    } else {
+        if constexpr (cEnc) {
+            aesni::ocb::Encrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+        } else {
+            aesni::ocb::Decrypt(pIn, pOut, blocks, pKey, nRounds, table, pass);
+        }
+    }
+}
+
+template<CpuCipherFeatures arch>
+static inline void
+ocbHash(const Uint8      pIn[],
+        Uint64           blocks,
+        const Uint8      pKey[],
+        int              nRounds,
+        const OcbLTable& table,
+        OcbPass&         pass)
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        vaes512::ocb::Hash(pIn, blocks, pKey, nRounds, table, pass);
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        vaes::ocb::Hash(pIn, blocks, pKey, nRounds, table, pass);
+    } else {
+        aesni::ocb::Hash(pIn, blocks, pKey, nRounds, table, pass);
+    }
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+OcbT<keyLenBits, arch>::setAad(const Uint8* pInput, Uint64 aadLen)
+{
+    if (!m_isKeySet_aes || m_isAadDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (aadLen == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    // like the message, every call but the last is a multiple of the block
+    Uint64 blocks = aadLen / Rijndael::cBlockSize;
+    Uint64 rem    = aadLen % Rijndael::cBlockSize;
+    if (blocks) {
+        ocbHash<arch>(pInput,
+                      blocks,
+                      m_cipher_key_data.m_enc_key,
+                      m_nrounds,
+                      m_lTable,
+                      m_aad);
+    }
+    if (rem) {
+        aesni::ocb::HashTail(pInput + blocks * Rijndael::cBlockSize,
+                             rem,
+                             m_cipher_key_data.m_enc_key,
+                             m_nrounds,
+                             m_lTable,
+                             m_aad);
+        m_isAadDone = true;
+    }
+
+    return ALC_ERROR_NONE;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+OcbT<keyLenBits, arch>::encrypt(const Uint8* pInput,
+                                Uint8*       pOutput,
+                                Uint64       len)
+{
+    if (!m_isKeySet_aes || !m_ivState_aes || m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (len == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr || pOutput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    m_isEnc_aes = ALCP_ENC;
+    setOffset();
+
+    Uint64 blocks = len / Rijndael::cBlockSize;
+    Uint64 rem    = len % Rijndael::cBlockSize;
+    if (blocks) {
+        ocbBlocks<arch, true>(pInput,
+                              pOutput,
+                              blocks,
+                              m_cipher_key_data.m_enc_key,
+                              m_nrounds,
+                              m_lTable,
+                              m_msg);
+    }
+    // a partial block can only end the message
+    if (rem) {
+        Uint64 done = blocks * Rijndael::cBlockSize;
+        aesni::ocb::CryptTail(pInput + done,
+                              pOutput + done,
+                              rem,
+                              true,
+                              m_cipher_key_data.m_enc_key,
+                              m_nrounds,
+                              m_lTable,
+                              m_msg);
+        m_isMsgDone = true;
+    }
+    m_dataLen += len;
+
+    return ALC_ERROR_NONE;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+OcbT<keyLenBits, arch>::decrypt(const Uint8* pInput,
+                                Uint8*       pOutput,
+                                Uint64       len)
+{
+    if (!m_isKeySet_aes || !m_ivState_aes || m_isMsgDone) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (len == 0) {
+        return ALC_ERROR_NONE;
+    }
+    if (pInput == nullptr || pOutput == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    m_isEnc_aes = ALCP_DEC;
+    setOffset();
+
+    Uint64 blocks = len / Rijndael::cBlockSize;
+    Uint64 rem    = len % Rijndael::cBlockSize;
+    if (blocks) {
+        ocbBlocks<arch, false>(pInput,
+                               pOutput,
+                               blocks,
+                               m_cipher_key_data.m_dec_key,
+                               m_nrounds,
+                               m_lTable,
+                               m_msg);
+    }
+    // the last partial block is a key stream xor, it uses the encrypt key
+    if (rem) {
+        Uint64 done = blocks * Rijndael::cBlockSize;
+        aesni::ocb::CryptTail(pInput + done,
+                              pOutput + done,
+                              rem,
+                              false,
+                              m_cipher_key_data.m_enc_key,
+                              m_nrounds,
+                              m_lTable,
+                              m_msg);
+        m_isMsgDone = true;
+    }
+    m_dataLen += len;
+
+    return ALC_ERROR_NONE;
+}
+
+template class OcbT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                    CpuCipherFeatures::eVaes512>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey192Bit,
+                    CpuCipherFeatures::eVaes512>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                    CpuCipherFeatures::eVaes512>;
+
+template class OcbT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                    CpuCipherFeatures::eVaes256>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey192Bit,
+                    CpuCipherFeatures::eVaes256>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                    CpuCipherFeatures::eVaes256>;
+
+template class OcbT<alcp::cipher::CipherKeyLen::eKey128Bit,
+                    CpuCipherFeatures::eAesni>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey192Bit,
+                    CpuCipherFeatures::eAesni>;
+template class OcbT<alcp::cipher::CipherKeyLen::eKey256Bit,
+                    CpuCipherFeatures::eAesni>;
+
+} // namespace alcp::cipher
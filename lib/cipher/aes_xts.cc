@@ -30,8 +30,13 @@
 //
 #include "alcp/cipher/aes_xts.hh"
 #include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/cipher/prepared_key.hh"
 
 #include "alcp/utils/cpuid.hh"
+#include "alcp/utils/thread_pool.hh"
+
+#include <algorithm>
+#include <vector>
 
 using alcp::utils::CpuId;
 
@@ -81,6 +86,25 @@ Xts::init(const Uint8* pKey,
     return err;
 }
 
+alc_error_t
+Xts::initWithKey(const PreparedKey* pKey, const Uint8* pIv, Uint64 ivLen)
+{
+    alc_error_t err = setPreparedKey(pKey);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    // the tweak keys are shared as well
+    m_xts.m_pTweak_key = pKey->getTweakKeys();
+
+    if (pIv != NULL && ivLen != 0) {
+        err           = Xts::setIv(pIv, ivLen);
+        m_ivState_aes = 1;
+    }
+
+    return err;
+}
+
 void
 Xts::tweakBlockSet(Uint64 aesBlockId)
 {
@@ -108,7 +132,7 @@ Xts::expandTweakKeys(const Uint8* pKey, int len)
 
     const Uint8* key = pKey ? pKey : &dummy_key[0];
     if (CpuId::cpuHasAesni()) {
-        aesni::ExpandTweakKeys(key, m_xts.m_pTweak_key, getRounds());
+        aesni::ExpandTweakKeys(key, m_xts.m_tweak_round_key, getRounds());
         return;
     }
 
@@ -120,7 +144,7 @@ Xts::expandTweakKeys(const Uint8* pKey, int len)
     const Uint32* rtbl = utils::s_round_constants;
     Uint32*       p_tweak_key32;
 
-    p_tweak_key32 = reinterpret_cast<Uint32*>(m_xts.m_pTweak_key);
+    p_tweak_key32 = reinterpret_cast<Uint32*>(m_xts.m_tweak_round_key);
 
     for (i = 0; i < nk; i++) {
         p_tweak_key32[i] = MakeWord(
@@ -175,6 +199,102 @@ Xts::expandTweakKeys(const Uint8* pKey, int len)
         return err;                                                                    \
     };
 
+using XtsKernelT =
+    alc_error_t (*)(const Uint8*, Uint8*, Uint64, const Uint8*, int, Uint8*);
+
+template<alcp::utils::CpuCipherFeatures arch>
+static inline XtsKernelT
+getXtsKernel(bool isEncrypt)
+{
+    if constexpr (arch == CpuCipherFeatures::eVaes512) {
+        return isEncrypt ? vaes512::EncryptXts : vaes512::DecryptXts;
+    } else if constexpr (arch == CpuCipherFeatures::eVaes256) {
+        return isEncrypt ? vaes::EncryptXts : vaes::DecryptXts;
+    } else {
+        return isEncrypt ? aesni::EncryptXts : aesni::DecryptXts;
+    }
+}
+
+// r = a * b in GF(2^128) with the XTS (little endian) bit order
+static void
+tweakMultiply(Uint8 r[16], const Uint8 a[16], const Uint8 b[16])
+{
+    Uint64 x[2], p[2] = { 0, 0 };
+    utils::CopyBytes(reinterpret_cast<Uint8*>(x), a, 16);
+
+    for (int i = 0; i < 128; i++) {
+        if ((b[i / 8] >> (i % 8)) & 1) {
+            p[0] ^= x[0];
+            p[1] ^= x[1];
+        }
+        Uint64 carry = x[1] >> 63;
+        x[1]         = (x[1] << 1) | (x[0] >> 63);
+        x[0]         = (x[0] << 1) ^ (carry * 0x87);
+    }
+    utils::CopyBytes(r, reinterpret_cast<Uint8*>(p), 16);
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+XtsT<keyLenBits, arch>::cryptParallel(const Uint8* pinput,
+                                      Uint8*       pOutput,
+                                      Uint64       len,
+                                      bool         isEncrypt)
+{
+    struct alignas(16) TweakT
+    {
+        Uint8 b[16];
+    };
+
+    // whole block chunks, a partial last block stays with the block before
+    // it for ciphertext stealing
+    Uint64 chunkSize = m_chunkSize;
+    Uint64 numChunks = len / chunkSize;
+    if (len % chunkSize >= Rijndael::cBlockSize) {
+        numChunks++;
+    }
+
+    // chunk i starts at tweak T * alpha^(i * chunkSize / 16)
+    TweakT step = { { 1 } };
+    aesni::TweakBlockCalculate(step.b, chunkSize / Rijndael::cBlockSize);
+
+    std::vector<TweakT> tweaks(numChunks);
+    utils::CopyBytes(tweaks[0].b, m_xts.m_tweak_block, 16);
+    for (Uint64 i = 1; i < numChunks; i++) {
+        tweakMultiply(tweaks[i].b, tweaks[i - 1].b, step.b);
+    }
+
+    XtsKernelT   kernel = getXtsKernel<arch>(isEncrypt);
+    const Uint8* pKey   = isEncrypt ? m_cipher_key_data.m_enc_key
+                                    : m_cipher_key_data.m_dec_key;
+
+    auto task = [&](Uint64 i) {
+        Uint64 offset   = i * chunkSize;
+        Uint64 chunkLen = (i == numChunks - 1) ? len - offset : chunkSize;
+
+        return kernel(pinput + offset,
+                      pOutput + offset,
+                      chunkLen,
+                      pKey,
+                      getRounds(),
+                      tweaks[i].b);
+    };
+
+    alc_error_t err =
+        utils::ThreadPool::getInstance().run(numChunks, m_numThreads, task);
+
+#ifdef AES_MULTI_UPDATE
+    // the kernels carry the tweak over to the next call, leave it where the
+    // serial path would
+    utils::CopyBytes(m_xts.m_tweak_block, tweaks[numChunks - 1].b, 16);
+#endif
+    memset(tweaks.data(), 0, tweaks.size() * sizeof(TweakT));
+
+    m_xts.m_aes_block_id += len / 16;
+    return err;
+}
+
 template<alcp::cipher::CipherKeyLen     keyLenBits,
          alcp::utils::CpuCipherFeatures arch>
 alc_error_t
@@ -195,6 +315,10 @@ XtsT<keyLenBits, arch>::encrypt(const Uint8* pinput, Uint8* pOutput, Uint64 len)
         return ALC_ERROR_NOT_SUPPORTED;
     }
 
+    if (isParallel(len)) {
+        return cryptParallel(pinput, pOutput, len, true);
+    }
+
     Uint64 blocks_in = len / 16;
 
     if constexpr (arch == CpuCipherFeatures::eVaes512) {
@@ -244,6 +368,10 @@ XtsT<keyLenBits, arch>::decrypt(const Uint8* pinput, Uint8* pOutput, Uint64 len)
         return ALC_ERROR_NOT_SUPPORTED;
     }
 
+    if (isParallel(len)) {
+        return cryptParallel(pinput, pOutput, len, false);
+    }
+
     Uint64 blocks_in = len / 16;
     if constexpr (arch == CpuCipherFeatures::eVaes512) {
         err = vaes512::DecryptXts(pinput,
@@ -405,6 +533,98 @@ XtsBlockT<keyLenBits, arch>::decryptSegment(const Uint8* pinput,
     return err;
 }
 
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+XtsBlockT<keyLenBits, arch>::cryptSectors(const alc_xts_sector_t* pSectors,
+                                          Uint64                  numSectors,
+                                          Uint64                  dataUnitSize,
+                                          bool                    isEncrypt)
+{
+    // sectors whose initial tweaks are encrypted together in one ECB call
+    constexpr Uint64 cSectorsPerPass = 64;
+
+    alc_error_t err = ALC_ERROR_NONE;
+    if (!m_isKeySet_aes) {
+        printf("\nError: Key not set \n");
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (dataUnitSize < 16 || dataUnitSize > (1 << 21)) {
+        return ALC_ERROR_INVALID_DATA;
+    }
+    if (pSectors == nullptr && numSectors != 0) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    for (Uint64 i = 0; i < numSectors; i++) {
+        if (pSectors[i].xs_src == nullptr || pSectors[i].xs_dst == nullptr) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    if constexpr ((keyLenBits != CipherKeyLen::eKey128Bit)
+                  && (keyLenBits != CipherKeyLen::eKey256Bit)) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    XtsKernelT   kernel = getXtsKernel<arch>(isEncrypt);
+    const Uint8* pKey   = isEncrypt ? m_cipher_key_data.m_enc_key
+                                    : m_cipher_key_data.m_dec_key;
+
+    __attribute__((aligned(64))) Uint8 tweaks[cSectorsPerPass * 16];
+
+    for (Uint64 done = 0; done < numSectors && err == ALC_ERROR_NONE;) {
+        Uint64 n = std::min(cSectorsPerPass, numSectors - done);
+
+        // IEEE 1619 tweak, the data unit number as a 128 bit little endian
+        // value, all of them through E(K2) with the parallel ECB kernel
+        memset(tweaks, 0, n * 16);
+        for (Uint64 i = 0; i < n; i++) {
+            Uint64 dataUnit = pSectors[done + i].xs_dataUnit;
+            for (int b = 0; b < 8; b++) {
+                tweaks[i * 16 + b] = static_cast<Uint8>(dataUnit >> (8 * b));
+            }
+        }
+        err = EncryptEcb<keyLenBits, arch>(
+            tweaks, tweaks, n * 16, m_xts.m_pTweak_key, getRounds());
+
+        // the kernels multiply the tweak by alpha block after block
+        for (Uint64 i = 0; i < n && err == ALC_ERROR_NONE; i++) {
+            const alc_xts_sector_t& sector = pSectors[done + i];
+
+            err = kernel(sector.xs_src,
+                         sector.xs_dst,
+                         dataUnitSize,
+                         pKey,
+                         getRounds(),
+                         tweaks + i * 16);
+        }
+        done += n;
+    }
+    memset(tweaks, 0, sizeof(tweaks));
+
+    return err;
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+XtsBlockT<keyLenBits, arch>::encryptSectors(const alc_xts_sector_t* pSectors,
+                                            Uint64                  numSectors,
+                                            Uint64 dataUnitSize)
+{
+    return cryptSectors(pSectors, numSectors, dataUnitSize, true);
+}
+
+template<alcp::cipher::CipherKeyLen     keyLenBits,
+         alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+XtsBlockT<keyLenBits, arch>::decryptSectors(const alc_xts_sector_t* pSectors,
+                                            Uint64                  numSectors,
+                                            Uint64 dataUnitSize)
+{
+    return cryptSectors(pSectors, numSectors, dataUnitSize, false);
+}
+
 template class XtsT<alcp::cipher::CipherKeyLen::eKey128Bit,
                     CpuCipherFeatures::eVaes512>;
 template class XtsT<alcp::cipher::CipherKeyLen::eKey256Bit,
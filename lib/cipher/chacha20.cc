@@ -27,30 +27,73 @@
  */
 
 #include "alcp/cipher/chacha20.hh"
+#include "alcp/cipher/chacha20_avx2.hh"
 #include "alcp/cipher/chacha20_zen4.hh"
+#include "alcp/utils/copy.hh"
 #include "chacha20_inplace.cc.inc"
 
+#include <algorithm>
+
 namespace alcp::cipher {
 
 #define CHACHA_CRYPT_WRAPPER_FUNC(CLASS_NAME, WRAPPER_FUNC, FUNC_NAME)         \
     alc_error_t CLASS_NAME::WRAPPER_FUNC(                                      \
         const Uint8* pInput, Uint8* pOutput, Uint64 len)                       \
     {                                                                          \
-        alc_error_t err      = ALC_ERROR_NONE;                                 \
-        Uint64      blocks   = len / cMBlockSize;                              \
-        int         remBytes = len - (blocks * cMBlockSize);                   \
-        err                  = FUNC_NAME(m_key,                                \
-                        cMKeylen,                             \
-                        m_iv,                                 \
-                        cMIvlen,                              \
-                        pInput,                               \
-                        pOutput,                              \
-                        blocks,                               \
-                        remBytes);                            \
-        /*err                  = FUNC_NAME(pInput, len, pOutput);*/            \
-        return err;                                                            \
+        return crypt(FUNC_NAME, pInput, pOutput, len);                         \
     }
 
+template<typename PROCESS>
+alc_error_t
+ChaCha20::crypt(PROCESS      process,
+                const Uint8* pInput,
+                Uint8*       pOutput,
+                Uint64       len)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    if (m_skip == 0) {
+        Uint64 blocks   = len / cMBlockSize;
+        int    remBytes = len - (blocks * cMBlockSize);
+        err             = process(
+            m_key, cMKeylen, m_iv, cMIvlen, pInput, pOutput, blocks, remBytes);
+        return err;
+    }
+
+    // the stream starts inside a block, finish that block on its own so that
+    // the rest is whole blocks from the next counter
+    Uint64 head = std::min(len, cMBlockSize - m_skip);
+
+    alignas(16) Uint8 block[cMBlockSize] = {};
+    alignas(16) Uint8 iv[cMIvlen];
+
+    utils::CopyBytes(iv, m_iv, cMIvlen);
+    utils::CopyBytes(block + m_skip, pInput, head);
+    err = process(m_key, cMKeylen, iv, cMIvlen, block, block, 1, 0);
+    utils::CopyBytes(pOutput, block + m_skip, head);
+
+    Uint64 rest = len - head;
+    if (err == ALC_ERROR_NONE && rest != 0) {
+        Uint64 blocks   = rest / cMBlockSize;
+        int    remBytes = rest - (blocks * cMBlockSize);
+
+        utils::CopyBytes(iv, m_iv, cMIvlen);
+        (*(reinterpret_cast<Uint32*>(iv))) += 1;
+        err = process(m_key,
+                      cMKeylen,
+                      iv,
+                      cMIvlen,
+                      pInput + head,
+                      pOutput + head,
+                      blocks,
+                      remBytes);
+    }
+    memset(block, 0, sizeof(block));
+    memset(iv, 0, sizeof(iv));
+
+    return err;
+}
+
 alc_error_t
 ChaCha20::init(const Uint8* pKey,
                const Uint64 keyLen,
@@ -104,14 +147,88 @@ ChaCha20::setIv(const Uint8 iv[], Uint64 ivlen)
         return err;
     }
     err = utils::SecureCopy<Uint8>(m_iv, cMIvlen, iv, ivlen);
+    if (err == ALC_ERROR_NONE) {
+        utils::CopyBytes(m_ivStart, m_iv, cMIvlen);
+        m_skip = 0;
+    }
     return err;
 }
 
+alc_error_t
+ChaCha20::setStreamOffset(Uint64 byteOffset)
+{
+    // the 32 bit block counter must not wrap within the stream
+    Uint64 counter = *(reinterpret_cast<const Uint32*>(m_ivStart))
+                     + byteOffset / cMBlockSize;
+    if (counter > 0xffffffff) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    utils::CopyBytes(m_iv, m_ivStart, cMIvlen);
+    (*(reinterpret_cast<Uint32*>(m_iv))) = static_cast<Uint32>(counter);
+    m_skip                               = byteOffset % cMBlockSize;
+
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+HChaCha20(const Uint8       key[],
+          Uint64            keyLen,
+          const Uint8       pNonces[],
+          Uint64            numNonces,
+          Uint8             pSubkeys[],
+          CpuCipherFeatures arch)
+{
+    alc_error_t err = ValidateKey(key, keyLen);
+    if (alcp_is_error(err)) {
+        return err;
+    }
+    if (pNonces == nullptr || pSubkeys == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    if (arch == CpuCipherFeatures::eVaes512) {
+        zen4::HChaCha20(key, pNonces, numNonces, pSubkeys);
+    } else if (arch == CpuCipherFeatures::eVaes256
+               || arch == CpuCipherFeatures::eAesni) {
+        avx2::HChaCha20(key, pNonces, numNonces, pSubkeys);
+    } else {
+        for (Uint64 i = 0; i < numNonces; i++) {
+            HChaCha20Block(key, pNonces + i * 16, pSubkeys + i * 32);
+        }
+    }
+
+    return err;
+}
+
+alc_error_t
+HChaCha20(const Uint8 key[],
+          Uint64      keyLen,
+          const Uint8 pNonces[],
+          Uint64      numNonces,
+          Uint8       pSubkeys[])
+{
+    // the kernels only need avx2 and avx512f, unlike the ciphers
+    CpuCipherFeatures arch = CpuCipherFeatures::eReference;
+    if (CpuId::cpuHasAvx2()) {
+        arch = CpuCipherFeatures::eAesni;
+        if (CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_F)) {
+            arch = CpuCipherFeatures::eVaes512;
+        }
+    }
+    return HChaCha20(key, keyLen, pNonces, numNonces, pSubkeys, arch);
+}
+
 namespace vaes512 {
     CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, encrypt, zen4::ProcessInput);
     CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, decrypt, zen4::ProcessInput);
 } // namespace vaes512
 
+namespace avx2 {
+    CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, encrypt, avx2::ProcessInput);
+    CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, decrypt, avx2::ProcessInput);
+} // namespace avx2
+
 namespace ref {
     CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, encrypt, ProcessInput);
     CHACHA_CRYPT_WRAPPER_FUNC(ChaCha256, decrypt, ProcessInput);
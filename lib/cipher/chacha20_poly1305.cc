@@ -27,378 +27,31 @@
  */
 
 #include "alcp/cipher/chacha20_poly1305.hh"
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
 #include "alcp/base.hh"
 
+#include <algorithm>
+
 namespace alcp::cipher {
 
 using mac::poly1305::Poly1305;
 
-// FIXME: to be moved to zen4 arch
 namespace vaes512 {
-    alc_error_t ChaChaPlusPoly::setIv(const Uint8* iv, Uint64 ivLen)
-    {
-        if (ivLen != 12) {
-            return ALC_ERROR_INVALID_SIZE;
-        }
-        memset(m_iv, 0, 4);
-        memcpy(m_iv + 4, iv, ivLen);
-
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPlusPoly::setKey(const Uint8* key, Uint64 keylen)
-    {
-        alc_error_t err = ChaCha256::setKey(key, keylen);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        std::fill(m_poly1305_key, m_poly1305_key + 32, 0);
-        err = ChaCha256::encrypt(m_poly1305_key, m_poly1305_key, 32);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 = 0;
-        m_len_aad_processed.u64   = 0;
-        err                       = Poly1305::init(m_poly1305_key, 32);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPoly::init(const Uint8* pKey,
-                                 Uint64       keyLen,
-                                 const Uint8* pIv,
-                                 Uint64       ivLen)
-    {
-        alc_error_t err = ALC_ERROR_NONE;
-        // FIXME: add ptr check and len checks
-        err = setIv(pIv, ivLen);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = setKey(pKey, keyLen);
-        return err;
-    }
-
-    /* chacha256::encrypt and poly::update to be fused */
-    alc_error_t ChaChaPoly256::encrypt(const Uint8* inputBuffer,
-                                       Uint8*       outputBuffer,
-                                       Uint64       bufferLength)
-    {
-
-        alc_error_t err = ALC_ERROR_NONE;
-        // set  Counter to 1
-        (*(reinterpret_cast<Uint32*>(ChaCha256::m_iv))) += 1;
-        err = ChaCha256::encrypt(inputBuffer, outputBuffer, bufferLength);
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 += bufferLength;
-
-        Uint64 padding_length = ((m_len_aad_processed.u64 % 16) == 0)
-                                    ? 0
-                                    : (16 - (m_len_aad_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        err = Poly1305::update(outputBuffer, bufferLength); // loop
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        padding_length = ((m_len_input_processed.u64 % 16) == 0)
-                             ? 0
-                             : (16 - (m_len_input_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        constexpr Uint64 cSizeLength = sizeof(Uint64);
-        err = Poly1305::update(m_len_aad_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = Poly1305::update(m_len_input_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPoly256::decrypt(const Uint8* inputBuffer,
-                                       Uint8*       outputBuffer,
-                                       Uint64       bufferLength)
-    {
-
-        alc_error_t err = ALC_ERROR_NONE;
-        // set  Counter to 1
-        (*(reinterpret_cast<Uint32*>(ChaCha256::m_iv))) += 1;
-        err = ChaCha256::encrypt(inputBuffer, outputBuffer, bufferLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 += bufferLength;
-
-        Uint64 padding_length = ((m_len_aad_processed.u64 % 16) == 0)
-                                    ? 0
-                                    : (16 - (m_len_aad_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        //  In case of decryption one should change the order of updation i.e
-        //  input (which is the ciphertext) should be updated
-        err = Poly1305::update(inputBuffer, bufferLength);
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        padding_length = ((m_len_input_processed.u64 % 16) == 0)
-                             ? 0
-                             : (16 - (m_len_input_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        constexpr Uint64 cSizeLength = sizeof(Uint64);
-        err = Poly1305::update(m_len_aad_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = Poly1305::update(m_len_input_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPolyAuth::setAad(const Uint8* pInput, Uint64 len)
-    {
-        alc_error_t err = Poly1305::update(pInput, len);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        m_len_aad_processed.u64 += len;
-        return err;
-    }
-
-    alc_error_t ChaChaPolyAuth::getTag(Uint8* pOutput, Uint64 len)
-    {
-        alc_error_t err = Poly1305::finalize(pOutput, len);
-        return err;
-    }
-
-    alc_error_t ChaChaPolyAuth::setTagLength(Uint64 tagLength)
-    {
-        if (tagLength != 16) {
-            return ALC_ERROR_INVALID_SIZE;
-        }
-        return ALC_ERROR_NONE;
-    }
-
+// kernels of the batch API
+static constexpr CpuCipherFeatures cMbArch = CpuCipherFeatures::eVaes512;
+#include "chacha20_poly1305.cc.inc"
 } // namespace vaes512
 
-#if 1 // duplicate of code under vaes512 to be refined.
-namespace ref {
-    alc_error_t ChaChaPlusPoly::setIv(const Uint8* iv, Uint64 ivLen)
-    {
-        if (ivLen != 12) {
-            return ALC_ERROR_INVALID_SIZE;
-        }
-        memset(m_iv, 0, 4);
-        memcpy(m_iv + 4, iv, ivLen);
-
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPlusPoly::setKey(const Uint8* key, Uint64 keylen)
-    {
-        alc_error_t err = ChaCha256::setKey(key, keylen);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        std::fill(m_poly1305_key, m_poly1305_key + 32, 0);
-        err = ChaCha256::encrypt(m_poly1305_key, m_poly1305_key, 32);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        err = Poly1305::init(m_poly1305_key, 32);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 = 0;
-        m_len_aad_processed.u64   = 0;
-
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPoly::init(const Uint8* pKey,
-                                 Uint64       keyLen,
-                                 const Uint8* pIv,
-                                 Uint64       ivLen)
-    {
-        alc_error_t err = ALC_ERROR_NONE;
-        // FIXME: add ptr check and len checks
-        err = setIv(pIv, ivLen);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = setKey(pKey, keyLen);
-        return err;
-    }
-
-    /* chacha256::encrypt and poly::update to be fused */
-    alc_error_t ChaChaPoly256::encrypt(const Uint8* inputBuffer,
-                                       Uint8*       outputBuffer,
-                                       Uint64       bufferLength)
-    {
-        alc_error_t err = ALC_ERROR_NONE;
-        // set  Counter to 1
-        (*(reinterpret_cast<Uint32*>(ChaCha256::m_iv))) += 1;
-        err = ChaCha256::encrypt(inputBuffer, outputBuffer, bufferLength);
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 += bufferLength;
-
-        Uint64 padding_length = ((m_len_aad_processed.u64 % 16) == 0)
-                                    ? 0
-                                    : (16 - (m_len_aad_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        err = Poly1305::update(outputBuffer, bufferLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        padding_length = ((m_len_input_processed.u64 % 16) == 0)
-                             ? 0
-                             : (16 - (m_len_input_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
+namespace avx2 {
+// kernels of the batch API
+static constexpr CpuCipherFeatures cMbArch = CpuCipherFeatures::eAesni;
+#include "chacha20_poly1305.cc.inc"
+} // namespace avx2
 
-        constexpr Uint64 cSizeLength = sizeof(Uint64);
-        err = Poly1305::update(m_len_aad_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = Poly1305::update(m_len_input_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPoly256::decrypt(const Uint8* inputBuffer,
-                                       Uint8*       outputBuffer,
-                                       Uint64       bufferLength)
-    {
-
-        alc_error_t err = ALC_ERROR_NONE;
-        // set  Counter to 1
-        (*(reinterpret_cast<Uint32*>(ChaCha256::m_iv))) += 1;
-        err = ChaCha256::encrypt(inputBuffer, outputBuffer, bufferLength);
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-
-        m_len_input_processed.u64 += bufferLength;
-
-        Uint64 padding_length = ((m_len_aad_processed.u64 % 16) == 0)
-                                    ? 0
-                                    : (16 - (m_len_aad_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        //  In case of decryption one should change the order of updation i.e
-        //  input (which is the ciphertext) should be updated
-        err = Poly1305::update(inputBuffer, bufferLength);
-
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        padding_length = ((m_len_input_processed.u64 % 16) == 0)
-                             ? 0
-                             : (16 - (m_len_input_processed.u64 % 16));
-        if (padding_length != 0) {
-            err = Poly1305::update(m_zero_padding, padding_length);
-            if (err != ALC_ERROR_NONE) {
-                return err;
-            }
-        }
-
-        constexpr Uint64 cSizeLength = sizeof(Uint64);
-        err = Poly1305::update(m_len_aad_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        err = Poly1305::update(m_len_input_processed.u8, cSizeLength);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        return ALC_ERROR_NONE;
-    }
-
-    alc_error_t ChaChaPolyAuth::setAad(const Uint8* pInput, Uint64 len)
-    {
-        alc_error_t err = Poly1305::update(pInput, len);
-        if (err != ALC_ERROR_NONE) {
-            return err;
-        }
-        m_len_aad_processed.u64 += len;
-        return err;
-    }
-
-    alc_error_t ChaChaPolyAuth::getTag(Uint8* pOutput, Uint64 len)
-    {
-        alc_error_t err = Poly1305::finalize(pOutput, len);
-        return err;
-    }
-
-    alc_error_t ChaChaPolyAuth::setTagLength(Uint64 tagLength)
-    {
-        if (tagLength != 16) {
-            return ALC_ERROR_INVALID_SIZE;
-        }
-        return ALC_ERROR_NONE;
-    }
+namespace ref {
+// kernels of the batch API
+static constexpr CpuCipherFeatures cMbArch = CpuCipherFeatures::eReference;
+#include "chacha20_poly1305.cc.inc"
 } // namespace ref
-#endif
 
 } // namespace alcp::cipher
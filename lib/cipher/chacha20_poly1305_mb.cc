@@ -0,0 +1,539 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
+#include "alcp/cipher/chacha20.hh"
+#include "alcp/utils/compare.hh"
+#include "alcp/utils/copy.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace alcp::cipher {
+
+typedef void (*ChaChaMbKernel)(ChaChaMbLanes& lanes, Uint64 blocks);
+typedef void (*PolyMbKernel)(Poly1305MbLanes& lanes, Uint64 blocks);
+
+// packets of a group go through all passes together, so that their data is
+// still in cache when Poly1305 reads what ChaCha20 wrote
+static constexpr Uint64 cMbGroupSize = 64;
+
+// the block counter starts at 1 for the message and must not wrap
+static constexpr Uint64 cMbMaxLen = 0xffffffffULL * 64;
+
+static constexpr Uint64 cMask26 = 0x3ffffff;
+
+struct alignas(64) MbGroup
+{
+    // keystream block 0, the first 32 bytes are the Poly1305 key
+    Uint8 polyKey[cMbGroupSize][64];
+    // last partial block of the message
+    Uint8 tail[cMbGroupSize][64];
+    // padded aad tail, padded message tail and the length block
+    Uint8 pad[cMbGroupSize][48];
+    Uint8 key[cMbGroupSize][32];
+    Uint8 nonce[cMbGroupSize][12];
+    Uint8 tag[cMbGroupSize][16];
+};
+
+// a run of keystream blocks of one packet
+struct ChaChaMbJob
+{
+    const Uint8* key;
+    const Uint8* nonce;
+    Uint32       counter;
+    const Uint8* src;
+    Uint8*       dst;
+    Uint64       blocks;
+};
+
+struct PolyMbSegment
+{
+    const Uint8* msg;
+    Uint64       blocks;
+};
+
+// Poly1305 input of one packet: aad, aad tail, message, message tail and
+// lengths
+struct PolyMbLane
+{
+    Uint64        packet;
+    PolyMbSegment seg[4];
+    Uint32        numSegs;
+    Uint32        nextSeg;
+    Uint64        blocksLeft;
+    bool          isActive;
+};
+
+static alc_error_t
+validatePackets(const alc_aead_packet_t* pPackets,
+                Uint64                   numPackets,
+                Uint64                   nonceLen)
+{
+    for (Uint64 i = 0; i < numPackets; i++) {
+        const alc_aead_packet_t& pkt = pPackets[i];
+
+        if (pkt.ap_iv == nullptr || pkt.ap_tag == nullptr
+            || (pkt.ap_aad == nullptr && pkt.ap_aadLen != 0)
+            || ((pkt.ap_in == nullptr || pkt.ap_out == nullptr)
+                && pkt.ap_len != 0)) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (pkt.ap_ivLen != nonceLen || pkt.ap_tagLen != 16
+            || pkt.ap_len > cMbMaxLen) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * Job manager: a lane picks the next job as soon as its current one drains
+ * and the kernel runs for the blocks left in the shortest active lane.
+ */
+static void
+chachaPass(ChaChaMbKernel     kernel,
+           Uint32             numLanes,
+           const ChaChaMbJob* pJobs,
+           Uint64             numJobs)
+{
+    ChaChaMbLanes     lanes;
+    alignas(64) Uint8 scratch[64]                     = {};
+    Uint64            blocks_left[cChaChaMbMaxLanes] = {};
+    Uint64            next                            = 0;
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    for (;;) {
+        Uint64 min_blocks = 0;
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (blocks_left[l] == 0) {
+                while (next < numJobs && pJobs[next].blocks == 0) {
+                    next++;
+                }
+                if (next == numJobs) {
+                    lanes.m_pSrc[l] = scratch;
+                    lanes.m_pDst[l] = scratch;
+                    lanes.m_step[l] = 0;
+                    continue;
+                }
+
+                const ChaChaMbJob& job = pJobs[next++];
+                for (int i = 0; i < 8; i++) {
+                    memcpy(&lanes.m_key[i][l], job.key + 4 * i, 4);
+                }
+                lanes.m_counter[l] = job.counter;
+                for (int i = 0; i < 3; i++) {
+                    memcpy(&lanes.m_nonce[i][l], job.nonce + 4 * i, 4);
+                }
+                lanes.m_pSrc[l] = job.src;
+                lanes.m_pDst[l] = job.dst;
+                lanes.m_step[l] = 64;
+                blocks_left[l]  = job.blocks;
+            }
+            if (min_blocks == 0 || blocks_left[l] < min_blocks) {
+                min_blocks = blocks_left[l];
+            }
+        }
+
+        if (min_blocks == 0) {
+            break;
+        }
+
+        kernel(lanes, min_blocks);
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (blocks_left[l] != 0) {
+                blocks_left[l] -= min_blocks;
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+}
+
+// clamped r in radix 2^26, accumulator cleared
+static void
+polyLaneInit(Poly1305MbLanes& lanes, Uint32 l, const Uint8 key[16])
+{
+    auto le32 = [key](int i) {
+        Uint32 v;
+        memcpy(&v, key + i, sizeof(v));
+        return static_cast<Uint64>(v);
+    };
+    lanes.m_r[0][l] = le32(0) & 0x3ffffff;
+    lanes.m_r[1][l] = (le32(3) >> 2) & 0x3ffff03;
+    lanes.m_r[2][l] = (le32(6) >> 4) & 0x3ffc0ff;
+    lanes.m_r[3][l] = (le32(9) >> 6) & 0x3f03fff;
+    lanes.m_r[4][l] = (le32(12) >> 8) & 0x00fffff;
+    for (int i = 0; i < 5; i++) {
+        lanes.m_h[i][l] = 0;
+    }
+}
+
+// tag = (h mod 2^130 - 5) + s mod 2^128
+static void
+polyLaneFinish(const Poly1305MbLanes& lanes,
+               Uint32                 l,
+               const Uint8            s[16],
+               Uint8                  tag[16])
+{
+    Uint64 h0 = lanes.m_h[0][l], h1 = lanes.m_h[1][l], h2 = lanes.m_h[2][l];
+    Uint64 h3 = lanes.m_h[3][l], h4 = lanes.m_h[4][l];
+    Uint64 c;
+
+    c  = h1 >> 26;
+    h1 = h1 & cMask26;
+    h2 += c;
+    c  = h2 >> 26;
+    h2 = h2 & cMask26;
+    h3 += c;
+    c  = h3 >> 26;
+    h3 = h3 & cMask26;
+    h4 += c;
+    c  = h4 >> 26;
+    h4 = h4 & cMask26;
+    h0 += c * 5;
+    c  = h0 >> 26;
+    h0 = h0 & cMask26;
+    h1 += c;
+
+    // g = h - p, kept when it does not borrow
+    Uint64 g0 = h0 + 5;
+    c         = g0 >> 26;
+    g0 &= cMask26;
+    Uint64 g1 = h1 + c;
+    c         = g1 >> 26;
+    g1 &= cMask26;
+    Uint64 g2 = h2 + c;
+    c         = g2 >> 26;
+    g2 &= cMask26;
+    Uint64 g3 = h3 + c;
+    c         = g3 >> 26;
+    g3 &= cMask26;
+    Uint64 g4 = h4 + c - (1ULL << 26);
+
+    Uint64 mask = (g4 >> 63) - 1;
+    h0          = (h0 & ~mask) | (g0 & mask);
+    h1          = (h1 & ~mask) | (g1 & mask);
+    h2          = (h2 & ~mask) | (g2 & mask);
+    h3          = (h3 & ~mask) | (g3 & mask);
+    h4          = (h4 & ~mask) | (g4 & mask);
+
+    // h1 may still carry a bit into h2
+    h2 += h1 >> 26;
+    h1 &= cMask26;
+    h3 += h2 >> 26;
+    h2 &= cMask26;
+    h4 += h3 >> 26;
+    h3 &= cMask26;
+
+    Uint64 lo = h0 | (h1 << 26) | (h2 << 52);
+    Uint64 hi = (h2 >> 12) | (h3 << 14) | (h4 << 40);
+    Uint64 s0, s1;
+    memcpy(&s0, s, 8);
+    memcpy(&s1, s + 8, 8);
+
+    Uint64 t0 = lo + s0;
+    Uint64 t1 = hi + s1 + (t0 < lo);
+    memcpy(tag, &t0, 8);
+    memcpy(tag + 8, &t1, 8);
+}
+
+/*
+ * Every lane takes the next packet once it has absorbed all segments of its
+ * current one, the tag of the finished packet is computed right away.
+ */
+static void
+polyPass(PolyMbKernel             kernel,
+         Uint32                   numLanes,
+         MbGroup&                 group,
+         const alc_aead_packet_t* pPackets,
+         Uint64                   numPackets,
+         bool                     isEncrypt)
+{
+    Poly1305MbLanes   lanes;
+    PolyMbLane        lane[cChaChaMbMaxLanes] = {};
+    alignas(64) Uint8 scratch[16]             = {};
+    Uint64            next                    = 0;
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    for (;;) {
+        Uint64 min_blocks = 0;
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            PolyMbLane& ln = lane[l];
+
+            while (ln.blocksLeft == 0) {
+                if (ln.isActive && ln.nextSeg < ln.numSegs) {
+                    const PolyMbSegment& seg = ln.seg[ln.nextSeg++];
+                    lanes.m_pMsg[l]          = seg.msg;
+                    ln.blocksLeft            = seg.blocks;
+                    continue;
+                }
+                if (ln.isActive) {
+                    polyLaneFinish(lanes,
+                                   l,
+                                   group.polyKey[ln.packet] + 16,
+                                   group.tag[ln.packet]);
+                    ln.isActive = false;
+                }
+                if (next == numPackets) {
+                    lanes.m_pMsg[l] = scratch;
+                    lanes.m_step[l] = 0;
+                    break;
+                }
+
+                // aad, message, each zero padded to 16 bytes, then the
+                // lengths of both in little endian
+                const alc_aead_packet_t& pkt     = pPackets[next];
+                const Uint8*             msg     = isEncrypt ? pkt.ap_out
+                                                             : pkt.ap_in;
+                Uint8*                   pad     = group.pad[next];
+                Uint64                   aad_rem = pkt.ap_aadLen % 16;
+                Uint64                   msg_rem = pkt.ap_len % 16;
+
+                memset(pad, 0, 48);
+                if (aad_rem != 0) {
+                    memcpy(pad, pkt.ap_aad + pkt.ap_aadLen - aad_rem, aad_rem);
+                }
+                if (msg_rem != 0) {
+                    memcpy(pad + 16, msg + pkt.ap_len - msg_rem, msg_rem);
+                }
+                memcpy(pad + 32, &pkt.ap_aadLen, 8);
+                memcpy(pad + 40, &pkt.ap_len, 8);
+
+                ln.seg[0]     = { pkt.ap_aad, pkt.ap_aadLen / 16 };
+                ln.seg[1]     = { pad, aad_rem != 0 ? 1ULL : 0ULL };
+                ln.seg[2]     = { msg, pkt.ap_len / 16 };
+                ln.seg[3]     = { msg_rem != 0 ? pad + 16 : pad + 32,
+                                  msg_rem != 0 ? 2ULL : 1ULL };
+                ln.numSegs    = 4;
+                ln.nextSeg    = 0;
+                ln.packet     = next++;
+                ln.isActive   = true;
+                lanes.m_step[l] = 16;
+                polyLaneInit(lanes, l, group.polyKey[ln.packet]);
+            }
+            if (ln.blocksLeft != 0
+                && (min_blocks == 0 || ln.blocksLeft < min_blocks)) {
+                min_blocks = ln.blocksLeft;
+            }
+        }
+
+        if (min_blocks == 0) {
+            break;
+        }
+
+        kernel(lanes, min_blocks);
+
+        for (Uint32 l = 0; l < numLanes; l++) {
+            if (lane[l].blocksLeft != 0) {
+                lane[l].blocksLeft -= min_blocks;
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+}
+
+static alc_error_t
+cryptGroup(ChaChaMbKernel     chachaKernel,
+           PolyMbKernel       polyKernel,
+           Uint32             numLanes,
+           MbGroup&           group,
+           const Uint8        key[],
+           alc_aead_packet_t* pPackets,
+           Uint64             numPackets,
+           Uint64             nonceLen,
+           bool               isEncrypt,
+           CpuCipherFeatures  arch)
+{
+    ChaChaMbJob jobs[2 * cMbGroupSize] = {};
+    Uint64      num_jobs = 0;
+
+    // XChaCha20: the subkeys of all packets in one batch, the stream nonce
+    // is 4 zero bytes and the last 8 bytes of the nonce
+    if (nonceLen == 24) {
+        Uint8 prefixes[cMbGroupSize][16];
+        for (Uint64 p = 0; p < numPackets; p++) {
+            memcpy(prefixes[p], pPackets[p].ap_iv, 16);
+            memset(group.nonce[p], 0, 4);
+            memcpy(group.nonce[p] + 4, pPackets[p].ap_iv + 16, 8);
+        }
+        alc_error_t err = HChaCha20(
+            key, 256, prefixes[0], numPackets, group.key[0], arch);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    } else {
+        for (Uint64 p = 0; p < numPackets; p++) {
+            memcpy(group.key[p], key, 32);
+            memcpy(group.nonce[p], pPackets[p].ap_iv, 12);
+        }
+    }
+
+    // single blocks: block 0 for the Poly1305 key and the partial last
+    // block of the message, which runs through a buffer
+    for (Uint64 p = 0; p < numPackets; p++) {
+        const alc_aead_packet_t& pkt  = pPackets[p];
+        Uint64                   full = pkt.ap_len / 64;
+        Uint64                   rem  = pkt.ap_len % 64;
+
+        memset(group.polyKey[p], 0, 64);
+        jobs[num_jobs++] = { group.key[p], group.nonce[p], 0,
+                             group.polyKey[p], group.polyKey[p], 1 };
+        if (rem != 0) {
+            memset(group.tail[p], 0, 64);
+            memcpy(group.tail[p], pkt.ap_in + full * 64, rem);
+            jobs[num_jobs++] = { group.key[p],
+                                 group.nonce[p],
+                                 static_cast<Uint32>(1 + full),
+                                 group.tail[p],
+                                 group.tail[p],
+                                 1 };
+        }
+    }
+    chachaPass(chachaKernel, numLanes, jobs, num_jobs);
+
+    // the ciphertext is authenticated before it is overwritten in place
+    if (!isEncrypt) {
+        polyPass(polyKernel, numLanes, group, pPackets, numPackets, false);
+    }
+
+    num_jobs = 0;
+    for (Uint64 p = 0; p < numPackets; p++) {
+        const alc_aead_packet_t& pkt = pPackets[p];
+        jobs[num_jobs++]             = { group.key[p], group.nonce[p], 1,
+                                         pkt.ap_in,    pkt.ap_out,
+                                         pkt.ap_len / 64 };
+    }
+    chachaPass(chachaKernel, numLanes, jobs, num_jobs);
+
+    for (Uint64 p = 0; p < numPackets; p++) {
+        const alc_aead_packet_t& pkt = pPackets[p];
+        Uint64                   rem = pkt.ap_len % 64;
+        if (rem != 0) {
+            memcpy(pkt.ap_out + pkt.ap_len - rem, group.tail[p], rem);
+        }
+    }
+
+    if (isEncrypt) {
+        polyPass(polyKernel, numLanes, group, pPackets, numPackets, true);
+    }
+
+    alc_error_t result = ALC_ERROR_NONE;
+    for (Uint64 p = 0; p < numPackets; p++) {
+        alc_aead_packet_t& pkt = pPackets[p];
+
+        pkt.ap_err = ALC_ERROR_NONE;
+        if (isEncrypt) {
+            utils::CopyBytes(pkt.ap_tag, group.tag[p], 16);
+        } else if (!utils::CompareConstTime(group.tag[p], pkt.ap_tag, 16)) {
+            if (pkt.ap_len != 0) {
+                memset(pkt.ap_out, 0, pkt.ap_len);
+            }
+            pkt.ap_err = ALC_ERROR_TAG_MISMATCH;
+            result     = ALC_ERROR_TAG_MISMATCH;
+        }
+    }
+
+    return result;
+}
+
+alc_error_t
+ChaChaPolyBatch(const Uint8        key[],
+                alc_aead_packet_t* pPackets,
+                Uint64             numPackets,
+                Uint64             nonceLen,
+                bool               isEncrypt,
+                CpuCipherFeatures  arch)
+{
+    if (key == nullptr || pPackets == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (nonceLen != 12 && nonceLen != 24) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    alc_error_t err = validatePackets(pPackets, numPackets, nonceLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    ChaChaMbKernel chacha_kernel = nullptr;
+    PolyMbKernel   poly_kernel   = nullptr;
+    Uint32         num_lanes     = 0;
+    switch (arch) {
+        case CpuCipherFeatures::eVaes512:
+            chacha_kernel = zen4::ChaCha20Mb;
+            poly_kernel   = zen4::Poly1305Mb;
+            num_lanes     = zen4::cChaChaPolyMbLanes;
+            break;
+        case CpuCipherFeatures::eVaes256:
+        case CpuCipherFeatures::eAesni:
+            chacha_kernel = avx2::ChaCha20Mb;
+            poly_kernel   = avx2::Poly1305Mb;
+            num_lanes     = avx2::cChaChaPolyMbLanes;
+            break;
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    // large, kept off the stack
+    auto group = std::make_unique<MbGroup>();
+
+    alc_error_t result = ALC_ERROR_NONE;
+    for (Uint64 first = 0; first < numPackets; first += cMbGroupSize) {
+        Uint64 n = std::min(cMbGroupSize, numPackets - first);
+
+        err = cryptGroup(chacha_kernel,
+                         poly_kernel,
+                         num_lanes,
+                         *group,
+                         key,
+                         pPackets + first,
+                         n,
+                         nonceLen,
+                         isEncrypt,
+                         arch);
+        if (err == ALC_ERROR_TAG_MISMATCH) {
+            result = err;
+        } else if (err != ALC_ERROR_NONE) {
+            result = err;
+            break;
+        }
+    }
+    memset(group.get(), 0, sizeof(MbGroup));
+
+    return result;
+}
+
+} // namespace alcp::cipher
@@ -28,22 +28,66 @@
 
 #include "alcp/cipher/aes.hh"
 
+#include "alcp/cipher/aegis.hh"
 #include "alcp/cipher/aes_ccm.hh"
 #include "alcp/cipher/aes_cmac_siv.hh"
 #include "alcp/cipher/aes_gcm.hh"
+#include "alcp/cipher/aes_gcm_siv.hh"
+#include "alcp/cipher/aes_ocb.hh"
 #include "alcp/cipher/aes_generic.hh"
 #include "alcp/cipher/aes_xts.hh"
 #include "alcp/cipher/chacha20.hh"
 #include "alcp/cipher/chacha20_poly1305.hh"
 
+#include <memory>
+#include <utility>
+
 using alcp::utils::CpuId;
 namespace alcp::cipher {
 
 using alcp::utils::CpuCipherFeatures;
 
+// Builds the cipher objects of getCipher(), on the heap or in the storage set
+// on the factory
+class CipherAllocator
+{
+  private:
+    void*  m_pStorage;
+    Uint64 m_storageSize;
+
+  public:
+    CipherAllocator(void* pStorage, Uint64 storageSize)
+        : m_pStorage{ pStorage }
+        , m_storageSize{ storageSize }
+    {
+    }
+
+    template<class T, typename... ARGS>
+    T* make(ARGS&&... args)
+    {
+        static_assert(sizeof(T) <= cCipherObjectMaxSize,
+                      "cipher object does not fit cCipherObjectMaxSize");
+        static_assert(alignof(T) <= cCipherObjectMaxAlign,
+                      "cipher object alignment above cCipherObjectMaxAlign");
+
+        if (m_pStorage == nullptr) {
+            return new T(std::forward<ARGS>(args)...);
+        }
+        void*       p_mem = m_pStorage;
+        std::size_t size  = m_storageSize;
+        if (std::align(alignof(T), sizeof(T), p_mem, size) == nullptr) {
+            printf("\n Error: cipher storage too small ");
+            return nullptr;
+        }
+        return new (p_mem) T(std::forward<ARGS>(args)...);
+    }
+};
+
 template<CipherMode MODE>
 iCipher*
-getGenericCiphers(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
+getGenericCiphers(const CipherKeyLen      keyLen,
+                  const CpuCipherFeatures arch,
+                  CipherAllocator&        alloc)
 {
     if (arch < alcp::utils::CpuCipherFeatures::eAesni) {
         printf("\n Error: Reference kernel not supported ");
@@ -53,47 +97,56 @@ getGenericCiphers(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey128Bit,
-                                              CpuCipherFeatures::eVaes512>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey192Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey192Bit,
-                                              CpuCipherFeatures::eVaes512>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey256Bit,
-                                              CpuCipherFeatures::eVaes512>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey128Bit,
-                                              CpuCipherFeatures::eVaes256>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey192Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey192Bit,
-                                              CpuCipherFeatures::eVaes256>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey256Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey256Bit,
-                                              CpuCipherFeatures::eVaes256>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey128Bit,
-                                              CpuCipherFeatures::eAesni>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey192Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey192Bit,
-                                              CpuCipherFeatures::eAesni>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey256Bit:
-                return new AesGenericCiphersT<MODE,
-                                              CipherKeyLen::eKey256Bit,
-                                              CpuCipherFeatures::eAesni>();
+                return alloc.make<
+                    AesGenericCiphersT<MODE,
+                                       CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
         }
     }
     printf("\n Error: Reference kernel not supported ");
@@ -101,54 +154,199 @@ getGenericCiphers(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
 }
 
 iCipherAead*
-getSiv(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
+getSiv(const CipherKeyLen      keyLen,
+       const CpuCipherFeatures arch,
+       CipherAllocator&        alloc)
 {
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new SivT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<SivT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey192Bit:
-                return new SivT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<SivT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new SivT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<SivT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new SivT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<SivT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey192Bit:
-                return new SivT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<SivT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey256Bit:
-                return new SivT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<SivT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new SivT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<SivT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey192Bit:
-                return new SivT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<SivT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey256Bit:
-                return new SivT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<SivT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
         }
     }
     printf("\n Error: Reference kernel not supported ");
     return nullptr;
 }
 
+// GCM-SIV is only defined for 128 and 256 bit keys
+iCipherAead*
+getGcmSiv(const CipherKeyLen      keyLen,
+          const CpuCipherFeatures arch,
+          CipherAllocator&        alloc)
+{
+    if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey128Bit,
+                                          CpuCipherFeatures::eVaes512>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey256Bit,
+                                          CpuCipherFeatures::eVaes512>>();
+            default:
+                break;
+        }
+    } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey128Bit,
+                                          CpuCipherFeatures::eVaes256>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey256Bit,
+                                          CpuCipherFeatures::eVaes256>>();
+            default:
+                break;
+        }
+    } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey128Bit,
+                                          CpuCipherFeatures::eAesni>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<GcmSivT<CipherKeyLen::eKey256Bit,
+                                          CpuCipherFeatures::eAesni>>();
+            default:
+                break;
+        }
+    }
+    printf("\n Error: GCM-SIV key length or arch not supported ");
+    return nullptr;
+}
+
+iCipherAead*
+getOcb(const CipherKeyLen      keyLen,
+       const CpuCipherFeatures arch,
+       CipherAllocator&        alloc)
+{
+    if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
+            case CipherKeyLen::eKey192Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes512>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
+        }
+    } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+            case CipherKeyLen::eKey192Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+        }
+    } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
+            case CipherKeyLen::eKey192Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eAesni>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<OcbT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
+        }
+    }
+    printf("\n Error: Reference kernel not supported ");
+    return nullptr;
+}
+
+// every AEGIS variant has a single key size
+iCipherAead*
+getAegis(const CipherMode        mode,
+         const CipherKeyLen      keyLen,
+         const CpuCipherFeatures arch,
+         CipherAllocator&        alloc)
+{
+    const bool isVaes = arch == CpuCipherFeatures::eVaes512
+                        || arch == CpuCipherFeatures::eVaes256;
+    switch (mode) {
+        case CipherMode::eAEGIS128L:
+            if (keyLen == CipherKeyLen::eKey128Bit) {
+                return alloc.make<AegisT<AegisVariant::e128L,
+                                         CpuCipherFeatures::eAesni>>();
+            }
+            break;
+        case CipherMode::eAEGIS256:
+            if (keyLen == CipherKeyLen::eKey256Bit) {
+                return alloc.make<AegisT<AegisVariant::e256,
+                                         CpuCipherFeatures::eAesni>>();
+            }
+            break;
+        case CipherMode::eAEGIS128X2:
+            if (keyLen != CipherKeyLen::eKey128Bit) {
+                break;
+            }
+            if (isVaes) {
+                return alloc.make<AegisT<AegisVariant::e128X2,
+                                         CpuCipherFeatures::eVaes256>>();
+            }
+            return alloc.make<AegisT<AegisVariant::e128X2,
+                                     CpuCipherFeatures::eAesni>>();
+        case CipherMode::eAEGIS128X4:
+            if (keyLen != CipherKeyLen::eKey128Bit) {
+                break;
+            }
+            if (arch == CpuCipherFeatures::eVaes512) {
+                return alloc.make<AegisT<AegisVariant::e128X4,
+                                         CpuCipherFeatures::eVaes512>>();
+            } else if (isVaes) {
+                return alloc.make<AegisT<AegisVariant::e128X4,
+                                         CpuCipherFeatures::eVaes256>>();
+            }
+            return alloc.make<AegisT<AegisVariant::e128X4,
+                                     CpuCipherFeatures::eAesni>>();
+        default:
+            break;
+    }
+    printf("\n Error: AEGIS key length not supported ");
+    return nullptr;
+}
+
 // copy-paste of siv, can be avoided
 iCipherAead*
 getGcm(const CipherKeyLen      keyLen,
        const CpuCipherFeatures arch,
-       alc_cipher_state_t*     pCipherState)
+       alc_cipher_state_t*     pCipherState,
+       CipherAllocator&        alloc)
 {
     if (pCipherState == nullptr) {
         printf("\n State invalid ");
@@ -158,38 +356,47 @@ getGcm(const CipherKeyLen      keyLen,
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes512>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey128Bit,
+                         CpuCipherFeatures::eVaes512>>(pCipherState);
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes512>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey192Bit,
+                         CpuCipherFeatures::eVaes512>>(pCipherState);
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes512>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey256Bit,
+                         CpuCipherFeatures::eVaes512>>(pCipherState);
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes256>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey128Bit,
+                         CpuCipherFeatures::eVaes256>>(pCipherState);
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes256>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey192Bit,
+                         CpuCipherFeatures::eVaes256>>(pCipherState);
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes256>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey256Bit,
+                         CpuCipherFeatures::eVaes256>>(pCipherState);
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eAesni>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey128Bit,
+                         CpuCipherFeatures::eAesni>>(pCipherState);
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eAesni>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey192Bit,
+                         CpuCipherFeatures::eAesni>>(pCipherState);
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eAesni>(pCipherState);
+                return alloc.make<
+                    GcmT<CipherKeyLen::eKey256Bit,
+                         CpuCipherFeatures::eAesni>>(pCipherState);
         }
     }
     printf("\n Error: Reference kernel not supported ");
@@ -197,43 +404,45 @@ getGcm(const CipherKeyLen      keyLen,
 }
 
 iCipherAead*
-getGcm(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
+getGcm(const CipherKeyLen      keyLen,
+       const CpuCipherFeatures arch,
+       CipherAllocator&        alloc)
 {
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<GcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<GcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<GcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<GcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<GcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<GcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new GcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<GcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey192Bit:
-                return new GcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<GcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey256Bit:
-                return new GcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<GcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
         }
     }
     printf("\n Error: Reference kernel not supported ");
@@ -241,19 +450,45 @@ getGcm(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
 }
 
 iCipherAead*
-getCcm(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
+getCcm(const CipherKeyLen      keyLen,
+       const CpuCipherFeatures arch,
+       CipherAllocator&        alloc)
 {
-    if (arch >= alcp::utils::CpuCipherFeatures::eAesni) {
+    if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLen) {
             case CipherKeyLen::eKey128Bit:
-                return new CcmT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<CcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey192Bit:
-                return new CcmT<CipherKeyLen::eKey192Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<CcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new CcmT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<CcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
+        }
+    } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+            case CipherKeyLen::eKey192Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
+        }
+    } else if (arch >= alcp::utils::CpuCipherFeatures::eAesni) {
+        switch (keyLen) {
+            case CipherKeyLen::eKey128Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
+            case CipherKeyLen::eKey192Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey192Bit,
+                                       CpuCipherFeatures::eAesni>>();
+            case CipherKeyLen::eKey256Bit:
+                return alloc.make<CcmT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
         }
     }
     printf("\n Error: Reference kernel not supported ");
@@ -261,7 +496,9 @@ getCcm(const CipherKeyLen keyLen, const CpuCipherFeatures arch)
 }
 
 iCipher*
-getXts(const CipherKeyLen keyLenBits, const CpuCipherFeatures arch)
+getXts(const CipherKeyLen      keyLenBits,
+       const CpuCipherFeatures arch,
+       CipherAllocator&        alloc)
 {
     if ((keyLenBits != CipherKeyLen::eKey128Bit)
         && (keyLenBits != CipherKeyLen::eKey256Bit)) {
@@ -271,33 +508,33 @@ getXts(const CipherKeyLen keyLenBits, const CpuCipherFeatures arch)
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<XtsT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes512>();
+                return alloc.make<XtsT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes512>>();
             default:
                 return nullptr;
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<XtsT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eVaes256>();
+                return alloc.make<XtsT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eVaes256>>();
             default:
                 return nullptr;
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsT<CipherKeyLen::eKey128Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<XtsT<CipherKeyLen::eKey128Bit,
+                                       CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsT<CipherKeyLen::eKey256Bit,
-                                CpuCipherFeatures::eAesni>();
+                return alloc.make<XtsT<CipherKeyLen::eKey256Bit,
+                                       CpuCipherFeatures::eAesni>>();
             default:
                 return nullptr;
         }
@@ -307,7 +544,9 @@ getXts(const CipherKeyLen keyLenBits, const CpuCipherFeatures arch)
 }
 
 iCipherSeg*
-getXtsBlock(const CipherKeyLen keyLenBits, const CpuCipherFeatures arch)
+getXtsBlock(const CipherKeyLen      keyLenBits,
+            const CpuCipherFeatures arch,
+            CipherAllocator&        alloc)
 {
     if ((keyLenBits != CipherKeyLen::eKey128Bit)
         && (keyLenBits != CipherKeyLen::eKey256Bit)) {
@@ -317,33 +556,33 @@ getXtsBlock(const CipherKeyLen keyLenBits, const CpuCipherFeatures arch)
     if (arch == alcp::utils::CpuCipherFeatures::eVaes512) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsBlockT<CipherKeyLen::eKey128Bit,
-                                     CpuCipherFeatures::eVaes512>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey128Bit,
+                                            CpuCipherFeatures::eVaes512>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsBlockT<CipherKeyLen::eKey256Bit,
-                                     CpuCipherFeatures::eVaes512>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey256Bit,
+                                            CpuCipherFeatures::eVaes512>>();
             default:
                 return nullptr;
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eVaes256) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsBlockT<CipherKeyLen::eKey128Bit,
-                                     CpuCipherFeatures::eVaes256>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey128Bit,
+                                            CpuCipherFeatures::eVaes256>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsBlockT<CipherKeyLen::eKey256Bit,
-                                     CpuCipherFeatures::eVaes256>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey256Bit,
+                                            CpuCipherFeatures::eVaes256>>();
             default:
                 return nullptr;
         }
     } else if (arch == alcp::utils::CpuCipherFeatures::eAesni) {
         switch (keyLenBits) {
             case CipherKeyLen::eKey128Bit:
-                return new XtsBlockT<CipherKeyLen::eKey128Bit,
-                                     CpuCipherFeatures::eAesni>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey128Bit,
+                                            CpuCipherFeatures::eAesni>>();
             case CipherKeyLen::eKey256Bit:
-                return new XtsBlockT<CipherKeyLen::eKey256Bit,
-                                     CpuCipherFeatures::eAesni>();
+                return alloc.make<XtsBlockT<CipherKeyLen::eKey256Bit,
+                                            CpuCipherFeatures::eAesni>>();
             default:
                 return nullptr;
         }
@@ -368,6 +607,7 @@ template<>
 void
 CipherFactory<iCipher>::getCipher()
 {
+    CipherAllocator alloc(m_pStorage, m_storageSize);
 
     if (!isKeyLenSupported(m_keyLen)) {
         printf("\n Error: key length not supported ");
@@ -377,32 +617,54 @@ CipherFactory<iCipher>::getCipher()
 
     // Non-AEAD ciphers
     switch (m_cipher_mode) {
+        case CipherMode::eAesECB:
+            m_iCipher = getGenericCiphers<CipherMode::eAesECB>(
+                m_keyLen, m_arch, alloc);
+            break;
         case CipherMode::eAesCBC:
-            m_iCipher =
-                getGenericCiphers<CipherMode::eAesCBC>(m_keyLen, m_arch);
+            m_iCipher = getGenericCiphers<CipherMode::eAesCBC>(
+                m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eAesOFB:
-            m_iCipher =
-                getGenericCiphers<CipherMode::eAesOFB>(m_keyLen, m_arch);
+            m_iCipher = getGenericCiphers<CipherMode::eAesOFB>(
+                m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eAesCTR:
-            m_iCipher =
-                getGenericCiphers<CipherMode::eAesCTR>(m_keyLen, m_arch);
+            m_iCipher = getGenericCiphers<CipherMode::eAesCTR>(
+                m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eAesCFB:
-            m_iCipher =
-                getGenericCiphers<CipherMode::eAesCFB>(m_keyLen, m_arch);
+            m_iCipher = getGenericCiphers<CipherMode::eAesCFB>(
+                m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eAesXTS:
-            m_iCipher = getXts(m_keyLen, m_arch);
+            m_iCipher = getXts(m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eCHACHA20:
             if (m_arch == CpuCipherFeatures::eVaes512) {
                 using namespace vaes512;
-                m_iCipher = new ChaCha256();
+                m_iCipher = alloc.make<ChaCha256>();
+            } else if (m_arch == CpuCipherFeatures::eVaes256
+                       || m_arch == CpuCipherFeatures::eAesni) {
+                // both imply avx2, see getCpuCipherFeature()
+                using namespace avx2;
+                m_iCipher = alloc.make<ChaCha256>();
+            } else {
+                using namespace ref;
+                m_iCipher = alloc.make<ChaCha256>();
+            }
+            break;
+        case CipherMode::eXCHACHA20:
+            if (m_arch == CpuCipherFeatures::eVaes512) {
+                using namespace vaes512;
+                m_iCipher = alloc.make<XChaCha256>();
+            } else if (m_arch == CpuCipherFeatures::eVaes256
+                       || m_arch == CpuCipherFeatures::eAesni) {
+                using namespace avx2;
+                m_iCipher = alloc.make<XChaCha256>();
             } else {
                 using namespace ref;
-                m_iCipher = new ChaCha256();
+                m_iCipher = alloc.make<XChaCha256>();
             }
             break;
         default:
@@ -416,6 +678,8 @@ template<>
 void
 CipherFactory<iCipherSeg>::getCipher()
 {
+    CipherAllocator alloc(m_pStorage, m_storageSize);
+
     if (m_arch < alcp::utils::CpuCipherFeatures::eAesni) {
         printf("\n Error: Reference kernel not supported ");
         m_iCipher = nullptr;
@@ -425,7 +689,7 @@ CipherFactory<iCipherSeg>::getCipher()
     // Non-AEAD ciphers
     switch (m_cipher_mode) {
         case CipherMode::eAesXTS:
-            m_iCipher = getXtsBlock(m_keyLen, m_arch);
+            m_iCipher = getXtsBlock(m_keyLen, m_arch, alloc);
             break;
         default:
             printf("\n Error: Cipher mode not supported in iCipherSeg ");
@@ -438,6 +702,8 @@ template<>
 void
 CipherFactory<iCipherAead>::getCipher()
 {
+    CipherAllocator alloc(m_pStorage, m_storageSize);
+
     if (!isKeyLenSupported(m_keyLen)) {
         printf("\n Error: key length not supported ");
         m_iCipher = nullptr;
@@ -448,24 +714,53 @@ CipherFactory<iCipherAead>::getCipher()
     switch (m_cipher_mode) {
         case CipherMode::eAesGCM:
             if (m_cipher_state != nullptr) {
-                m_iCipher = getGcm(m_keyLen, m_arch, m_cipher_state);
+                m_iCipher = getGcm(m_keyLen, m_arch, m_cipher_state, alloc);
             } else {
-                m_iCipher = getGcm(m_keyLen, m_arch);
+                m_iCipher = getGcm(m_keyLen, m_arch, alloc);
             }
             break;
         case CipherMode::eAesCCM:
-            m_iCipher = getCcm(m_keyLen, m_arch);
+            m_iCipher = getCcm(m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eAesSIV:
-            m_iCipher = getSiv(m_keyLen, m_arch);
+            m_iCipher = getSiv(m_keyLen, m_arch, alloc);
+            break;
+        case CipherMode::eAesGCMSIV:
+            m_iCipher = getGcmSiv(m_keyLen, m_arch, alloc);
+            break;
+        case CipherMode::eAesOCB:
+            m_iCipher = getOcb(m_keyLen, m_arch, alloc);
+            break;
+        case CipherMode::eAEGIS128L:
+        case CipherMode::eAEGIS256:
+        case CipherMode::eAEGIS128X2:
+        case CipherMode::eAEGIS128X4:
+            m_iCipher = getAegis(m_cipher_mode, m_keyLen, m_arch, alloc);
             break;
         case CipherMode::eCHACHA20_POLY1305:
             if (m_arch == CpuCipherFeatures::eVaes512) {
                 using namespace vaes512;
-                m_iCipher = new ChaChaPoly256();
+                m_iCipher = alloc.make<ChaChaPoly256>();
+            } else if (m_arch == CpuCipherFeatures::eVaes256
+                       || m_arch == CpuCipherFeatures::eAesni) {
+                using namespace avx2;
+                m_iCipher = alloc.make<ChaChaPoly256>();
             } else {
                 using namespace ref;
-                m_iCipher = new ChaChaPoly256();
+                m_iCipher = alloc.make<ChaChaPoly256>();
+            }
+            break;
+        case CipherMode::eXCHACHA20_POLY1305:
+            if (m_arch == CpuCipherFeatures::eVaes512) {
+                using namespace vaes512;
+                m_iCipher = alloc.make<XChaChaPoly256>();
+            } else if (m_arch == CpuCipherFeatures::eVaes256
+                       || m_arch == CpuCipherFeatures::eAesni) {
+                using namespace avx2;
+                m_iCipher = alloc.make<XChaChaPoly256>();
+            } else {
+                using namespace ref;
+                m_iCipher = alloc.make<XChaChaPoly256>();
             }
             break;
         default:
@@ -489,6 +784,9 @@ template<class INTERFACE>
 INTERFACE*
 CipherFactory<INTERFACE>::create(const string& name)
 {
+    if (m_cipherMap.empty()) {
+        initCipherMap();
+    }
     auto it = m_cipherMap.find(name);
     if (it == m_cipherMap.end()) {
         std::cout << "\n error " << name << " cipher mode not supported "
@@ -504,6 +802,9 @@ template<class INTERFACE>
 INTERFACE*
 CipherFactory<INTERFACE>::create(const string& name, CpuCipherFeatures arch)
 {
+    if (m_cipherMap.empty()) {
+        initCipherMap();
+    }
     auto it = m_cipherMap.find(name);
     if (it == m_cipherMap.end()) {
         std::cout << "\n error " << name << " cipher mode not supported "
@@ -595,6 +896,10 @@ void
 CipherFactory<iCipher>::initCipherMap()
 {
     m_cipherMap = {
+        { "aes-ecb-128", { CipherMode::eAesECB, CipherKeyLen::eKey128Bit } },
+        { "aes-ecb-192", { CipherMode::eAesECB, CipherKeyLen::eKey192Bit } },
+        { "aes-ecb-256", { CipherMode::eAesECB, CipherKeyLen::eKey256Bit } },
+
         { "aes-cbc-128", { CipherMode::eAesCBC, CipherKeyLen::eKey128Bit } },
         { "aes-cbc-192", { CipherMode::eAesCBC, CipherKeyLen::eKey192Bit } },
         { "aes-cbc-256", { CipherMode::eAesCBC, CipherKeyLen::eKey256Bit } },
@@ -615,6 +920,7 @@ CipherFactory<iCipher>::initCipherMap()
         { "aes-xts-256", { CipherMode::eAesXTS, CipherKeyLen::eKey256Bit } },
 
         { "chacha20", { CipherMode::eCHACHA20, CipherKeyLen::eKey256Bit } },
+        { "xchacha20", { CipherMode::eXCHACHA20, CipherKeyLen::eKey256Bit } },
     };
 }
 
@@ -645,8 +951,26 @@ CipherFactory<iCipherAead>::initCipherMap()
         { "aes-siv-192", { CipherMode::eAesSIV, CipherKeyLen::eKey192Bit } },
         { "aes-siv-256", { CipherMode::eAesSIV, CipherKeyLen::eKey256Bit } },
 
+        { "aes-gcm-siv-128",
+          { CipherMode::eAesGCMSIV, CipherKeyLen::eKey128Bit } },
+        { "aes-gcm-siv-256",
+          { CipherMode::eAesGCMSIV, CipherKeyLen::eKey256Bit } },
+
+        { "aes-ocb-128", { CipherMode::eAesOCB, CipherKeyLen::eKey128Bit } },
+        { "aes-ocb-192", { CipherMode::eAesOCB, CipherKeyLen::eKey192Bit } },
+        { "aes-ocb-256", { CipherMode::eAesOCB, CipherKeyLen::eKey256Bit } },
+
         { "chachapoly",
           { CipherMode::eCHACHA20_POLY1305, CipherKeyLen::eKey256Bit } },
+        { "xchachapoly",
+          { CipherMode::eXCHACHA20_POLY1305, CipherKeyLen::eKey256Bit } },
+
+        { "aegis-128l", { CipherMode::eAEGIS128L, CipherKeyLen::eKey128Bit } },
+        { "aegis-256", { CipherMode::eAEGIS256, CipherKeyLen::eKey256Bit } },
+        { "aegis-128x2",
+          { CipherMode::eAEGIS128X2, CipherKeyLen::eKey128Bit } },
+        { "aegis-128x4",
+          { CipherMode::eAEGIS128X4, CipherKeyLen::eKey128Bit } },
     };
 }
 
@@ -657,21 +981,37 @@ CipherFactory<INTERFACE>::clearCipherMap()
     m_cipherMap.clear();
 }
 
+// the name map is only built by the create() overloads taking a name, so a
+// factory on the stack costs no allocation
 template<class INTERFACE>
-CipherFactory<INTERFACE>::CipherFactory()
-{
-    initCipherMap();
-};
+CipherFactory<INTERFACE>::CipherFactory() = default;
 
 template<class INTERFACE>
 CipherFactory<INTERFACE>::~CipherFactory()
 {
     clearCipherMap();
-    if (m_iCipher != nullptr) {
+    if (m_iCipher != nullptr && m_pStorage == nullptr) {
         delete m_iCipher;
     }
 };
 
+template<class INTERFACE>
+void
+CipherFactory<INTERFACE>::setStorage(void* pStorage, Uint64 storageSize)
+{
+    m_pStorage    = pStorage;
+    m_storageSize = storageSize;
+}
+
+template<class INTERFACE>
+void
+CipherFactory<INTERFACE>::destroy(INTERFACE* pCipher)
+{
+    if (pCipher != nullptr) {
+        pCipher->~INTERFACE();
+    }
+}
+
 template class CipherFactory<iCipherAead>;
 template class CipherFactory<iCipher>;
 template class CipherFactory<iCipherSeg>;
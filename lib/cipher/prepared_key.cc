@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/prepared_key.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/utils/copy.hh"
+#include "alcp/utils/cpuid.hh"
+#include "alcp/utils/memory.hh"
+
+#include <cstring>
+#include <new>
+
+using alcp::utils::CpuId;
+
+namespace alcp::cipher {
+
+static bool
+isSupportedMode(CipherMode mode)
+{
+    switch (mode) {
+        case CipherMode::eAesECB:
+        case CipherMode::eAesCBC:
+        case CipherMode::eAesOFB:
+        case CipherMode::eAesCTR:
+        case CipherMode::eAesCFB:
+        case CipherMode::eAesXTS:
+        case CipherMode::eAesGCM:
+        case CipherMode::eAesCCM:
+        case CipherMode::eAesOCB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// same choice as CipherFactory makes for the GCM kernels
+static bool
+hasVaes512()
+{
+    return CpuId::cpuHasAesni() && CpuId::cpuHasAvx2() && CpuId::cpuHasVaes()
+           && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_F)
+           && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_DQ)
+           && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_BW);
+}
+
+PreparedKey::PreparedKey(CipherMode mode, Uint64 keyLen)
+    : m_mode{ mode }
+    , m_keyLen{ keyLen }
+{
+    utils::memlock(m_enc_key, sizeof(m_enc_key));
+    utils::memlock(m_dec_key, sizeof(m_dec_key));
+    utils::memlock(m_tweak_key, sizeof(m_tweak_key));
+}
+
+PreparedKey::~PreparedKey()
+{
+    memset(m_enc_key, 0, sizeof(m_enc_key));
+    memset(m_dec_key, 0, sizeof(m_dec_key));
+    memset(m_tweak_key, 0, sizeof(m_tweak_key));
+    memset(m_hashSubkeyTable, 0, sizeof(m_hashSubkeyTable));
+    utils::memunlock(m_enc_key, sizeof(m_enc_key));
+    utils::memunlock(m_dec_key, sizeof(m_dec_key));
+    utils::memunlock(m_tweak_key, sizeof(m_tweak_key));
+}
+
+alc_error_t
+PreparedKey::create(CipherMode    mode,
+                    const Uint8*  pKey,
+                    Uint64        keyLen,
+                    PreparedKey** ppKey)
+{
+    if (pKey == nullptr || ppKey == nullptr) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    if (!isSupportedMode(mode)) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+    if (!Aes::isSupported(keyLen)) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    auto p_key = new (std::nothrow) PreparedKey(mode, keyLen);
+    if (p_key == nullptr) {
+        return ALC_ERROR_NO_MEMORY;
+    }
+
+    {
+        Rijndael rij;
+        rij.setKey(pKey, static_cast<int>(keyLen));
+        utils::CopyBytes(p_key->m_enc_key, rij.getEncryptKeys(), cRoundKeySize);
+        utils::CopyBytes(p_key->m_dec_key, rij.getDecryptKeys(), cRoundKeySize);
+    }
+
+    // XTS tweak key follows the data key, it only needs the encrypt schedule
+    if (mode == CipherMode::eAesXTS) {
+        Rijndael rij;
+        rij.setKey(pKey + keyLen / 8, static_cast<int>(keyLen));
+        utils::CopyBytes(
+            p_key->m_tweak_key, rij.getEncryptKeys(), cRoundKeySize);
+    }
+
+    if (mode == CipherMode::eAesGCM && hasVaes512()) {
+        int rounds = static_cast<int>(keyLen / 32 + 6);
+        vaes512::computeGcmHashTable(
+            p_key->m_enc_key, rounds, p_key->m_hashSubkeyTable);
+        p_key->m_hasHashSubkeyTable = true;
+    }
+
+    *ppKey = p_key;
+    return ALC_ERROR_NONE;
+}
+
+void
+PreparedKey::retain() const
+{
+    m_refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+PreparedKey::release() const
+{
+    // the last reference frees the key, after every other holder is done
+    if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete this;
+    }
+}
+
+} // namespace alcp::cipher
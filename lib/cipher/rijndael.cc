@@ -334,7 +334,7 @@ Rijndael::setKey(const Uint8* key, int len)
     /* Encryption and Decryption keys */
     m_enc_key = m_round_key_enc;
     m_dec_key = m_round_key_dec;
-    expandKeys(key);
+    expandKeys(key, m_round_key_enc, m_round_key_dec);
 }
 
 void
@@ -348,7 +348,19 @@ Rijndael::setKey(const Uint8* key, Uint8* pExpKey, int len)
     /* Encryption and Decryption keys */
     m_enc_key = pExpKey;
     m_dec_key = pExpKey + (8 * 8);
-    expandKeys(key);
+    expandKeys(key, pExpKey, pExpKey + (8 * 8));
+}
+
+void
+Rijndael::setExpandedKeys(const Uint8* pEncKey, const Uint8* pDecKey, int len)
+{
+    m_block_size      = BitsToBlockSize(len);
+    const Params& prm = ParamsMap.at(m_block_size);
+    m_nrounds         = prm.Nr;
+    m_key_size        = len / utils::BitsPerByte;
+
+    m_enc_key = pEncKey;
+    m_dec_key = pDecKey;
 }
 
 /*
@@ -580,16 +592,14 @@ Rijndael::decrypt(const Uint8* pSrc, Uint8* pDst, Uint64 len) const
  * conciseness.
  */
 void
-Rijndael::expandKeys(const Uint8* pUserKey) noexcept
+Rijndael::expandKeys(const Uint8* pUserKey,
+                     Uint8*       pEncKey,
+                     Uint8*       pDecKey) noexcept
 {
     using utils::GetByte, utils::MakeWord;
 
     Uint8        dummy_key[Rijndael::cMaxKeySize] = { 0 };
-    const Uint8* key     = pUserKey ? pUserKey : &dummy_key[0];
-    Uint8 *      pEncKey = nullptr, *pDecKey = nullptr;
-
-    pEncKey = m_enc_key;
-    pDecKey = m_dec_key;
+    const Uint8* key = pUserKey ? pUserKey : &dummy_key[0];
 
     if (CpuId::cpuHasAesni()) {
         aesni::ExpandKeys(key, pEncKey, pDecKey, m_nrounds);
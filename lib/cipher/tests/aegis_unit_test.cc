@@ -0,0 +1,449 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+using alcp::cipher::CipherFactory;
+using alcp::cipher::CipherKeyLen;
+using alcp::cipher::CipherMode;
+using alcp::cipher::iCipherAead;
+namespace alcp::cipher::unittest::aegis {
+std::vector<Uint8>
+parseHex(const std::string& in)
+{
+    std::vector<Uint8> out;
+    for (Uint64 i = 0; i + 1 < in.size(); i += 2) {
+        out.push_back(std::stoi(in.substr(i, 2), nullptr, 16));
+    }
+    return out;
+}
+
+struct AegisVector
+{
+    const char* name;
+    const char* key;
+    const char* nonce;
+    const char* aad;
+    const char* plainText;
+    const char* cipherText;
+    const char* tag;
+};
+
+// draft-irtf-cfrg-aegis-aead test vectors
+std::vector<AegisVector> vectors = {
+    { "aegis-128l",
+      "10010000000000000000000000000000",
+      "10000200000000000000000000000000",
+      "",
+      "00000000000000000000000000000000",
+      "c1c0e58bd913006feba00f4b3cc3594e",
+      "abe0ece80c24868a226a35d16bdae37a" },
+    { "aegis-128l",
+      "10010000000000000000000000000000",
+      "10000200000000000000000000000000",
+      "",
+      "00000000000000000000000000000000",
+      "c1c0e58bd913006feba00f4b3cc3594e",
+      "25835bfbb21632176cf03840687cb968cace4617af1bd0f7d064c639a5c79ee4" },
+    { "aegis-256",
+      "1001000000000000000000000000000000000000000000000000000000000000",
+      "1000020000000000000000000000000000000000000000000000000000000000",
+      "",
+      "00000000000000000000000000000000",
+      "754fc3d8c973246dcc6d741412a4b236",
+      "3fe91994768b332ed7f570a19ec5896e" },
+    { "aegis-256",
+      "1001000000000000000000000000000000000000000000000000000000000000",
+      "1000020000000000000000000000000000000000000000000000000000000000",
+      "",
+      "00000000000000000000000000000000",
+      "754fc3d8c973246dcc6d741412a4b236",
+      "1181a1d18091082bf0266f66297d167d2e68b845f61a3b0527d31fc7b7b89f13" },
+    { "aegis-128x2",
+      "000102030405060708090a0b0c0d0e0f",
+      "101112131415161718191a1b1c1d1e1f",
+      "",
+      "",
+      "",
+      "63117dc57756e402819a82e13eca8379" },
+    { "aegis-128x2",
+      "000102030405060708090a0b0c0d0e0f",
+      "101112131415161718191a1b1c1d1e1f",
+      "",
+      "",
+      "",
+      "b92c71fdbd358b8a4de70b27631ace90cffd9b9cfba82028412bac41b4f53759" },
+    { "aegis-128x4",
+      "000102030405060708090a0b0c0d0e0f",
+      "101112131415161718191a1b1c1d1e1f",
+      "",
+      "",
+      "",
+      "5bef762d0947c00455b97bb3af30dfa3" },
+    { "aegis-128x4",
+      "000102030405060708090a0b0c0d0e0f",
+      "101112131415161718191a1b1c1d1e1f",
+      "",
+      "",
+      "",
+      "a4b25437f4be93cfa856a2f27e4416b42cac79fd4698f2cdbe6af25673e10a68" },
+};
+
+// Long message which runs through the wide kernels for both the message and
+// the AAD. Key is 00 01 02 ..., nonce 64 65 ..., plaintext[i] = i,
+// aad[i] = 7 * i.
+struct LongVector
+{
+    const char* name;
+    Uint64      keyLen;
+    const char* firstBlock;
+    const char* lastBlock;
+    const char* tag;
+    const char* longTag;
+};
+
+std::vector<LongVector> longVectors = {
+    { "aegis-128l",
+      16,
+      "6f41fb2c32fcdbee888b0c996172e883",
+      "3a7a5d4dbfc68fcf7007b28464a967e1",
+      "304186828ede48bb3732e14b1b87d7e7",
+      "9aa9361f6a9f8e399af0bbc22f6019466f5c5d347a23ca6f647cd60a6fff177e" },
+    { "aegis-256",
+      32,
+      "e238f40255d647f80ab6aec4113a0340",
+      "c9e6841f9cfbdae49acfccc857de7b96",
+      "d5b79f4e638d563b83c900287ca793f4",
+      "56af055172839785f1346c59f5efca8283189a1f110ec1be72fd6c7189485976" },
+    { "aegis-128x2",
+      16,
+      "0e113a0635caae227c85e9f0f205fe90",
+      "ceb3673666d632e969fa46c15051b795",
+      "97b99fcb1d48c95124489996d063d8e0",
+      "2299460a19d356e192a111e1201d1fdf7f1df337fa1f2b722f81db21b0a10926" },
+    { "aegis-128x4",
+      16,
+      "92a8da26562510f93f14e3851dbee1fd",
+      "765ab801f0a9616a42fc1e47f28a9552",
+      "c3933033e0c1b4ee38cda2a86bbd98ec",
+      "5eedda4eeb234885975d6581eaa33b002152eea5135e70e95355d09e020be033" },
+};
+
+// Tag verification is left to the caller, like GCM
+template<bool cEnc>
+alc_error_t
+aegisCrypt(iCipherAead*              aegis,
+           const std::vector<Uint8>& key,
+           const std::vector<Uint8>& nonce,
+           const std::vector<Uint8>& aad,
+           const std::vector<Uint8>& input,
+           std::vector<Uint8>&       output,
+           std::vector<Uint8>&       tag,
+           Uint64                    tagLen = 16)
+{
+    alc_error_t err =
+        aegis->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (!aad.empty()) {
+        err = aegis->setAad(&aad[0], aad.size());
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+    output.resize(input.size());
+    if constexpr (cEnc) {
+        err = aegis->encrypt(input.data(), output.data(), input.size());
+    } else {
+        err = aegis->decrypt(input.data(), output.data(), input.size());
+    }
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    tag.resize(tagLen);
+    return aegis->getTag(&tag[0], tag.size());
+}
+
+const std::vector<std::string> names = {
+    "aegis-128l", "aegis-256", "aegis-128x2", "aegis-128x4"
+};
+} // namespace alcp::cipher::unittest::aegis
+
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::aegis;
+
+TEST(AEGIS, creation)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        for (auto& name : names) {
+            EXPECT_NE(alcpCipher.create(name, feature), nullptr);
+        }
+        // each variant has a single key size
+        EXPECT_EQ(alcpCipher.create(CipherMode::eAEGIS128L,
+                                    CipherKeyLen::eKey256Bit,
+                                    feature),
+                  nullptr);
+        EXPECT_EQ(alcpCipher.create(CipherMode::eAEGIS256,
+                                    CipherKeyLen::eKey128Bit,
+                                    feature),
+                  nullptr);
+    }
+}
+
+TEST(AEGIS, KnownAnswer)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : vectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead* aegis = alcpCipher.create(v.name, feature);
+            ASSERT_NE(aegis, nullptr);
+
+            auto key = parseHex(v.key), nonce = parseHex(v.nonce);
+            auto aad = parseHex(v.aad), pt = parseHex(v.plainText);
+            auto expTag = parseHex(v.tag);
+            std::vector<Uint8> ct, tag, back, backTag;
+
+            EXPECT_EQ(aegisCrypt<true>(
+                          aegis, key, nonce, aad, pt, ct, tag, expTag.size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ct, parseHex(v.cipherText)) << v.name;
+            EXPECT_EQ(tag, expTag) << v.name;
+
+            EXPECT_EQ(
+                aegisCrypt<false>(
+                    aegis, key, nonce, aad, ct, back, backTag, expTag.size()),
+                ALC_ERROR_NONE);
+            EXPECT_EQ(back, pt);
+            EXPECT_EQ(backTag, tag);
+        }
+    }
+}
+
+TEST(AEGIS, LongMessage)
+{
+    std::vector<Uint8> nonce(32), pt(1031), aad(301);
+    for (Uint64 i = 0; i < nonce.size(); i++) {
+        nonce[i] = 100 + i;
+    }
+    for (Uint64 i = 0; i < pt.size(); i++) {
+        pt[i] = i & 0xff;
+    }
+    for (Uint64 i = 0; i < aad.size(); i++) {
+        aad[i] = (7 * i) & 0xff;
+    }
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : longVectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead* aegis = alcpCipher.create(v.name, feature);
+            ASSERT_NE(aegis, nullptr);
+
+            // the nonce is as long as the key
+            std::vector<Uint8> key(v.keyLen), n(nonce.begin(),
+                                                 nonce.begin() + v.keyLen);
+            for (Uint64 i = 0; i < key.size(); i++) {
+                key[i] = i;
+            }
+            std::vector<Uint8> ct, tag, longTag, back;
+
+            EXPECT_EQ(aegisCrypt<true>(aegis, key, n, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(std::vector<Uint8>(ct.begin(), ct.begin() + 16),
+                      parseHex(v.firstBlock))
+                << v.name;
+            EXPECT_EQ(std::vector<Uint8>(ct.end() - 16, ct.end()),
+                      parseHex(v.lastBlock))
+                << v.name;
+            EXPECT_EQ(tag, parseHex(v.tag)) << v.name;
+
+            EXPECT_EQ(
+                aegisCrypt<false>(aegis, key, n, aad, ct, back, longTag, 32),
+                ALC_ERROR_NONE);
+            EXPECT_EQ(back, pt);
+            EXPECT_EQ(longTag, parseHex(v.longTag)) << v.name;
+        }
+    }
+}
+
+// Every length up to a few wide iterations must agree with the AES-NI path
+TEST(AEGIS, MatchesAesni)
+{
+    Randomize          rng(19);
+    std::vector<Uint8> key(16), nonce(16), input(1200), aad(600);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(nonce);
+    rng.getRandomBytes(input);
+    rng.getRandomBytes(aad);
+
+    for (auto name : { "aegis-128x2", "aegis-128x4" }) {
+        CipherFactory<iCipherAead> refFactory;
+        iCipherAead* ref = refFactory.create(name, CpuCipherFeatures::eAesni);
+        ASSERT_NE(ref, nullptr);
+
+        for (CpuCipherFeatures feature : getSupportedFeatures()) {
+            if (feature == CpuCipherFeatures::eReference
+                || feature == CpuCipherFeatures::eAesni) {
+                continue;
+            }
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead*               aegis = alcpCipher.create(name, feature);
+            ASSERT_NE(aegis, nullptr);
+
+            for (Uint64 len = 0; len <= input.size(); len += 13) {
+                std::vector<Uint8> pt(input.begin(), input.begin() + len);
+                std::vector<Uint8> a(aad.begin(), aad.begin() + len / 2);
+                std::vector<Uint8> ct, tag, refCt, refTag;
+
+                EXPECT_EQ(
+                    aegisCrypt<true>(ref, key, nonce, a, pt, refCt, refTag),
+                    ALC_ERROR_NONE);
+                EXPECT_EQ(aegisCrypt<true>(aegis, key, nonce, a, pt, ct, tag),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(ct, refCt) << name << " len " << len;
+                EXPECT_EQ(tag, refTag) << name << " len " << len;
+            }
+        }
+    }
+}
+
+// Updates of any size are buffered up to the rate of the variant
+TEST(AEGIS, MultiUpdate)
+{
+    Randomize          rng(23);
+    std::vector<Uint8> key(32), nonce(32), pt(1000), aad(500);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(nonce);
+    rng.getRandomBytes(pt);
+    rng.getRandomBytes(aad);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& name : names) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead*               aegis = alcpCipher.create(name, feature);
+            ASSERT_NE(aegis, nullptr);
+
+            Uint64             keyLen = name == "aegis-256" ? 32 : 16;
+            std::vector<Uint8> k(key.begin(), key.begin() + keyLen);
+            std::vector<Uint8> n(nonce.begin(), nonce.begin() + keyLen);
+            std::vector<Uint8> ct, tag;
+            ASSERT_EQ(aegisCrypt<true>(aegis, k, n, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+
+            for (Uint64 chunk : { 1, 7, 33, 100, 129 }) {
+                std::vector<Uint8> out(pt.size()), back(pt.size());
+                std::vector<Uint8> outTag(16), backTag(16);
+
+                aegis->init(&k[0], keyLen * 8, &n[0], keyLen);
+                for (Uint64 off = 0; off < aad.size(); off += chunk) {
+                    Uint64 len = std::min(chunk, aad.size() - off);
+                    EXPECT_EQ(aegis->setAad(&aad[off], len), ALC_ERROR_NONE);
+                }
+                for (Uint64 off = 0; off < pt.size(); off += chunk) {
+                    Uint64 len = std::min(chunk, pt.size() - off);
+                    EXPECT_EQ(aegis->encrypt(&pt[off], &out[off], len),
+                              ALC_ERROR_NONE);
+                }
+                EXPECT_EQ(aegis->getTag(&outTag[0], 16), ALC_ERROR_NONE);
+                EXPECT_EQ(out, ct) << name << " chunk " << chunk;
+                EXPECT_EQ(outTag, tag) << name << " chunk " << chunk;
+
+                aegis->init(&k[0], keyLen * 8, &n[0], keyLen);
+                EXPECT_EQ(aegis->setAad(&aad[0], aad.size()), ALC_ERROR_NONE);
+                for (Uint64 off = 0; off < ct.size(); off += chunk) {
+                    Uint64 len = std::min(chunk, ct.size() - off);
+                    EXPECT_EQ(aegis->decrypt(&ct[off], &back[off], len),
+                              ALC_ERROR_NONE);
+                }
+                EXPECT_EQ(aegis->getTag(&backTag[0], 16), ALC_ERROR_NONE);
+                EXPECT_EQ(back, pt) << name << " chunk " << chunk;
+                EXPECT_EQ(backTag, tag) << name << " chunk " << chunk;
+            }
+        }
+    }
+}
+
+TEST(AEGIS, InvalidState)
+{
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead*               aegis = alcpCipher.create("aegis-128l");
+    ASSERT_NE(aegis, nullptr);
+
+    std::vector<Uint8> key(16), nonce(16), pt(40), ct(40), tag(32);
+
+    // key and nonce sizes are fixed
+    EXPECT_EQ(aegis->init(&key[0], 256, &nonce[0], 16),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aegis->init(&key[0], 128, &nonce[0], 12),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aegis->encrypt(&pt[0], &ct[0], pt.size()), ALC_ERROR_BAD_STATE);
+
+    ASSERT_EQ(aegis->init(&key[0], 128, &nonce[0], 16), ALC_ERROR_NONE);
+    EXPECT_EQ(aegis->setTagLength(8), ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aegis->setTagLength(32), ALC_ERROR_NONE);
+    EXPECT_EQ(aegis->encrypt(&pt[0], &ct[0], pt.size()), ALC_ERROR_NONE);
+
+    // the AAD comes before the message
+    EXPECT_EQ(aegis->setAad(&pt[0], 16), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(aegis->getTag(&tag[0], 8), ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aegis->getTag(&tag[0], 32), ALC_ERROR_NONE);
+
+    // a new nonce is needed after the tag
+    EXPECT_EQ(aegis->getTag(&tag[0], 32), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(aegis->encrypt(&pt[0], &ct[0], pt.size()), ALC_ERROR_BAD_STATE);
+    nonce[0] ^= 1;
+    EXPECT_EQ(aegis->init(nullptr, 0, &nonce[0], 16), ALC_ERROR_NONE);
+    EXPECT_EQ(aegis->encrypt(&pt[0], &ct[0], pt.size()), ALC_ERROR_NONE);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "alcp/cipher/aes_mb.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+using alcp::cipher::CipherFactory;
+using alcp::cipher::iCipher;
+namespace alcp::cipher::unittest::cbc_mb {
+// NIST SP 800-38A F.2.1 CBC-AES128.Encrypt
+std::vector<Uint8> key       = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+std::vector<Uint8> iv        = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+std::vector<Uint8> plainText = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11,
+    0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30, 0xc8, 0x1c, 0x46,
+    0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b,
+    0xe6, 0x6c, 0x37, 0x10
+};
+std::vector<Uint8> cipherText = {
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b,
+    0x12, 0xe9, 0x19, 0x7d, 0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee,
+    0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2, 0x73, 0xbe, 0xd6, 0xb8,
+    0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+    0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30,
+    0x75, 0x86, 0xe1, 0xa7
+};
+
+struct Stream
+{
+    std::vector<Uint8> key;
+    std::vector<Uint8> iv;
+    std::vector<Uint8> in;
+    std::vector<Uint8> out;
+};
+
+static std::vector<Uint8>
+serialCbcEncrypt(const Stream& s)
+{
+    static const char* names[] = { "aes-cbc-128", "aes-cbc-192", "aes-cbc-256" };
+
+    std::vector<Uint8>     out(s.in.size());
+    CipherFactory<iCipher> alcpCipher;
+    iCipher* cbc = alcpCipher.create(names[(s.key.size() - 16) / 8]);
+
+    if (cbc == nullptr) {
+        return {};
+    }
+    cbc->init(&s.key[0], s.key.size() * 8, &s.iv[0], s.iv.size());
+    cbc->encrypt(&s.in[0], &out[0], s.in.size());
+    return out;
+}
+
+static std::vector<alc_cipher_mb_job_t>
+makeJobs(std::vector<Stream>& streams)
+{
+    std::vector<alc_cipher_mb_job_t> jobs(streams.size());
+    for (size_t i = 0; i < streams.size(); i++) {
+        jobs[i].mj_key    = &streams[i].key[0];
+        jobs[i].mj_keyLen = streams[i].key.size() * 8;
+        jobs[i].mj_iv     = &streams[i].iv[0];
+        jobs[i].mj_src    = streams[i].in.data();
+        jobs[i].mj_dst    = streams[i].out.data();
+        jobs[i].mj_len    = streams[i].in.size();
+    }
+    return jobs;
+}
+} // namespace alcp::cipher::unittest::cbc_mb
+
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::cbc_mb;
+
+TEST(CBC_MB, KnownAnswer)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        // same stream in every lane, plus one more to force a refill
+        std::vector<Stream> streams(alcp::cipher::cMbMaxLanes + 1);
+        for (auto& s : streams) {
+            s = { key, iv, plainText, std::vector<Uint8>(plainText.size()) };
+        }
+        auto jobs = makeJobs(streams);
+
+        alc_error_t err =
+            alcp::cipher::EncryptCbcMb(&jobs[0], jobs.size(), feature);
+        EXPECT_EQ(err, ALC_ERROR_NONE);
+        for (auto& s : streams) {
+            EXPECT_EQ(s.out, cipherText);
+        }
+    }
+}
+
+TEST(CBC_MB, MixedKeysAndLengths)
+{
+    Randomize rng(42);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        std::vector<Stream> streams(53);
+        for (size_t i = 0; i < streams.size(); i++) {
+            Stream& s = streams[i];
+            s.key.resize(16 + 8 * (i % 3));
+            s.iv.resize(16);
+            // lengths from 0 to 40 blocks, so lanes drain at different times
+            s.in.resize(16 * ((i * 7) % 41));
+            s.out.resize(s.in.size());
+            rng.getRandomBytes(s.key);
+            rng.getRandomBytes(s.iv);
+            rng.getRandomBytes(s.in);
+        }
+        auto jobs = makeJobs(streams);
+
+        alc_error_t err =
+            alcp::cipher::EncryptCbcMb(&jobs[0], jobs.size(), feature);
+        EXPECT_EQ(err, ALC_ERROR_NONE);
+        for (auto& s : streams) {
+            if (s.in.empty()) {
+                continue;
+            }
+            EXPECT_EQ(s.out, serialCbcEncrypt(s));
+        }
+    }
+}
+
+TEST(CBC_MB, InPlace)
+{
+    std::vector<Stream> streams(3);
+    for (auto& s : streams) {
+        s = { key, iv, plainText, {} };
+    }
+    std::vector<alc_cipher_mb_job_t> jobs = makeJobs(streams);
+    for (size_t i = 0; i < streams.size(); i++) {
+        jobs[i].mj_dst = &streams[i].in[0];
+    }
+
+    alc_error_t err = alcp_cipher_encrypt_cbc_mb(&jobs[0], jobs.size());
+    EXPECT_EQ(err, ALC_ERROR_NONE);
+    for (auto& s : streams) {
+        EXPECT_EQ(s.in, cipherText);
+    }
+}
+
+TEST(CBC_MB, InvalidJobs)
+{
+    std::vector<Stream> streams(2);
+    for (auto& s : streams) {
+        s = { key, iv, plainText, std::vector<Uint8>(plainText.size()) };
+    }
+    auto jobs = makeJobs(streams);
+
+    // partial block
+    jobs[1].mj_len = plainText.size() - 1;
+    EXPECT_EQ(alcp_cipher_encrypt_cbc_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+    // nothing is written when the batch is rejected
+    EXPECT_EQ(streams[0].out, std::vector<Uint8>(plainText.size()));
+
+    jobs[1].mj_len    = plainText.size();
+    jobs[1].mj_keyLen = 100;
+    EXPECT_EQ(alcp_cipher_encrypt_cbc_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+
+    jobs[1].mj_keyLen = 128;
+    jobs[1].mj_iv     = nullptr;
+    EXPECT_EQ(alcp_cipher_encrypt_cbc_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_ARG);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
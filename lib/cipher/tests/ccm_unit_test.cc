@@ -27,6 +27,8 @@
  */
 
 #include "alcp/cipher/aes_ccm.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
 #include <gtest/gtest.h>
 
 // KAT Data
@@ -416,10 +418,8 @@ TEST_P(CCM_KAT, Encrypt)
 
     alc_error_t err;
 
-#ifdef CCM_MULTI_UPDATE
     err = pCcmObj->setPlainTextLength(m_plaintext.size());
     ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
     /* Encryption begins here */
     if (!m_tag.empty()) {
         err = pCcmObj->setTagLength(m_tag.size());
@@ -468,10 +468,8 @@ TEST_P(CCM_KAT, Encrypt_Double)
 
         alc_error_t err;
 
-#ifdef CCM_MULTI_UPDATE
         err = pCcmObj->setPlainTextLength(m_plaintext.size());
         ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
         /* Encryption begins here */
         if (!m_tag.empty()) {
             err = pCcmObj->setTagLength(m_tag.size());
@@ -517,10 +515,8 @@ TEST_P(CCM_KAT, Encrypt_Double)
             out_ciphertext(m_plaintext.size(), 0x01);
 
         alc_error_t err;
-#ifdef CCM_MULTI_UPDATE
         err = pCcmObj->setPlainTextLength(m_plaintext.size());
         ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
         /* Encryption begins here */
         if (!m_tag.empty()) {
             err = pCcmObj->setTagLength(m_tag.size());
@@ -570,10 +566,8 @@ TEST_P(CCM_KAT, Decrypt)
 
     alc_error_t err;
 
-#ifdef CCM_MULTI_UPDATE
     err = pCcmObj->setPlainTextLength(m_plaintext.size());
     ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
 
     /* Decryption begins here*/
     if (!m_tag.empty()) {
@@ -623,10 +617,8 @@ TEST_P(CCM_KAT, Decrypt_Double)
 
         alc_error_t err;
 
-#ifdef CCM_MULTI_UPDATE
         err = pCcmObj->setPlainTextLength(out_plaintext.size());
         ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
 
         /* Decryption begins here*/
         if (!m_tag.empty()) {
@@ -673,10 +665,8 @@ TEST_P(CCM_KAT, Decrypt_Double)
             out_plaintext(m_ciphertext.size(), 0x01);
 
         alc_error_t err;
-#ifdef CCM_MULTI_UPDATE
         err = pCcmObj->setPlainTextLength(out_plaintext.size());
         ASSERT_EQ(err, ALC_ERROR_NONE);
-#endif
 
         /* Decryption begins here*/
         if (!m_tag.empty()) {
@@ -774,10 +764,8 @@ TEST(CCM, InvalidNonceLen)
 
     EXPECT_EQ(err, ALC_ERROR_NONE);
 
-#ifdef CCM_MULTI_UPDATE
     err = pCcmObj->setPlainTextLength(0);
     EXPECT_EQ(err, ALC_ERROR_NONE);
-#endif
     // Nonce
     err = pCcmObj->init(key, sizeof(key) * 8, getPtr(nonce), nonce.size());
 
@@ -785,3 +773,226 @@ TEST(CCM, InvalidNonceLen)
 
     delete alcpCipher;
 }
+
+using alcp::cipher::unittest::getSupportedFeatures;
+using alcp::cipher::unittest::Randomize;
+
+/*
+ * Runs one message through CCM. With no chunk sizes the message goes in a
+ * single update and its length is left for the library to pick up, else the
+ * length is announced and the message is fed in the given chunks.
+ */
+static alc_error_t
+ccmCrypt(CpuCipherFeatures          arch,
+         bool                       isEncrypt,
+         const std::vector<Uint8>&  key,
+         const std::vector<Uint8>&  nonce,
+         const std::vector<Uint8>&  aad,
+         const std::vector<Uint8>&  in,
+         std::vector<Uint8>&        out,
+         std::vector<Uint8>&        tag,
+         const std::vector<Uint64>& chunks = {})
+{
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead* pCcmObj = alcpCipher.create(keyToModStr(key.size()), arch);
+    if (pCcmObj == nullptr) {
+        return ALC_ERROR_GENERIC;
+    }
+    alc_error_t err = pCcmObj->setTagLength(tag.size());
+    if (!chunks.empty()) {
+        err |= pCcmObj->setPlainTextLength(in.size());
+    }
+    err |= pCcmObj->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (!aad.empty()) {
+        err |= pCcmObj->setAad(&aad[0], aad.size());
+    }
+
+    std::vector<Uint64> sizes = chunks;
+    if (sizes.empty()) {
+        sizes.push_back(in.size());
+    }
+    Uint8  dummy;
+    Uint64 done = 0;
+    for (Uint64 size : sizes) {
+        const Uint8* p_in  = size ? &in[done] : &dummy;
+        Uint8*       p_out = size ? &out[done] : &dummy;
+        if (isEncrypt) {
+            err |= pCcmObj->encrypt(p_in, p_out, size);
+        } else {
+            err |= pCcmObj->decrypt(p_in, p_out, size);
+        }
+        done += size;
+    }
+    err |= pCcmObj->getTag(&tag[0], tag.size());
+    return err;
+}
+
+/*
+ * The wide kernels only differ from aesni on messages spanning several
+ * registers, cross check them on lengths around every loop boundary.
+ */
+TEST(CCM, CrossArchLongMessages)
+{
+    const Uint64 lengths[] = { 1,   15,  16,  17,  31,  32,  33,  63,
+                               64,  65,  127, 128, 129, 255, 256, 257,
+                               300, 511, 512, 513, 1000, 4099 };
+    Randomize    rng(1234);
+
+    for (Uint64 keySize : { 16, 24, 32 }) {
+        for (Uint64 len : lengths) {
+            std::vector<Uint8> key(keySize), nonce(12), aad(len % 40),
+                pt(len), ct_ref(len), tag_ref(16);
+            rng.getRandomBytes(key);
+            rng.getRandomBytes(nonce);
+            rng.getRandomBytes(aad);
+            rng.getRandomBytes(pt);
+
+            ASSERT_EQ(ccmCrypt(CpuCipherFeatures::eAesni,
+                               true,
+                               key,
+                               nonce,
+                               aad,
+                               pt,
+                               ct_ref,
+                               tag_ref),
+                      ALC_ERROR_NONE);
+
+            for (CpuCipherFeatures feature : getSupportedFeatures()) {
+                if (feature == CpuCipherFeatures::eReference) {
+                    continue;
+                }
+                std::vector<Uint8> ct(len), dec(len), tag(16), dec_tag(16);
+                EXPECT_EQ(
+                    ccmCrypt(feature, true, key, nonce, aad, pt, ct, tag),
+                    ALC_ERROR_NONE);
+                EXPECT_EQ(ct, ct_ref) << "len " << len;
+                EXPECT_EQ(tag, tag_ref) << "len " << len;
+
+                EXPECT_EQ(
+                    ccmCrypt(feature, false, key, nonce, aad, ct, dec, dec_tag),
+                    ALC_ERROR_NONE);
+                EXPECT_EQ(dec, pt) << "len " << len;
+                EXPECT_EQ(dec_tag, tag_ref) << "len " << len;
+            }
+        }
+    }
+}
+
+TEST(CCM, StreamingMatchesSingleShot)
+{
+    Randomize rng(4321);
+
+    for (Uint64 len : { 0, 1, 15, 16, 17, 100, 257, 1000, 4099 }) {
+        std::vector<Uint8> key(16), nonce(13), aad(24), pt(len), ct_ref(len),
+            tag_ref(16);
+        rng.getRandomBytes(key);
+        rng.getRandomBytes(nonce);
+        rng.getRandomBytes(aad);
+        rng.getRandomBytes(pt);
+
+        ASSERT_EQ(ccmCrypt(CpuCipherFeatures::eAesni,
+                           true,
+                           key,
+                           nonce,
+                           aad,
+                           pt,
+                           ct_ref,
+                           tag_ref),
+                  ALC_ERROR_NONE);
+
+        // Chunk sizes that leave partial blocks carried across updates,
+        // including empty updates
+        std::vector<Uint64> chunks;
+        for (Uint64 done = 0, i = 0; done < len; i++) {
+            Uint64 size = std::min<Uint64>((i * 7 + 3) % 40, len - done);
+            chunks.push_back(size);
+            done += size;
+        }
+        chunks.push_back(0);
+
+        for (CpuCipherFeatures feature : getSupportedFeatures()) {
+            if (feature == CpuCipherFeatures::eReference) {
+                continue;
+            }
+            std::vector<Uint8> ct(len), dec(len), tag(16), dec_tag(16);
+            EXPECT_EQ(
+                ccmCrypt(feature, true, key, nonce, aad, pt, ct, tag, chunks),
+                ALC_ERROR_NONE);
+            EXPECT_EQ(ct, ct_ref) << "len " << len;
+            EXPECT_EQ(tag, tag_ref) << "len " << len;
+
+            EXPECT_EQ(ccmCrypt(feature,
+                               false,
+                               key,
+                               nonce,
+                               aad,
+                               ct,
+                               dec,
+                               dec_tag,
+                               chunks),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(dec, pt) << "len " << len;
+            EXPECT_EQ(dec_tag, tag_ref) << "len " << len;
+        }
+    }
+}
+
+TEST(CCM, StreamingLengthMismatch)
+{
+    std::vector<Uint8> key(16, 0x11), nonce(12, 0x22), in(64, 0x33),
+        out(64), tag(16);
+
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead* pCcmObj = alcpCipher.create(keyToModStr(key.size()));
+    ASSERT_NE(pCcmObj, nullptr);
+
+    EXPECT_EQ(pCcmObj->setTagLength(tag.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->setPlainTextLength(48), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->init(&key[0], 128, &nonce[0], nonce.size()),
+              ALC_ERROR_NONE);
+
+    EXPECT_EQ(pCcmObj->encrypt(&in[0], &out[0], 40), ALC_ERROR_NONE);
+    // Short of the announced length, no tag yet
+    EXPECT_EQ(pCcmObj->getTag(&tag[0], tag.size()), ALC_ERROR_INVALID_DATA);
+    // Past the announced length
+    EXPECT_EQ(pCcmObj->encrypt(&in[40], &out[40], 24), ALC_ERROR_INVALID_DATA);
+}
+
+TEST(CCM, AnnouncedLengthEndsWithMessage)
+{
+    std::vector<Uint8> key(16, 0x11), nonce(12, 0x22), in(48, 0x33),
+        out(48), tag(16);
+
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead* pCcmObj = alcpCipher.create(keyToModStr(key.size()));
+    ASSERT_NE(pCcmObj, nullptr);
+
+    // First message with its length announced
+    EXPECT_EQ(pCcmObj->setTagLength(tag.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->setPlainTextLength(48), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->init(&key[0], 128, &nonce[0], nonce.size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->encrypt(&in[0], &out[0], 48), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->getTag(&tag[0], tag.size()), ALC_ERROR_NONE);
+
+    // Second message on the same object in a single update, no length
+    std::vector<Uint8> pt(32, 0x44), ct(32), ct_ref(32), tag_ref(16);
+    nonce[0] ^= 1;
+    EXPECT_EQ(pCcmObj->init(nullptr, 0, &nonce[0], nonce.size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->encrypt(&pt[0], &ct[0], pt.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(pCcmObj->getTag(&tag[0], tag.size()), ALC_ERROR_NONE);
+
+    // Same as on a fresh object
+    ASSERT_EQ(ccmCrypt(CpuCipherFeatures::eAesni,
+                       true,
+                       key,
+                       nonce,
+                       {},
+                       pt,
+                       ct_ref,
+                       tag_ref),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(ct, ct_ref);
+    EXPECT_EQ(tag, tag_ref);
+}
@@ -201,6 +201,305 @@ TEST_F(ChaChaPolyTest, MultiBytesDecryptTest)
     testChacha20Poly1305MultiBytes();
 }
 
+// messages over several stitch chunks, every arch against the reference
+TEST(Chacha20Poly1305, LongMessageArchesAgree)
+{
+    Uint8 key[32], nonce[12], aad[20];
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(0x80 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(nonce); i++) {
+        nonce[i] = static_cast<Uint8>(0x40 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(aad); i++) {
+        aad[i] = static_cast<Uint8>(0x50 + i);
+    }
+
+    // encrypt, then decrypt in place and out of place, returns
+    // ciphertext || tag
+    auto sealOpen = [&](iCipherAead& aead, const std::vector<Uint8>& msg) {
+        std::vector<Uint8> out(msg.size() + 16);
+        std::vector<Uint8> buf(msg);
+        Uint8              tag[16];
+
+        EXPECT_EQ(aead.init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(aead.setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.encrypt(&msg[0], &out[0], msg.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.getTag(&out[msg.size()], 16), ALC_ERROR_NONE);
+
+        std::copy(out.begin(), out.begin() + msg.size(), buf.begin());
+        EXPECT_EQ(aead.init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(aead.setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.decrypt(&buf[0], &buf[0], buf.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.getTag(tag, 16), ALC_ERROR_NONE);
+        EXPECT_EQ(buf, msg);
+        EXPECT_EQ(std::vector<Uint8>(tag, tag + 16),
+                  std::vector<Uint8>(out.begin() + msg.size(), out.end()));
+
+        std::fill(buf.begin(), buf.end(), 0);
+        EXPECT_EQ(aead.init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(aead.setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.decrypt(&out[0], &buf[0], buf.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(aead.getTag(tag, 16), ALC_ERROR_NONE);
+        EXPECT_EQ(buf, msg);
+        EXPECT_EQ(std::vector<Uint8>(tag, tag + 16),
+                  std::vector<Uint8>(out.begin() + msg.size(), out.end()));
+        return out;
+    };
+
+    for (Uint64 len : { 4096, 3 * 4096 + 77, 65536, 2 * 65536 + 20001 }) {
+        std::vector<Uint8> msg(len);
+        for (Uint64 i = 0; i < len; i++) {
+            msg[i] = static_cast<Uint8>(i * 31 + 7);
+        }
+
+        ref::ChaChaPoly256 refAead;
+        std::vector<Uint8> expected = sealOpen(refAead, msg);
+        if (CpuId::cpuHasAvx2()) {
+            avx2::ChaChaPoly256 avx2Aead;
+            EXPECT_EQ(sealOpen(avx2Aead, msg), expected) << "length " << len;
+        }
+        if (CpuId::cpuHasAvx512f()) {
+            vaes512::ChaChaPoly256 zen4Aead;
+            EXPECT_EQ(sealOpen(zen4Aead, msg), expected) << "length " << len;
+        }
+    }
+}
+
+// a message fed in uneven pieces seals and opens like one call
+TEST(Chacha20Poly1305, StreamingUpdates)
+{
+    Uint8 key[32], nonce[12], aad[13];
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(0x80 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(nonce); i++) {
+        nonce[i] = static_cast<Uint8>(0x40 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(aad); i++) {
+        aad[i] = static_cast<Uint8>(0x50 + i);
+    }
+    const Uint64       pieces[] = { 1, 15, 48, 63, 64, 65, 4097, 5000, 7 };
+    std::vector<Uint8> msg(9360);
+    for (Uint64 i = 0; i < msg.size(); i++) {
+        msg[i] = static_cast<Uint8>(i * 29 + 3);
+    }
+
+    CipherFactory<iCipherAead> oneShotFactory, streamFactory;
+    iCipherAead* oneShot = oneShotFactory.create("chachapoly");
+    iCipherAead* stream  = streamFactory.create("chachapoly");
+    ASSERT_NE(oneShot, nullptr);
+    ASSERT_NE(stream, nullptr);
+
+    std::vector<Uint8> expected(msg.size()), out(msg.size());
+    Uint8              expectedTag[16], tag[16];
+    EXPECT_EQ(oneShot->init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(oneShot->setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+    EXPECT_EQ(oneShot->encrypt(&msg[0], &expected[0], msg.size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(oneShot->getTag(expectedTag, 16), ALC_ERROR_NONE);
+
+    for (bool isEncrypt : { true, false }) {
+        const std::vector<Uint8>& in = isEncrypt ? msg : expected;
+
+        EXPECT_EQ(stream->init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        // aad in two pieces as well
+        EXPECT_EQ(stream->setAad(aad, 5), ALC_ERROR_NONE);
+        EXPECT_EQ(stream->setAad(aad + 5, sizeof(aad) - 5), ALC_ERROR_NONE);
+
+        Uint64 offset = 0;
+        for (Uint64 n : pieces) {
+            alc_error_t err =
+                isEncrypt ? stream->encrypt(&in[offset], &out[offset], n)
+                          : stream->decrypt(&in[offset], &out[offset], n);
+            EXPECT_EQ(err, ALC_ERROR_NONE);
+            offset += n;
+        }
+        ASSERT_EQ(offset, msg.size());
+        EXPECT_EQ(stream->setAad(aad, 1), ALC_ERROR_BAD_STATE);
+        EXPECT_EQ(stream->getTag(tag, 16), ALC_ERROR_NONE);
+
+        EXPECT_EQ(out, isEncrypt ? expected : msg);
+        EXPECT_EQ(std::vector<Uint8>(tag, tag + 16),
+                  std::vector<Uint8>(expectedTag, expectedTag + 16));
+    }
+}
+
+// draft-irtf-cfrg-xchacha appendix A.3.1
+TEST(Chacha20Poly1305, XChaChaKnownAnswer)
+{
+    Uint8 key[32], nonce[24];
+    Uint8 aad[] = { 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1,
+                    0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7 };
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(0x80 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(nonce); i++) {
+        nonce[i] = static_cast<Uint8>(0x40 + i);
+    }
+    const char* cMsg =
+        "Ladies and Gentlemen of the class of '99: If I could offer you only "
+        "one tip for the future, sunscreen would be it.";
+    std::vector<Uint8> msg(cMsg, cMsg + strlen(cMsg));
+    const std::vector<Uint8> cExpectedTag = { 0xc0, 0x87, 0x59, 0x24,
+                                              0xc1, 0xc7, 0x98, 0x79,
+                                              0x47, 0xde, 0xaf, 0xd8,
+                                              0x78, 0x0a, 0xcf, 0x49 };
+
+    ref::XChaChaPoly256       refAead;
+    avx2::XChaChaPoly256      avx2Aead;
+    vaes512::XChaChaPoly256   zen4Aead;
+    std::vector<iCipherAead*> aeads = { &refAead };
+    if (CpuId::cpuHasAvx2()) {
+        aeads.push_back(&avx2Aead);
+    }
+    if (CpuId::cpuHasAvx512f()) {
+        aeads.push_back(&zen4Aead);
+    }
+    for (iCipherAead* aead : aeads) {
+        std::vector<Uint8> ct(msg.size()), pt(msg.size()), tag(16);
+        EXPECT_EQ(aead->init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(aead->setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+        EXPECT_EQ(aead->encrypt(&msg[0], &ct[0], msg.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(aead->getTag(&tag[0], 16), ALC_ERROR_NONE);
+        EXPECT_EQ(tag, cExpectedTag);
+
+        // the next message only changes the nonce
+        EXPECT_EQ(aead->init(nullptr, 0, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(aead->setAad(aad, sizeof(aad)), ALC_ERROR_NONE);
+        EXPECT_EQ(aead->decrypt(&ct[0], &pt[0], ct.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(aead->getTag(&tag[0], 16), ALC_ERROR_NONE);
+        EXPECT_EQ(tag, cExpectedTag);
+        EXPECT_EQ(pt, msg);
+    }
+}
+
+TEST(Chacha20Poly1305, BatchMatchesSingle)
+{
+    const std::vector<Uint64> cLens    = { 0,  1,   15,  16,  17,   63,
+                                           64, 65,  100, 128, 255,  576,
+                                           1, 1400, 0,   33,  1500, 64 };
+    const std::vector<Uint64> cAadLens = { 0, 1, 12, 16, 20, 32 };
+    // more packets than one group of the driver
+    const Uint64 cNumPackets = 150;
+    Uint8        key[32];
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(0x80 + i);
+    }
+
+    for (Uint64 nonce_len : { 12, 24 }) {
+        std::vector<std::vector<Uint8>> msg(cNumPackets), aad(cNumPackets),
+            iv(cNumPackets), ct(cNumPackets), tag(cNumPackets),
+            expected_ct(cNumPackets), expected_tag(cNumPackets);
+        std::vector<alc_aead_packet_t> packets(cNumPackets);
+
+        ref::ChaChaPoly256     refAead;
+        ref::XChaChaPoly256    refXAead;
+        iCipherAead*           single = &refAead;
+        if (nonce_len == 24) {
+            single = &refXAead;
+        }
+        for (Uint64 p = 0; p < cNumPackets; p++) {
+            msg[p].resize(cLens[p % cLens.size()]);
+            aad[p].resize(cAadLens[p % cAadLens.size()]);
+            iv[p].resize(nonce_len);
+            for (Uint64 i = 0; i < msg[p].size(); i++) {
+                msg[p][i] = static_cast<Uint8>(p * 7 + i);
+            }
+            for (Uint64 i = 0; i < aad[p].size(); i++) {
+                aad[p][i] = static_cast<Uint8>(p + 3 * i);
+            }
+            for (Uint64 i = 0; i < nonce_len; i++) {
+                iv[p][i] = static_cast<Uint8>(p * 13 + i);
+            }
+            ct[p].resize(msg[p].size() + 1);
+            expected_ct[p].resize(msg[p].size() + 1);
+            expected_tag[p].resize(16);
+            tag[p].resize(16);
+
+            EXPECT_EQ(single->init(key, 256, &iv[p][0], nonce_len),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(single->setAad(aad[p].data(), aad[p].size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(single->encrypt(
+                          msg[p].data(), &expected_ct[p][0], msg[p].size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(single->getTag(&expected_tag[p][0], 16),
+                      ALC_ERROR_NONE);
+        }
+        // the reference arch has no batch kernels
+        EXPECT_EQ(single->sealBatch(&packets[0], 0), ALC_ERROR_NOT_SUPPORTED);
+
+        avx2::ChaChaPoly256     avx2Aead;
+        avx2::XChaChaPoly256    avx2XAead;
+        vaes512::ChaChaPoly256  zen4Aead;
+        vaes512::XChaChaPoly256 zen4XAead;
+        std::vector<iCipherAead*> aeads;
+        if (CpuId::cpuHasAvx2()) {
+            aeads.push_back(nonce_len == 12
+                                ? static_cast<iCipherAead*>(&avx2Aead)
+                                : static_cast<iCipherAead*>(&avx2XAead));
+        }
+        if (CpuId::cpuHasAvx512f()) {
+            aeads.push_back(nonce_len == 12
+                                ? static_cast<iCipherAead*>(&zen4Aead)
+                                : static_cast<iCipherAead*>(&zen4XAead));
+        }
+        for (iCipherAead* aead : aeads) {
+            EXPECT_EQ(aead->sealBatch(&packets[0], cNumPackets),
+                      ALC_ERROR_BAD_STATE);
+            EXPECT_EQ(aead->init(key, 256, &iv[0][0], nonce_len),
+                      ALC_ERROR_NONE);
+
+            for (Uint64 p = 0; p < cNumPackets; p++) {
+                std::fill(ct[p].begin(), ct[p].end(), 0xa5);
+                packets[p] = { &iv[p][0],      nonce_len,     aad[p].data(),
+                               aad[p].size(),  msg[p].data(), &ct[p][0],
+                               msg[p].size(),  &tag[p][0],    16,
+                               ALC_ERROR_NONE };
+            }
+            EXPECT_EQ(aead->sealBatch(&packets[0], cNumPackets),
+                      ALC_ERROR_NONE);
+            for (Uint64 p = 0; p < cNumPackets; p++) {
+                // the byte past the message is not written
+                expected_ct[p].back() = 0xa5;
+                EXPECT_EQ(ct[p], expected_ct[p]) << "packet " << p;
+                EXPECT_EQ(tag[p], expected_tag[p]) << "packet " << p;
+            }
+
+            // in place open, one packet with a broken tag
+            for (Uint64 p = 0; p < cNumPackets; p++) {
+                packets[p].ap_in  = &ct[p][0];
+                packets[p].ap_out = &ct[p][0];
+            }
+            tag[5][0] ^= 1;
+            EXPECT_EQ(aead->openBatch(&packets[0], cNumPackets),
+                      ALC_ERROR_TAG_MISMATCH);
+            for (Uint64 p = 0; p < cNumPackets; p++) {
+                std::vector<Uint8> pt(ct[p].begin(), ct[p].end() - 1);
+                if (p == 5) {
+                    EXPECT_EQ(packets[p].ap_err, ALC_ERROR_TAG_MISMATCH);
+                    EXPECT_EQ(pt, std::vector<Uint8>(pt.size(), 0));
+                } else {
+                    EXPECT_EQ(packets[p].ap_err, ALC_ERROR_NONE);
+                    EXPECT_EQ(pt, msg[p]) << "packet " << p;
+                }
+            }
+
+            packets[7].ap_tagLen = 12;
+            EXPECT_EQ(aead->sealBatch(&packets[0], cNumPackets),
+                      ALC_ERROR_INVALID_SIZE);
+        }
+    }
+}
+
 TEST(Chacha20Poly1305, PerformanceTest)
 {
     ref::ChaChaPoly256 chacha_poly;
@@ -252,6 +252,229 @@ TEST(Chacha20, Encrypt_MultipleBytes)
     }
 }
 
+TEST(Chacha20, Avx2MatchesReference)
+{
+    if (!CpuId::cpuHasAvx2()) {
+        GTEST_SKIP() << "AVX2 not supported";
+    }
+    Uint8 key[32];
+    // the last iv starts 3 blocks before the 32 bit counter wraps
+    Uint8 ivs[][16] = {
+        { 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4a, 0, 0, 0, 0 },
+        { 0xfd, 0xff, 0xff, 0xff, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0xff, 0xee },
+    };
+    std::vector<Uint8> plaintext(1100);
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(i * 11 + 3);
+    }
+    for (Uint64 i = 0; i < plaintext.size(); i++) {
+        plaintext[i] = static_cast<Uint8>(i * 17 + 1);
+    }
+
+    for (auto& iv : ivs) {
+        ref::ChaCha256  expected;
+        avx2::ChaCha256 actual;
+        EXPECT_EQ(expected.init(key, sizeof(key) * 8, iv, sizeof(iv)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(actual.init(key, sizeof(key) * 8, iv, sizeof(iv)),
+                  ALC_ERROR_NONE);
+
+        // every mix of 8 block, 4 block and tail processing
+        for (Uint64 len = 0; len <= plaintext.size(); len++) {
+            std::vector<Uint8> refOut(len), avx2Out(len);
+            expected.encrypt(&plaintext[0], &refOut[0], len);
+            actual.encrypt(&plaintext[0], &avx2Out[0], len);
+            ASSERT_EQ(avx2Out, refOut) << "Failed at length " << len;
+
+            // in place
+            actual.decrypt(&avx2Out[0], &avx2Out[0], len);
+            ASSERT_EQ(avx2Out,
+                      std::vector<Uint8>(plaintext.begin(),
+                                         plaintext.begin() + len));
+        }
+    }
+}
+
+TEST(Chacha20, StreamOffsetMatchesSlice)
+{
+    Uint8 key[32];
+    Uint8 iv[16] = { 0x07, 0, 0, 0, 0, 0, 0, 0x4a, 0, 0, 0, 0, 1, 2, 3, 4 };
+    std::vector<Uint8> plaintext(4096 + 37);
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(i * 7 + 1);
+    }
+    for (Uint64 i = 0; i < plaintext.size(); i++) {
+        plaintext[i] = static_cast<Uint8>(i * 13 + 5);
+    }
+
+    ref::ChaCha256     full;
+    std::vector<Uint8> ciphertext(plaintext.size());
+    full.init(key, sizeof(key) * 8, iv, sizeof(iv));
+    full.encrypt(&plaintext[0], &ciphertext[0], plaintext.size());
+
+    ref::ChaCha256        refSeek;
+    avx2::ChaCha256       avx2Seek;
+    vaes512::ChaCha256    zen4Seek;
+    std::vector<iCipher*> seekers = { &refSeek };
+    if (CpuId::cpuHasAvx2()) {
+        seekers.push_back(&avx2Seek);
+    }
+    if (CpuId::cpuHasAvx512f()) {
+        seekers.push_back(&zen4Seek);
+    }
+
+    const Uint64 offsets[] = { 0, 1, 63, 64, 65, 130, 1000, 4100 };
+    for (iCipher* seek : seekers) {
+        EXPECT_EQ(seek->init(key, sizeof(key) * 8, iv, sizeof(iv)),
+                  ALC_ERROR_NONE);
+        for (Uint64 offset : offsets) {
+            // short read within the first block and a read to the end
+            for (Uint64 len : { Uint64(3), plaintext.size() - offset }) {
+                std::vector<Uint8> out(len);
+                EXPECT_EQ(seek->setStreamOffset(offset), ALC_ERROR_NONE);
+                EXPECT_EQ(seek->decrypt(&ciphertext[offset], &out[0], len),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(out,
+                          std::vector<Uint8>(plaintext.begin() + offset,
+                                             plaintext.begin() + offset + len))
+                    << "offset " << offset << " len " << len;
+            }
+        }
+    }
+
+    // the 32 bit block counter must not wrap
+    iv[0] = iv[1] = iv[2] = iv[3] = 0xff;
+    EXPECT_EQ(refSeek.init(nullptr, 0, iv, sizeof(iv)), ALC_ERROR_NONE);
+    EXPECT_EQ(refSeek.setStreamOffset(63), ALC_ERROR_NONE);
+    EXPECT_EQ(refSeek.setStreamOffset(64), ALC_ERROR_INVALID_ARG);
+}
+
+// draft-irtf-cfrg-xchacha section 2.2.1
+TEST(Chacha20, HChaCha20KnownAnswer)
+{
+    Uint8 key[32];
+    Uint8 nonce[16] = { 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a,
+                        0x00, 0x00, 0x00, 0x00, 0x31, 0x41, 0x59, 0x27 };
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(i);
+    }
+    const std::vector<Uint8> expected = {
+        0x82, 0x41, 0x3b, 0x42, 0x27, 0xb2, 0x7b, 0xfe, 0xd3, 0x0e, 0x42,
+        0x50, 0x8a, 0x87, 0x7d, 0x73, 0xa0, 0xf9, 0xe4, 0xd5, 0x8a, 0x74,
+        0xa8, 0x53, 0xc1, 0x2e, 0xc4, 0x13, 0x26, 0xd3, 0xec, 0xdc
+    };
+
+    std::vector<Uint8> subkey(32);
+    HChaCha20Block(key, nonce, &subkey[0]);
+    EXPECT_EQ(subkey, expected);
+
+    std::fill(subkey.begin(), subkey.end(), 0);
+    EXPECT_EQ(HChaCha20(key, sizeof(key) * 8, nonce, 1, &subkey[0]),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(subkey, expected);
+
+    EXPECT_EQ(HChaCha20(key, 128, nonce, 1, &subkey[0]),
+              ALC_ERROR_INVALID_ARG);
+}
+
+// every lane count and tail of the batched kernels against one at a time
+TEST(Chacha20, HChaCha20BatchMatchesSingle)
+{
+    Uint8              key[32];
+    std::vector<Uint8> nonces(40 * 16);
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(i * 5 + 9);
+    }
+    for (Uint64 i = 0; i < nonces.size(); i++) {
+        nonces[i] = static_cast<Uint8>(i * 29 + 3);
+    }
+
+    std::vector<Uint8> expected(40 * 32);
+    for (Uint64 i = 0; i < 40; i++) {
+        HChaCha20Block(key, &nonces[i * 16], &expected[i * 32]);
+    }
+
+    std::vector<CpuCipherFeatures> archs = { CpuCipherFeatures::eReference };
+    if (CpuId::cpuHasAvx2()) {
+        archs.push_back(CpuCipherFeatures::eAesni);
+    }
+    if (CpuId::cpuHasAvx512f()) {
+        archs.push_back(CpuCipherFeatures::eVaes512);
+    }
+    for (auto arch : archs) {
+        for (Uint64 count = 1; count <= 40; count++) {
+            // one spare subkey to catch writes past the end
+            std::vector<Uint8> subkeys((count + 1) * 32, 0xa5);
+            EXPECT_EQ(HChaCha20(key,
+                                sizeof(key) * 8,
+                                &nonces[0],
+                                count,
+                                &subkeys[0],
+                                arch),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(
+                std::vector<Uint8>(subkeys.begin(), subkeys.end() - 32),
+                std::vector<Uint8>(expected.begin(),
+                                   expected.begin() + count * 32))
+                << "arch " << static_cast<int>(arch) << " count " << count;
+            EXPECT_EQ(std::vector<Uint8>(subkeys.end() - 32, subkeys.end()),
+                      std::vector<Uint8>(32, 0xa5));
+        }
+    }
+}
+
+// XChaCha20 is ChaCha20 under the HChaCha20 subkey with counter 0
+TEST(Chacha20, XChaCha20MatchesSubkey)
+{
+    Uint8 key[32], nonce[24];
+    for (Uint64 i = 0; i < sizeof(key); i++) {
+        key[i] = static_cast<Uint8>(0x80 + i);
+    }
+    for (Uint64 i = 0; i < sizeof(nonce); i++) {
+        nonce[i] = static_cast<Uint8>(0x40 + i);
+    }
+    std::vector<Uint8> plaintext(700);
+    for (Uint64 i = 0; i < plaintext.size(); i++) {
+        plaintext[i] = static_cast<Uint8>(i * 3 + 1);
+    }
+
+    Uint8 subkey[32], iv[16] = {};
+    HChaCha20Block(key, nonce, subkey);
+    memcpy(iv + 8, nonce + 16, 8);
+
+    ref::ChaCha256     chacha;
+    std::vector<Uint8> expected(plaintext.size());
+    chacha.init(subkey, sizeof(subkey) * 8, iv, sizeof(iv));
+    chacha.encrypt(&plaintext[0], &expected[0], plaintext.size());
+
+    ref::XChaCha256       refX;
+    avx2::XChaCha256      avx2X;
+    vaes512::XChaCha256   zen4X;
+    std::vector<iCipher*> ciphers = { &refX };
+    if (CpuId::cpuHasAvx2()) {
+        ciphers.push_back(&avx2X);
+    }
+    if (CpuId::cpuHasAvx512f()) {
+        ciphers.push_back(&zen4X);
+    }
+    for (iCipher* x : ciphers) {
+        std::vector<Uint8> out(plaintext.size());
+        EXPECT_EQ(x->init(key, sizeof(key) * 8, nonce, sizeof(nonce)),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(x->encrypt(&plaintext[0], &out[0], out.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(out, expected);
+
+        // a new nonce on its own keeps the key
+        EXPECT_EQ(x->init(nullptr, 0, nonce, sizeof(nonce)), ALC_ERROR_NONE);
+        EXPECT_EQ(x->decrypt(&out[0], &out[0], out.size()), ALC_ERROR_NONE);
+        EXPECT_EQ(out, plaintext);
+
+        EXPECT_EQ(x->init(nullptr, 0, nonce, 16), ALC_ERROR_INVALID_SIZE);
+        EXPECT_EQ(x->init(key, 128, nullptr, 0), ALC_ERROR_INVALID_SIZE);
+    }
+}
+
 TEST(Chacha20, PerformanceTest)
 {
     ref::ChaCha256 chacha20_obj;
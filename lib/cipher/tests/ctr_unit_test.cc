@@ -40,6 +40,8 @@
 
 #undef DEBUG
 
+using alcp::cipher::cCipherObjectMaxAlign;
+using alcp::cipher::cCipherObjectMaxSize;
 using alcp::cipher::CipherFactory;
 using alcp::cipher::iCipher;
 namespace alcp::cipher::unittest::ctr {
@@ -412,6 +414,217 @@ TEST(CTR, RandomEncryptDecryptTest)
         }
 }
 
+TEST(CTR, ParallelMatchesSerial)
+{
+    std::vector<Uint8> key_256(32);
+    // low 64 bits of the counter wrap around within the buffer
+    std::vector<Uint8> iv_wrap = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                                   0x07, 0x08, 0xff, 0xff, 0xff, 0xff,
+                                   0xff, 0xff, 0xff, 0x80 };
+    std::vector<Uint8> plain_text_vect((1 << 20) + 37);
+
+    std::unique_ptr<IRandomize> random = std::make_unique<Randomize>(12);
+    random->getRandomBytes(plain_text_vect);
+    random->getRandomBytes(key_256);
+
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        auto serialCipher   = new CipherFactory<iCipher>;
+        auto serial         = serialCipher->create("aes-ctr-256", feature);
+        auto parallelCipher = new CipherFactory<iCipher>;
+        auto parallel       = parallelCipher->create("aes-ctr-256", feature);
+
+        if (serial == nullptr || parallel == nullptr) {
+            delete serialCipher;
+            delete parallelCipher;
+            FAIL();
+        }
+        EXPECT_EQ(parallel->setParallelism(4, 16 * 1024), ALC_ERROR_NONE);
+
+        std::vector<Uint8> serialOut(plain_text_vect.size());
+        std::vector<Uint8> parallelOut(plain_text_vect.size());
+
+        EXPECT_EQ(serial->init(&key_256[0], 256, &iv_wrap[0], 16),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(parallel->init(&key_256[0], 256, &iv_wrap[0], 16),
+                  ALC_ERROR_NONE);
+
+        // second call checks the counter left in the handle
+        for (int call = 0; call < 2; call++) {
+            EXPECT_EQ(serial->encrypt(&plain_text_vect[0],
+                                      &serialOut[0],
+                                      plain_text_vect.size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(parallel->encrypt(&plain_text_vect[0],
+                                        &parallelOut[0],
+                                        plain_text_vect.size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(serialOut, parallelOut);
+        }
+
+        // in place decrypt from the start
+        EXPECT_EQ(parallel->init(nullptr, 0, &iv_wrap[0], 16), ALC_ERROR_NONE);
+        EXPECT_EQ(serial->init(nullptr, 0, &iv_wrap[0], 16), ALC_ERROR_NONE);
+        EXPECT_EQ(serial->encrypt(&plain_text_vect[0],
+                                  &serialOut[0],
+                                  plain_text_vect.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(parallel->decrypt(
+                      &serialOut[0], &serialOut[0], serialOut.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(serialOut, plain_text_vect);
+
+        delete serialCipher;
+        delete parallelCipher;
+    }
+}
+
+TEST(CTR, ParallelismInvalid)
+{
+    auto alcpCipher = new CipherFactory<iCipher>;
+    auto ctr        = alcpCipher->create("aes-ctr-128");
+    auto cbcCipher  = new CipherFactory<iCipher>;
+    auto cbc        = cbcCipher->create("aes-cbc-128");
+
+    if (ctr == nullptr || cbc == nullptr) {
+        delete alcpCipher;
+        delete cbcCipher;
+        FAIL();
+    }
+    EXPECT_EQ(ctr->setParallelism(4, 1000), ALC_ERROR_INVALID_ARG);
+    EXPECT_EQ(ctr->setParallelism(0, 0), ALC_ERROR_NONE);
+    EXPECT_EQ(cbc->setParallelism(4, 0), ALC_ERROR_NOT_SUPPORTED);
+
+    delete alcpCipher;
+    delete cbcCipher;
+}
+
+TEST(CTR, StreamOffsetMatchesSlice)
+{
+    std::vector<Uint8> key_128(16);
+    // low 64 bits of the counter wrap around within the buffer
+    std::vector<Uint8> iv_wrap = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                                   0x07, 0x08, 0xff, 0xff, 0xff, 0xff,
+                                   0xff, 0xff, 0xff, 0xf0 };
+    std::vector<Uint8> plain_text_vect((1 << 17) + 37);
+
+    std::unique_ptr<IRandomize> random = std::make_unique<Randomize>(13);
+    random->getRandomBytes(plain_text_vect);
+    random->getRandomBytes(key_128);
+
+    const Uint64 offsets[] = { 0, 5, 16, 31, 255, 1000, 70001, 131000 };
+
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        auto fullCipher = new CipherFactory<iCipher>;
+        auto full       = fullCipher->create("aes-ctr-128", feature);
+        auto seekCipher = new CipherFactory<iCipher>;
+        auto seek       = seekCipher->create("aes-ctr-128", feature);
+
+        if (full == nullptr || seek == nullptr) {
+            delete fullCipher;
+            delete seekCipher;
+            FAIL();
+        }
+        // long tails after a seek also take the parallel path
+        EXPECT_EQ(seek->setParallelism(4, 16 * 1024), ALC_ERROR_NONE);
+
+        std::vector<Uint8> cipher_text(plain_text_vect.size());
+        EXPECT_EQ(full->init(&key_128[0], 128, &iv_wrap[0], 16),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(full->encrypt(&plain_text_vect[0],
+                                &cipher_text[0],
+                                plain_text_vect.size()),
+                  ALC_ERROR_NONE);
+
+        EXPECT_EQ(seek->init(&key_128[0], 128, &iv_wrap[0], 16),
+                  ALC_ERROR_NONE);
+        for (Uint64 offset : offsets) {
+            // short read within the first block and a read to the end
+            for (Uint64 len : { Uint64(3), plain_text_vect.size() - offset }) {
+                std::vector<Uint8> out(len);
+                EXPECT_EQ(seek->setStreamOffset(offset), ALC_ERROR_NONE);
+                EXPECT_EQ(seek->decrypt(&cipher_text[offset], &out[0], len),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(out,
+                          std::vector<Uint8>(plain_text_vect.begin() + offset,
+                                             plain_text_vect.begin() + offset
+                                                 + len))
+                    << "offset " << offset << " len " << len;
+            }
+        }
+
+        delete fullCipher;
+        delete seekCipher;
+    }
+}
+
+TEST(CTR, StreamOffsetInvalid)
+{
+    auto alcpCipher = new CipherFactory<iCipher>;
+    auto ctr        = alcpCipher->create("aes-ctr-128");
+    auto cbcCipher  = new CipherFactory<iCipher>;
+    auto cbc        = cbcCipher->create("aes-cbc-128");
+
+    if (ctr == nullptr || cbc == nullptr) {
+        delete alcpCipher;
+        delete cbcCipher;
+        FAIL();
+    }
+    // no iv to count the offset from
+    EXPECT_EQ(ctr->setStreamOffset(16), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(cbc->setStreamOffset(16), ALC_ERROR_NOT_SUPPORTED);
+
+    delete alcpCipher;
+    delete cbcCipher;
+}
+
+TEST(CTR, InPlaceMatchesHeap)
+{
+    // deliberately misaligned, the factory aligns the object itself
+    std::vector<Uint8> storage(cCipherObjectMaxSize + cCipherObjectMaxAlign
+                               + 1);
+    Uint8*             p_storage = &storage[1];
+
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        CipherFactory<iCipher> heapCipher;
+        auto                   heap = heapCipher.create("aes-ctr-128", feature);
+
+        CipherFactory<iCipher> inPlaceCipher;
+        inPlaceCipher.setStorage(p_storage, storage.size() - 1);
+        auto in_place = inPlaceCipher.create("aes-ctr-128", feature);
+
+        ASSERT_NE(heap, nullptr);
+        ASSERT_NE(in_place, nullptr);
+        auto p_obj = reinterpret_cast<Uint8*>(in_place);
+        EXPECT_GE(p_obj, p_storage);
+        EXPECT_LT(p_obj, p_storage + storage.size() - 1);
+
+        std::vector<Uint8> heap_out(plainText.size());
+        std::vector<Uint8> in_place_out(plainText.size());
+        EXPECT_EQ(heap->init(&key[0], key.size() * 8, &iv[0], iv.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(heap->encrypt(&plainText[0], &heap_out[0], plainText.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(in_place->init(&key[0], key.size() * 8, &iv[0], iv.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(in_place->encrypt(
+                      &plainText[0], &in_place_out[0], plainText.size()),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(heap_out, cipherText);
+        EXPECT_EQ(in_place_out, cipherText);
+
+        // the factory does not own objects built in the storage
+        CipherFactory<iCipher>::destroy(in_place);
+    }
+
+    // storage smaller than the object
+    CipherFactory<iCipher> smallCipher;
+    smallCipher.setStorage(p_storage, 8);
+    EXPECT_EQ(smallCipher.create("aes-ctr-128"), nullptr);
+}
+
 int
 main(int argc, char** argv)
 {
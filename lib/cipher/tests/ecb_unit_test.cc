@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+using alcp::cipher::CipherFactory;
+using alcp::cipher::iCipher;
+namespace alcp::cipher::unittest::ecb {
+// NIST SP 800-38A F.1.1, F.1.3 and F.1.5
+std::vector<Uint8> plainText = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11,
+    0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30, 0xc8, 0x1c, 0x46,
+    0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b,
+    0xe6, 0x6c, 0x37, 0x10
+};
+
+struct EcbVector
+{
+    const char*        name;
+    std::vector<Uint8> key;
+    std::vector<Uint8> cipherText;
+};
+
+std::vector<EcbVector> vectors = {
+    { "aes-ecb-128",
+      { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+        0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c },
+      { 0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60, 0xa8, 0x9e, 0xca,
+        0xf3, 0x24, 0x66, 0xef, 0x97, 0xf5, 0xd3, 0xd5, 0x85, 0x03, 0xb9,
+        0x69, 0x9d, 0xe7, 0x85, 0x89, 0x5a, 0x96, 0xfd, 0xba, 0xaf, 0x43,
+        0xb1, 0xcd, 0x7f, 0x59, 0x8e, 0xce, 0x23, 0x88, 0x1b, 0x00, 0xe3,
+        0xed, 0x03, 0x06, 0x88, 0x7b, 0x0c, 0x78, 0x5e, 0x27, 0xe8, 0xad,
+        0x3f, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5d, 0xd4 } },
+    { "aes-ecb-192",
+      { 0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52,
+        0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+        0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b },
+      { 0xbd, 0x33, 0x4f, 0x1d, 0x6e, 0x45, 0xf2, 0x5f, 0xf7, 0x12, 0xa2,
+        0x14, 0x57, 0x1f, 0xa5, 0xcc, 0x97, 0x41, 0x04, 0x84, 0x6d, 0x0a,
+        0xd3, 0xad, 0x77, 0x34, 0xec, 0xb3, 0xec, 0xee, 0x4e, 0xef, 0xef,
+        0x7a, 0xfd, 0x22, 0x70, 0xe2, 0xe6, 0x0a, 0xdc, 0xe0, 0xba, 0x2f,
+        0xac, 0xe6, 0x44, 0x4e, 0x9a, 0x4b, 0x41, 0xba, 0x73, 0x8d, 0x6c,
+        0x72, 0xfb, 0x16, 0x69, 0x16, 0x03, 0xc1, 0x8e, 0x0e } },
+    { "aes-ecb-256",
+      { 0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae,
+        0xf0, 0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61,
+        0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 },
+      { 0xf3, 0xee, 0xd1, 0xbd, 0xb5, 0xd2, 0xa0, 0x3c, 0x06, 0x4b, 0x5a,
+        0x7e, 0x3d, 0xb1, 0x81, 0xf8, 0x59, 0x1c, 0xcb, 0x10, 0xd4, 0x10,
+        0xed, 0x26, 0xdc, 0x5b, 0xa7, 0x4a, 0x31, 0x36, 0x28, 0x70, 0xb6,
+        0xed, 0x21, 0xb9, 0x9c, 0xa6, 0xf4, 0xf9, 0xf1, 0x53, 0xe7, 0xb1,
+        0xbe, 0xaf, 0xed, 0x1d, 0x23, 0x30, 0x4b, 0x7a, 0x39, 0xf9, 0xf3,
+        0xff, 0x06, 0x7d, 0x8d, 0x8f, 0x9e, 0x24, 0xec, 0xc7 } },
+};
+} // namespace alcp::cipher::unittest::ecb
+
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::ecb;
+
+TEST(ECB, creation)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipher> alcpCipher;
+        EXPECT_NE(alcpCipher.create("aes-ecb-128", feature), nullptr);
+    }
+}
+
+TEST(ECB, KnownAnswer)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : vectors) {
+            CipherFactory<iCipher> alcpCipher;
+            iCipher*               ecb = alcpCipher.create(v.name, feature);
+            ASSERT_NE(ecb, nullptr);
+
+            std::vector<Uint8> output(plainText.size());
+            EXPECT_EQ(ecb->init(&v.key[0], v.key.size() * 8, nullptr, 0),
+                      ALC_ERROR_NONE);
+
+            EXPECT_EQ(ecb->encrypt(&plainText[0], &output[0], output.size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(output, v.cipherText);
+
+            EXPECT_EQ(ecb->decrypt(&v.cipherText[0], &output[0], output.size()),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(output, plainText);
+        }
+    }
+}
+
+// Every block count up to 70 touches all of the bulk and tail paths
+TEST(ECB, BulkMatchesSingleBlock)
+{
+    Randomize          rng(7);
+    std::vector<Uint8> key(32), input(70 * 16);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(input);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipher> alcpCipher;
+        iCipher*               ecb = alcpCipher.create("aes-ecb-256", feature);
+        ASSERT_NE(ecb, nullptr);
+        ecb->init(&key[0], key.size() * 8, nullptr, 0);
+
+        std::vector<Uint8> expected(input.size());
+        for (Uint64 i = 0; i < input.size(); i += 16) {
+            ecb->encrypt(&input[i], &expected[i], 16);
+        }
+
+        for (Uint64 blocks = 1; blocks <= 70; blocks++) {
+            Uint64             len = blocks * 16;
+            std::vector<Uint8> out(len), back(len);
+
+            EXPECT_EQ(ecb->encrypt(&input[0], &out[0], len), ALC_ERROR_NONE);
+            EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+
+            EXPECT_EQ(ecb->decrypt(&out[0], &back[0], len), ALC_ERROR_NONE);
+            EXPECT_TRUE(std::equal(back.begin(), back.end(), input.begin()));
+        }
+    }
+}
+
+TEST(ECB, PartialBlock)
+{
+    CipherFactory<iCipher> alcpCipher;
+    iCipher*               ecb = alcpCipher.create("aes-ecb-128");
+    ASSERT_NE(ecb, nullptr);
+
+    std::vector<Uint8> output(plainText.size());
+    ecb->init(&vectors[0].key[0], 128, nullptr, 0);
+    EXPECT_EQ(ecb->encrypt(&plainText[0], &output[0], plainText.size() - 1),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(ecb->decrypt(&plainText[0], &output[0], 15),
+              ALC_ERROR_INVALID_SIZE);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,382 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+using alcp::cipher::CipherFactory;
+using alcp::cipher::iCipherAead;
+namespace alcp::cipher::unittest::gcmsiv {
+std::vector<Uint8>
+parseHex(const std::string& in)
+{
+    std::vector<Uint8> out;
+    for (Uint64 i = 0; i + 1 < in.size(); i += 2) {
+        out.push_back(std::stoi(in.substr(i, 2), nullptr, 16));
+    }
+    return out;
+}
+
+struct GcmSivVector
+{
+    const char* name;
+    const char* key;
+    const char* nonce;
+    const char* aad;
+    const char* plainText;
+    const char* cipherText;
+    const char* tag;
+};
+
+// RFC 8452 Appendix C.1 and C.2
+std::vector<GcmSivVector> vectors = {
+    { "aes-gcm-siv-128",
+      "01000000000000000000000000000000",
+      "030000000000000000000000",
+      "",
+      "",
+      "",
+      "dc20e2d83f25705bb49e439eca56de25" },
+    { "aes-gcm-siv-128",
+      "01000000000000000000000000000000",
+      "030000000000000000000000",
+      "",
+      "0100000000000000",
+      "b5d839330ac7b786",
+      "578782fff6013b815b287c22493a364c" },
+    { "aes-gcm-siv-128",
+      "01000000000000000000000000000000",
+      "030000000000000000000000",
+      "",
+      "010000000000000000000000",
+      "7323ea61d05932260047d942",
+      "a4978db357391a0bc4fdec8b0d106639" },
+    { "aes-gcm-siv-128",
+      "01000000000000000000000000000000",
+      "030000000000000000000000",
+      "01",
+      "0200000000000000",
+      "1e6daba35669f427",
+      "3b0a1a2560969cdf790d99759abd1508" },
+    { "aes-gcm-siv-128",
+      "01000000000000000000000000000000",
+      "030000000000000000000000",
+      "01",
+      "02000000000000000000000000000000"
+      "03000000000000000000000000000000"
+      "04000000000000000000000000000000",
+      "50c8303ea93925d64090d07bd109dfd9"
+      "515a5a33431019c17d93465999a8b005"
+      "3201d723120a8562b838cdff25bf9d1e",
+      "6a8cc3865f76897c2e4b245cf31c51f2" },
+    { "aes-gcm-siv-256",
+      "01000000000000000000000000000000"
+      "00000000000000000000000000000000",
+      "030000000000000000000000",
+      "",
+      "",
+      "",
+      "07f5f4169bbf55a8400cd47ea6fd400f" },
+    { "aes-gcm-siv-256",
+      "01000000000000000000000000000000"
+      "00000000000000000000000000000000",
+      "030000000000000000000000",
+      "",
+      "0100000000000000",
+      "c2ef328e5c71c83b",
+      "843122130f7364b761e0b97427e3df28" },
+    { "aes-gcm-siv-256",
+      "01000000000000000000000000000000"
+      "00000000000000000000000000000000",
+      "030000000000000000000000",
+      "01",
+      "0200000000000000",
+      "1de22967237a8132",
+      "91213f267e3b452f02d01ae33e4ec854" },
+};
+
+// Long message which runs through the wide POLYVAL and CTR32 loops. Key is
+// 00 01 02 ..., nonce 64 65 .. 6f, plaintext[i] = i, aad[i] = 7 * i.
+struct LongVector
+{
+    const char* name;
+    Uint64      keyLen;
+    const char* firstBlock;
+    const char* lastBlock;
+    const char* tag;
+};
+
+std::vector<LongVector> longVectors = {
+    { "aes-gcm-siv-128",
+      16,
+      "c1337857be9f7122f6ea48649e2a1463",
+      "17f17e510c2d3b3aa3e3e2578b196bbd",
+      "e48e2b7f2f9504f3781de3e78dd7b22a" },
+    { "aes-gcm-siv-256",
+      32,
+      "5ae24ae1d925c772873323c35660894e",
+      "33b2916cea3c4c4c0fa1590a51a09fac",
+      "927d5e8b2e7b0eae9b9e1d1e40eb1248" },
+};
+
+alc_error_t
+gcmSivEncrypt(iCipherAead*              siv,
+              const std::vector<Uint8>& key,
+              const std::vector<Uint8>& nonce,
+              const std::vector<Uint8>& aad,
+              const std::vector<Uint8>& input,
+              std::vector<Uint8>&       output,
+              std::vector<Uint8>&       tag)
+{
+    alc_error_t err =
+        siv->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (!aad.empty()) {
+        err = siv->setAad(&aad[0], aad.size());
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+    output.resize(input.size());
+    err = siv->encrypt(input.data(), output.data(), input.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    tag.resize(16);
+    return siv->getTag(&tag[0], tag.size());
+}
+
+alc_error_t
+gcmSivDecrypt(iCipherAead*              siv,
+              const std::vector<Uint8>& key,
+              const std::vector<Uint8>& nonce,
+              const std::vector<Uint8>& aad,
+              const std::vector<Uint8>& input,
+              const std::vector<Uint8>& tag,
+              std::vector<Uint8>&       output)
+{
+    alc_error_t err =
+        siv->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (!aad.empty()) {
+        err = siv->setAad(&aad[0], aad.size());
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+    err = siv->setExpectedTag(&tag[0], tag.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    output.resize(input.size());
+    return siv->decrypt(input.data(), output.data(), input.size());
+}
+} // namespace alcp::cipher::unittest::gcmsiv
+
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::gcmsiv;
+
+TEST(GCMSIV, creation)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        EXPECT_NE(alcpCipher.create("aes-gcm-siv-128", feature), nullptr);
+        EXPECT_NE(alcpCipher.create("aes-gcm-siv-256", feature), nullptr);
+        // RFC 8452 only defines 128 and 256 bit keys
+        EXPECT_EQ(alcpCipher.create("aes-gcm-siv-192", feature), nullptr);
+    }
+}
+
+TEST(GCMSIV, KnownAnswer)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : vectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead* siv = alcpCipher.create(v.name, feature);
+            ASSERT_NE(siv, nullptr);
+
+            auto key = parseHex(v.key), nonce = parseHex(v.nonce);
+            auto aad = parseHex(v.aad), pt = parseHex(v.plainText);
+            std::vector<Uint8> ct, tag, back;
+
+            EXPECT_EQ(gcmSivEncrypt(siv, key, nonce, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ct, parseHex(v.cipherText));
+            EXPECT_EQ(tag, parseHex(v.tag));
+
+            EXPECT_EQ(gcmSivDecrypt(siv, key, nonce, aad, ct, tag, back),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(back, pt);
+        }
+    }
+}
+
+TEST(GCMSIV, LongMessage)
+{
+    std::vector<Uint8> nonce(12), pt(1031), aad(67);
+    for (Uint64 i = 0; i < nonce.size(); i++) {
+        nonce[i] = 100 + i;
+    }
+    for (Uint64 i = 0; i < pt.size(); i++) {
+        pt[i] = i & 0xff;
+    }
+    for (Uint64 i = 0; i < aad.size(); i++) {
+        aad[i] = (7 * i) & 0xff;
+    }
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : longVectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead* siv = alcpCipher.create(v.name, feature);
+            ASSERT_NE(siv, nullptr);
+
+            std::vector<Uint8> key(v.keyLen), ct, tag;
+            for (Uint64 i = 0; i < key.size(); i++) {
+                key[i] = i;
+            }
+            EXPECT_EQ(gcmSivEncrypt(siv, key, nonce, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(std::vector<Uint8>(ct.begin(), ct.begin() + 16),
+                      parseHex(v.firstBlock));
+            EXPECT_EQ(std::vector<Uint8>(ct.end() - 16, ct.end()),
+                      parseHex(v.lastBlock));
+            EXPECT_EQ(tag, parseHex(v.tag));
+        }
+    }
+}
+
+// Every length up to a few wide iterations must agree with the AES-NI path
+TEST(GCMSIV, MatchesAesni)
+{
+    Randomize          rng(11);
+    std::vector<Uint8> key(32), nonce(12), input(600), aad(300);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(nonce);
+    rng.getRandomBytes(input);
+    rng.getRandomBytes(aad);
+
+    CipherFactory<iCipherAead> refFactory;
+    iCipherAead*               ref =
+        refFactory.create("aes-gcm-siv-256", CpuCipherFeatures::eAesni);
+    ASSERT_NE(ref, nullptr);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference
+            || feature == CpuCipherFeatures::eAesni) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        iCipherAead* siv = alcpCipher.create("aes-gcm-siv-256", feature);
+        ASSERT_NE(siv, nullptr);
+
+        for (Uint64 len = 0; len <= input.size(); len += 7) {
+            std::vector<Uint8> pt(input.begin(), input.begin() + len);
+            std::vector<Uint8> a(aad.begin(), aad.begin() + len / 2);
+            std::vector<Uint8> ct, tag, refCt, refTag;
+
+            EXPECT_EQ(gcmSivEncrypt(ref, key, nonce, a, pt, refCt, refTag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(gcmSivEncrypt(siv, key, nonce, a, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ct, refCt) << "len " << len;
+            EXPECT_EQ(tag, refTag) << "len " << len;
+        }
+    }
+}
+
+TEST(GCMSIV, TagMismatch)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        auto&                      v = vectors[4];
+        CipherFactory<iCipherAead> alcpCipher;
+        iCipherAead*               siv = alcpCipher.create(v.name, feature);
+        ASSERT_NE(siv, nullptr);
+
+        auto key = parseHex(v.key), nonce = parseHex(v.nonce);
+        auto aad = parseHex(v.aad), ct = parseHex(v.cipherText);
+        auto tag = parseHex(v.tag);
+        std::vector<Uint8> out;
+
+        tag[0] ^= 1;
+        EXPECT_EQ(gcmSivDecrypt(siv, key, nonce, aad, ct, tag, out),
+                  ALC_ERROR_TAG_MISMATCH);
+        // Unauthenticated plaintext must not be released
+        EXPECT_TRUE(std::all_of(
+            out.begin(), out.end(), [](Uint8 b) { return b == 0; }));
+    }
+}
+
+TEST(GCMSIV, DecryptNeedsTag)
+{
+    auto&                      v = vectors[1];
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead*               siv = alcpCipher.create(v.name);
+    ASSERT_NE(siv, nullptr);
+
+    auto key = parseHex(v.key), nonce = parseHex(v.nonce);
+    auto ct  = parseHex(v.cipherText);
+    std::vector<Uint8> out(ct.size());
+
+    siv->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    EXPECT_EQ(siv->decrypt(&ct[0], &out[0], ct.size()), ALC_ERROR_BAD_STATE);
+
+    // Only the full 16 byte tag is accepted
+    EXPECT_NE(siv->setExpectedTag(&ct[0], 8), ALC_ERROR_NONE);
+    EXPECT_NE(siv->init(&key[0], key.size() * 8, &nonce[0], 16),
+              ALC_ERROR_NONE);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -28,6 +28,10 @@
 
 #include "alcp/cipher/aes.hh"
 #include "alcp/cipher/aes_gcm.hh"
+#include "alcp/cipher/aes_mb.hh"
+#include "alcp/cipher_mb.h"
+#include "dispatcher.hh"
+#include "randomize.hh"
 
 #include "gtest/gtest.h"
 #include <math.h>
@@ -40,6 +44,7 @@
 #endif
 
 using namespace alcp::cipher;
+using namespace alcp::cipher::unittest;
 
 // KAT Data
 // clang-format off
@@ -808,4 +813,411 @@ TEST(GCM, DecryptUpdateMultipleStream)
 
     delete alcpCipher;
 }
-#endif
\ No newline at end of file
+#endif
+struct GcmPacket
+{
+    std::vector<Uint8> iv, aad, in, out, tag;
+};
+
+static std::vector<alc_aead_packet_t>
+makePackets(std::vector<GcmPacket>& pkts)
+{
+    std::vector<alc_aead_packet_t> batch(pkts.size());
+    for (size_t i = 0; i < pkts.size(); i++) {
+        batch[i]           = {};
+        batch[i].ap_iv     = getPtr(pkts[i].iv);
+        batch[i].ap_ivLen  = pkts[i].iv.size();
+        batch[i].ap_aad    = getPtr(pkts[i].aad);
+        batch[i].ap_aadLen = pkts[i].aad.size();
+        batch[i].ap_in     = getPtr(pkts[i].in);
+        batch[i].ap_out    = getPtr(pkts[i].out);
+        batch[i].ap_len    = pkts[i].in.size();
+        batch[i].ap_tag    = getPtr(pkts[i].tag);
+        batch[i].ap_tagLen = pkts[i].tag.size();
+    }
+    return batch;
+}
+
+// packet sizes around the 4 block bulk/tail split, and a few long ones
+static std::vector<GcmPacket>
+randomPackets(Randomize& rng, size_t count)
+{
+    const Uint64 lens[] = { 0,   1,   15,  16,  17,  31,  48,   63,
+                            64,  65,  79,  80,  95,  127, 128,  224,
+                            239, 240, 255, 300, 512, 1024, 1500 };
+
+    std::vector<GcmPacket> pkts(count);
+    for (size_t i = 0; i < count; i++) {
+        Uint64 len = lens[i % (sizeof(lens) / sizeof(lens[0]))];
+        pkts[i].iv.resize(i % 5 == 4 ? 1 + i % 23 : 12);
+        pkts[i].aad.resize((i * 7) % 40);
+        pkts[i].in.resize(len);
+        pkts[i].out.resize(len);
+        pkts[i].tag.resize(i % 3 == 2 ? 12 : 16);
+        rng.getRandomBytes(pkts[i].iv);
+        rng.getRandomBytes(pkts[i].aad);
+        rng.getRandomBytes(pkts[i].in);
+    }
+    return pkts;
+}
+
+TEST(GCM, BatchMatchesSingle)
+{
+    Randomize rng(7);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (Uint64 keyLen : { 128, 192, 256 }) {
+            std::vector<Uint8> key(keyLen / 8);
+            rng.getRandomBytes(key);
+            std::string name = "aes-gcm-" + std::to_string(keyLen);
+
+            CipherFactory<iCipherAead> factory;
+            auto                       aead = factory.create(name, feature);
+            ASSERT_NE(aead, nullptr);
+            EXPECT_EQ(aead->init(getPtr(key), keyLen, nullptr, 0),
+                      ALC_ERROR_NONE);
+
+            // more than one group of tails
+            auto pkts  = randomPackets(rng, 41);
+            auto batch = makePackets(pkts);
+            EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()),
+                      ALC_ERROR_NONE);
+
+            CipherFactory<iCipherAead> refFactory;
+            auto ref = refFactory.create(name, CpuCipherFeatures::eAesni);
+            ASSERT_NE(ref, nullptr);
+            for (auto& p : pkts) {
+                std::vector<Uint8> out(p.in.size()), tag(p.tag.size());
+                EXPECT_EQ(
+                    ref->init(getPtr(key), keyLen, &p.iv[0], p.iv.size()),
+                    ALC_ERROR_NONE);
+                EXPECT_EQ(ref->setAad(getPtr(p.aad), p.aad.size()),
+                          ALC_ERROR_NONE);
+                if (!p.in.empty()) {
+                    EXPECT_EQ(ref->encrypt(&p.in[0], &out[0], p.in.size()),
+                              ALC_ERROR_NONE);
+                }
+                EXPECT_EQ(ref->getTag(&tag[0], tag.size()), ALC_ERROR_NONE);
+                EXPECT_EQ(p.out, out);
+                EXPECT_EQ(p.tag, tag);
+            }
+
+            // and back
+            std::vector<GcmPacket> sealed = pkts;
+            for (auto& p : sealed) {
+                std::swap(p.in, p.out);
+            }
+            batch = makePackets(sealed);
+            EXPECT_EQ(aead->openBatch(&batch[0], batch.size()),
+                      ALC_ERROR_NONE);
+            for (size_t i = 0; i < pkts.size(); i++) {
+                EXPECT_EQ(batch[i].ap_err, ALC_ERROR_NONE);
+                EXPECT_EQ(sealed[i].out, pkts[i].in);
+            }
+        }
+    }
+}
+
+TEST(GCM, BatchKnownAnswer)
+{
+    // same vector as EncryptUpdateSingle, 19 byte nonce
+    std::vector<Uint8> key   = { 0xfe, 0xc7, 0x2f, 0xee, 0x8f, 0xc3, 0x88, 0x33,
+                                 0xe0, 0xdb, 0x47, 0xd2, 0x0d, 0x69, 0x22, 0x36 };
+    GcmPacket          pkt;
+    pkt.iv  = { 0x39, 0x8c, 0x22, 0x07, 0x78, 0xa3, 0x13, 0xa0, 0x0c, 0x35,
+                0x6e, 0x65, 0x31, 0x99, 0x74, 0x82, 0x2c, 0x7e, 0x17 };
+    pkt.aad = { 0x23, 0xfb, 0x6b, 0xe4, 0x66, 0x0f, 0x61, 0x18,
+                0xce, 0xd9, 0xa2, 0xae, 0xfd, 0x11, 0x73, 0xe7,
+                0x59, 0x19, 0x3e, 0x4d, 0x50, 0x3d, 0x98, 0xa2,
+                0x16, 0x6d, 0xd0, 0xf3, 0xeb, 0x69, 0x51, 0x1f };
+    pkt.in  = { 0xee, 0xd2, 0xfe, 0xe8, 0xf9, 0xbe, 0x1d, 0x5a, 0x55, 0xee,
+                0x4c, 0x28, 0x61, 0xb9, 0x31, 0x42, 0x58, 0x2a, 0x67, 0xdd,
+                0xef, 0x39, 0x7b, 0xff, 0xa6, 0xfa, 0x38, 0x1c, 0xa3, 0x4c,
+                0x93, 0xd5, 0xb4, 0xa1, 0xbd, 0x07, 0xb5, 0xee, 0xbf, 0x30,
+                0xc0, 0x0f, 0xb0, 0xa3, 0xb5, 0x87, 0x9d, 0x85 };
+    std::vector<Uint8> ctext = {
+        0xb6, 0xdd, 0x7e, 0xbb, 0xeb, 0x56, 0x83, 0x43, 0x17, 0xf2, 0xac, 0x1c,
+        0xf0, 0xdc, 0x69, 0xb3, 0xb0, 0x2a, 0xb8, 0x7e, 0x7e, 0x52, 0x41, 0x11,
+        0x36, 0x46, 0x34, 0x25, 0xf4, 0x00, 0x1c, 0xcd, 0xe3, 0x2a, 0x36, 0xf3,
+        0x70, 0xcf, 0xe0, 0xfc, 0xe6, 0xa0, 0xac, 0x37, 0x6a, 0xe1, 0x3a, 0xe2
+    };
+    std::vector<Uint8> tag = { 0x77, 0xf6, 0xc4, 0x7b, 0x05, 0x40, 0xf0, 0xb9,
+                               0xff, 0x3c, 0x3b, 0x07, 0xa2, 0x4c, 0x62, 0xfe };
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> factory;
+        auto aead = factory.create("aes-gcm-128", feature);
+        ASSERT_NE(aead, nullptr);
+        EXPECT_EQ(aead->init(getPtr(key), 128, nullptr, 0), ALC_ERROR_NONE);
+
+        // the same packet in every slot of a group
+        std::vector<GcmPacket> pkts(17, pkt);
+        for (auto& p : pkts) {
+            p.out.resize(p.in.size());
+            p.tag.resize(tag.size());
+        }
+        auto batch = makePackets(pkts);
+        EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()), ALC_ERROR_NONE);
+        for (auto& p : pkts) {
+            EXPECT_EQ(p.out, ctext);
+            EXPECT_EQ(p.tag, tag);
+        }
+    }
+}
+
+TEST(GCM, BatchTagMismatch)
+{
+    Randomize          rng(11);
+    std::vector<Uint8> key(16);
+    rng.getRandomBytes(key);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> factory;
+        auto aead = factory.create("aes-gcm-128", feature);
+        ASSERT_NE(aead, nullptr);
+        EXPECT_EQ(aead->init(getPtr(key), 128, nullptr, 0), ALC_ERROR_NONE);
+
+        auto pkts  = randomPackets(rng, 24);
+        auto batch = makePackets(pkts);
+        EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()), ALC_ERROR_NONE);
+
+        std::vector<GcmPacket> sealed = pkts;
+        for (auto& p : sealed) {
+            std::swap(p.in, p.out);
+        }
+        sealed[3].in[0] ^= 1;   // 16 bytes, all in the tail
+        sealed[11].tag[0] ^= 1; // 80 bytes
+        sealed[17].in[10] ^= 1; // 240 bytes, in the bulk
+        sealed[23].aad[0] ^= 1; // empty message
+        batch = makePackets(sealed);
+
+        EXPECT_EQ(aead->openBatch(&batch[0], batch.size()),
+                  ALC_ERROR_TAG_MISMATCH);
+        for (size_t i = 0; i < pkts.size(); i++) {
+            if (i == 3 || i == 11 || i == 17 || i == 23) {
+                EXPECT_EQ(batch[i].ap_err, ALC_ERROR_TAG_MISMATCH);
+                // nothing of a rejected packet is left in the output
+                EXPECT_EQ(sealed[i].out,
+                          std::vector<Uint8>(sealed[i].out.size()));
+            } else {
+                EXPECT_EQ(batch[i].ap_err, ALC_ERROR_NONE);
+                EXPECT_EQ(sealed[i].out, pkts[i].in);
+            }
+        }
+    }
+}
+
+TEST(GCM, BatchInPlace)
+{
+    Randomize          rng(13);
+    std::vector<Uint8> key(32);
+    rng.getRandomBytes(key);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> factory;
+        auto aead = factory.create("aes-gcm-256", feature);
+        ASSERT_NE(aead, nullptr);
+        EXPECT_EQ(aead->init(getPtr(key), 256, nullptr, 0), ALC_ERROR_NONE);
+
+        auto pkts  = randomPackets(rng, 18);
+        auto batch = makePackets(pkts);
+        EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()), ALC_ERROR_NONE);
+
+        std::vector<GcmPacket> inPlace = pkts;
+        for (auto& p : inPlace) {
+            p.out = p.in;
+        }
+        batch = makePackets(inPlace);
+        for (auto& b : batch) {
+            b.ap_in = b.ap_out;
+        }
+        EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()), ALC_ERROR_NONE);
+        for (size_t i = 0; i < pkts.size(); i++) {
+            EXPECT_EQ(inPlace[i].out, pkts[i].out);
+            EXPECT_EQ(inPlace[i].tag, pkts[i].tag);
+        }
+
+        EXPECT_EQ(aead->openBatch(&batch[0], batch.size()), ALC_ERROR_NONE);
+        for (size_t i = 0; i < pkts.size(); i++) {
+            EXPECT_EQ(inPlace[i].out, pkts[i].in);
+        }
+    }
+}
+
+TEST(GCM, BatchInvalidPackets)
+{
+    std::vector<Uint8> key(16);
+
+    CipherFactory<iCipherAead> factory;
+    iCipherAead*               aead = factory.create("aes-gcm-128");
+    ASSERT_NE(aead, nullptr);
+
+    Randomize rng(17);
+    auto      pkts  = randomPackets(rng, 4);
+    auto      batch = makePackets(pkts);
+
+    // no key yet
+    EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(aead->init(getPtr(key), 128, nullptr, 0), ALC_ERROR_NONE);
+
+    batch[2].ap_tagLen = 17;
+    EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()),
+              ALC_ERROR_INVALID_SIZE);
+    // nothing is written when the batch is rejected
+    EXPECT_EQ(pkts[0].out, std::vector<Uint8>(pkts[0].out.size()));
+
+    batch[2].ap_tagLen = 16;
+    batch[2].ap_ivLen  = 0;
+    EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()),
+              ALC_ERROR_INVALID_SIZE);
+
+    batch[2].ap_ivLen = 12;
+    batch[2].ap_aad   = nullptr;
+    EXPECT_EQ(aead->sealBatch(&batch[0], batch.size()),
+              ALC_ERROR_INVALID_ARG);
+}
+
+// packets of several connections, with keys of every size
+static std::vector<alc_aead_mb_job_t>
+makeMbJobs(std::vector<GcmPacket>&                       pkts,
+           const std::vector<alc_cipher_prepared_key_p>& keys)
+{
+    auto                           batch = makePackets(pkts);
+    std::vector<alc_aead_mb_job_t> jobs(pkts.size());
+    for (size_t i = 0; i < pkts.size(); i++) {
+        jobs[i].aj_key    = keys[(i * 5) % keys.size()];
+        jobs[i].aj_packet = batch[i];
+    }
+    return jobs;
+}
+
+TEST(GCM, MultiKeyMatchesSingle)
+{
+    Randomize rng(19);
+
+    std::vector<std::vector<Uint8>>        rawKeys;
+    std::vector<alc_cipher_prepared_key_p> keys;
+    for (int i = 0; i < 9; i++) {
+        std::vector<Uint8> key(16 + 8 * (i % 3));
+        rng.getRandomBytes(key);
+        alc_cipher_prepared_key_p p_key = nullptr;
+        ASSERT_EQ(alcp_cipher_prepared_key_create(
+                      ALC_AES_MODE_GCM, &key[0], key.size() * 8, &p_key),
+                  ALC_ERROR_NONE);
+        rawKeys.push_back(key);
+        keys.push_back(p_key);
+    }
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        // more than one group, lanes of every key size drain at different
+        // times, narrower cpus go one packet after the other
+        auto pkts = randomPackets(rng, 77);
+        auto jobs = makeMbJobs(pkts, keys);
+        EXPECT_EQ(CryptGcmMb(&jobs[0], jobs.size(), true, feature),
+                  ALC_ERROR_NONE);
+
+        for (size_t i = 0; i < pkts.size(); i++) {
+            const GcmPacket&          p   = pkts[i];
+            const std::vector<Uint8>& key = rawKeys[(i * 5) % keys.size()];
+            std::string name = "aes-gcm-" + std::to_string(key.size() * 8);
+
+            CipherFactory<iCipherAead> refFactory;
+            auto ref = refFactory.create(name, CpuCipherFeatures::eAesni);
+            ASSERT_NE(ref, nullptr);
+
+            std::vector<Uint8> out(p.in.size()), tag(p.tag.size());
+            EXPECT_EQ(
+                ref->init(&key[0], key.size() * 8, &p.iv[0], p.iv.size()),
+                ALC_ERROR_NONE);
+            EXPECT_EQ(ref->setAad(getPtr(p.aad), p.aad.size()), ALC_ERROR_NONE);
+            if (!p.in.empty()) {
+                EXPECT_EQ(ref->encrypt(&p.in[0], &out[0], p.in.size()),
+                          ALC_ERROR_NONE);
+            }
+            EXPECT_EQ(ref->getTag(&tag[0], tag.size()), ALC_ERROR_NONE);
+            EXPECT_EQ(p.out, out) << "packet " << i;
+            EXPECT_EQ(p.tag, tag) << "packet " << i;
+        }
+
+        // and back in place, two packets with a broken tag
+        std::vector<GcmPacket> sealed = pkts;
+        for (auto& p : sealed) {
+            p.in = p.out;
+        }
+        sealed[6].tag[0] ^= 1;
+        sealed[50].tag[3] ^= 0x80;
+        jobs = makeMbJobs(sealed, keys);
+        for (auto& j : jobs) {
+            j.aj_packet.ap_in = j.aj_packet.ap_out;
+        }
+        EXPECT_EQ(CryptGcmMb(&jobs[0], jobs.size(), false, feature),
+                  ALC_ERROR_TAG_MISMATCH);
+        for (size_t i = 0; i < pkts.size(); i++) {
+            if (i == 6 || i == 50) {
+                EXPECT_EQ(jobs[i].aj_packet.ap_err, ALC_ERROR_TAG_MISMATCH);
+                EXPECT_EQ(sealed[i].out, std::vector<Uint8>(pkts[i].in.size()));
+            } else {
+                EXPECT_EQ(jobs[i].aj_packet.ap_err, ALC_ERROR_NONE);
+                EXPECT_EQ(sealed[i].out, pkts[i].in) << "packet " << i;
+            }
+        }
+    }
+
+    for (auto p_key : keys) {
+        alcp_cipher_prepared_key_release(p_key);
+    }
+}
+
+TEST(GCM, MultiKeyInvalidJobs)
+{
+    std::vector<Uint8>        key(16);
+    alc_cipher_prepared_key_p gcmKey = nullptr;
+    alc_cipher_prepared_key_p ctrKey = nullptr;
+    ASSERT_EQ(alcp_cipher_prepared_key_create(
+                  ALC_AES_MODE_GCM, &key[0], 128, &gcmKey),
+              ALC_ERROR_NONE);
+    ASSERT_EQ(alcp_cipher_prepared_key_create(
+                  ALC_AES_MODE_CTR, &key[0], 128, &ctrKey),
+              ALC_ERROR_NONE);
+
+    Randomize rng(23);
+    auto      pkts = randomPackets(rng, 4);
+    auto      jobs = makeMbJobs(pkts, { gcmKey });
+
+    EXPECT_EQ(CryptGcmMb(
+                  &jobs[0], jobs.size(), true, CpuCipherFeatures::eReference),
+              ALC_ERROR_NOT_SUPPORTED);
+
+    jobs[1].aj_key = ctrKey;
+    EXPECT_EQ(alcp_cipher_aead_seal_gcm_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_ARG);
+    // nothing is written when the batch is rejected
+    EXPECT_EQ(pkts[0].out, std::vector<Uint8>(pkts[0].out.size()));
+
+    jobs[1].aj_key = nullptr;
+    EXPECT_EQ(alcp_cipher_aead_seal_gcm_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_ARG);
+
+    jobs[1].aj_key              = gcmKey;
+    jobs[2].aj_packet.ap_tagLen = 17;
+    EXPECT_EQ(alcp_cipher_aead_seal_gcm_mb(&jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+
+    alcp_cipher_prepared_key_release(gcmKey);
+    alcp_cipher_prepared_key_release(ctrKey);
+}
@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher/aes_kw.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+namespace alcp::cipher::unittest::kw {
+
+struct KnownAnswer
+{
+    alc_key_wrap_mode_t mode;
+    std::vector<Uint8>  kek;
+    std::vector<Uint8>  key;
+    std::vector<Uint8>  wrapped;
+};
+
+// RFC 3394 section 4 and RFC 5649 section 6
+std::vector<KnownAnswer> knownAnswers = {
+    { ALC_KEY_WRAP_KW,
+      { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+      { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff },
+      { 0x1f, 0xa6, 0x8b, 0x0a, 0x81, 0x12, 0xb4, 0x47,
+        0xae, 0xf3, 0x4b, 0xd8, 0xfb, 0x5a, 0x7b, 0x82,
+        0x9d, 0x3e, 0x86, 0x23, 0x71, 0xd2, 0xcf, 0xe5 } },
+    { ALC_KEY_WRAP_KW,
+      { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17 },
+      { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 },
+      { 0x03, 0x1d, 0x33, 0x26, 0x4e, 0x15, 0xd3, 0x32,
+        0x68, 0xf2, 0x4e, 0xc2, 0x60, 0x74, 0x3e, 0xdc,
+        0xe1, 0xc6, 0xc7, 0xdd, 0xee, 0x72, 0x5a, 0x93,
+        0x6b, 0xa8, 0x14, 0x91, 0x5c, 0x67, 0x62, 0xd2 } },
+    { ALC_KEY_WRAP_KW,
+      { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f },
+      { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+      { 0x28, 0xc9, 0xf4, 0x04, 0xc4, 0xb8, 0x10, 0xf4,
+        0xcb, 0xcc, 0xb3, 0x5c, 0xfb, 0x87, 0xf8, 0x26,
+        0x3f, 0x57, 0x86, 0xe2, 0xd8, 0x0e, 0xd3, 0x26,
+        0xcb, 0xc7, 0xf0, 0xe7, 0x1a, 0x99, 0xf4, 0x3b,
+        0xfb, 0x98, 0x8b, 0x9b, 0x7a, 0x02, 0xdd, 0x21 } },
+    { ALC_KEY_WRAP_KWP,
+      { 0x58, 0x40, 0xdf, 0x6e, 0x29, 0xb0, 0x2a, 0xf1,
+        0xab, 0x49, 0x3b, 0x70, 0x5b, 0xf1, 0x6e, 0xa1,
+        0xae, 0x83, 0x38, 0xf4, 0xdc, 0xc1, 0x76, 0xa8 },
+      { 0xc3, 0x7b, 0x7e, 0x64, 0x92, 0x58, 0x43, 0x40, 0xbe, 0xd1,
+        0x22, 0x07, 0x80, 0x89, 0x41, 0x15, 0x50, 0x68, 0xf7, 0x38 },
+      { 0x13, 0x8b, 0xde, 0xaa, 0x9b, 0x8f, 0xa7, 0xfc,
+        0x61, 0xf9, 0x77, 0x42, 0xe7, 0x22, 0x48, 0xee,
+        0x5a, 0xe6, 0xae, 0x53, 0x60, 0xd1, 0xae, 0x6a,
+        0x5f, 0x54, 0xf3, 0x73, 0xfa, 0x54, 0x3b, 0x6a } },
+    { ALC_KEY_WRAP_KWP,
+      { 0x58, 0x40, 0xdf, 0x6e, 0x29, 0xb0, 0x2a, 0xf1,
+        0xab, 0x49, 0x3b, 0x70, 0x5b, 0xf1, 0x6e, 0xa1,
+        0xae, 0x83, 0x38, 0xf4, 0xdc, 0xc1, 0x76, 0xa8 },
+      { 0x46, 0x6f, 0x72, 0x50, 0x61, 0x73, 0x69 },
+      { 0xaf, 0xbe, 0xb0, 0xf0, 0x7d, 0xfb, 0xf5, 0x41,
+        0x92, 0x00, 0xf2, 0xcc, 0xb5, 0x0b, 0xb2, 0x4f } },
+};
+
+struct Key
+{
+    std::vector<Uint8> in;
+    std::vector<Uint8> out;
+};
+
+static std::vector<alc_key_wrap_job_t>
+makeJobs(std::vector<Key>& keys)
+{
+    std::vector<alc_key_wrap_job_t> jobs(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        jobs[i]           = {};
+        jobs[i].kj_src    = keys[i].in.data();
+        jobs[i].kj_srcLen = keys[i].in.size();
+        jobs[i].kj_dst    = keys[i].out.data();
+    }
+    return jobs;
+}
+
+static Uint64
+wrappedSize(alc_key_wrap_mode_t mode, Uint64 len)
+{
+    return (mode == ALC_KEY_WRAP_KW ? len : (len + 7) / 8 * 8) + 8;
+}
+} // namespace alcp::cipher::unittest::kw
+
+using namespace alcp::cipher;
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::kw;
+
+TEST(KW, KnownAnswer)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& kat : knownAnswers) {
+            // same key in every lane, plus one more to force a refill
+            std::vector<Key> keys(cMbMaxLanes + 1);
+            for (auto& k : keys) {
+                k = { kat.key, std::vector<Uint8>(kat.wrapped.size()) };
+            }
+            auto jobs = makeJobs(keys);
+
+            alc_error_t err = WrapKeys(kat.mode,
+                                       &kat.kek[0],
+                                       kat.kek.size() * 8,
+                                       &jobs[0],
+                                       jobs.size(),
+                                       feature);
+            EXPECT_EQ(err, ALC_ERROR_NONE);
+            for (size_t i = 0; i < keys.size(); i++) {
+                EXPECT_EQ(keys[i].out, kat.wrapped);
+                EXPECT_EQ(jobs[i].kj_dstLen, kat.wrapped.size());
+            }
+
+            for (auto& k : keys) {
+                k = { kat.wrapped, std::vector<Uint8>(kat.wrapped.size() - 8) };
+            }
+            jobs = makeJobs(keys);
+
+            err = UnwrapKeys(kat.mode,
+                             &kat.kek[0],
+                             kat.kek.size() * 8,
+                             &jobs[0],
+                             jobs.size(),
+                             feature);
+            EXPECT_EQ(err, ALC_ERROR_NONE);
+            for (size_t i = 0; i < keys.size(); i++) {
+                EXPECT_EQ(jobs[i].kj_err, ALC_ERROR_NONE);
+                ASSERT_EQ(jobs[i].kj_dstLen, kat.key.size());
+                keys[i].out.resize(jobs[i].kj_dstLen);
+                EXPECT_EQ(keys[i].out, kat.key);
+            }
+        }
+    }
+}
+
+TEST(KW, BatchMatchesSingle)
+{
+    Randomize rng(42);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto mode : { ALC_KEY_WRAP_KW, ALC_KEY_WRAP_KWP }) {
+            std::vector<Uint8> kek(32);
+            rng.getRandomBytes(kek);
+
+            // lengths from 1 to 8 blocks, so lanes drain at different times
+            std::vector<Key> keys(45);
+            for (size_t i = 0; i < keys.size(); i++) {
+                Uint64 len = mode == ALC_KEY_WRAP_KW ? 16 + 8 * (i % 7)
+                                                     : 1 + (i * 5) % 64;
+                keys[i].in.resize(len);
+                keys[i].out.resize(wrappedSize(mode, len));
+                rng.getRandomBytes(keys[i].in);
+            }
+            auto jobs = makeJobs(keys);
+
+            alc_error_t err =
+                WrapKeys(mode, &kek[0], 256, &jobs[0], jobs.size(), feature);
+            EXPECT_EQ(err, ALC_ERROR_NONE);
+
+            for (size_t i = 0; i < keys.size(); i++) {
+                std::vector<Key> single = { { keys[i].in, {} } };
+                single[0].out.resize(keys[i].out.size());
+                auto job = makeJobs(single);
+
+                err = WrapKeys(mode,
+                               &kek[0],
+                               256,
+                               &job[0],
+                               1,
+                               CpuCipherFeatures::eAesni);
+                EXPECT_EQ(err, ALC_ERROR_NONE);
+                EXPECT_EQ(keys[i].out, single[0].out);
+            }
+
+            // and back
+            std::vector<Key> wrapped(keys.size());
+            for (size_t i = 0; i < keys.size(); i++) {
+                wrapped[i].in = keys[i].out;
+                wrapped[i].out.resize(keys[i].out.size() - 8);
+            }
+            jobs = makeJobs(wrapped);
+
+            err = UnwrapKeys(
+                mode, &kek[0], 256, &jobs[0], jobs.size(), feature);
+            EXPECT_EQ(err, ALC_ERROR_NONE);
+            for (size_t i = 0; i < keys.size(); i++) {
+                wrapped[i].out.resize(jobs[i].kj_dstLen);
+                EXPECT_EQ(wrapped[i].out, keys[i].in);
+            }
+        }
+    }
+}
+
+TEST(KW, IntegrityFailure)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& kat : knownAnswers) {
+            std::vector<Key> keys(5);
+            for (auto& k : keys) {
+                k = { kat.wrapped, std::vector<Uint8>(kat.wrapped.size() - 8) };
+            }
+            keys[1].in[0] ^= 1;
+            keys[3].in.back() ^= 0x80;
+            auto jobs = makeJobs(keys);
+
+            alc_error_t err = UnwrapKeys(kat.mode,
+                                         &kat.kek[0],
+                                         kat.kek.size() * 8,
+                                         &jobs[0],
+                                         jobs.size(),
+                                         feature);
+            EXPECT_EQ(err, ALC_ERROR_TAG_MISMATCH);
+            for (size_t i = 0; i < keys.size(); i++) {
+                if (i == 1 || i == 3) {
+                    EXPECT_EQ(jobs[i].kj_err, ALC_ERROR_TAG_MISMATCH);
+                    EXPECT_EQ(jobs[i].kj_dstLen, 0U);
+                    // nothing of a rejected key is left in the output
+                    EXPECT_EQ(keys[i].out,
+                              std::vector<Uint8>(keys[i].out.size()));
+                } else {
+                    EXPECT_EQ(jobs[i].kj_err, ALC_ERROR_NONE);
+                    keys[i].out.resize(jobs[i].kj_dstLen);
+                    EXPECT_EQ(keys[i].out, kat.key);
+                }
+            }
+        }
+    }
+}
+
+TEST(KW, InPlace)
+{
+    const KnownAnswer& kat = knownAnswers[2];
+
+    std::vector<Uint8> buf(kat.wrapped.size());
+    std::copy(kat.key.begin(), kat.key.end(), buf.begin());
+
+    alc_key_wrap_job_t job = {};
+    job.kj_src             = &buf[0];
+    job.kj_srcLen          = kat.key.size();
+    job.kj_dst             = &buf[0];
+
+    alc_error_t err = alcp_cipher_key_wrap(
+        kat.mode, &kat.kek[0], kat.kek.size() * 8, &job, 1);
+    EXPECT_EQ(err, ALC_ERROR_NONE);
+    EXPECT_EQ(buf, kat.wrapped);
+
+    job.kj_srcLen = buf.size();
+    err           = alcp_cipher_key_unwrap(
+        kat.mode, &kat.kek[0], kat.kek.size() * 8, &job, 1);
+    EXPECT_EQ(err, ALC_ERROR_NONE);
+    buf.resize(job.kj_dstLen);
+    EXPECT_EQ(buf, kat.key);
+}
+
+TEST(KW, InvalidJobs)
+{
+    const KnownAnswer& kat = knownAnswers[0];
+
+    std::vector<Key> keys(2);
+    for (auto& k : keys) {
+        k = { kat.key, std::vector<Uint8>(kat.wrapped.size()) };
+    }
+    auto jobs = makeJobs(keys);
+
+    // KW is on whole 64-bit blocks
+    jobs[1].kj_srcLen = kat.key.size() - 1;
+    EXPECT_EQ(alcp_cipher_key_wrap(
+                  ALC_KEY_WRAP_KW, &kat.kek[0], 128, &jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+    // nothing is written when the batch is rejected
+    EXPECT_EQ(keys[0].out, std::vector<Uint8>(kat.wrapped.size()));
+
+    // but KWP is not
+    EXPECT_EQ(alcp_cipher_key_wrap(
+                  ALC_KEY_WRAP_KWP, &kat.kek[0], 128, &jobs[0], jobs.size()),
+              ALC_ERROR_NONE);
+
+    jobs[1].kj_srcLen = 8;
+    EXPECT_EQ(alcp_cipher_key_wrap(
+                  ALC_KEY_WRAP_KW, &kat.kek[0], 128, &jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(alcp_cipher_key_unwrap(
+                  ALC_KEY_WRAP_KW, &kat.kek[0], 128, &jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_SIZE);
+
+    jobs[1].kj_srcLen = kat.key.size();
+    EXPECT_EQ(alcp_cipher_key_wrap(
+                  ALC_KEY_WRAP_KW, &kat.kek[0], 100, &jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_ARG);
+
+    jobs[1].kj_dst = nullptr;
+    EXPECT_EQ(alcp_cipher_key_wrap(
+                  ALC_KEY_WRAP_KW, &kat.kek[0], 128, &jobs[0], jobs.size()),
+              ALC_ERROR_INVALID_ARG);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,441 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+using alcp::cipher::CipherFactory;
+using alcp::cipher::iCipherAead;
+namespace alcp::cipher::unittest::ocb {
+std::vector<Uint8>
+parseHex(const std::string& in)
+{
+    std::vector<Uint8> out;
+    for (Uint64 i = 0; i + 1 < in.size(); i += 2) {
+        out.push_back(std::stoi(in.substr(i, 2), nullptr, 16));
+    }
+    return out;
+}
+
+struct OcbVector
+{
+    const char* nonce;
+    const char* aad;
+    const char* plainText;
+    const char* cipherText;
+    const char* tag;
+};
+
+// RFC 7253 Appendix A, K = 000102030405060708090A0B0C0D0E0F
+std::vector<OcbVector> vectors = {
+    { "BBAA99887766554433221100",
+      "",
+      "",
+      "",
+      "785407BFFFC8AD9EDCC5520AC9111EE6" },
+    { "BBAA99887766554433221101",
+      "0001020304050607",
+      "0001020304050607",
+      "6820B3657B6F615A",
+      "5725BDA0D3B4EB3A257C9AF1F8F03009" },
+    { "BBAA99887766554433221102",
+      "0001020304050607",
+      "",
+      "",
+      "81017F8203F081277152FADE694A0A00" },
+    { "BBAA99887766554433221103",
+      "",
+      "0001020304050607",
+      "45DD69F8F5AAE724",
+      "14054CD1F35D82760B2CD00D2F99BFA9" },
+};
+
+// RFC 7253 Appendix A iterative test, one entry per key and tag length
+struct IterativeVector
+{
+    const char* name;
+    Uint64      keyLen;
+    Uint64      tagLen;
+    const char* tag;
+};
+
+std::vector<IterativeVector> iterativeVectors = {
+    { "aes-ocb-128", 16, 16, "67E944D23256C5E0B6C61FA22FDF1EA2" },
+    { "aes-ocb-192", 24, 16, "F673F2C3E7174AAE7BAE986CA9F29E17" },
+    { "aes-ocb-256", 32, 16, "D90EB8E9C977C88B79DD793D7FFA161C" },
+    { "aes-ocb-128", 16, 12, "77A3D8E73589158D25D01209" },
+    { "aes-ocb-128", 16, 8, "192C9B7BD90BA06A" },
+};
+
+// Long message which runs through the wide kernels for both the message and
+// the AAD. Key is 00 01 02 ..., nonce 64 65 .. 6f, plaintext[i] = i,
+// aad[i] = 7 * i.
+struct LongVector
+{
+    const char* name;
+    Uint64      keyLen;
+    const char* firstBlock;
+    const char* lastBlock;
+    const char* tag;
+};
+
+std::vector<LongVector> longVectors = {
+    { "aes-ocb-128",
+      16,
+      "8f3827b3bf1c7bec549847a70079cf9c",
+      "8e253b3682af5929f4ed0d4ea14ea2d8",
+      "25c1f9c5ce414b6c1610782a89f2561c" },
+    { "aes-ocb-192",
+      24,
+      "eddec29a93331f8b04ec70d479d002bc",
+      "6e3f93feee8c7714bad9bbff4f5771de",
+      "08eab2c650a0b2d21e9b1f18502cf91e" },
+    { "aes-ocb-256",
+      32,
+      "2b2f3d7dce793e23376d9cabb7903065",
+      "b20297b102df79e1d77ed2f9efbcecb1",
+      "494af77de07d4f1457c6ec0cf5605aa8" },
+};
+
+alc_error_t
+ocbEncrypt(iCipherAead*              ocb,
+           const std::vector<Uint8>& key,
+           const std::vector<Uint8>& nonce,
+           const std::vector<Uint8>& aad,
+           const std::vector<Uint8>& input,
+           std::vector<Uint8>&       output,
+           std::vector<Uint8>&       tag,
+           Uint64                    tagLen = 16)
+{
+    alc_error_t err =
+        ocb->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    err = ocb->setTagLength(tagLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (!aad.empty()) {
+        err = ocb->setAad(&aad[0], aad.size());
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+    output.resize(input.size());
+    err = ocb->encrypt(input.data(), output.data(), input.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    tag.resize(tagLen);
+    return ocb->getTag(&tag[0], tag.size());
+}
+
+// Tag verification is left to the caller, like GCM
+alc_error_t
+ocbDecrypt(iCipherAead*              ocb,
+           const std::vector<Uint8>& key,
+           const std::vector<Uint8>& nonce,
+           const std::vector<Uint8>& aad,
+           const std::vector<Uint8>& input,
+           std::vector<Uint8>&       output,
+           std::vector<Uint8>&       tag,
+           Uint64                    tagLen = 16)
+{
+    alc_error_t err =
+        ocb->init(&key[0], key.size() * 8, &nonce[0], nonce.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    err = ocb->setTagLength(tagLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (!aad.empty()) {
+        err = ocb->setAad(&aad[0], aad.size());
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+    }
+    output.resize(input.size());
+    err = ocb->decrypt(input.data(), output.data(), input.size());
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    tag.resize(tagLen);
+    return ocb->getTag(&tag[0], tag.size());
+}
+} // namespace alcp::cipher::unittest::ocb
+
+using namespace alcp::cipher::unittest;
+using namespace alcp::cipher::unittest::ocb;
+
+TEST(OCB, creation)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        EXPECT_NE(alcpCipher.create("aes-ocb-128", feature), nullptr);
+        EXPECT_NE(alcpCipher.create("aes-ocb-192", feature), nullptr);
+        EXPECT_NE(alcpCipher.create("aes-ocb-256", feature), nullptr);
+    }
+}
+
+TEST(OCB, KnownAnswer)
+{
+    std::vector<Uint8> key(16);
+    for (Uint64 i = 0; i < key.size(); i++) {
+        key[i] = i;
+    }
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : vectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead* ocb = alcpCipher.create("aes-ocb-128", feature);
+            ASSERT_NE(ocb, nullptr);
+
+            auto nonce = parseHex(v.nonce), aad = parseHex(v.aad);
+            auto pt    = parseHex(v.plainText);
+            std::vector<Uint8> ct, tag, back, backTag;
+
+            EXPECT_EQ(ocbEncrypt(ocb, key, nonce, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ct, parseHex(v.cipherText));
+            EXPECT_EQ(tag, parseHex(v.tag));
+
+            EXPECT_EQ(ocbDecrypt(ocb, key, nonce, aad, ct, back, backTag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(back, pt);
+            EXPECT_EQ(backTag, tag);
+        }
+    }
+}
+
+TEST(OCB, Iterative)
+{
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : iterativeVectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead*               ocb = alcpCipher.create(v.name, feature);
+            ASSERT_NE(ocb, nullptr);
+
+            std::vector<Uint8> key(v.keyLen), nonce(12), c, ct, tag;
+            key.back() = v.tagLen * 8;
+
+            auto step = [&](Uint64                    n,
+                            const std::vector<Uint8>& a,
+                            const std::vector<Uint8>& p) {
+                nonce[10] = n >> 8;
+                nonce[11] = n & 0xff;
+                EXPECT_EQ(ocbEncrypt(ocb, key, nonce, a, p, ct, tag, v.tagLen),
+                          ALC_ERROR_NONE);
+                c.insert(c.end(), ct.begin(), ct.end());
+                c.insert(c.end(), tag.begin(), tag.end());
+            };
+            for (Uint64 i = 0; i < 128; i++) {
+                std::vector<Uint8> s(i), empty;
+                step(3 * i + 1, s, s);
+                step(3 * i + 2, empty, s);
+                step(3 * i + 3, s, empty);
+            }
+            nonce[10] = 385 >> 8;
+            nonce[11] = 385 & 0xff;
+            EXPECT_EQ(ocbEncrypt(ocb, key, nonce, c, {}, ct, tag, v.tagLen),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(tag, parseHex(v.tag)) << v.name << " " << v.tagLen;
+        }
+    }
+}
+
+TEST(OCB, LongMessage)
+{
+    std::vector<Uint8> nonce(12), pt(1031), aad(301);
+    for (Uint64 i = 0; i < nonce.size(); i++) {
+        nonce[i] = 100 + i;
+    }
+    for (Uint64 i = 0; i < pt.size(); i++) {
+        pt[i] = i & 0xff;
+    }
+    for (Uint64 i = 0; i < aad.size(); i++) {
+        aad[i] = (7 * i) & 0xff;
+    }
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        for (auto& v : longVectors) {
+            CipherFactory<iCipherAead> alcpCipher;
+            iCipherAead*               ocb = alcpCipher.create(v.name, feature);
+            ASSERT_NE(ocb, nullptr);
+
+            std::vector<Uint8> key(v.keyLen), ct, tag, back, backTag;
+            for (Uint64 i = 0; i < key.size(); i++) {
+                key[i] = i;
+            }
+            EXPECT_EQ(ocbEncrypt(ocb, key, nonce, aad, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(std::vector<Uint8>(ct.begin(), ct.begin() + 16),
+                      parseHex(v.firstBlock));
+            EXPECT_EQ(std::vector<Uint8>(ct.end() - 16, ct.end()),
+                      parseHex(v.lastBlock));
+            EXPECT_EQ(tag, parseHex(v.tag));
+
+            EXPECT_EQ(ocbDecrypt(ocb, key, nonce, aad, ct, back, backTag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(back, pt);
+            EXPECT_EQ(backTag, tag);
+        }
+    }
+}
+
+// Every length up to a few wide iterations must agree with the AES-NI path
+TEST(OCB, MatchesAesni)
+{
+    Randomize          rng(13);
+    std::vector<Uint8> key(32), nonce(12), input(700), aad(400);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(nonce);
+    rng.getRandomBytes(input);
+    rng.getRandomBytes(aad);
+
+    CipherFactory<iCipherAead> refFactory;
+    iCipherAead*               ref =
+        refFactory.create("aes-ocb-256", CpuCipherFeatures::eAesni);
+    ASSERT_NE(ref, nullptr);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference
+            || feature == CpuCipherFeatures::eAesni) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        iCipherAead* ocb = alcpCipher.create("aes-ocb-256", feature);
+        ASSERT_NE(ocb, nullptr);
+
+        for (Uint64 len = 0; len <= input.size(); len += 7) {
+            std::vector<Uint8> pt(input.begin(), input.begin() + len);
+            std::vector<Uint8> a(aad.begin(), aad.begin() + len / 2);
+            std::vector<Uint8> ct, tag, refCt, refTag;
+
+            EXPECT_EQ(ocbEncrypt(ref, key, nonce, a, pt, refCt, refTag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ocbEncrypt(ocb, key, nonce, a, pt, ct, tag),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(ct, refCt) << "len " << len;
+            EXPECT_EQ(tag, refTag) << "len " << len;
+        }
+    }
+}
+
+// Chunked updates start the wide kernels at unaligned block indices
+TEST(OCB, MultiUpdate)
+{
+    Randomize          rng(17);
+    std::vector<Uint8> key(16), nonce(12), pt(1000), aad(500);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(nonce);
+    rng.getRandomBytes(pt);
+    rng.getRandomBytes(aad);
+
+    for (CpuCipherFeatures feature : getSupportedFeatures()) {
+        if (feature == CpuCipherFeatures::eReference) {
+            continue;
+        }
+        CipherFactory<iCipherAead> alcpCipher;
+        iCipherAead* ocb = alcpCipher.create("aes-ocb-128", feature);
+        ASSERT_NE(ocb, nullptr);
+
+        std::vector<Uint8> ct, tag;
+        ASSERT_EQ(ocbEncrypt(ocb, key, nonce, aad, pt, ct, tag),
+                  ALC_ERROR_NONE);
+
+        for (Uint64 chunk : { 16, 48, 112, 272 }) {
+            std::vector<Uint8> out(pt.size()), outTag(16);
+            ASSERT_EQ(ocb->init(&key[0], 128, &nonce[0], nonce.size()),
+                      ALC_ERROR_NONE);
+            for (Uint64 off = 0; off < aad.size(); off += chunk) {
+                Uint64 len = std::min(chunk, aad.size() - off);
+                EXPECT_EQ(ocb->setAad(&aad[off], len), ALC_ERROR_NONE);
+            }
+            for (Uint64 off = 0; off < pt.size(); off += chunk) {
+                Uint64 len = std::min(chunk, pt.size() - off);
+                EXPECT_EQ(ocb->encrypt(&pt[off], &out[off], len),
+                          ALC_ERROR_NONE);
+            }
+            EXPECT_EQ(ocb->getTag(&outTag[0], outTag.size()), ALC_ERROR_NONE);
+            EXPECT_EQ(out, ct) << "chunk " << chunk;
+            EXPECT_EQ(outTag, tag) << "chunk " << chunk;
+        }
+    }
+}
+
+TEST(OCB, InvalidState)
+{
+    CipherFactory<iCipherAead> alcpCipher;
+    iCipherAead*               ocb = alcpCipher.create("aes-ocb-128");
+    ASSERT_NE(ocb, nullptr);
+
+    std::vector<Uint8> key(16), nonce(12), pt(40), ct(40), tag(16);
+
+    // nonce is limited to 15 bytes
+    EXPECT_NE(ocb->init(&key[0], 128, &nonce[0], 16), ALC_ERROR_NONE);
+    ASSERT_EQ(ocb->init(&key[0], 128, &nonce[0], nonce.size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(ocb->setTagLength(17), ALC_ERROR_INVALID_SIZE);
+
+    // a partial block ends the message
+    EXPECT_EQ(ocb->encrypt(&pt[0], &ct[0], 20), ALC_ERROR_NONE);
+    EXPECT_EQ(ocb->encrypt(&pt[20], &ct[20], 20), ALC_ERROR_BAD_STATE);
+
+    // the tag length is fixed once data has been processed
+    EXPECT_EQ(ocb->setTagLength(8), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(ocb->getTag(&tag[0], 8), ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(ocb->getTag(&tag[0], 16), ALC_ERROR_NONE);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
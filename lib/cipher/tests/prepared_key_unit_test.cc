@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alcp/cipher.hh"
+#include "alcp/cipher/prepared_key.hh"
+#include "dispatcher.hh"
+#include "randomize.hh"
+
+namespace alcp::cipher::unittest::prepared_key {
+
+// Releases the reference held by the test when the scope ends
+struct KeyRef
+{
+    PreparedKey* m_pKey = nullptr;
+    ~KeyRef()
+    {
+        if (m_pKey != nullptr) {
+            m_pKey->release();
+        }
+    }
+};
+
+static std::string
+modeName(CipherMode mode)
+{
+    switch (mode) {
+        case CipherMode::eAesECB:
+            return "aes-ecb-";
+        case CipherMode::eAesCBC:
+            return "aes-cbc-";
+        case CipherMode::eAesOFB:
+            return "aes-ofb-";
+        case CipherMode::eAesCTR:
+            return "aes-ctr-";
+        case CipherMode::eAesCFB:
+            return "aes-cfb-";
+        case CipherMode::eAesXTS:
+            return "aes-xts-";
+        case CipherMode::eAesGCM:
+            return "aes-gcm-";
+        case CipherMode::eAesCCM:
+            return "aes-ccm-";
+        default:
+            return "aes-ocb-";
+    }
+}
+
+// Encrypt a message with a key set either way, ciphertext followed by tag
+static std::vector<Uint8>
+sealAead(iCipherAead*              aead,
+         const std::vector<Uint8>& iv,
+         const std::vector<Uint8>& aad,
+         const std::vector<Uint8>& in)
+{
+    std::vector<Uint8> out(in.size() + 16);
+    EXPECT_EQ(aead->setAad(&aad[0], aad.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(aead->encrypt(&in[0], &out[0], in.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(aead->getTag(&out[in.size()], 16), ALC_ERROR_NONE);
+    return out;
+}
+
+TEST(PreparedKey, MatchesRawKey)
+{
+    Randomize rng(11);
+
+    for (CipherMode mode : { CipherMode::eAesECB,
+                             CipherMode::eAesCBC,
+                             CipherMode::eAesOFB,
+                             CipherMode::eAesCTR,
+                             CipherMode::eAesCFB,
+                             CipherMode::eAesXTS }) {
+        for (Uint64 keyLen : { 128, 192, 256 }) {
+            if (mode == CipherMode::eAesXTS && keyLen == 192) {
+                continue;
+            }
+            // XTS takes the tweak key after the data key
+            Uint64 keyBytes = mode == CipherMode::eAesXTS ? keyLen / 4
+                                                          : keyLen / 8;
+            std::string        name = modeName(mode) + std::to_string(keyLen);
+            std::vector<Uint8> key(keyBytes), iv(16), in(16 * 37);
+            rng.getRandomBytes(key);
+            rng.getRandomBytes(iv);
+            rng.getRandomBytes(in);
+
+            KeyRef ref;
+            ASSERT_EQ(PreparedKey::create(mode, &key[0], keyLen, &ref.m_pKey),
+                      ALC_ERROR_NONE);
+
+            for (CpuCipherFeatures feature : getSupportedFeatures()) {
+                CipherFactory<iCipher> rawFactory, preparedFactory;
+                auto raw      = rawFactory.create(name, feature);
+                auto prepared = preparedFactory.create(name, feature);
+                ASSERT_NE(raw, nullptr) << name;
+                ASSERT_NE(prepared, nullptr) << name;
+
+                std::vector<Uint8> expected(in.size()), out(in.size());
+                EXPECT_EQ(raw->init(&key[0], keyLen, &iv[0], iv.size()),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(raw->encrypt(&in[0], &expected[0], in.size()),
+                          ALC_ERROR_NONE);
+
+                EXPECT_EQ(prepared->initWithKey(ref.m_pKey, &iv[0], iv.size()),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(prepared->encrypt(&in[0], &out[0], in.size()),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(out, expected) << name;
+
+                // decrypt uses the shared decryption round keys
+                std::vector<Uint8> back(in.size());
+                EXPECT_EQ(prepared->initWithKey(ref.m_pKey, &iv[0], iv.size()),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(prepared->decrypt(&out[0], &back[0], out.size()),
+                          ALC_ERROR_NONE);
+                EXPECT_EQ(back, in) << name;
+            }
+        }
+    }
+}
+
+TEST(PreparedKey, AeadMatchesRawKey)
+{
+    Randomize rng(12);
+
+    for (CipherMode mode :
+         { CipherMode::eAesGCM, CipherMode::eAesCCM, CipherMode::eAesOCB }) {
+        for (Uint64 keyLen : { 128, 192, 256 }) {
+            std::string name = modeName(mode) + std::to_string(keyLen);
+            std::vector<Uint8> key(keyLen / 8), iv(12), aad(20);
+            rng.getRandomBytes(key);
+            rng.getRandomBytes(iv);
+            rng.getRandomBytes(aad);
+
+            KeyRef ref;
+            ASSERT_EQ(PreparedKey::create(mode, &key[0], keyLen, &ref.m_pKey),
+                      ALC_ERROR_NONE);
+
+            for (CpuCipherFeatures feature : getSupportedFeatures()) {
+                if (mode == CipherMode::eAesGCM
+                    && feature == CpuCipherFeatures::eReference) {
+                    continue;
+                }
+                CipherFactory<iCipherAead> rawFactory, preparedFactory;
+                auto raw      = rawFactory.create(name, feature);
+                auto prepared = preparedFactory.create(name, feature);
+                ASSERT_NE(raw, nullptr) << name;
+                ASSERT_NE(prepared, nullptr) << name;
+                // CCM takes it before the nonce
+                EXPECT_EQ(raw->setTagLength(16), ALC_ERROR_NONE);
+                EXPECT_EQ(prepared->setTagLength(16), ALC_ERROR_NONE);
+
+                // short and long messages, GCM takes the powers of H from
+                // the prepared key once a message is long enough
+                for (Uint64 len : { 16, 100, 512, 4096 }) {
+                    std::vector<Uint8> in(len);
+                    rng.getRandomBytes(in);
+
+                    EXPECT_EQ(raw->init(&key[0], keyLen, &iv[0], iv.size()),
+                              ALC_ERROR_NONE);
+                    auto expected = sealAead(raw, iv, aad, in);
+
+                    EXPECT_EQ(
+                        prepared->initWithKey(ref.m_pKey, &iv[0], iv.size()),
+                        ALC_ERROR_NONE);
+                    auto out = sealAead(prepared, iv, aad, in);
+                    EXPECT_EQ(out, expected) << name << " len " << len;
+                }
+            }
+        }
+    }
+}
+
+TEST(PreparedKey, SharedAcrossThreads)
+{
+    Randomize          rng(13);
+    std::vector<Uint8> key(32), iv(12), aad(16), in(3000);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(iv);
+    rng.getRandomBytes(aad);
+    rng.getRandomBytes(in);
+
+    CipherFactory<iCipherAead> refFactory;
+    auto                       raw = refFactory.create("aes-gcm-256");
+    ASSERT_NE(raw, nullptr);
+    EXPECT_EQ(raw->init(&key[0], 256, &iv[0], iv.size()), ALC_ERROR_NONE);
+    auto expected = sealAead(raw, iv, aad, in);
+
+    PreparedKey* p_key = nullptr;
+    ASSERT_EQ(PreparedKey::create(CipherMode::eAesGCM, &key[0], 256, &p_key),
+              ALC_ERROR_NONE);
+
+    constexpr int                   cThreads = 8;
+    std::vector<std::vector<Uint8>> results(cThreads);
+    std::vector<std::thread>        threads;
+    for (int t = 0; t < cThreads; t++) {
+        threads.emplace_back([&, t] {
+            CipherFactory<iCipherAead> factory;
+            auto                       aead = factory.create("aes-gcm-256");
+            for (int i = 0; i < 50; i++) {
+                aead->initWithKey(p_key, &iv[0], iv.size());
+                results[t] = sealAead(aead, iv, aad, in);
+            }
+        });
+    }
+    // the handles hold their own references from here on
+    for (auto& th : threads) {
+        th.join();
+    }
+    p_key->release();
+
+    for (auto& r : results) {
+        EXPECT_EQ(r, expected);
+    }
+}
+
+TEST(PreparedKey, OutlivesCallerReference)
+{
+    Randomize          rng(14);
+    std::vector<Uint8> key(16), iv(16), in(64), expected(64), out(64);
+    rng.getRandomBytes(key);
+    rng.getRandomBytes(iv);
+    rng.getRandomBytes(in);
+
+    CipherFactory<iCipher> rawFactory, preparedFactory;
+    auto                   raw      = rawFactory.create("aes-ctr-128");
+    auto                   prepared = preparedFactory.create("aes-ctr-128");
+    ASSERT_NE(raw, nullptr);
+    ASSERT_NE(prepared, nullptr);
+    EXPECT_EQ(raw->init(&key[0], 128, &iv[0], iv.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(raw->encrypt(&in[0], &expected[0], in.size()), ALC_ERROR_NONE);
+
+    PreparedKey* p_key = nullptr;
+    ASSERT_EQ(PreparedKey::create(CipherMode::eAesCTR, &key[0], 128, &p_key),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(prepared->initWithKey(p_key, &iv[0], iv.size()),
+              ALC_ERROR_NONE);
+    p_key->release();
+
+    EXPECT_EQ(prepared->encrypt(&in[0], &out[0], in.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(out, expected);
+
+    // a raw key replaces the prepared one
+    EXPECT_EQ(prepared->init(&key[0], 128, &iv[0], iv.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(prepared->encrypt(&in[0], &out[0], in.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(out, expected);
+}
+
+TEST(PreparedKey, InvalidUse)
+{
+    std::vector<Uint8> key(64, 0x5a), iv(16, 0xa5);
+    PreparedKey*       p_key = nullptr;
+
+    EXPECT_EQ(PreparedKey::create(CipherMode::eAesSIV, &key[0], 128, &p_key),
+              ALC_ERROR_NOT_SUPPORTED);
+    EXPECT_EQ(
+        PreparedKey::create(CipherMode::eCHACHA20, &key[0], 256, &p_key),
+        ALC_ERROR_NOT_SUPPORTED);
+    EXPECT_EQ(PreparedKey::create(CipherMode::eAesCTR, &key[0], 100, &p_key),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(PreparedKey::create(CipherMode::eAesCTR, nullptr, 128, &p_key),
+              ALC_ERROR_INVALID_ARG);
+
+    KeyRef ctrKey, xtsKey;
+    ASSERT_EQ(
+        PreparedKey::create(CipherMode::eAesCTR, &key[0], 128, &ctrKey.m_pKey),
+        ALC_ERROR_NONE);
+    ASSERT_EQ(
+        PreparedKey::create(CipherMode::eAesXTS, &key[0], 128, &xtsKey.m_pKey),
+        ALC_ERROR_NONE);
+
+    CipherFactory<iCipher> ctrFactory, xtsFactory;
+    auto                   ctr = ctrFactory.create("aes-ctr-256");
+    auto                   xts = xtsFactory.create("aes-xts-128");
+    ASSERT_NE(ctr, nullptr);
+    ASSERT_NE(xts, nullptr);
+
+    // key length of the handle
+    EXPECT_EQ(ctr->initWithKey(ctrKey.m_pKey, &iv[0], iv.size()),
+              ALC_ERROR_INVALID_SIZE);
+    // XTS keys carry a tweak key, other modes have none
+    EXPECT_EQ(xts->initWithKey(ctrKey.m_pKey, &iv[0], iv.size()),
+              ALC_ERROR_INVALID_ARG);
+
+    CipherFactory<iCipherAead> aeadFactory;
+    auto                       siv = aeadFactory.create("aes-siv-128");
+    ASSERT_NE(siv, nullptr);
+    EXPECT_EQ(siv->initWithKey(ctrKey.m_pKey, &iv[0], iv.size()),
+              ALC_ERROR_NOT_SUPPORTED);
+}
+
+} // namespace alcp::cipher::unittest::prepared_key
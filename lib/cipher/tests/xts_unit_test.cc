@@ -914,6 +914,164 @@ TEST(XTS, decrypt_huge_multi_update)
     }
 }
 
+TEST(XTS, encrypt_sectors_matches_per_sector)
+{
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        for (Uint64 keyLen : { 128, 256 }) {
+            // 4096 byte sectors and one with ciphertext stealing, more
+            // sectors than a single tweak pass holds
+            for (Uint64 unitSize : { 4096, 520 }) {
+                Uint64 numSectors = 70;
+
+                std::vector<Uint8> key(keyLen / 4);
+                std::vector<Uint8> plainText(numSectors * unitSize);
+                std::vector<Uint8> batchOut(plainText.size(), 0);
+                std::vector<Uint8> singleOut(plainText.size(), 0);
+                fillRandom(key);
+                fillRandom(plainText);
+
+                std::string name = "aes-xts-" + std::to_string(keyLen);
+
+                auto batchFactory  = new CipherFactory<iCipherSeg>;
+                auto batch         = batchFactory->create(name, feature);
+                auto singleFactory = new CipherFactory<iCipherSeg>;
+                auto single        = singleFactory->create(name, feature);
+                if (batch == nullptr || single == nullptr) {
+                    delete batchFactory;
+                    delete singleFactory;
+                    FAIL();
+                }
+
+                // sparse and unordered data unit numbers
+                std::vector<alc_xts_sector_t> sectors(numSectors);
+                for (Uint64 i = 0; i < numSectors; i++) {
+                    Uint64 dataUnit = (i * 0x9e3779b97f4a7c15ULL) ^ i;
+
+                    sectors[i] = { dataUnit,
+                                   &plainText[i * unitSize],
+                                   &batchOut[i * unitSize] };
+
+                    Uint8 iv[16] = {};
+                    for (int b = 0; b < 8; b++) {
+                        iv[b] = static_cast<Uint8>(dataUnit >> (8 * b));
+                    }
+                    alc_error_t err = single->init(key.data(), keyLen, iv, 16);
+                    ASSERT_EQ(err, ALC_ERROR_NONE);
+                    err = single->encrypt(&plainText[i * unitSize],
+                                          &singleOut[i * unitSize],
+                                          unitSize);
+                    ASSERT_EQ(err, ALC_ERROR_NONE);
+                }
+
+                alc_error_t err = batch->init(key.data(), keyLen, nullptr, 0);
+                EXPECT_EQ(err, ALC_ERROR_NONE);
+                err = batch->encryptSectors(
+                    sectors.data(), numSectors, unitSize);
+                EXPECT_EQ(err, ALC_ERROR_NONE);
+                EXPECT_EQ(batchOut, singleOut);
+
+                // decrypt in place
+                for (Uint64 i = 0; i < numSectors; i++) {
+                    sectors[i].xs_src = &batchOut[i * unitSize];
+                }
+                err = batch->decryptSectors(
+                    sectors.data(), numSectors, unitSize);
+                EXPECT_EQ(err, ALC_ERROR_NONE);
+                EXPECT_EQ(batchOut, plainText);
+
+                // and encrypt in place again
+                err = batch->encryptSectors(
+                    sectors.data(), numSectors, unitSize);
+                EXPECT_EQ(err, ALC_ERROR_NONE);
+                EXPECT_EQ(batchOut, singleOut);
+
+                delete batchFactory;
+                delete singleFactory;
+            }
+        }
+    }
+}
+
+TEST(XTS, encrypt_sectors_invalid)
+{
+    std::vector<Uint8> key(32, 0x5a);
+    std::vector<Uint8> buf(512, 0);
+
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        auto alcpCipher = new CipherFactory<iCipherSeg>;
+        auto xts        = alcpCipher->create("aes-xts-128", feature);
+
+        if (xts == nullptr) {
+            delete alcpCipher;
+            FAIL();
+        }
+        alc_xts_sector_t sector = { 1, buf.data(), buf.data() };
+
+        // key not set
+        EXPECT_EQ(xts->encryptSectors(&sector, 1, 512), ALC_ERROR_BAD_STATE);
+
+        EXPECT_EQ(xts->init(key.data(), 128, nullptr, 0), ALC_ERROR_NONE);
+        EXPECT_EQ(xts->encryptSectors(&sector, 1, 15), ALC_ERROR_INVALID_DATA);
+        EXPECT_EQ(xts->encryptSectors(nullptr, 1, 512), ALC_ERROR_INVALID_ARG);
+
+        sector.xs_dst = nullptr;
+        EXPECT_EQ(xts->decryptSectors(&sector, 1, 512), ALC_ERROR_INVALID_ARG);
+
+        delete alcpCipher;
+    }
+}
+
+TEST(XTS, parallel_matches_serial)
+{
+    std::vector<Uint8> key(64);
+    std::vector<Uint8> iv(16);
+    fillRandom(key);
+    fillRandom(iv);
+
+    std::vector<CpuCipherFeatures> cpu_features = getSupportedFeatures();
+    for (CpuCipherFeatures feature : cpu_features) {
+        // whole chunks, a last chunk of whole blocks and a last chunk
+        // carrying a partial block
+        for (Uint64 len : { 1 << 20, (1 << 20) + 48, (1 << 20) + 5 }) {
+            std::vector<Uint8> plainText(len);
+            std::vector<Uint8> serialOut(len);
+            std::vector<Uint8> parallelOut(len);
+            fillRandom(plainText);
+
+            auto serialCipher   = new CipherFactory<iCipher>;
+            auto serial         = serialCipher->create("aes-xts-256", feature);
+            auto parallelCipher = new CipherFactory<iCipher>;
+            auto parallel = parallelCipher->create("aes-xts-256", feature);
+            if (serial == nullptr || parallel == nullptr) {
+                delete serialCipher;
+                delete parallelCipher;
+                FAIL();
+            }
+            EXPECT_EQ(parallel->setParallelism(4, 16 * 1024), ALC_ERROR_NONE);
+
+            EXPECT_EQ(serial->init(&key[0], 256, &iv[0], 16), ALC_ERROR_NONE);
+            EXPECT_EQ(parallel->init(&key[0], 256, &iv[0], 16),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(serial->encrypt(&plainText[0], &serialOut[0], len),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(parallel->encrypt(&plainText[0], &parallelOut[0], len),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(serialOut, parallelOut);
+
+            // in place
+            EXPECT_EQ(parallel->init(nullptr, 0, &iv[0], 16), ALC_ERROR_NONE);
+            EXPECT_EQ(parallel->decrypt(&parallelOut[0], &parallelOut[0], len),
+                      ALC_ERROR_NONE);
+            EXPECT_EQ(parallelOut, plainText);
+
+            delete serialCipher;
+            delete parallelCipher;
+        }
+    }
+}
+
 // FIXME: Need to bring back this testing
 #if 1
 
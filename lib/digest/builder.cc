@@ -36,20 +36,30 @@
 #include "alcp/digest/sha3.hh"
 #include "alcp/digest/sha512.hh"
 
+#include <memory>
+#include <utility>
+
 namespace alcp::digest {
 
 using Context = alcp::digest::Context;
 
-/* FIXME: Disabling temporarily to fix a compilation error while using AOCC */
-#if 0
-static std::pmr::synchronized_pool_resource s_digest_pool{};
-
-std::pmr::synchronized_pool_resource&
-GetDefaultDigestPool()
+// Digest objects are constructed in the storage following the Context in the
+// handle, so hashing a message does not cost an allocation
+template<typename ALGONAME, typename... ARGS>
+static ALGONAME*
+__construct_in_ctx(Context& ctx, ARGS&&... args)
 {
-    return s_digest_pool;
+    static_assert(sizeof(ALGONAME) <= cDigestObjectMaxSize,
+                  "digest object does not fit cDigestObjectMaxSize");
+    static_assert(alignof(ALGONAME) <= cDigestObjectMaxAlign,
+                  "digest object alignment above cDigestObjectMaxAlign");
+
+    void*       p_mem = ctx.storage();
+    std::size_t size  = cContextStorageSize;
+    // cannot fail, the storage has room for the worst case alignment
+    std::align(alignof(ALGONAME), sizeof(ALGONAME), p_mem, size);
+    return new (p_mem) ALGONAME(std::forward<ARGS>(args)...);
 }
-#endif
 
 template<typename DIGESTTYPE>
 static alc_error_t
@@ -105,7 +115,7 @@ __sha_dtor(void* pDigest)
 {
     alc_error_t e  = ALC_ERROR_NONE;
     auto        ap = static_cast<DIGESTTYPE*>(pDigest);
-    delete ap;
+    ap->~DIGESTTYPE();
     return e;
 }
 
@@ -115,7 +125,8 @@ __build_with_copy_sha(Context& srcCtx, Context& destCtx)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
-    auto algo = new ALGONAME(*reinterpret_cast<ALGONAME*>(srcCtx.m_digest));
+    auto algo = __construct_in_ctx<ALGONAME>(
+        destCtx, *reinterpret_cast<ALGONAME*>(srcCtx.m_digest));
     destCtx.m_digest = static_cast<void*>(algo);
 
     destCtx.init         = srcCtx.init;
@@ -134,7 +145,7 @@ __build_sha(Context& ctx)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
-    auto algo     = new ALGONAME();
+    auto algo     = __construct_in_ctx<ALGONAME>(ctx);
     ctx.m_digest  = static_cast<void*>(algo);
     ctx.init      = __sha_init_wrapper<ALGONAME>;
     ctx.update    = __sha_update_wrapper<ALGONAME>;
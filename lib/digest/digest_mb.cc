@@ -0,0 +1,525 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/digest/digest_mb.hh"
+#include "alcp/digest/md5.hh"
+#include "alcp/digest/md5_sha1.hh"
+#include "alcp/digest/sha1.hh"
+#include "alcp/digest/sha2.hh"
+#include "alcp/digest/sha512.hh"
+
+#include "alcp/utils/cpuid.hh"
+#include "alcp/utils/endian.hh"
+
+#include <cstring>
+#include <vector>
+
+namespace alcp::digest {
+
+using utils::CpuId;
+
+// longest block of the supported digests
+static constexpr Uint64 cMbMaxBlockLen = 128;
+
+static constexpr Uint32 cMd5Iv[4] = { 0x67452301, 0xefcdab89, 0x98badcfe,
+                                      0x10325476 };
+
+static constexpr Uint32 cSha1Iv[5] = { 0x67452301, 0xefcdab89, 0x98badcfe,
+                                       0x10325476, 0xc3d2e1f0 };
+
+static constexpr Uint32 cSha224Iv[8] = { 0xc1059ed8, 0x367cd507, 0x3070dd17,
+                                         0xf70e5939, 0xffc00b31, 0x68581511,
+                                         0x64f98fa7, 0xbefa4fa4 };
+
+static constexpr Uint32 cSha256Iv[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                         0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                         0x1f83d9ab, 0x5be0cd19 };
+
+static constexpr Uint64 cSha512Iv[8] = {
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b,
+    0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+    0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+};
+
+static constexpr Uint64 cSha384Iv[8] = {
+    0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17,
+    0x152fecd8f70e5939, 0x67332667ffc00b31, 0x8eb44a8768581511,
+    0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4
+};
+
+static constexpr Uint64 cSha512_256Iv[8] = {
+    0x22312194fc2bf72c, 0x9f555fa3c84c64c2, 0x2393b86b6f53b151,
+    0x963877195940eabd, 0x96283ee2a88effe3, 0xbe5e1e2553863992,
+    0x2b0199fc2c85b8aa, 0x0eb72ddc81c52ca2
+};
+
+static constexpr Uint64 cSha512_224Iv[8] = {
+    0x8c3d37c819544da2, 0x73e1996689dcd4d6, 0x1dfab7ae32ff9c82,
+    0x679dd514582f9fcf, 0x0f6d2b697bd44da8, 0x77e36f7304c48942,
+    0x3f9d85a86a1d36c8, 0x1112e6ad91d692a1
+};
+
+/*
+ * What the driver needs to know about a Merkle-Damgard digest: the message
+ * is followed by 0x80, zeros and its length in bits, which fills the last
+ * cLenBytes of the last block. The digest is the leading digestLen bytes of
+ * the final state.
+ */
+template<typename WORD, Uint32 cStateWords>
+struct DigestMbAlgo
+{
+    using Lanes = DigestMbLanes<WORD, cStateWords>;
+
+    void (*kernel)(Lanes& lanes, Uint64 blocks);
+    Uint32      numLanes;
+    Uint64      blockLen;
+    Uint64      lenBytes;
+    bool        isBigEndian;
+    const WORD* pIv;
+    Uint64      digestLen;
+};
+
+// one message in a lane, the full blocks are read from the message itself,
+// the rest from the padded tail
+struct DigestMbLane
+{
+    const alc_digest_mb_job_t* pJob;
+    Uint64                     blocksLeft;
+    Uint64                     tailBlocks;
+};
+
+static alc_error_t
+validateJobs(const alc_digest_mb_job_t* pJobs,
+             Uint64                     numJobs,
+             Uint64                     digestLen)
+{
+    for (Uint64 i = 0; i < numJobs; i++) {
+        const alc_digest_mb_job_t& job = pJobs[i];
+
+        if (job.dj_digest == nullptr
+            || (job.dj_msg == nullptr && job.dj_msgLen != 0)) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (job.dj_digestLen != digestLen) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+    return ALC_ERROR_NONE;
+}
+
+// returns the number of blocks in tail
+template<typename WORD, Uint32 cStateWords>
+static Uint64
+padTail(const DigestMbAlgo<WORD, cStateWords>& algo,
+        const alc_digest_mb_job_t&             job,
+        Uint8*                                 tail)
+{
+    Uint64 rem    = job.dj_msgLen % algo.blockLen;
+    Uint64 blocks = (rem + 1 + algo.lenBytes <= algo.blockLen) ? 1 : 2;
+    Uint64 bits   = job.dj_msgLen * 8;
+
+    memset(tail, 0, 2 * algo.blockLen);
+    if (rem != 0) {
+        memcpy(tail, job.dj_msg + job.dj_msgLen - rem, rem);
+    }
+    tail[rem] = 0x80;
+
+    // lengths beyond 2^64 bits are not supported, the high bytes of a
+    // longer length field stay zero
+    Uint8* len_field = tail + blocks * algo.blockLen - algo.lenBytes;
+    if (algo.isBigEndian) {
+        bits = utils::ToBigEndian(bits);
+        memcpy(len_field + algo.lenBytes - sizeof(bits), &bits, sizeof(bits));
+    } else {
+        bits = utils::ToLittleEndian(bits);
+        memcpy(len_field, &bits, sizeof(bits));
+    }
+
+    return blocks;
+}
+
+template<typename WORD, Uint32 cStateWords>
+static void
+laneDigest(const DigestMbAlgo<WORD, cStateWords>&  algo,
+           const DigestMbLanes<WORD, cStateWords>& lanes,
+           Uint32                                  l,
+           const alc_digest_mb_job_t&              job)
+{
+    Uint8 out[cStateWords * sizeof(WORD)];
+
+    for (Uint32 i = 0; i < cStateWords; i++) {
+        WORD w = lanes.m_state[i][l];
+        w = algo.isBigEndian ? utils::ToBigEndian(w) : utils::ToLittleEndian(w);
+        memcpy(out + i * sizeof(WORD), &w, sizeof(WORD));
+    }
+    memcpy(job.dj_digest, out, algo.digestLen);
+    memset(out, 0, sizeof(out));
+}
+
+/*
+ * Job manager: a lane takes the next message as soon as it has compressed
+ * the last block of its current one, and the kernel runs for the blocks
+ * left in the shortest active lane.
+ */
+template<typename WORD, Uint32 cStateWords>
+static void
+hashJobs(const DigestMbAlgo<WORD, cStateWords>& algo,
+         const alc_digest_mb_job_t*             pJobs,
+         Uint64                                 numJobs)
+{
+    DigestMbLanes<WORD, cStateWords> lanes;
+    DigestMbLane                     lane[cDigestMbMaxLanes] = {};
+    alignas(64) Uint8 tail[cDigestMbMaxLanes][2 * cMbMaxBlockLen];
+    alignas(64) Uint8 scratch[cMbMaxBlockLen] = {};
+    Uint64            next                    = 0;
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    for (;;) {
+        Uint64 min_blocks = 0;
+
+        for (Uint32 l = 0; l < algo.numLanes; l++) {
+            DigestMbLane& ln = lane[l];
+
+            while (ln.blocksLeft == 0) {
+                if (ln.tailBlocks != 0) {
+                    lanes.m_pData[l] = tail[l];
+                    ln.blocksLeft    = ln.tailBlocks;
+                    ln.tailBlocks    = 0;
+                    continue;
+                }
+                if (ln.pJob != nullptr) {
+                    laneDigest(algo, lanes, l, *ln.pJob);
+                    ln.pJob = nullptr;
+                }
+                if (next == numJobs) {
+                    lanes.m_pData[l] = scratch;
+                    lanes.m_step[l]  = 0;
+                    break;
+                }
+
+                const alc_digest_mb_job_t& job = pJobs[next++];
+                for (Uint32 i = 0; i < cStateWords; i++) {
+                    lanes.m_state[i][l] = algo.pIv[i];
+                }
+                lanes.m_pData[l] = job.dj_msg;
+                lanes.m_step[l]  = algo.blockLen;
+                ln.pJob          = &job;
+                ln.blocksLeft    = job.dj_msgLen / algo.blockLen;
+                ln.tailBlocks    = padTail(algo, job, tail[l]);
+            }
+            if (ln.blocksLeft != 0
+                && (min_blocks == 0 || ln.blocksLeft < min_blocks)) {
+                min_blocks = ln.blocksLeft;
+            }
+        }
+
+        if (min_blocks == 0) {
+            break;
+        }
+
+        algo.kernel(lanes, min_blocks);
+
+        for (Uint32 l = 0; l < algo.numLanes; l++) {
+            if (lane[l].blocksLeft != 0) {
+                lane[l].blocksLeft -= min_blocks;
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+    memset(tail, 0, sizeof(tail));
+}
+
+// one message after the other through the single stream digest
+template<class DIGEST>
+static alc_error_t
+hashSerial(const alc_digest_mb_job_t* pJobs, Uint64 numJobs)
+{
+    DIGEST      digest;
+    alc_error_t err = ALC_ERROR_NONE;
+
+    for (Uint64 i = 0; i < numJobs && err == ALC_ERROR_NONE; i++) {
+        const alc_digest_mb_job_t& job = pJobs[i];
+
+        digest.init();
+        if (job.dj_msgLen != 0) {
+            err = digest.update(job.dj_msg, job.dj_msgLen);
+        }
+        if (err == ALC_ERROR_NONE) {
+            err = digest.finalize(job.dj_digest, job.dj_digestLen);
+        }
+    }
+    return err;
+}
+
+static alc_error_t
+md5Mb(const alc_digest_mb_job_t* pJobs, Uint64 numJobs, DigestMbArch arch)
+{
+    // little endian words and length
+    DigestMbAlgo<Uint32, 4> algo = {
+        nullptr, 0, 64, 8, false, cMd5Iv, ALC_DIGEST_LEN_128 / 8,
+    };
+
+    alc_error_t err = validateJobs(pJobs, numJobs, algo.digestLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    switch (arch) {
+        case DigestMbArch::eAvx512:
+            algo.kernel   = zen4::Md5Mb;
+            algo.numLanes = zen4::cMd5MbLanes;
+            break;
+        case DigestMbArch::eAvx2:
+            algo.kernel   = avx2::Md5Mb;
+            algo.numLanes = avx2::cMd5MbLanes;
+            break;
+        default:
+            return hashSerial<Md5>(pJobs, numJobs);
+    }
+
+    hashJobs(algo, pJobs, numJobs);
+
+    return ALC_ERROR_NONE;
+}
+
+static alc_error_t
+sha1Mb(const alc_digest_mb_job_t* pJobs, Uint64 numJobs, DigestMbArch arch)
+{
+    DigestMbAlgo<Uint32, 5> algo = {
+        nullptr, 0, 64, 8, true, cSha1Iv, ALC_DIGEST_LEN_160 / 8,
+    };
+
+    alc_error_t err = validateJobs(pJobs, numJobs, algo.digestLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    switch (arch) {
+        case DigestMbArch::eAvx512:
+            algo.kernel   = zen4::Sha1Mb;
+            algo.numLanes = zen4::cSha1MbLanes;
+            break;
+        case DigestMbArch::eAvx2:
+            algo.kernel   = avx2::Sha1Mb;
+            algo.numLanes = avx2::cSha1MbLanes;
+            break;
+        default:
+            return hashSerial<Sha1>(pJobs, numJobs);
+    }
+
+    hashJobs(algo, pJobs, numJobs);
+
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * MD5 followed by SHA-1 of every message, each pass through the lanes of
+ * its own batch kernel. The sub jobs write into the two parts of the job
+ * digest.
+ */
+static alc_error_t
+md5Sha1Mb(const alc_digest_mb_job_t* pJobs, Uint64 numJobs, DigestMbArch arch)
+{
+    constexpr Uint64 cMd5Len  = ALC_DIGEST_LEN_128 / 8;
+    constexpr Uint64 cSha1Len = ALC_DIGEST_LEN_160 / 8;
+
+    alc_error_t err = validateJobs(pJobs, numJobs, cMd5Len + cSha1Len);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    if (arch == DigestMbArch::eReference) {
+        return hashSerial<Md5_Sha1>(pJobs, numJobs);
+    }
+
+    std::vector<alc_digest_mb_job_t> md5_jobs(pJobs, pJobs + numJobs);
+    std::vector<alc_digest_mb_job_t> sha1_jobs(pJobs, pJobs + numJobs);
+
+    for (Uint64 i = 0; i < numJobs; i++) {
+        md5_jobs[i].dj_digestLen  = cMd5Len;
+        sha1_jobs[i].dj_digest    = pJobs[i].dj_digest + cMd5Len;
+        sha1_jobs[i].dj_digestLen = cSha1Len;
+    }
+
+    err = md5Mb(md5_jobs.data(), numJobs, arch);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+    return sha1Mb(sha1_jobs.data(), numJobs, arch);
+}
+
+template<alc_digest_len_t digest_len>
+static alc_error_t
+sha256Mb(const alc_digest_mb_job_t* pJobs, Uint64 numJobs, DigestMbArch arch)
+{
+    DigestMbAlgo<Uint32, 8> algo = {
+        nullptr,
+        0,
+        64,
+        8,
+        true,
+        digest_len == ALC_DIGEST_LEN_224 ? cSha224Iv : cSha256Iv,
+        digest_len / 8,
+    };
+
+    alc_error_t err = validateJobs(pJobs, numJobs, algo.digestLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    switch (arch) {
+        case DigestMbArch::eAvx512:
+            algo.kernel   = zen4::Sha256Mb;
+            algo.numLanes = zen4::cSha256MbLanes;
+            break;
+        case DigestMbArch::eAvx2:
+            algo.kernel   = avx2::Sha256Mb;
+            algo.numLanes = avx2::cSha256MbLanes;
+            break;
+        default:
+            return hashSerial<Sha2<digest_len>>(pJobs, numJobs);
+    }
+
+    hashJobs(algo, pJobs, numJobs);
+
+    return ALC_ERROR_NONE;
+}
+
+template<alc_digest_len_t digest_len>
+static alc_error_t
+sha512Mb(const alc_digest_mb_job_t* pJobs, Uint64 numJobs, DigestMbArch arch)
+{
+    const Uint64* p_iv = cSha512Iv;
+    if constexpr (digest_len == ALC_DIGEST_LEN_384) {
+        p_iv = cSha384Iv;
+    } else if constexpr (digest_len == ALC_DIGEST_LEN_256) {
+        p_iv = cSha512_256Iv;
+    } else if constexpr (digest_len == ALC_DIGEST_LEN_224) {
+        p_iv = cSha512_224Iv;
+    }
+
+    // 128 bit length field, the digest may end inside a word (SHA-512/224)
+    DigestMbAlgo<Uint64, 8> algo = {
+        nullptr, 0, 128, 16, true, p_iv, digest_len / 8,
+    };
+
+    alc_error_t err = validateJobs(pJobs, numJobs, algo.digestLen);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    switch (arch) {
+        case DigestMbArch::eAvx512:
+            algo.kernel   = zen4::Sha512Mb;
+            algo.numLanes = zen4::cSha512MbLanes;
+            break;
+        case DigestMbArch::eAvx2:
+            algo.kernel   = avx2::Sha512Mb;
+            algo.numLanes = avx2::cSha512MbLanes;
+            break;
+        default:
+            return hashSerial<Sha2_512<digest_len>>(pJobs, numJobs);
+    }
+
+    hashJobs(algo, pJobs, numJobs);
+
+    return ALC_ERROR_NONE;
+}
+
+alc_error_t
+DigestMb(alc_digest_mode_t          mode,
+         const alc_digest_mb_job_t* pJobs,
+         Uint64                     numJobs,
+         DigestMbArch               arch)
+{
+    if (pJobs == nullptr && numJobs != 0) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    switch (mode) {
+        case ALC_MD5:
+            return md5Mb(pJobs, numJobs, arch);
+        case ALC_SHA1:
+            return sha1Mb(pJobs, numJobs, arch);
+        case ALC_MD5_SHA1:
+            return md5Sha1Mb(pJobs, numJobs, arch);
+        case ALC_SHA2_224:
+            return sha256Mb<ALC_DIGEST_LEN_224>(pJobs, numJobs, arch);
+        case ALC_SHA2_256:
+            return sha256Mb<ALC_DIGEST_LEN_256>(pJobs, numJobs, arch);
+        case ALC_SHA2_384:
+            return sha512Mb<ALC_DIGEST_LEN_384>(pJobs, numJobs, arch);
+        case ALC_SHA2_512:
+            return sha512Mb<ALC_DIGEST_LEN_512>(pJobs, numJobs, arch);
+        case ALC_SHA2_512_224:
+            return sha512Mb<ALC_DIGEST_LEN_224>(pJobs, numJobs, arch);
+        case ALC_SHA2_512_256:
+            return sha512Mb<ALC_DIGEST_LEN_256>(pJobs, numJobs, arch);
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
+    }
+}
+
+DigestMbArch
+getDigestMbArch()
+{
+    DigestMbArch arch = DigestMbArch::eReference;
+
+    if (CpuId::cpuHasAvx2()) {
+        arch = DigestMbArch::eAvx2;
+
+        if (CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_F)
+            && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_DQ)
+            && CpuId::cpuHasAvx512(utils::Avx512Flags::AVX512_BW)) {
+            arch = DigestMbArch::eAvx512;
+        }
+    }
+
+    return arch;
+}
+
+alc_error_t
+DigestMb(alc_digest_mode_t          mode,
+         const alc_digest_mb_job_t* pJobs,
+         Uint64                     numJobs)
+{
+    static const DigestMbArch arch      = getDigestMbArch();
+    static const bool         has_shani = CpuId::cpuHasShani();
+
+    // SHA-NI on a single stream outruns 8 lanes of AVX2 for SHA-256, not for
+    // the cheaper SHA-1 rounds
+    if (arch == DigestMbArch::eAvx2 && has_shani
+        && (mode == ALC_SHA2_224 || mode == ALC_SHA2_256)) {
+        return DigestMb(mode, pJobs, numJobs, DigestMbArch::eReference);
+    }
+
+    return DigestMb(mode, pJobs, numJobs, arch);
+}
+
+} // namespace alcp::digest
@@ -27,22 +27,57 @@
  */
 
 #include "alcp/digest/sha1.hh"
+#include "alcp/digest/shani.hh"
+#include "alcp/utils/bits.hh"
+#include "alcp/utils/copy.hh"
+#include "alcp/utils/cpuid.hh"
+#include "alcp/utils/endian.hh"
+
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <openssl/err.h>
 
 namespace alcp::digest {
 
+using utils::CpuId;
+
+static const Uint32 cSha1Iv[Sha1::cHashSizeWords] = {
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+};
+
 Sha1::Sha1()
 {
+    static bool shani_available = CpuId::cpuHasShani();
+
     m_block_len  = ALC_DIGEST_BLOCK_SIZE_SHA1 / 8;
     m_digest_len = ALC_DIGEST_LEN_160 / 8;
-    m_ctx        = EVP_MD_CTX_new();
-    m_md         = EVP_MD_fetch(NULL, "SHA-1", "provider=default");
+    m_use_shani  = shani_available;
+    if (!m_use_shani) {
+        m_ctx = EVP_MD_CTX_new();
+        m_md  = EVP_MD_fetch(NULL, "SHA-1", "provider=default");
+    }
+}
+
+alc_error_t
+Sha1::processChunk(const Uint8* pSrc, Uint64 len)
+{
+    /* we need len to be multiple of cChunkSize */
+    assert((len & cChunkSizeMask) == 0);
+
+    return shani::ShaUpdate1(m_hash, pSrc, len);
 }
 
 void
 Sha1::init()
 {
+    if (m_use_shani) {
+        utils::CopyBlock(m_hash, cSha1Iv, sizeof(m_hash));
+        m_finished = false;
+        m_msg_len  = 0;
+        m_idx      = 0;
+        return;
+    }
     if (EVP_DigestInit(m_ctx, m_md) != 1) {
         std::cout << "SHA1: Error code in EVP_DigestInit: "
                   << ERR_GET_REASON(ERR_get_error()) << std::endl;
@@ -54,6 +89,42 @@ alc_error_t
 Sha1::update(const Uint8* pBuf, Uint64 size)
 {
     alc_error_t err = ALC_ERROR_NONE;
+    if (m_use_shani) {
+        if (pBuf == nullptr || m_finished) {
+            return ALC_ERROR_INVALID_ARG;
+        }
+        if (size == 0) {
+            return err;
+        }
+        m_msg_len += size;
+
+        if (m_idx) {
+            /* complete the chunk left over from the last call first */
+            Uint64 to_process = std::min(size, cChunkSize - m_idx);
+            utils::CopyBlock(&m_buffer[m_idx], pBuf, to_process);
+            pBuf += to_process;
+            size -= to_process;
+            m_idx += to_process;
+            if (m_idx < cChunkSize) {
+                return err;
+            }
+            err   = processChunk(m_buffer, cChunkSize);
+            m_idx = 0;
+        }
+
+        Uint64 sizeChunk = size & ~cChunkSizeMask;
+        if (sizeChunk) {
+            err = processChunk(pBuf, sizeChunk);
+            pBuf += sizeChunk;
+            size -= sizeChunk;
+        }
+
+        if (size) {
+            utils::CopyBlock(m_buffer, pBuf, size);
+            m_idx = size;
+        }
+        return err;
+    }
     if (EVP_DigestUpdate(m_ctx, pBuf, size) != 1) {
         err = ALC_ERROR_EXISTS;
     }
@@ -67,7 +138,36 @@ Sha1::finalize(Uint8* pBuf, Uint64 size)
     if (size != (160 / 8)) {
         return ALC_ERROR_INVALID_ARG;
     }
-    alc_error_t  err         = ALC_ERROR_NONE;
+    alc_error_t err = ALC_ERROR_NONE;
+    if (m_use_shani) {
+        if (m_finished) {
+            return err;
+        }
+
+        /* same length encoding as SHA-256 */
+        m_buffer[m_idx++] = 0x80;
+
+        Uint64 buf_len =
+            m_idx <= (cChunkSize - 8) ? cChunkSize : sizeof(m_buffer);
+        utils::PadBlock<Uint8>(
+            &m_buffer[m_idx], 0x0, buf_len - m_idx - utils::BytesPerDWord);
+
+        Uint64  len_in_bits = m_msg_len * 8;
+        Uint64* msg_len_ptr =
+            reinterpret_cast<Uint64*>(&m_buffer[buf_len] - sizeof(Uint64));
+        msg_len_ptr[0] = utils::ToBigEndian(len_in_bits);
+
+        err = processChunk(m_buffer, buf_len);
+        if (err != ALC_ERROR_NONE) {
+            return err;
+        }
+
+        utils::CopyBlockWith<Uint32, true>(
+            pBuf, m_hash, m_digest_len, utils::ToBigEndian<Uint32>);
+        m_idx      = 0;
+        m_finished = true;
+        return err;
+    }
     unsigned int output_size = 0;
     if (EVP_DigestFinal_ex(m_ctx, pBuf, &output_size) != 1) {
         err = ALC_ERROR_EXISTS;
@@ -91,6 +191,15 @@ Sha1::Sha1(const Sha1& src)
 {
     m_digest_len = src.m_digest_len;
     m_block_len  = src.m_block_len;
+    m_use_shani  = src.m_use_shani;
+    if (m_use_shani) {
+        m_msg_len  = src.m_msg_len;
+        m_idx      = src.m_idx;
+        m_finished = src.m_finished;
+        memcpy(m_buffer, src.m_buffer, sizeof(m_buffer));
+        memcpy(m_hash, src.m_hash, sizeof(m_hash));
+        return;
+    }
     if (m_md) {
         EVP_MD_free(m_md);
     }
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "alcp/digest/digest_mb.hh"
+#include "alcp/digest/md5.hh"
+#include "alcp/digest/md5_sha1.hh"
+#include "alcp/digest/sha1.hh"
+#include "alcp/digest/sha2.hh"
+#include "alcp/digest/sha512.hh"
+#include "gtest/gtest.h"
+
+namespace {
+using namespace std;
+using namespace alcp::digest;
+
+// lengths around the padding boundaries and long enough that lanes drain
+// at different times
+static const Uint64 MbMsgLens[] = { 0,   1,   3,    55,   56,  63,  64,
+                                    65,  111, 112,  119,  120, 127, 128,
+                                    200, 239, 1000, 4096, 4159, 7,   640,
+                                    333, 64,  2048, 255,  256 };
+
+template<class DIGEST>
+static void
+checkDigestMb(alc_digest_mode_t mode, DigestMbArch arch)
+{
+    const Uint64 cNumJobs   = 3 * std::size(MbMsgLens);
+    const Uint64 cDigestLen = DIGEST().getHashSize();
+
+    std::vector<std::vector<Uint8>>  msg(cNumJobs);
+    std::vector<alc_digest_mb_job_t> jobs(cNumJobs);
+    std::vector<Uint8>               digests(cNumJobs * cDigestLen);
+
+    for (Uint64 i = 0; i < cNumJobs; i++) {
+        msg[i].resize(MbMsgLens[(i * 7) % std::size(MbMsgLens)]);
+        for (Uint64 j = 0; j < msg[i].size(); j++) {
+            msg[i][j] = static_cast<Uint8>(i * 31 + j);
+        }
+        jobs[i] = { msg[i].data(),
+                    msg[i].size(),
+                    digests.data() + i * cDigestLen,
+                    cDigestLen };
+    }
+
+    ASSERT_EQ(DigestMb(mode, jobs.data(), cNumJobs, arch), ALC_ERROR_NONE);
+
+    for (Uint64 i = 0; i < cNumJobs; i++) {
+        DIGEST             digest;
+        std::vector<Uint8> expected(cDigestLen);
+
+        digest.init();
+        if (!msg[i].empty()) {
+            ASSERT_EQ(digest.update(msg[i].data(), msg[i].size()),
+                      ALC_ERROR_NONE);
+        }
+        ASSERT_EQ(digest.finalize(expected.data(), cDigestLen),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(memcmp(expected.data(), jobs[i].dj_digest, cDigestLen), 0)
+            << "job " << i << " len " << msg[i].size();
+    }
+}
+
+static std::vector<DigestMbArch>
+supportedMbArchs()
+{
+    std::vector<DigestMbArch> archs = { DigestMbArch::eReference };
+    DigestMbArch              best  = getDigestMbArch();
+
+    if (best >= DigestMbArch::eAvx2) {
+        archs.push_back(DigestMbArch::eAvx2);
+    }
+    if (best >= DigestMbArch::eAvx512) {
+        archs.push_back(DigestMbArch::eAvx512);
+    }
+    return archs;
+}
+
+TEST(DigestMbTest, md5_matches_single_stream_test)
+{
+    for (DigestMbArch arch : supportedMbArchs()) {
+        checkDigestMb<Md5>(ALC_MD5, arch);
+        checkDigestMb<Md5_Sha1>(ALC_MD5_SHA1, arch);
+    }
+}
+
+TEST(DigestMbTest, sha1_matches_single_stream_test)
+{
+    for (DigestMbArch arch : supportedMbArchs()) {
+        checkDigestMb<Sha1>(ALC_SHA1, arch);
+    }
+}
+
+TEST(DigestMbTest, sha256_matches_single_stream_test)
+{
+    for (DigestMbArch arch : supportedMbArchs()) {
+        checkDigestMb<Sha256>(ALC_SHA2_256, arch);
+        checkDigestMb<Sha224>(ALC_SHA2_224, arch);
+    }
+}
+
+TEST(DigestMbTest, sha512_matches_single_stream_test)
+{
+    for (DigestMbArch arch : supportedMbArchs()) {
+        checkDigestMb<Sha512>(ALC_SHA2_512, arch);
+        checkDigestMb<Sha384>(ALC_SHA2_384, arch);
+        checkDigestMb<Sha512_256>(ALC_SHA2_512_256, arch);
+        checkDigestMb<Sha512_224>(ALC_SHA2_512_224, arch);
+    }
+}
+
+TEST(DigestMbTest, md5_known_answer_test)
+{
+    const string msg = "abc";
+    Uint8        hash[16];
+
+    alc_digest_mb_job_t job = {
+        (const Uint8*)msg.c_str(), msg.size(), hash, sizeof(hash)
+    };
+    ASSERT_EQ(DigestMb(ALC_MD5, &job, 1), ALC_ERROR_NONE);
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (Uint16 i = 0; i < sizeof(hash); ++i) {
+        ss << std::setw(2) << static_cast<unsigned>(hash[i]);
+    }
+    EXPECT_EQ(ss.str(), "900150983cd24fb0d6963f7d28e17f72");
+}
+
+TEST(DigestMbTest, sha1_known_answer_test)
+{
+    const string msg = "abc";
+    Uint8        hash[20];
+
+    alc_digest_mb_job_t job = {
+        (const Uint8*)msg.c_str(), msg.size(), hash, sizeof(hash)
+    };
+    ASSERT_EQ(DigestMb(ALC_SHA1, &job, 1), ALC_ERROR_NONE);
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (Uint16 i = 0; i < sizeof(hash); ++i) {
+        ss << std::setw(2) << static_cast<unsigned>(hash[i]);
+    }
+    EXPECT_EQ(ss.str(), "a9993e364706816aba3e25717850c26c9cd0d89d");
+}
+
+TEST(DigestMbTest, sha256_known_answer_test)
+{
+    const string msg = "abc";
+    Uint8        hash[32];
+
+    alc_digest_mb_job_t job = {
+        (const Uint8*)msg.c_str(), msg.size(), hash, sizeof(hash)
+    };
+    ASSERT_EQ(DigestMb(ALC_SHA2_256, &job, 1), ALC_ERROR_NONE);
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (Uint16 i = 0; i < sizeof(hash); ++i) {
+        ss << std::setw(2) << static_cast<unsigned>(hash[i]);
+    }
+    EXPECT_EQ(ss.str(),
+              "ba7816bf8f01cfea414140de5dae2223"
+              "b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(DigestMbTest, sha512_known_answer_test)
+{
+    const string msg = "abc";
+    Uint8        hash[64];
+
+    alc_digest_mb_job_t job = {
+        (const Uint8*)msg.c_str(), msg.size(), hash, sizeof(hash)
+    };
+    ASSERT_EQ(DigestMb(ALC_SHA2_512, &job, 1), ALC_ERROR_NONE);
+
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (Uint16 i = 0; i < sizeof(hash); ++i) {
+        ss << std::setw(2) << static_cast<unsigned>(hash[i]);
+    }
+    EXPECT_EQ(ss.str(),
+              "ddaf35a193617abacc417349ae204131"
+              "12e6fa4e89a97ea20a9eeee64b55d39a"
+              "2192992a274fc1a836ba3c23a3feebbd"
+              "454d4423643ce80e2a9ac94fa54ca49f");
+}
+
+TEST(DigestMbTest, invalid_job_test)
+{
+    Uint8               hash[64];
+    alc_digest_mb_job_t job = { nullptr, 1, hash, 32 };
+
+    EXPECT_EQ(DigestMb(ALC_SHA2_256, &job, 1), ALC_ERROR_INVALID_ARG);
+
+    job = { nullptr, 0, hash, 31 };
+    EXPECT_EQ(DigestMb(ALC_SHA2_256, &job, 1), ALC_ERROR_INVALID_SIZE);
+
+    job = { nullptr, 0, hash, 32 };
+    EXPECT_EQ(DigestMb(ALC_SHA2_512, &job, 1), ALC_ERROR_INVALID_SIZE);
+
+    job = { nullptr, 0, hash, 16 };
+    EXPECT_EQ(DigestMb(ALC_MD5_SHA1, &job, 1), ALC_ERROR_INVALID_SIZE);
+
+    EXPECT_EQ(DigestMb(ALC_SHA3_256, &job, 1), ALC_ERROR_NOT_SUPPORTED);
+}
+
+} // namespace
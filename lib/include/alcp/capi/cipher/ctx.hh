@@ -28,6 +28,7 @@
 #pragma once
 
 #include "alcp/cipher.h"
+#include "alcp/cipher.hh"
 
 #include <functional>
 
@@ -35,8 +36,8 @@ namespace alcp::cipher {
 
 typedef struct Context
 {
-    void* m_cipher         = nullptr;
-    void* m_cipher_factory = nullptr;
+    // points into the storage following the Context, see cContextSize
+    void* m_cipher = nullptr;
 
     Uint8 destructed;
 
@@ -84,6 +85,14 @@ typedef struct Context
         , finish{ nullptr } {};
 
     ~Context() { destructed = 1; }
+
+    void* storage() { return this + 1; }
 } alcp_cipher_ctx_t;
 
+// A handle context is the Context followed by the storage the cipher object is
+// constructed in, so a request does not allocate
+constexpr Uint64 cContextSize =
+    sizeof(Context) + cCipherObjectMaxSize + cCipherObjectMaxAlign;
+constexpr Uint64 cContextStorageSize = cContextSize - sizeof(Context);
+
 } // namespace alcp::cipher
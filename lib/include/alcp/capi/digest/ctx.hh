@@ -63,8 +63,21 @@ class Context
         finalize     = nullptr;
         shakeSqueeze = nullptr;
     }
+
+    void* storage() { return this + 1; }
 };
 
+// Upper bound of the size and alignment of every digest object the builder
+// creates, checked at compile time by the builder.
+constexpr Uint64 cDigestObjectMaxSize  = 512;
+constexpr Uint64 cDigestObjectMaxAlign = 64;
+
+// A handle context is the Context followed by the storage the digest object is
+// constructed in, so a request does not allocate
+constexpr Uint64 cContextSize =
+    sizeof(Context) + cDigestObjectMaxSize + cDigestObjectMaxAlign;
+constexpr Uint64 cContextStorageSize = cContextSize - sizeof(Context);
+
 } // namespace alcp::digest
 
 #endif /* _CAPI_DIGEST_HH */
@@ -60,6 +60,7 @@ namespace alcp { namespace cipher {
     {
         eCipherModeNone = 0,
         /* aes ciphers */
+        eAesECB,
         eAesCBC,
         eAesOFB,
         eAesCTR,
@@ -70,10 +71,26 @@ namespace alcp { namespace cipher {
         eAesGCM,
         eAesCCM,
         eAesSIV,
+        eAesGCMSIV,
+        eAesOCB,
         eCHACHA20_POLY1305, // non-aes
+        eAEGIS128L,         // aes round function only
+        eAEGIS256,
+        eAEGIS128X2,
+        eAEGIS128X4,
+        eXCHACHA20,          // non-aes, 24 byte nonce
+        eXCHACHA20_POLY1305, // non-aes aead, 24 byte nonce
         eCipherModeMax,
     };
 
+    class PreparedKey;
+
+    // Upper bound of the size and alignment of every cipher object the
+    // factories can create, checked at compile time by the factory. Room for
+    // one object is part of the C API handle context.
+    constexpr Uint64 cCipherObjectMaxSize  = 4096;
+    constexpr Uint64 cCipherObjectMaxAlign = 64;
+
     using cipherKeyLenTupleT = std::tuple<const CipherMode, const CipherKeyLen>;
     using cipherAlgoMapT     = std::map<const string, const cipherKeyLenTupleT>;
 
@@ -96,6 +113,31 @@ namespace alcp { namespace cipher {
                                     Uint8*       pDrc,
                                     Uint64       len) = 0;
         virtual alc_error_t finish(const void*) = 0;
+
+        // Set an already expanded key & iv, the cipher keeps a reference to
+        // pKey. Only supported by the AES modes which use the key as is.
+        virtual alc_error_t initWithKey(const PreparedKey* pKey,
+                                        const Uint8*       pIv,
+                                        Uint64             ivLen)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+
+        // Opt-in splitting of long buffers over the library thread pool,
+        // output is the same as the serial path. Only supported by CTR and
+        // XTS.
+        virtual alc_error_t setParallelism(Uint32 numThreads, Uint64 chunkSize)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+
+        // Move to byteOffset of the keystream started by the iv of the last
+        // init, the next call begins there. Only supported by CTR and
+        // ChaCha20.
+        virtual alc_error_t setStreamOffset(Uint64 byteOffset)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
     };
 
     // iCipher segments
@@ -125,6 +167,22 @@ namespace alcp { namespace cipher {
                                            Uint64       len,
                                            Uint64       startBlockNum) = 0;
         virtual alc_error_t finish(const void*)                  = 0;
+
+        // Independent data units of dataUnitSize bytes under the key already
+        // set, each tweaked by its own data unit number. Only supported by
+        // XTS.
+        virtual alc_error_t encryptSectors(const alc_xts_sector_t* pSectors,
+                                           Uint64                  numSectors,
+                                           Uint64 dataUnitSize)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+        virtual alc_error_t decryptSectors(const alc_xts_sector_t* pSectors,
+                                           Uint64                  numSectors,
+                                           Uint64 dataUnitSize)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
     };
 
     // Additional Authentication functionality used for AEAD schemes
@@ -143,6 +201,11 @@ namespace alcp { namespace cipher {
             return ALC_ERROR_EXISTS;
         }
         virtual alc_error_t setTagLength(Uint64 tagLen) = 0;
+        virtual alc_error_t setExpectedTag(const Uint8* pTag, Uint64 tagLen)
+        {
+            // Only needed by GCM-SIV, where the tag drives decryption.
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
     };
 
     // aead cipher interface
@@ -153,6 +216,20 @@ namespace alcp { namespace cipher {
     {
       public:
         virtual ~iCipherAead() = default;
+
+        // Independent messages under the key already set, each packet
+        // carries its own iv, aad and tag. Only supported by GCM and
+        // ChaCha20-Poly1305.
+        virtual alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                                      Uint64             numPackets)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+        virtual alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                                      Uint64             numPackets)
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
     };
 
     /* Cipher Factory for different Aead and non-Aead modes */
@@ -168,11 +245,20 @@ namespace alcp { namespace cipher {
         INTERFACE*          m_iCipher      = nullptr;
         cipherAlgoMapT      m_cipherMap    = {};
         alc_cipher_state_t* m_cipher_state = nullptr;
+        void*               m_pStorage     = nullptr;
+        Uint64              m_storageSize  = 0;
 
       public:
         CipherFactory();
         ~CipherFactory();
 
+        // Build the ciphers of the following create() calls in pStorage
+        // instead of on the heap. The factory does not own such an object,
+        // the caller releases it with destroy() before reusing the storage.
+        void setStorage(void* pStorage, Uint64 storageSize);
+
+        static void destroy(INTERFACE* pCipher);
+
         // cipher creators
         INTERFACE* create(const string& name);
         INTERFACE* create(const string& name, CpuCipherFeatures arch);
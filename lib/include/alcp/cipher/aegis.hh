@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/error.h"
+
+#include "alcp/cipher.hh"
+#include "alcp/cipher/cipher_common.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * @brief        AEGIS-128L, AEGIS-256 and AEGIS-128X AEAD
+ *               (draft-irtf-cfrg-aegis-aead)
+ * @note         The state is only ever updated with the AES round function,
+ *               xor and and. AEGIS-128X runs D independent AEGIS-128L lanes
+ *               which only differ by a lane context at setup, one vector
+ *               instruction updates all of them.
+ */
+
+#define ALCP_AEGIS_TAG_SIZE      16
+#define ALCP_AEGIS_TAG_SIZE_LONG 32
+// AEGIS-128L and AEGIS-128X use 8 state words, AEGIS-256 uses 6
+#define ALCP_AEGIS_STATE_WORDS 8
+// AEGIS-128X4 has the widest words, 4 lanes of 128 bits
+#define ALCP_AEGIS_MAX_LANES 4
+// bytes absorbed per update for AEGIS-128X4
+#define ALCP_AEGIS_MAX_RATE 128
+
+enum class AegisVariant
+{
+    e128L,
+    e256,
+    e128X2,
+    e128X4,
+};
+
+template<AegisVariant cV>
+struct AegisParams
+{
+    static constexpr Uint64 cLanes = cV == AegisVariant::e128X4   ? 4
+                                     : cV == AegisVariant::e128X2 ? 2
+                                                                  : 1;
+    static constexpr Uint64 cKeyLen   = cV == AegisVariant::e256 ? 32 : 16;
+    static constexpr Uint64 cNonceLen = cKeyLen;
+    // AEGIS-256 absorbs one word per update, the others two
+    static constexpr Uint64 cRate =
+        cV == AegisVariant::e256 ? 16 : 32 * cLanes;
+};
+
+/*
+ * State words are stored one after the other, each word holding its lanes
+ * next to each other. Every arch loads and stores the same layout so a
+ * message can move between the wide kernels and AES-NI.
+ */
+struct AegisState
+{
+    __m128i w[ALCP_AEGIS_STATE_WORDS * ALCP_AEGIS_MAX_LANES];
+};
+
+/*
+ * Setup, keystream for a partial update and finalization are a handful of
+ * state updates and run on AES-NI for every arch. Absorb, Encrypt and
+ * Decrypt process full rate sized chunks.
+ */
+namespace aesni::aegis {
+    template<AegisVariant cV>
+    void Init(AegisState& st, const Uint8 key[], const Uint8 nonce[]);
+    template<AegisVariant cV>
+    void Keystream(const AegisState& st, Uint8 z[]);
+    template<AegisVariant cV>
+    void Finalize(AegisState& st,
+                  Uint64      aadLen,
+                  Uint64      msgLen,
+                  Uint8       tag[],
+                  Uint64      tagLen);
+
+    template<AegisVariant cV>
+    void Absorb(AegisState& st, const Uint8 pIn[], Uint64 chunks);
+    template<AegisVariant cV>
+    void Encrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+    template<AegisVariant cV>
+    void Decrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+} // namespace aesni::aegis
+
+// AEGIS-128X2 and AEGIS-128X4 on 256 bit VAES
+namespace vaes::aegis {
+    template<AegisVariant cV>
+    void Absorb(AegisState& st, const Uint8 pIn[], Uint64 chunks);
+    template<AegisVariant cV>
+    void Encrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+    template<AegisVariant cV>
+    void Decrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+} // namespace vaes::aegis
+
+// AEGIS-128X4 on 512 bit VAES, one zmm per state word
+namespace vaes512::aegis {
+    template<AegisVariant cV>
+    void Absorb(AegisState& st, const Uint8 pIn[], Uint64 chunks);
+    template<AegisVariant cV>
+    void Encrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+    template<AegisVariant cV>
+    void Decrypt(AegisState& st,
+                 const Uint8 pIn[],
+                 Uint8       pOut[],
+                 Uint64      chunks);
+} // namespace vaes512::aegis
+
+template<AegisVariant cV, CpuCipherFeatures arch>
+class ALCP_API_EXPORT AegisT : public virtual iCipherAead
+{
+  private:
+    using Params = AegisParams<cV>;
+
+    AegisState m_state{};
+    Uint8      m_key[Params::cKeyLen]{};
+    Uint8      m_nonce[Params::cNonceLen]{};
+    // a partial chunk of AAD or message waiting for the rest of the chunk,
+    // message chunks keep their plaintext and the keystream already used
+    Uint8  m_buf[Params::cRate]{};
+    Uint8  m_ks[Params::cRate]{};
+    Uint64 m_bufLen    = 0;
+    Uint64 m_aadLen    = 0;
+    Uint64 m_msgLen    = 0;
+    bool   m_isKeySet  = false;
+    bool   m_isIvSet   = false;
+    bool   m_isAadDone = false;
+    bool   m_isDone    = false;
+
+    void        startMessage();
+    alc_error_t crypt(const Uint8* pInput,
+                      Uint8*       pOutput,
+                      Uint64       len,
+                      bool         isEnc);
+
+  public:
+    AegisT() = default;
+    ~AegisT();
+
+    alc_error_t init(const Uint8* pKey,
+                     Uint64       keyLen,
+                     const Uint8* pIv,
+                     Uint64       ivLen) override;
+    alc_error_t setAad(const Uint8* pInput, Uint64 aadLen) override;
+    alc_error_t encrypt(const Uint8* pPlainText,
+                        Uint8*       pCipherText,
+                        Uint64       len) override;
+    alc_error_t decrypt(const Uint8* pCipherText,
+                        Uint8*       pPlainText,
+                        Uint64       len) override;
+    alc_error_t getTag(Uint8* pTag, Uint64 tagLen) override;
+    alc_error_t setTagLength(Uint64 tagLen) override;
+    alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+};
+
+} // namespace alcp::cipher
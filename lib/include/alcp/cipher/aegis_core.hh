@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/cipher/aegis.hh"
+
+#include <cstring>
+#include <utility>
+
+/*
+ * AEGIS-128L / AEGIS-128X round logic shared by the arch kernels. Only to be
+ * included from lib/arch, every arch instantiates it with its own vector
+ * wrapper V:
+ *   V::T                vector type
+ *   V::cBytes           bytes per vector
+ *   V::load / V::store  unaligned load and store
+ *   V::xor_ / V::and_   bitwise ops
+ *   V::round(in, rk)    AES round on every 128 bit lane, aesenc semantics
+ */
+namespace alcp::cipher::aegis {
+
+static constexpr Uint8 cC0[16] = { 0x00, 0x01, 0x01, 0x02, 0x03, 0x05,
+                                   0x08, 0x0d, 0x15, 0x22, 0x37, 0x59,
+                                   0x90, 0xe9, 0x79, 0x62 };
+static constexpr Uint8 cC1[16] = { 0xdb, 0x3d, 0x18, 0x55, 0x6d, 0xc2,
+                                   0x2f, 0xf1, 0x20, 0x11, 0x31, 0x42,
+                                   0x73, 0xb5, 0x28, 0xdd };
+
+/*
+ * State of AEGIS-128L (cLanes == 1) or AEGIS-128X (cLanes > 1) held in
+ * registers. A state word is cLanes * 16 bytes and takes cN vectors; lanes
+ * never mix so vector j of a word only meets vector j of the other words.
+ */
+template<class V, Uint64 cLanes>
+class Aegis128LCore
+{
+    using T = typename V::T;
+
+    static constexpr Uint64 cWordBytes = cLanes * 16;
+    static constexpr Uint64 cN         = cWordBytes / V::cBytes;
+
+    T s0[cN], s1[cN], s2[cN], s3[cN], s4[cN], s5[cN], s6[cN], s7[cN];
+
+    // f(j) for every vector of a word with j a constant, so that the state
+    // arrays can stay in registers without relying on loop unrolling
+    template<class F, Uint64... J>
+    static inline void eachImpl(F&& f, std::integer_sequence<Uint64, J...>)
+    {
+        (f(std::integral_constant<Uint64, J>{}), ...);
+    }
+
+    template<class F>
+    static inline void each(F&& f)
+    {
+        eachImpl(f, std::make_integer_sequence<Uint64, cN>{});
+    }
+
+    static inline void loadWord(T w[], const Uint8* p)
+    {
+        each([&](auto j) {
+            w[j] = V::load(p + j * V::cBytes);
+        });
+    }
+
+    static inline void storeWord(Uint8* p, const T w[])
+    {
+        each([&](auto j) {
+            V::store(p + j * V::cBytes, w[j]);
+        });
+    }
+
+    // xor the lanes of a word down to 16 bytes
+    static inline void foldLanes(Uint8 out[16], const T w[])
+    {
+        Uint8 buf[cWordBytes];
+        storeWord(buf, w);
+        for (Uint64 i = 0; i < 16; i++) {
+            out[i] = buf[i];
+            for (Uint64 l = 1; l < cLanes; l++) {
+                out[i] ^= buf[l * 16 + i];
+            }
+        }
+    }
+
+    // lanes of a word all set to the same 16 bytes
+    static inline void repeatWord(T w[], const Uint8 in[16])
+    {
+        Uint8 buf[cWordBytes];
+        for (Uint64 l = 0; l < cLanes; l++) {
+            memcpy(buf + l * 16, in, 16);
+        }
+        loadWord(w, buf);
+    }
+
+    inline void keystream(T z0[], T z1[]) const
+    {
+        each([&](auto j) {
+            z0[j] = V::xor_(V::xor_(s6[j], s1[j]), V::and_(s2[j], s3[j]));
+            z1[j] = V::xor_(V::xor_(s2[j], s5[j]), V::and_(s6[j], s7[j]));
+        });
+    }
+
+  public:
+    static constexpr Uint64 cRate = 2 * cWordBytes;
+
+    inline void load(const AegisState& st)
+    {
+        auto p = reinterpret_cast<const Uint8*>(st.w);
+        loadWord(s0, p);
+        loadWord(s1, p + cWordBytes);
+        loadWord(s2, p + 2 * cWordBytes);
+        loadWord(s3, p + 3 * cWordBytes);
+        loadWord(s4, p + 4 * cWordBytes);
+        loadWord(s5, p + 5 * cWordBytes);
+        loadWord(s6, p + 6 * cWordBytes);
+        loadWord(s7, p + 7 * cWordBytes);
+    }
+
+    inline void store(AegisState& st) const
+    {
+        auto p = reinterpret_cast<Uint8*>(st.w);
+        storeWord(p, s0);
+        storeWord(p + cWordBytes, s1);
+        storeWord(p + 2 * cWordBytes, s2);
+        storeWord(p + 3 * cWordBytes, s3);
+        storeWord(p + 4 * cWordBytes, s4);
+        storeWord(p + 5 * cWordBytes, s5);
+        storeWord(p + 6 * cWordBytes, s6);
+        storeWord(p + 7 * cWordBytes, s7);
+    }
+
+    // Update(M0, M1), the eight rounds are independent of each other
+    inline void update(const T m0[], const T m1[])
+    {
+        each([&](auto j) {
+            T t7  = s7[j];
+            s7[j] = V::round(s6[j], s7[j]);
+            s6[j] = V::round(s5[j], s6[j]);
+            s5[j] = V::round(s4[j], s5[j]);
+            s4[j] = V::round(s3[j], V::xor_(s4[j], m1[j]));
+            s3[j] = V::round(s2[j], s3[j]);
+            s2[j] = V::round(s1[j], s2[j]);
+            s1[j] = V::round(s0[j], s1[j]);
+            s0[j] = V::round(t7, V::xor_(s0[j], m0[j]));
+        });
+    }
+
+    inline void init(const Uint8 key[16], const Uint8 nonce[16])
+    {
+        T k[cN], n[cN], c0[cN], c1[cN], ctx[cN];
+        repeatWord(k, key);
+        repeatWord(n, nonce);
+        repeatWord(c0, cC0);
+        repeatWord(c1, cC1);
+
+        // lane i of AEGIS-128X gets the context i || D - 1
+        Uint8 lanes[cWordBytes] = {};
+        for (Uint64 l = 0; l < cLanes; l++) {
+            lanes[l * 16]     = static_cast<Uint8>(l);
+            lanes[l * 16 + 1] = static_cast<Uint8>(cLanes - 1);
+        }
+        loadWord(ctx, lanes);
+
+        each([&](auto j) {
+            s0[j] = V::xor_(k[j], n[j]);
+            s1[j] = c1[j];
+            s2[j] = c0[j];
+            s3[j] = c1[j];
+            s4[j] = V::xor_(k[j], n[j]);
+            s5[j] = V::xor_(k[j], c0[j]);
+            s6[j] = V::xor_(k[j], c1[j]);
+            s7[j] = V::xor_(k[j], c0[j]);
+        });
+        for (int r = 0; r < 10; r++) {
+            if constexpr (cLanes > 1) {
+                each([&](auto j) {
+                    s3[j] = V::xor_(s3[j], ctx[j]);
+                    s7[j] = V::xor_(s7[j], ctx[j]);
+                });
+            }
+            update(n, k);
+        }
+    }
+
+    inline void absorb(const Uint8* pIn, Uint64 chunks)
+    {
+        T m0[cN], m1[cN];
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate) {
+            loadWord(m0, pIn);
+            loadWord(m1, pIn + cWordBytes);
+            update(m0, m1);
+        }
+    }
+
+    inline void encrypt(const Uint8* pIn, Uint8* pOut, Uint64 chunks)
+    {
+        T z0[cN], z1[cN], m0[cN], m1[cN], c[cN];
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate, pOut += cRate) {
+            keystream(z0, z1);
+            loadWord(m0, pIn);
+            loadWord(m1, pIn + cWordBytes);
+            each([&](auto j) {
+                c[j] = V::xor_(m0[j], z0[j]);
+            });
+            storeWord(pOut, c);
+            each([&](auto j) {
+                c[j] = V::xor_(m1[j], z1[j]);
+            });
+            storeWord(pOut + cWordBytes, c);
+            update(m0, m1);
+        }
+    }
+
+    inline void decrypt(const Uint8* pIn, Uint8* pOut, Uint64 chunks)
+    {
+        T z0[cN], z1[cN], m0[cN], m1[cN];
+        for (Uint64 i = 0; i < chunks; i++, pIn += cRate, pOut += cRate) {
+            keystream(z0, z1);
+            loadWord(m0, pIn);
+            loadWord(m1, pIn + cWordBytes);
+            each([&](auto j) {
+                m0[j] = V::xor_(m0[j], z0[j]);
+                m1[j] = V::xor_(m1[j], z1[j]);
+            });
+            storeWord(pOut, m0);
+            storeWord(pOut + cWordBytes, m1);
+            update(m0, m1);
+        }
+    }
+
+    // keystream of the next chunk, for a chunk which is not complete yet
+    inline void keystream(Uint8 z[]) const
+    {
+        T z0[cN], z1[cN];
+        keystream(z0, z1);
+        storeWord(z, z0);
+        storeWord(z + cWordBytes, z1);
+    }
+
+    inline void finalize(Uint64 aadLen,
+                         Uint64 msgLen,
+                         Uint8  tag[],
+                         Uint64 tagLen)
+    {
+        Uint8  lens[16];
+        Uint64 bits[2] = { aadLen * 8, msgLen * 8 };
+        memcpy(lens, bits, sizeof(lens)); // little endian
+
+        T t[cN];
+        repeatWord(t, lens);
+        each([&](auto j) {
+            t[j] = V::xor_(t[j], s2[j]);
+        });
+        for (int r = 0; r < 7; r++) {
+            update(t, t);
+        }
+
+        T w0[cN], w1[cN];
+        if (tagLen == ALCP_AEGIS_TAG_SIZE) {
+            each([&](auto j) {
+                w0[j] = V::xor_(V::xor_(s0[j], s1[j]), V::xor_(s2[j], s3[j]));
+                w0[j] = V::xor_(V::xor_(w0[j], s4[j]), V::xor_(s5[j], s6[j]));
+            });
+            foldLanes(tag, w0);
+        } else {
+            each([&](auto j) {
+                w0[j] = V::xor_(V::xor_(s0[j], s1[j]), V::xor_(s2[j], s3[j]));
+                w1[j] = V::xor_(V::xor_(s4[j], s5[j]), V::xor_(s6[j], s7[j]));
+            });
+            foldLanes(tag, w0);
+            foldLanes(tag + 16, w1);
+        }
+    }
+};
+
+} // namespace alcp::cipher::aegis
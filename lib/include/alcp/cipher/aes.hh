@@ -46,6 +46,8 @@ namespace alcp::cipher {
 #define ALCP_DEC           0
 #define MAX_CIPHER_IV_SIZE (1024 / 8)
 
+class PreparedKey;
+
 typedef struct alc_cipher_key_data
 {
     // key expanded
@@ -99,6 +101,7 @@ class Aes : public Rijndael
   protected:
     virtual ~Aes()
     {
+        releasePreparedKey();
         utils::memunlock(m_iv_aes, MAX_CIPHER_IV_SIZE);
         std::fill(m_iv_aes, m_iv_aes + MAX_CIPHER_IV_SIZE, 0);
     }
@@ -125,6 +128,14 @@ class Aes : public Rijndael
     alc_error_t setKey(const Uint8* pKey, const Uint64 keyLen);
     alc_error_t setIv(const Uint8* pIv, const Uint64 ivLen);
 
+    // round keys of pKey are used in place, a reference is held until the
+    // next key is set
+    alc_error_t setPreparedKey(const PreparedKey* pKey);
+
+    // split long buffers in chunks of chunkSize bytes over numThreads threads
+    // of the library pool, one thread (the default) keeps the serial path
+    alc_error_t setParallel(Uint32 numThreads, Uint64 chunkSize);
+
     void getKey()
     {
         m_cipher_key_data.m_enc_key = getEncryptKeys();
@@ -136,8 +147,22 @@ class Aes : public Rijndael
     ALCP_API_EXPORT virtual alc_error_t setMode(CipherMode mode);
 
   protected:
-    CipherMode m_mode{};
-    void*      m_this{};
+    CipherMode         m_mode{};
+    void*              m_this{};
+    const PreparedKey* m_pPreparedKey = nullptr;
+
+    // L2 friendly default chunk of a parallel call
+    static constexpr Uint64 cParallelChunkSize = 128 * 1024;
+
+    Uint32 m_numThreads = 1;
+    Uint64 m_chunkSize  = cParallelChunkSize;
+
+    void releasePreparedKey();
+
+    bool isParallel(Uint64 len) const
+    {
+        return m_numThreads > 1 && len >= 2 * m_chunkSize;
+    }
 };
 
 } // namespace alcp::cipher
@@ -62,7 +62,7 @@ enum class CCM_ERROR
 };
 
 namespace aesni::ccm {
-    // Defined in arch/zen3
+    // Defined in arch/avx2
     CCM_ERROR SetAad(ccm_data_t* ctx,
                      const Uint8 aad[],
                      Uint64      alen,
@@ -80,6 +80,42 @@ namespace aesni::ccm {
                       Uint64      len);
 } // namespace aesni::ccm
 
+/*
+ * Wide kernels, same contract as aesni::ccm::Encrypt/Decrypt. The serial
+ * CBC-MAC chain is stitched with CTR keystream generated several blocks at a
+ * time, AAD and tag finalization stay with the aesni code.
+ */
+namespace vaes::ccm {
+    // Defined in arch/zen3
+    CCM_ERROR Encrypt(ccm_data_t* ctx,
+                      const Uint8 inp[],
+                      Uint8       out[],
+                      Uint64      dataLen);
+
+    CCM_ERROR Decrypt(ccm_data_t* ctx,
+                      const Uint8 inp[],
+                      Uint8       out[],
+                      Uint64      len);
+} // namespace vaes::ccm
+
+namespace vaes512::ccm {
+    // Defined in arch/zen4
+    CCM_ERROR Encrypt(ccm_data_t* ctx,
+                      const Uint8 inp[],
+                      Uint8       out[],
+                      Uint64      dataLen);
+
+    CCM_ERROR Decrypt(ccm_data_t* ctx,
+                      const Uint8 inp[],
+                      Uint8       out[],
+                      Uint64      len);
+} // namespace vaes512::ccm
+
+typedef CCM_ERROR (*CcmCryptFn)(ccm_data_t* ctx,
+                                const Uint8 inp[],
+                                Uint8       out[],
+                                Uint64      len);
+
 class ALCP_API_EXPORT Ccm
     : public Aes
     , public virtual iCipher
@@ -91,14 +127,23 @@ class ALCP_API_EXPORT Ccm
     const Uint8* m_additionalData{};
     Uint64       m_plainTextLength      = 0;
     bool         m_is_plaintext_len_set = false;
+    bool         m_is_started           = false;
     Uint64       m_updatedLength        = 0;
     ccm_data_t   m_ccm_data{};
+    // Tail of the previous update which did not fill a block. Its output is
+    // already written, it joins the CBC-MAC once the block is complete or the
+    // message ends.
+    alignas(16) Uint8 m_carry[16]{};
+    Uint64     m_carryLen = 0;
+    CcmCryptFn m_cryptFn  = nullptr;
 
   protected:
     alc_error_t setIv(ccm_data_t* ccm_data,
                       const Uint8 pIv[],
                       Uint64      ivLen,
                       Uint64      dataLen);
+    alc_error_t startMessage(Uint64 len);
+    void        flushCarry();
 
   public:
     Ccm(Uint32 keyLen_in_bytes, CipherMode mode)
@@ -113,11 +158,14 @@ class ALCP_API_EXPORT Ccm
                      Uint64       keyLen,
                      const Uint8* pIv,
                      Uint64       ivLen) override;
+    alc_error_t initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen) override;
 
     alc_error_t cryptUpdate(const Uint8 pInput[],
                             Uint8       pOutput[],
                             Uint64      dataLen,
-                            bool        isEncrypt);
+                            CcmCryptFn  cryptFn);
 };
 
 class ALCP_API_EXPORT CcmHash
@@ -134,8 +182,8 @@ class ALCP_API_EXPORT CcmHash
     alc_error_t getTag(Uint8* pOutput, Uint64 tagLen) override;
     alc_error_t setTagLength(Uint64 tagLength) override;
 
-    alc_error_t setPlainTextLength(
-        Uint64 len) override; // used in multiupdate case only
+    // Optional, needed only when the message is fed in several updates
+    alc_error_t setPlainTextLength(Uint64 len) override;
 };
 
 template<CipherKeyLen keyLenBits, CpuCipherFeatures arch>
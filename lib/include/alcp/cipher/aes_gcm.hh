@@ -82,6 +82,8 @@ typedef struct _alc_gcm_ctx
     __m128i m_reverse_mask_128;
     __m128i m_tag_128;
     Uint64  m_additionalDataLen;
+    // powers of H from a prepared key, used instead of computing them
+    const __m512i* m_pHashSubkeyTable_shared = nullptr;
 #if !ALWAYS_COMPUTE
     _alc_cipher_gcm_key_data_t m_gcm_key_data{};
     Uint64*                    m_pHashSubkeyTable_precomputed = nullptr;
@@ -148,6 +150,9 @@ class ALCP_API_EXPORT Gcm
                      Uint64       keyLen,
                      const Uint8* pIv,
                      Uint64       ivLen) override;
+    alc_error_t initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen) override;
 };
 
 // GCM authentication class
@@ -194,6 +199,16 @@ class GcmT
                         Uint8*       pPlainText,
                         Uint64       len) override;
     alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+
+    alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                          Uint64             numPackets) override;
+    alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                          Uint64             numPackets) override;
+
+  private:
+    alc_error_t cryptBatch(alc_aead_packet_t* pPackets,
+                           Uint64             numPackets,
+                           bool               isEncrypt);
 };
 
 } // namespace alcp::cipher
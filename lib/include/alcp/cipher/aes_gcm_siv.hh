@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/error.h"
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/cipher_common.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * @brief        AES-GCM-SIV, nonce misuse resistant AEAD (RFC 8452)
+ * @note         Every nonce derives its own POLYVAL and encryption keys from
+ *               the key generating key. The tag is computed over the whole
+ *               plaintext before encryption, hence a message is processed in
+ *               a single encrypt/decrypt call.
+ */
+
+#define ALCP_GCM_SIV_TAG_SIZE   16
+#define ALCP_GCM_SIV_NONCE_SIZE 12
+#define ALCP_GCM_SIV_MAX_POWERS 16
+// RFC 8452 limits both plaintext and additional data to 2^36 bytes
+#define ALCP_GCM_SIV_MAX_LEN (1ULL << 36)
+
+/*
+ * Key setup and tag computation only touch a few blocks, they run on AES-NI
+ * for every arch. DeriveKeys produces the POLYVAL key and the 16 or 32 byte
+ * encryption key from the expanded key generating key.
+ *
+ * POLYVAL is the GHASH field multiplication without the bit reflection,
+ * the Montgomery reduction used by gMul computes it directly on the raw
+ * little endian blocks. pHtable holds H^1 .. H^n with n the number of blocks
+ * aggregated by the kernel, a trailing partial block is zero padded.
+ *
+ * CryptCtr32 runs the RFC 8452 counter mode, the first 32 bits of the counter
+ * block are a little endian counter which wraps without carry.
+ */
+namespace aesni::gcmsiv {
+    constexpr Uint32 cHashPowers = 4;
+
+    void DeriveKeys(const Uint8 pKeyGenKey[],
+                    int         nRounds,
+                    const Uint8 nonce[],
+                    Uint8       authKey[],
+                    Uint8       encKey[]);
+    void InitHashPowers(const Uint8 authKey[],
+                        __m128i     pHtable[],
+                        Uint32      count);
+    void GetTag(__m128i       state,
+                const __m128i pHtable[],
+                Uint64        aadLen,
+                Uint64        len,
+                const Uint8   nonce[],
+                const Uint8   pKey[],
+                int           nRounds,
+                Uint8         tag[]);
+    void Polyval(const Uint8   pIn[],
+                 Uint64        len,
+                 const __m128i pHtable[],
+                 __m128i&      state);
+    void CryptCtr32(const Uint8 pIn[],
+                    Uint8       pOut[],
+                    Uint64      len,
+                    const Uint8 pKey[],
+                    int         nRounds,
+                    const Uint8 counter[]);
+} // namespace aesni::gcmsiv
+
+namespace vaes::gcmsiv {
+    constexpr Uint32 cHashPowers = 8;
+
+    void Polyval(const Uint8   pIn[],
+                 Uint64        len,
+                 const __m128i pHtable[],
+                 __m128i&      state);
+    void CryptCtr32(const Uint8 pIn[],
+                    Uint8       pOut[],
+                    Uint64      len,
+                    const Uint8 pKey[],
+                    int         nRounds,
+                    const Uint8 counter[]);
+} // namespace vaes::gcmsiv
+
+namespace vaes512::gcmsiv {
+    constexpr Uint32 cHashPowers = 16;
+
+    void Polyval(const Uint8   pIn[],
+                 Uint64        len,
+                 const __m128i pHtable[],
+                 __m128i&      state);
+    void CryptCtr32(const Uint8 pIn[],
+                    Uint8       pOut[],
+                    Uint64      len,
+                    const Uint8 pKey[],
+                    int         nRounds,
+                    const Uint8 counter[]);
+} // namespace vaes512::gcmsiv
+
+class ALCP_API_EXPORT GcmSiv
+    : public Aes
+    , public virtual iCipher
+{
+  protected:
+    // expanded key generating key, the Aes schedule holds the per nonce key
+    alignas(16) Uint8 m_keyGenKey[(Rijndael::cMaxRounds + 1) * 16] = {};
+    Uint32  m_keyGenRounds                                        = 0;
+    Uint32  m_hashPowers                                          = 0;
+    __m128i m_hTable[ALCP_GCM_SIV_MAX_POWERS]{};
+    __m128i m_polyval{};
+    Uint64  m_aadLen = 0;
+    alignas(16) Uint8 m_tag[ALCP_GCM_SIV_TAG_SIZE]         = {};
+    alignas(16) Uint8 m_expectedTag[ALCP_GCM_SIV_TAG_SIZE] = {};
+    bool m_isKeyGenSet                                     = false;
+    bool m_isExpectedTagSet                                = false;
+    bool m_isMsgDone                                       = false;
+
+    alc_error_t deriveKeys();
+    void        computeTag(Uint64 len);
+    void        getCounter(const Uint8 tag[], Uint8 counter[]) const;
+
+  public:
+    GcmSiv(Uint32 keyLen_in_bytes, Uint32 hashPowers)
+        : Aes(keyLen_in_bytes)
+        , m_hashPowers{ hashPowers }
+    {
+        setMode(CipherMode::eAesGCMSIV);
+        m_ivLen_aes = ALCP_GCM_SIV_NONCE_SIZE;
+    }
+
+    ~GcmSiv();
+
+    alc_error_t init(const Uint8* pKey,
+                     Uint64       keyLen,
+                     const Uint8* pIv,
+                     Uint64       ivLen) override;
+};
+
+// GCM-SIV authentication class
+class ALCP_API_EXPORT GcmSivAuth
+    : public GcmSiv
+    , public virtual iCipherAuth
+{
+  public:
+    GcmSivAuth(Uint32 keyLen_in_bytes, Uint32 hashPowers)
+        : GcmSiv(keyLen_in_bytes, hashPowers)
+    {
+    }
+    ~GcmSivAuth() {}
+
+    alc_error_t setAad(const Uint8* pInput, Uint64 aadLen) override;
+    alc_error_t getTag(Uint8* pTag, Uint64 tagLen) override;
+    alc_error_t setTagLength(Uint64 tagLen) override;
+    alc_error_t setExpectedTag(const Uint8* pTag, Uint64 tagLen) override;
+};
+
+template<CipherKeyLen keyLenBits, CpuCipherFeatures arch>
+class GcmSivT
+    : public GcmSivAuth
+    , public virtual iCipherAead
+{
+  public:
+    GcmSivT();
+    ~GcmSivT() = default;
+
+  public:
+    alc_error_t encrypt(const Uint8* pPlainText,
+                        Uint8*       pCipherText,
+                        Uint64       len) override;
+    alc_error_t decrypt(const Uint8* pCipherText,
+                        Uint8*       pPlainText,
+                        Uint64       len) override;
+    alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+};
+
+} // namespace alcp::cipher
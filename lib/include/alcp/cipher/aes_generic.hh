@@ -53,14 +53,23 @@ class ALCP_API_EXPORT AesGenericInit
         m_ivLen_max = 16;
         m_ivLen_min = 16;
     };
-    ~AesGenericInit() {}
+    ~AesGenericInit() { std::fill(m_ctrStart, m_ctrStart + 16, 0); }
     alc_error_t init(const Uint8* pKey,
                      Uint64       keyLen,
                      const Uint8* pIv,
-                     Uint64       ivLen) override
-    {
-        return Aes::init(pKey, keyLen, pIv, ivLen);
-    }
+                     Uint64       ivLen) override;
+    alc_error_t initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen) override;
+
+  protected:
+    // counter block set by the last init, stream offsets are counted from it
+    __attribute__((aligned(16))) Uint8 m_ctrStart[16] = {};
+    // bytes of the current counter block which precede the stream position
+    Uint64 m_ctrSkip = 0;
+
+    void        startStream(const Uint8* pIv, Uint64 ivLen);
+    alc_error_t seekCtr(Uint64 byteOffset);
 };
 
 template<CipherMode mode, CipherKeyLen keyLenBits, CpuCipherFeatures arch>
@@ -82,6 +91,30 @@ class AesGenericCiphersT
                         Uint8*       pPlainText,
                         Uint64       len) override;
     alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+
+    alc_error_t setParallelism(Uint32 numThreads, Uint64 chunkSize) override
+    {
+        if constexpr (mode == CipherMode::eAesCTR) {
+            return setParallel(numThreads, chunkSize);
+        }
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    alc_error_t setStreamOffset(Uint64 byteOffset) override
+    {
+        if constexpr (mode == CipherMode::eAesCTR) {
+            return seekCtr(byteOffset);
+        }
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+  private:
+    alc_error_t cryptCtrStream(const Uint8* pSrc, Uint8* pDst, Uint64 len);
+    alc_error_t cryptCtr(const Uint8* pSrc,
+                         Uint8*       pDst,
+                         Uint64       len,
+                         Uint8*       pIv);
+    alc_error_t cryptCtrParallel(const Uint8* pSrc, Uint8* pDst, Uint64 len);
 };
 
 } // namespace alcp::cipher
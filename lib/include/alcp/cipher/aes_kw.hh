@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/cipher_kw.h"
+#include "alcp/error.h"
+
+#include "alcp/cipher/aes_mb.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * Multi-buffer AES Key Wrap
+ *
+ * A wrap of n 64-bit blocks is a chain of 6n AES calls, every call needs the
+ * integrity register A of the previous one. Different keys are independent
+ * though, so a lane per key keeps all the AES units busy. All the lanes
+ * share one KEK, the round keys are broadcast instead of transposed.
+ *
+ * Step of a lane, W(rap) and U(nwrap), t starts at 1 for W and 6n for U:
+ *  W: B = AES(K, A | R[i]),       A = MSB64(B) ^ t, R[i] = LSB64(B), t++
+ *  U: B = AES-1(K, (A ^ t) | R[i]), A = MSB64(B),   R[i] = LSB64(B), t--
+ * R[i] walks R[1]..R[n] (W) or R[n]..R[1] (U) and wraps around. A and t are
+ * kept in the low 64 bits of m_a and m_t, t in native byte order.
+ */
+struct alignas(64) AesKwLanes
+{
+    __m128i m_a[cMbMaxLanes];
+    __m128i m_t[cMbMaxLanes];
+    Uint8*  m_pR[cMbMaxLanes];
+    Uint8*  m_pFirst[cMbMaxLanes];
+    Uint8*  m_pLast[cMbMaxLanes];
+};
+
+namespace aesni {
+    static constexpr Uint32 cKwMbLanes = 8;
+
+    void WrapKwMb(AesKwLanes&  lanes,
+                  Uint64       steps,
+                  const Uint8* pEncKey,
+                  int          nRounds);
+    void UnwrapKwMb(AesKwLanes&  lanes,
+                    Uint64       steps,
+                    const Uint8* pDecKey,
+                    int          nRounds);
+} // namespace aesni
+
+namespace vaes {
+    static constexpr Uint32 cKwMbLanes = 16;
+
+    void WrapKwMb(AesKwLanes&  lanes,
+                  Uint64       steps,
+                  const Uint8* pEncKey,
+                  int          nRounds);
+    void UnwrapKwMb(AesKwLanes&  lanes,
+                    Uint64       steps,
+                    const Uint8* pDecKey,
+                    int          nRounds);
+} // namespace vaes
+
+namespace vaes512 {
+    static constexpr Uint32 cKwMbLanes = 16;
+
+    void WrapKwMb(AesKwLanes&  lanes,
+                  Uint64       steps,
+                  const Uint8* pEncKey,
+                  int          nRounds);
+    void UnwrapKwMb(AesKwLanes&  lanes,
+                    Uint64       steps,
+                    const Uint8* pDecKey,
+                    int          nRounds);
+} // namespace vaes512
+
+/**
+ * @brief Wraps a batch of keys under one KEK.
+ *
+ * @param mode      ALC_KEY_WRAP_KW or ALC_KEY_WRAP_KWP
+ * @param pKek      Key encryption key
+ * @param kekLen    KEK length in bits
+ * @param pJobs     Array of jobs, see alc_key_wrap_job_t
+ * @param numJobs   Number of jobs
+ * @param arch      Kernel to be used, eReference is not supported
+ * @return ALC_ERROR_NONE on success
+ */
+ALCP_API_EXPORT alc_error_t
+WrapKeys(alc_key_wrap_mode_t mode,
+         const Uint8*        pKek,
+         Uint64              kekLen,
+         alc_key_wrap_job_t* pJobs,
+         Uint64              numJobs,
+         CpuCipherFeatures   arch);
+
+/**
+ * @brief Unwraps a batch of keys wrapped under one KEK, the integrity check
+ * result of every job is returned in kj_err.
+ *
+ * @return ALC_ERROR_NONE if all the jobs were unwrapped,
+ *         ALC_ERROR_TAG_MISMATCH if any of them failed the integrity check
+ */
+ALCP_API_EXPORT alc_error_t
+UnwrapKeys(alc_key_wrap_mode_t mode,
+           const Uint8*        pKek,
+           Uint64              kekLen,
+           alc_key_wrap_job_t* pJobs,
+           Uint64              numJobs,
+           CpuCipherFeatures   arch);
+
+/**
+ * @brief Same as above, kernel selected based on the cpu features
+ */
+ALCP_API_EXPORT alc_error_t
+WrapKeys(alc_key_wrap_mode_t mode,
+         const Uint8*        pKek,
+         Uint64              kekLen,
+         alc_key_wrap_job_t* pJobs,
+         Uint64              numJobs);
+
+ALCP_API_EXPORT alc_error_t
+UnwrapKeys(alc_key_wrap_mode_t mode,
+           const Uint8*        pKek,
+           Uint64              kekLen,
+           alc_key_wrap_job_t* pJobs,
+           Uint64              numJobs);
+
+} // namespace alcp::cipher
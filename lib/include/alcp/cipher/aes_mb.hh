@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/cipher_mb.h"
+#include "alcp/error.h"
+
+#include "alcp/cipher/cipher_common.hh"
+#include "alcp/cipher/rijndael.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * Multi-buffer AES
+ *
+ * A multi-buffer kernel advances several independent streams (lanes) in
+ * lock step, one block per lane per iteration. Round keys are kept
+ * transposed, round major and lane minor, so that the keys of 2 (ymm) or 4
+ * (zmm) neighbouring lanes are loaded with a single load. A lane with no
+ * work points at a scratch block and does not advance (m_step == 0).
+ */
+static constexpr Uint32 cMbMaxLanes = 16;
+
+struct alignas(64) AesMbLanes
+{
+    __m128i      m_round_keys[Rijndael::cMaxRounds + 1][cMbMaxLanes];
+    __m128i      m_iv[cMbMaxLanes];
+    const Uint8* m_pSrc[cMbMaxLanes];
+    Uint8*       m_pDst[cMbMaxLanes];
+    Uint64       m_step[cMbMaxLanes];
+};
+
+namespace aesni {
+    static constexpr Uint32 cCbcMbLanes = 8;
+
+    void EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds);
+} // namespace aesni
+
+namespace vaes {
+    static constexpr Uint32 cCbcMbLanes = 16;
+
+    void EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds);
+} // namespace vaes
+
+namespace vaes512 {
+    static constexpr Uint32 cCbcMbLanes = 16;
+    static constexpr Uint32 cGcmMbLanes = 16;
+
+    void EncryptCbcMb(AesMbLanes& lanes, Uint64 blocks, int nRounds);
+
+    // jobs are validated by the caller
+    alc_error_t CryptGcmMb(alc_aead_mb_job_t* pJobs,
+                           Uint64             numJobs,
+                           bool               isEncrypt);
+} // namespace vaes512
+
+/**
+ * @brief Encrypts a batch of independent CBC streams.
+ *
+ * @param pJobs     Array of jobs, see alc_cipher_mb_job_t
+ * @param numJobs   Number of jobs
+ * @param arch      Kernel to be used, eReference is not supported
+ * @return ALC_ERROR_NONE on success
+ */
+ALCP_API_EXPORT alc_error_t
+EncryptCbcMb(const alc_cipher_mb_job_t* pJobs,
+             Uint64                     numJobs,
+             CpuCipherFeatures          arch);
+
+/**
+ * @brief Same as above, kernel selected based on the cpu features
+ */
+ALCP_API_EXPORT alc_error_t
+EncryptCbcMb(const alc_cipher_mb_job_t* pJobs, Uint64 numJobs);
+
+/**
+ * @brief Seals or opens a batch of GCM packets, each under its own prepared
+ * key.
+ *
+ * @param pJobs      Array of jobs, see alc_aead_mb_job_t
+ * @param numJobs    Number of jobs
+ * @param isEncrypt  Seal when true, open otherwise
+ * @param arch       Kernel to be used, eVaes256 and eAesni run one packet
+ *                   after the other
+ * @return ALC_ERROR_NONE on success, ALC_ERROR_TAG_MISMATCH if the tag of
+ * any of the opened packets did not match, ALC_ERROR_NOT_SUPPORTED for
+ * eReference
+ */
+ALCP_API_EXPORT alc_error_t
+CryptGcmMb(alc_aead_mb_job_t* pJobs,
+           Uint64             numJobs,
+           bool               isEncrypt,
+           CpuCipherFeatures  arch);
+
+/**
+ * @brief Same as above, kernel selected based on the cpu features
+ */
+ALCP_API_EXPORT alc_error_t
+CryptGcmMb(alc_aead_mb_job_t* pJobs, Uint64 numJobs, bool isEncrypt);
+
+/**
+ * @brief Widest multi-buffer kernel supported by the cpu, eReference if
+ * there is none
+ */
+CpuCipherFeatures
+getMbCpuFeature();
+
+} // namespace alcp::cipher
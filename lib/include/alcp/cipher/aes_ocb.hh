@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/error.h"
+
+#include "alcp/cipher/aes.hh"
+#include "alcp/cipher/cipher_common.hh"
+
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * @brief        AES-OCB3 single pass AEAD (RFC 7253)
+ * @note         Every block is masked with an offset derived from the L table,
+ *               blocks are independent of each other so encryption,
+ *               decryption and the AAD hash all run as wide as the arch allows.
+ *               Every update except the last one has to be a multiple of the
+ *               block size.
+ */
+
+#define ALCP_OCB_TAG_SIZE       16
+#define ALCP_OCB_NONCE_MAX_SIZE 15
+// block numbers are 64 bit, ntz() of a block number is at most 63
+#define ALCP_OCB_L_TABLE_SIZE 64
+// widest batch of blocks sharing one offset computation
+#define ALCP_OCB_MAX_BATCH 16
+
+/*
+ * L table precomputed at key setup. l[i] is L_i of RFC 7253, gray[j] is
+ * L_ntz(1) ^ .. ^ L_ntz(j): the offset of block n + j is the offset of block
+ * n xored with gray[j], as long as n is a multiple of a batch size larger than
+ * j.
+ */
+struct OcbLTable
+{
+    __m128i lStar;
+    __m128i lDollar;
+    __m128i l[ALCP_OCB_L_TABLE_SIZE];
+    __m128i gray[ALCP_OCB_MAX_BATCH];
+};
+
+// Running state of the message or of the AAD hash
+struct OcbPass
+{
+    __m128i offset;
+    __m128i sum;    // checksum of the plaintext, or the AAD hash
+    Uint64  blocks; // full blocks processed
+};
+
+enum class OcbOp
+{
+    eEncrypt,
+    eDecrypt,
+    eHash,
+};
+
+/*
+ * Key and nonce setup, the partial last blocks and the tag only touch a few
+ * blocks and run on AES-NI for every arch.
+ *
+ * Encrypt, Decrypt and Hash process full blocks and update the pass. Decrypt
+ * takes the decryption key schedule, everything else the encryption one.
+ */
+namespace aesni::ocb {
+    void    InitLTable(const Uint8 pKey[], int nRounds, OcbLTable& table);
+    __m128i InitOffset(const Uint8 pKey[],
+                       int         nRounds,
+                       const Uint8 nonce[],
+                       Uint64      nonceLen,
+                       Uint64      tagLen);
+    void    CryptTail(const Uint8      pIn[],
+                      Uint8            pOut[],
+                      Uint64           len,
+                      bool             isEnc,
+                      const Uint8      pKey[],
+                      int              nRounds,
+                      const OcbLTable& table,
+                      OcbPass&         pass);
+    void    HashTail(const Uint8      pIn[],
+                     Uint64           len,
+                     const Uint8      pKey[],
+                     int              nRounds,
+                     const OcbLTable& table,
+                     OcbPass&         pass);
+    void    GetTag(const OcbPass&   msg,
+                   const OcbPass&   aad,
+                   const Uint8      pKey[],
+                   int              nRounds,
+                   const OcbLTable& table,
+                   Uint8            tag[],
+                   Uint64           tagLen);
+
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass);
+} // namespace aesni::ocb
+
+namespace vaes::ocb {
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass);
+} // namespace vaes::ocb
+
+namespace vaes512::ocb {
+    void Encrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Decrypt(const Uint8      pIn[],
+                 Uint8            pOut[],
+                 Uint64           blocks,
+                 const Uint8      pKey[],
+                 int              nRounds,
+                 const OcbLTable& table,
+                 OcbPass&         pass);
+    void Hash(const Uint8      pIn[],
+              Uint64           blocks,
+              const Uint8      pKey[],
+              int              nRounds,
+              const OcbLTable& table,
+              OcbPass&         pass);
+} // namespace vaes512::ocb
+
+class ALCP_API_EXPORT Ocb
+    : public Aes
+    , public virtual iCipher
+{
+  protected:
+    OcbLTable m_lTable{};
+    OcbPass   m_msg{};
+    OcbPass   m_aad{};
+    Uint64    m_tagLen      = ALCP_OCB_TAG_SIZE;
+    bool      m_isOffsetSet = false;
+    bool      m_isMsgDone   = false;
+    bool      m_isAadDone   = false;
+
+    // Offset_0 depends on the tag length, it is computed on first use
+    void setOffset();
+
+  public:
+    Ocb(Uint32 keyLen_in_bytes)
+        : Aes(keyLen_in_bytes)
+    {
+        setMode(CipherMode::eAesOCB);
+        m_ivLen_max = ALCP_OCB_NONCE_MAX_SIZE;
+        m_ivLen_aes = 12;
+    }
+
+    ~Ocb();
+
+    alc_error_t init(const Uint8* pKey,
+                     Uint64       keyLen,
+                     const Uint8* pIv,
+                     Uint64       ivLen) override;
+    alc_error_t initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen) override;
+};
+
+// OCB authentication class
+class ALCP_API_EXPORT OcbAuth
+    : public Ocb
+    , public virtual iCipherAuth
+{
+  public:
+    OcbAuth(Uint32 keyLen_in_bytes)
+        : Ocb(keyLen_in_bytes)
+    {
+    }
+    ~OcbAuth() {}
+
+    alc_error_t getTag(Uint8* pTag, Uint64 tagLen) override;
+    alc_error_t setTagLength(Uint64 tagLen) override;
+};
+
+template<CipherKeyLen keyLenBits, CpuCipherFeatures arch>
+class OcbT
+    : public OcbAuth
+    , public virtual iCipherAead
+{
+  public:
+    OcbT()
+        : OcbAuth((static_cast<Uint32>(keyLenBits)) / 8)
+    {
+    }
+    ~OcbT() = default;
+
+  public:
+    // the AAD hash runs on the same wide kernels as the message
+    alc_error_t setAad(const Uint8* pInput, Uint64 aadLen) override;
+    alc_error_t encrypt(const Uint8* pPlainText,
+                        Uint8*       pCipherText,
+                        Uint64       len) override;
+    alc_error_t decrypt(const Uint8* pCipherText,
+                        Uint8*       pPlainText,
+                        Uint64       len) override;
+    alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+};
+
+} // namespace alcp::cipher
@@ -48,7 +48,7 @@ typedef struct _alc_cipher_xts_data
     __attribute__((aligned(64))) Uint8 m_iv_xts[16];
     __attribute__((aligned(64))) Uint8 m_tweak_block[16];
     Uint8  m_tweak_round_key[(RIJ_SIZE_ALIGNED(32) * (16))];
-    Uint8* m_pTweak_key; // this pointer can be removed.
+    const Uint8* m_pTweak_key; // this pointer can be removed.
     Int64  m_aes_block_id;
 
 } _alc_cipher_xts_data_t;
@@ -96,6 +96,9 @@ class ALCP_API_EXPORT Xts
                      Uint64       keyLen,
                      const Uint8* pIv,
                      Uint64       ivLen) override;
+    alc_error_t initWithKey(const PreparedKey* pKey,
+                            const Uint8*       pIv,
+                            Uint64             ivLen) override;
 
     void tweakBlockSet(Uint64 aesBlockId);
 
@@ -130,6 +133,17 @@ class XtsT
                         Uint8*       pPlainText,
                         Uint64       len) override;
     alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+
+    alc_error_t setParallelism(Uint32 numThreads, Uint64 chunkSize) override
+    {
+        return setParallel(numThreads, chunkSize);
+    }
+
+  private:
+    alc_error_t cryptParallel(const Uint8* pSrc,
+                              Uint8*       pDst,
+                              Uint64       len,
+                              bool         isEncrypt);
 };
 
 /* iCipherSeg classes */
@@ -166,7 +180,19 @@ class XtsBlockT
                                Uint8*       pDest,
                                Uint64       currSrcLen,
                                Uint64       startBlockNum) override;
+    alc_error_t encryptSectors(const alc_xts_sector_t* pSectors,
+                               Uint64                  numSectors,
+                               Uint64                  dataUnitSize) override;
+    alc_error_t decryptSectors(const alc_xts_sector_t* pSectors,
+                               Uint64                  numSectors,
+                               Uint64                  dataUnitSize) override;
     alc_error_t finish(const void*) override { return ALC_ERROR_NONE; }
+
+  private:
+    alc_error_t cryptSectors(const alc_xts_sector_t* pSectors,
+                             Uint64                  numSectors,
+                             Uint64                  dataUnitSize,
+                             bool                    isEncrypt);
 };
 
 } // namespace alcp::cipher
@@ -34,6 +34,8 @@
 
 #include "alcp/cipher/cipher_common.hh"
 
+#include <cstring>
+
 namespace alcp::cipher {
 using utils::CpuCipherFeatures;
 using utils::CpuId;
@@ -73,6 +75,16 @@ class ALCP_API_EXPORT ChaCha20 : public virtual iCipher
 
   protected:
     alignas(16) Uint8 m_iv[cMIvlen];
+    // iv set by the last init, stream offsets are counted from it
+    alignas(16) Uint8 m_ivStart[cMIvlen]{};
+    // bytes of the current block which precede the stream position
+    Uint64 m_skip = 0;
+
+    template<typename PROCESS>
+    alc_error_t crypt(PROCESS      process,
+                      const Uint8* pInput,
+                      Uint8*       pOutput,
+                      Uint64       len);
 
     // FIXME: Needs to be private or protected after chacha20-poly1305
     // integration
@@ -90,15 +102,117 @@ class ALCP_API_EXPORT ChaCha20 : public virtual iCipher
                      const Uint64 keyLen,
                      const Uint8* pIv,
                      const Uint64 ivLen) override;
+    alc_error_t setStreamOffset(Uint64 byteOffset) override;
+};
+
+/**
+ * @brief HChaCha20 subkeys of a batch of nonces under one key, the nonces are
+ * spread over the SIMD lanes of the kernel.
+ *
+ * @param key        Key
+ * @param keyLen     Key length in bits, 256
+ * @param pNonces    numNonces nonces of 16 bytes each
+ * @param numNonces  Number of nonces
+ * @param pSubkeys   numNonces subkeys of 32 bytes each, subkey i is derived
+ *                   from nonce i
+ * @param arch       Kernel to be used
+ * @return ALC_ERROR_NONE on success
+ */
+ALCP_API_EXPORT alc_error_t
+HChaCha20(const Uint8       key[],
+          Uint64            keyLen,
+          const Uint8       pNonces[],
+          Uint64            numNonces,
+          Uint8             pSubkeys[],
+          CpuCipherFeatures arch);
+
+/**
+ * @brief Same as above, kernel selected based on the cpu features
+ */
+ALCP_API_EXPORT alc_error_t
+HChaCha20(const Uint8 key[],
+          Uint64      keyLen,
+          const Uint8 pNonces[],
+          Uint64      numNonces,
+          Uint8       pSubkeys[]);
+
+/*
+ * XChaCha20 (draft-irtf-cfrg-xchacha) over a ChaCha20 cipher CHACHA which
+ * takes an IVLEN byte iv. The stream is keyed with the HChaCha20 subkey of
+ * the key and the first 16 bytes of the 24 byte nonce, the last 8 bytes are
+ * the nonce of the stream. The key is kept so that init can set a new nonce
+ * on its own.
+ */
+template<class CHACHA, Uint64 IVLEN>
+class XChaCha : public CHACHA
+{
+  protected:
+    static constexpr Uint64 cXNonceLen = 24;
+
+    alignas(16) Uint8 m_xKey[32]{};
+    alignas(16) Uint8 m_xNonce[cXNonceLen]{};
+    bool m_hasKey   = false;
+    bool m_hasNonce = false;
+
+  public:
+    ~XChaCha() { memset(m_xKey, 0, sizeof(m_xKey)); }
+
+    alc_error_t init(const Uint8* pKey,
+                     Uint64       keyLen,
+                     const Uint8* pIv,
+                     Uint64       ivLen) override
+    {
+        if (pKey != nullptr && keyLen != 0) {
+            if (keyLen != 256) {
+                return ALC_ERROR_INVALID_SIZE;
+            }
+            memcpy(m_xKey, pKey, sizeof(m_xKey));
+            m_hasKey = true;
+        }
+        if (pIv != nullptr && ivLen != 0) {
+            if (ivLen != cXNonceLen) {
+                return ALC_ERROR_INVALID_SIZE;
+            }
+            memcpy(m_xNonce, pIv, cXNonceLen);
+            m_hasNonce = true;
+        }
+        if (!m_hasKey || !m_hasNonce) {
+            return ALC_ERROR_NONE;
+        }
+
+        // counter 0, 4 zero bytes and the last 8 bytes of the nonce, a 12
+        // byte iv is the same without the counter
+        alignas(16) Uint8 subkey[32];
+        alignas(16) Uint8 iv[16] = {};
+        memcpy(iv + 8, m_xNonce + 16, 8);
+
+        alc_error_t err = HChaCha20(
+            m_xKey, 256, m_xNonce, 1, subkey, CpuCipherFeatures::eReference);
+        if (err == ALC_ERROR_NONE) {
+            err = CHACHA::init(subkey, 256, iv + 16 - IVLEN, IVLEN);
+        }
+        memset(subkey, 0, sizeof(subkey));
+
+        return err;
+    }
 };
 
 namespace vaes512 {
     CIPHER_CLASS_GEN_(ChaCha256, ChaCha20, virtual iCipher, 256 / 8)
 
+    using XChaCha256 = XChaCha<ChaCha256, 16>;
 } // namespace vaes512
 
+namespace avx2 {
+    CIPHER_CLASS_GEN_(ChaCha256, ChaCha20, virtual iCipher, 256 / 8)
+
+    using XChaCha256 = XChaCha<ChaCha256, 16>;
+} // namespace avx2
+
 namespace ref {
     CIPHER_CLASS_GEN_(ChaCha256, ChaCha20, virtual iCipher, 256 / 8)
+
+    using XChaCha256 = XChaCha<ChaCha256, 16>;
 } // namespace ref
 
 } // namespace alcp::cipher
@@ -52,6 +52,8 @@ inline alc_error_t
 SetKey(Uint32 state[16], const Uint8 key[], Uint64 keylen);
 inline alc_error_t
 SetIv(Uint32 state[16], const Uint8 iv[], Uint64 ivlen);
+inline void
+HChaCha20Block(const Uint8 key[], const Uint8 nonce[], Uint8 subkey[]);
 inline alc_error_t
 CreateInitialState(Uint32      state[16],
                    const Uint8 key[],
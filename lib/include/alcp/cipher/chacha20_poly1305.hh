@@ -59,6 +59,12 @@ namespace vaes512 {
         const Uint8         m_zero_padding[16]{};
         len_input_processed m_len_input_processed{};
         len_aad_processed   m_len_aad_processed{};
+        bool                m_is_msg_started = false;
+        bool                m_is_key_set     = false;
+
+        // chunk of message run through ChaCha20 and Poly1305, input and
+        // output of a chunk stay in L2
+        static constexpr Uint64 cStitchChunkSize = 64 * 1024;
 
       public:
         ChaChaPlusPoly(Uint32 keyLen_in_bytes){};
@@ -66,11 +72,19 @@ namespace vaes512 {
 
         alc_error_t setIv(const Uint8* iv, Uint64 ivLen);
         alc_error_t setKey(const Uint8* key, Uint64 keylen);
+
+      protected:
+        alc_error_t padBlock(Uint64 processed);
+        alc_error_t startMessage();
+        alc_error_t cryptAndMac(const Uint8* pInput,
+                                Uint8*       pOutput,
+                                Uint64       len,
+                                bool         isEncrypt);
     };
 
     class ALCP_API_EXPORT ChaChaPoly
         : public ChaChaPlusPoly
-        , public virtual iCipher
+        , public virtual iCipherAead
     {
 
       public:
@@ -81,6 +95,19 @@ namespace vaes512 {
                          Uint64       keyLen,
                          const Uint8* pIv,
                          Uint64       ivLen) override;
+
+        // the keystream position is tied to the tag, no seeking
+        alc_error_t setStreamOffset(Uint64 byteOffset) override
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+
+        // packets with 12 byte nonces under the key already set, the state
+        // of the handle is left as it is
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
     };
 
     AEAD_AUTH_CLASS_GEN(ChaChaPolyAuth, ChaChaPoly, virtual iCipherAuth);
@@ -90,8 +117,98 @@ namespace vaes512 {
                       virtual iCipherAead,
                       256 / 8);
 
+    class ALCP_API_EXPORT XChaChaPoly256 : public XChaCha<ChaChaPoly256, 12>
+    {
+      public:
+        // packets with 24 byte nonces, each one gets its own subkey
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+    };
+
 } // namespace vaes512
 
+namespace avx2 {
+    class ALCP_API_EXPORT ChaChaPlusPoly
+        : public ChaCha256
+        , public alcp::mac::poly1305::Poly1305<CpuArchFeature::eDynamic>
+    {
+      protected:
+        Uint8               m_poly1305_key[32]{};
+        const Uint8         m_zero_padding[16]{};
+        len_input_processed m_len_input_processed{};
+        len_aad_processed   m_len_aad_processed{};
+        bool                m_is_msg_started = false;
+        bool                m_is_key_set     = false;
+
+        // chunk of message run through ChaCha20 and Poly1305, input and
+        // output of a chunk stay in L2
+        static constexpr Uint64 cStitchChunkSize = 64 * 1024;
+
+      public:
+        ChaChaPlusPoly(Uint32 keyLen_in_bytes){};
+        virtual ~ChaChaPlusPoly() = default;
+
+        alc_error_t setIv(const Uint8* iv, Uint64 ivLen);
+        alc_error_t setKey(const Uint8* key, Uint64 keylen);
+
+      protected:
+        alc_error_t padBlock(Uint64 processed);
+        alc_error_t startMessage();
+        alc_error_t cryptAndMac(const Uint8* pInput,
+                                Uint8*       pOutput,
+                                Uint64       len,
+                                bool         isEncrypt);
+    };
+
+    class ALCP_API_EXPORT ChaChaPoly
+        : public ChaChaPlusPoly
+        , public virtual iCipherAead
+    {
+
+      public:
+        ChaChaPoly(Uint32 keyLen_in_bytes)
+            : ChaChaPlusPoly(keyLen_in_bytes){}; /* fixed keyLen*/
+        virtual ~ChaChaPoly() = default;
+        alc_error_t init(const Uint8* pKey,
+                         Uint64       keyLen,
+                         const Uint8* pIv,
+                         Uint64       ivLen) override;
+
+        // the keystream position is tied to the tag, no seeking
+        alc_error_t setStreamOffset(Uint64 byteOffset) override
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+
+        // packets with 12 byte nonces under the key already set, the state
+        // of the handle is left as it is
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+    };
+
+    AEAD_AUTH_CLASS_GEN(ChaChaPolyAuth, ChaChaPoly, virtual iCipherAuth);
+
+    CIPHER_CLASS_GEN_(ChaChaPoly256,
+                      ChaChaPolyAuth,
+                      virtual iCipherAead,
+                      256 / 8);
+
+    class ALCP_API_EXPORT XChaChaPoly256 : public XChaCha<ChaChaPoly256, 12>
+    {
+      public:
+        // packets with 24 byte nonces, each one gets its own subkey
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+    };
+
+} // namespace avx2
+
 namespace ref {
 
     class ALCP_API_EXPORT ChaChaPlusPoly
@@ -103,6 +220,12 @@ namespace ref {
         const Uint8         m_zero_padding[16]{};
         len_input_processed m_len_input_processed{};
         len_aad_processed   m_len_aad_processed{};
+        bool                m_is_msg_started = false;
+        bool                m_is_key_set     = false;
+
+        // chunk of message run through ChaCha20 and Poly1305, input and
+        // output of a chunk stay in L2
+        static constexpr Uint64 cStitchChunkSize = 64 * 1024;
 
       public:
         ChaChaPlusPoly(Uint32 keyLen_in_bytes){};
@@ -110,11 +233,19 @@ namespace ref {
 
         alc_error_t setIv(const Uint8* iv, Uint64 ivLen);
         alc_error_t setKey(const Uint8* key, Uint64 keylen);
+
+      protected:
+        alc_error_t padBlock(Uint64 processed);
+        alc_error_t startMessage();
+        alc_error_t cryptAndMac(const Uint8* pInput,
+                                Uint8*       pOutput,
+                                Uint64       len,
+                                bool         isEncrypt);
     };
 
     class ALCP_API_EXPORT ChaChaPoly
         : public ChaChaPlusPoly
-        , public virtual iCipher
+        , public virtual iCipherAead
     {
 
       public:
@@ -125,6 +256,19 @@ namespace ref {
                          Uint64       keyLen,
                          const Uint8* pIv,
                          Uint64       ivLen) override;
+
+        // the keystream position is tied to the tag, no seeking
+        alc_error_t setStreamOffset(Uint64 byteOffset) override
+        {
+            return ALC_ERROR_NOT_SUPPORTED;
+        }
+
+        // packets with 12 byte nonces under the key already set, the state
+        // of the handle is left as it is
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
     };
 
     AEAD_AUTH_CLASS_GEN(ChaChaPolyAuth, ChaChaPoly, virtual iCipherAuth);
@@ -133,6 +277,16 @@ namespace ref {
                       ChaChaPolyAuth,
                       virtual iCipherAead,
                       256 / 8);
+
+    class ALCP_API_EXPORT XChaChaPoly256 : public XChaCha<ChaChaPoly256, 12>
+    {
+      public:
+        // packets with 24 byte nonces, each one gets its own subkey
+        alc_error_t sealBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+        alc_error_t openBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets) override;
+    };
 } // namespace ref
 
 } // namespace alcp::cipher
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/cipher_aead.h"
+#include "alcp/error.h"
+
+#include "alcp/cipher/cipher_common.hh"
+
+namespace alcp::cipher {
+
+/*
+ * Multi-packet ChaCha20-Poly1305
+ *
+ * Small packets are too short to go wide within one message, instead every
+ * SIMD lane carries a different packet. A ChaCha20 lane has its own key,
+ * counter and nonce and xors one block from m_pSrc to m_pDst per step, a
+ * Poly1305 lane has its own r and accumulator and absorbs one 16 byte block
+ * from m_pMsg per step. The driver hands a drained lane the next piece of
+ * work, a lane with no work points at scratch memory and does not advance
+ * (m_step == 0).
+ */
+static constexpr Uint32 cChaChaMbMaxLanes = 16;
+
+struct alignas(64) ChaChaMbLanes
+{
+    // word major so that a word of all lanes is one load
+    Uint32       m_key[8][cChaChaMbMaxLanes];
+    Uint32       m_counter[cChaChaMbMaxLanes];
+    Uint32       m_nonce[3][cChaChaMbMaxLanes];
+    const Uint8* m_pSrc[cChaChaMbMaxLanes];
+    Uint8*       m_pDst[cChaChaMbMaxLanes];
+    Uint64       m_step[cChaChaMbMaxLanes];
+};
+
+struct alignas(64) Poly1305MbLanes
+{
+    // radix 2^26 limbs, one 64 bit slot per lane
+    Uint64       m_h[5][cChaChaMbMaxLanes];
+    Uint64       m_r[5][cChaChaMbMaxLanes];
+    const Uint8* m_pMsg[cChaChaMbMaxLanes];
+    Uint64       m_step[cChaChaMbMaxLanes];
+};
+
+namespace avx2 {
+    static constexpr Uint32 cChaChaPolyMbLanes = 8;
+
+    void ChaCha20Mb(ChaChaMbLanes& lanes, Uint64 blocks);
+    void Poly1305Mb(Poly1305MbLanes& lanes, Uint64 blocks);
+} // namespace avx2
+
+namespace zen4 {
+    static constexpr Uint32 cChaChaPolyMbLanes = 16;
+
+    void ChaCha20Mb(ChaChaMbLanes& lanes, Uint64 blocks);
+    void Poly1305Mb(Poly1305MbLanes& lanes, Uint64 blocks);
+} // namespace zen4
+
+/**
+ * @brief Seals or opens a batch of ChaCha20-Poly1305 packets under one key.
+ *
+ * @param key         Key, 32 bytes
+ * @param pPackets    Array of packets, see alc_aead_packet_t
+ * @param numPackets  Number of packets
+ * @param nonceLen    Nonce length of every packet, 12 or 24 for
+ *                    XChaCha20-Poly1305
+ * @param isEncrypt   Seal when true, open otherwise
+ * @param arch        Kernel to be used, eReference is not supported
+ * @return ALC_ERROR_NONE on success, ALC_ERROR_TAG_MISMATCH if the tag of
+ * any of the opened packets did not match
+ */
+ALCP_API_EXPORT alc_error_t
+ChaChaPolyBatch(const Uint8        key[],
+                alc_aead_packet_t* pPackets,
+                Uint64             numPackets,
+                Uint64             nonceLen,
+                bool               isEncrypt,
+                CpuCipherFeatures  arch);
+
+} // namespace alcp::cipher
@@ -41,4 +41,12 @@ ProcessInput(const Uint8 key[],
              Uint8       ciphertext[],
              Uint64      blocks,
              int         remBytes);
+
+// HChaCha20 subkeys of numNonces 16 byte nonces under one key, 16 nonces at a
+// time
+void
+HChaCha20(const Uint8 key[],
+          const Uint8 nonces[],
+          Uint64      numNonces,
+          Uint8       subkeys[]);
 } // namespace alcp::cipher::zen4
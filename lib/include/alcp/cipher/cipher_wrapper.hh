@@ -50,6 +50,22 @@ alc_error_t
 tDecryptCbc(
     const Uint8* pSrc, Uint8* pDest, Uint64 len, const Uint8* pKey, Uint8* pIv);
 
+template<alcp::cipher::CipherKeyLen keyLen, alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+EncryptEcb(const Uint8* pSrc,
+           Uint8*       pDest,
+           Uint64       len,
+           const Uint8* pKey,
+           int          nRounds);
+
+template<alcp::cipher::CipherKeyLen keyLen, alcp::utils::CpuCipherFeatures arch>
+alc_error_t
+DecryptEcb(const Uint8* pSrc,
+           Uint8*       pDest,
+           Uint64       len,
+           const Uint8* pKey,
+           int          nRounds);
+
 template<alcp::cipher::CipherKeyLen keyLen, alcp::utils::CpuCipherFeatures arch>
 alc_error_t
 DecryptCfb(const Uint8* pSrc,
@@ -250,6 +266,15 @@ namespace vaes512 {
                               int            nRounds,
                               alc_gcm_ctx_t* gcmCtx);
 
+    alc_error_t cryptGcmBatch(alc_aead_packet_t* pPackets,
+                              Uint64             numPackets,
+                              const Uint8*       pKey,
+                              int                nRounds,
+                              bool               isEncrypt);
+
+    // H^1..H^32 as laid out by the kernels, MAX_NUM_512_BLKS * 8 words
+    void computeGcmHashTable(const Uint8* pKey, int nRounds, Uint64* pTable);
+
 } // namespace vaes512
 
 namespace vaes {
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/cipher/chacha20_poly1305_mb.hh"
+
+/*
+ * Poly1305 block function over the lanes of Poly1305MbLanes, shared by the
+ * arch kernels. Only to be included from lib/arch, every arch instantiates
+ * it with its own vector wrapper V of 64 bit slots:
+ *   V::T                      vector type
+ *   V::cLanes                 lanes per vector
+ *   V::load / V::store        unaligned load and store of cLanes Uint64
+ *   V::loadBlocks(p, lo, hi)  the 16 byte blocks at p[0..cLanes), split in
+ *                             their low and high 64 bits
+ *   V::add / V::and_ / V::or_ 64 bit lane ops
+ *   V::mul(a, b)              low 32 bits of a and b multiplied to 64 bits
+ *   V::srli<N> / V::slli<N>   64 bit lane shifts
+ *   V::set1                   broadcast of a Uint64
+ * Every block is a full block, in ChaCha20-Poly1305 the message and the aad
+ * are padded to 16 bytes.
+ */
+namespace alcp::cipher::poly1305mb {
+
+template<class V, Uint32 cNumLanes>
+inline void
+Blocks(Poly1305MbLanes& lanes, Uint64 blocks)
+{
+    using T = typename V::T;
+
+    // vectors per limb
+    constexpr Uint32 cN = cNumLanes / V::cLanes;
+
+    const T cMask  = V::set1(0x3ffffff);
+    const T cHibit = V::set1(1 << 24);
+
+    T h[5][cN], r[5][cN], s[5][cN];
+    for (int i = 0; i < 5; i++) {
+        for (Uint32 v = 0; v < cN; v++) {
+            h[i][v] = V::load(&lanes.m_h[i][v * V::cLanes]);
+            r[i][v] = V::load(&lanes.m_r[i][v * V::cLanes]);
+            // 2^130 = 5 mod p, s = 5 * r folds the high products back
+            s[i][v] = V::add(V::template slli<2>(r[i][v]), r[i][v]);
+        }
+    }
+
+    const Uint8* p[cNumLanes];
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        p[l] = lanes.m_pMsg[l];
+    }
+
+    for (Uint64 b = 0; b < blocks; b++) {
+        for (Uint32 v = 0; v < cN; v++) {
+            T lo, hi;
+            V::loadBlocks(p + v * V::cLanes, lo, hi);
+
+            // h += m, the block split in 26 bit limbs with the 2^128 bit
+            T h0 = V::add(h[0][v], V::and_(lo, cMask));
+            T h1 = V::add(h[1][v], V::and_(V::template srli<26>(lo), cMask));
+            T h2 = V::add(h[2][v],
+                          V::and_(V::or_(V::template srli<52>(lo),
+                                         V::template slli<12>(hi)),
+                                  cMask));
+            T h3 = V::add(h[3][v], V::and_(V::template srli<14>(hi), cMask));
+            T h4 = V::add(h[4][v], V::or_(V::template srli<40>(hi), cHibit));
+
+            // h *= r mod 2^130 - 5
+            T d0 = V::mul(h0, r[0][v]);
+            d0   = V::add(d0, V::mul(h1, s[4][v]));
+            d0   = V::add(d0, V::mul(h2, s[3][v]));
+            d0   = V::add(d0, V::mul(h3, s[2][v]));
+            d0   = V::add(d0, V::mul(h4, s[1][v]));
+            T d1 = V::mul(h0, r[1][v]);
+            d1   = V::add(d1, V::mul(h1, r[0][v]));
+            d1   = V::add(d1, V::mul(h2, s[4][v]));
+            d1   = V::add(d1, V::mul(h3, s[3][v]));
+            d1   = V::add(d1, V::mul(h4, s[2][v]));
+            T d2 = V::mul(h0, r[2][v]);
+            d2   = V::add(d2, V::mul(h1, r[1][v]));
+            d2   = V::add(d2, V::mul(h2, r[0][v]));
+            d2   = V::add(d2, V::mul(h3, s[4][v]));
+            d2   = V::add(d2, V::mul(h4, s[3][v]));
+            T d3 = V::mul(h0, r[3][v]);
+            d3   = V::add(d3, V::mul(h1, r[2][v]));
+            d3   = V::add(d3, V::mul(h2, r[1][v]));
+            d3   = V::add(d3, V::mul(h3, r[0][v]));
+            d3   = V::add(d3, V::mul(h4, s[4][v]));
+            T d4 = V::mul(h0, r[4][v]);
+            d4   = V::add(d4, V::mul(h1, r[3][v]));
+            d4   = V::add(d4, V::mul(h2, r[2][v]));
+            d4   = V::add(d4, V::mul(h3, r[1][v]));
+            d4   = V::add(d4, V::mul(h4, r[0][v]));
+
+            // partial carry, the limbs stay small enough for the next block
+            d1      = V::add(d1, V::template srli<26>(d0));
+            d2      = V::add(d2, V::template srli<26>(d1));
+            d3      = V::add(d3, V::template srli<26>(d2));
+            d4      = V::add(d4, V::template srli<26>(d3));
+            T c     = V::template srli<26>(d4);
+            h0      = V::add(V::and_(d0, cMask),
+                        V::add(V::template slli<2>(c), c));
+            h[1][v] = V::add(V::and_(d1, cMask), V::template srli<26>(h0));
+            h[0][v] = V::and_(h0, cMask);
+            h[2][v] = V::and_(d2, cMask);
+            h[3][v] = V::and_(d3, cMask);
+            h[4][v] = V::and_(d4, cMask);
+        }
+        for (Uint32 l = 0; l < cNumLanes; l++) {
+            p[l] += lanes.m_step[l];
+        }
+    }
+
+    for (int i = 0; i < 5; i++) {
+        for (Uint32 v = 0; v < cN; v++) {
+            V::store(&lanes.m_h[i][v * V::cLanes], h[i][v]);
+        }
+    }
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        lanes.m_pMsg[l] = p[l];
+    }
+}
+
+} // namespace alcp::cipher::poly1305mb
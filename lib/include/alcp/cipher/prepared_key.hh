@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/error.h"
+
+#include "alcp/cipher.hh"
+#include "alcp/cipher/aes_gcm.hh"
+#include "alcp/cipher/rijndael.hh"
+
+#include <atomic>
+#include <immintrin.h>
+
+namespace alcp::cipher {
+
+/*
+ * @brief  Expanded AES key, computed once and then only read.
+ *
+ * A prepared key is created holding one reference which belongs to the
+ * caller, every cipher it is attached to takes one more and drops it when
+ * a new key is set or the cipher goes away. Nothing changes after create(),
+ * so any number of ciphers on any number of threads can share it.
+ *
+ * Next to the round keys it keeps what a mode would otherwise rebuild on
+ * every init: the tweak round keys of XTS and the powers of the hash subkey
+ * used by the VAES-512 kernels of GCM.
+ */
+class ALCP_API_EXPORT PreparedKey
+{
+  public:
+    static constexpr Uint32 cRoundKeySize =
+        Rijndael::cMaxKeySize * (Rijndael::cMaxRounds + 2);
+
+    /* keyLen in bits, for XTS pKey holds the data key and the tweak key */
+    static alc_error_t create(CipherMode    mode,
+                              const Uint8*  pKey,
+                              Uint64        keyLen,
+                              PreparedKey** ppKey);
+
+    void retain() const;
+    void release() const;
+
+    CipherMode   getMode() const { return m_mode; }
+    Uint64       getKeyLen() const { return m_keyLen; }
+    const Uint8* getEncryptKeys() const { return m_enc_key; }
+    const Uint8* getDecryptKeys() const { return m_dec_key; }
+    const Uint8* getTweakKeys() const { return m_tweak_key; }
+
+    /* nullptr unless the key is for GCM and the VAES-512 kernels are used */
+    const __m512i* getHashSubkeyTable() const
+    {
+        return m_hasHashSubkeyTable
+                   ? reinterpret_cast<const __m512i*>(m_hashSubkeyTable)
+                   : nullptr;
+    }
+
+  private:
+    PreparedKey(CipherMode mode, Uint64 keyLen);
+    ~PreparedKey();
+
+    mutable std::atomic<Uint32> m_refs{ 1 };
+
+    CipherMode m_mode               = CipherMode::eCipherModeNone;
+    Uint64     m_keyLen             = 0;
+    bool       m_hasHashSubkeyTable = false;
+
+    __attribute__((aligned(64))) Uint8 m_enc_key[cRoundKeySize]   = {};
+    __attribute__((aligned(64))) Uint8 m_dec_key[cRoundKeySize]   = {};
+    __attribute__((aligned(64))) Uint8 m_tweak_key[cRoundKeySize] = {};
+    __attribute__((aligned(64))) Uint64
+        m_hashSubkeyTable[MAX_NUM_512_BLKS * 8] = {};
+};
+
+} // namespace alcp::cipher
@@ -78,8 +78,8 @@ class ALCP_API_EXPORT Rijndael
     __attribute__((aligned(64)))
     Uint8 m_round_key_dec[cMaxKeySize * (cMaxRounds + 2)] = {};
 
-    Uint8* m_enc_key = NULL;
-    Uint8* m_dec_key = NULL;
+    const Uint8* m_enc_key = NULL;
+    const Uint8* m_dec_key = NULL;
 
     Uint32    m_nrounds    = 0; /* no of rounds */
     Uint32    m_ncolumns   = 0; /* no of columns in matrix */
@@ -134,8 +134,13 @@ class ALCP_API_EXPORT Rijndael
     void setKey(const Uint8* key, int len);
     void setKey(const Uint8* key, Uint8* pExpKey, int len);
 
+    /* round keys expanded by another Rijndael, they are used in place */
+    void setExpandedKeys(const Uint8* pEncKey, const Uint8* pDecKey, int len);
+
   private:
-    void expandKeys(const Uint8* pUserKey) noexcept;
+    void expandKeys(const Uint8* pUserKey,
+                    Uint8*       pEncKey,
+                    Uint8*       pDecKey) noexcept;
     void addRoundKey(Uint8 state[][4], Uint8 k[][4]) noexcept;
 };
 
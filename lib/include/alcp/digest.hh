@@ -36,24 +36,12 @@
 #include "alcp/utils/bits.hh"
 
 /* System headers */
-/* FIXME: Disabling temporarily to fix a compilation error while using AOCC */
-#if 0
-#include <memory_resource>
-#endif
 #include <string>
 
 namespace alcp::digest {
 using alcp::utils::RotateLeft;
 using alcp::utils::RotateRight;
 
-/* FIXME: Disabling temporarily to fix a compilation error while using AOCC */
-#if 0
-typedef std::pmr::synchronized_pool_resource DigestPool;
-
-std::pmr::synchronized_pool_resource&
-GetDefaultDigestPool();
-#endif
-
 class IDigest
 {
   public:
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/digest.h"
+#include "alcp/error.h"
+
+namespace alcp::digest {
+
+/*
+ * Multi-buffer digests
+ *
+ * A single message cannot be hashed wide, every block depends on the state
+ * left by the previous one. Instead every SIMD lane carries a different
+ * message: a lane has its own chaining state and compresses one block from
+ * m_pData per step. The driver hands a drained lane the next message, a lane
+ * with no work points at scratch memory and does not advance (m_step == 0).
+ */
+static constexpr Uint32 cDigestMbMaxLanes = 16;
+
+template<typename WORD, Uint32 cStateWords>
+struct alignas(64) DigestMbLanes
+{
+    // word major so that a word of all lanes is one load
+    WORD         m_state[cStateWords][cDigestMbMaxLanes];
+    const Uint8* m_pData[cDigestMbMaxLanes];
+    Uint64       m_step[cDigestMbMaxLanes];
+};
+
+using Md5MbLanes    = DigestMbLanes<Uint32, 4>;
+using Sha1MbLanes   = DigestMbLanes<Uint32, 5>;
+using Sha256MbLanes = DigestMbLanes<Uint32, 8>;
+using Sha512MbLanes = DigestMbLanes<Uint64, 8>;
+
+namespace avx2 {
+    static constexpr Uint32 cMd5MbLanes    = 8;
+    static constexpr Uint32 cSha1MbLanes   = 8;
+    static constexpr Uint32 cSha256MbLanes = 8;
+    static constexpr Uint32 cSha512MbLanes = 4;
+
+    void Md5Mb(Md5MbLanes& lanes, Uint64 blocks);
+    void Sha1Mb(Sha1MbLanes& lanes, Uint64 blocks);
+    void Sha256Mb(Sha256MbLanes& lanes, Uint64 blocks);
+    void Sha512Mb(Sha512MbLanes& lanes, Uint64 blocks);
+} // namespace avx2
+
+namespace zen4 {
+    static constexpr Uint32 cMd5MbLanes    = 16;
+    static constexpr Uint32 cSha1MbLanes   = 16;
+    static constexpr Uint32 cSha256MbLanes = 16;
+    static constexpr Uint32 cSha512MbLanes = 8;
+
+    void Md5Mb(Md5MbLanes& lanes, Uint64 blocks);
+    void Sha1Mb(Sha1MbLanes& lanes, Uint64 blocks);
+    void Sha256Mb(Sha256MbLanes& lanes, Uint64 blocks);
+    void Sha512Mb(Sha512MbLanes& lanes, Uint64 blocks);
+} // namespace zen4
+
+enum class DigestMbArch
+{
+    eReference = 0, // one message after the other
+    eAvx2,
+    eAvx512,
+};
+
+/**
+ * @brief Hashes a batch of independent messages.
+ *
+ * @param mode      Digest of every message, MD5, SHA-1, MD5+SHA-1 or one of
+ *                  the SHA-2 modes
+ * @param pJobs     Array of jobs, see alc_digest_mb_job_t
+ * @param numJobs   Number of jobs
+ * @param arch      Kernel to be used
+ * @return ALC_ERROR_NONE on success, ALC_ERROR_NOT_SUPPORTED for any other
+ * mode
+ */
+ALCP_API_EXPORT alc_error_t
+DigestMb(alc_digest_mode_t          mode,
+         const alc_digest_mb_job_t* pJobs,
+         Uint64                     numJobs,
+         DigestMbArch               arch);
+
+/**
+ * @brief Same as above, kernel selected based on the cpu features
+ */
+ALCP_API_EXPORT alc_error_t
+DigestMb(alc_digest_mode_t          mode,
+         const alc_digest_mb_job_t* pJobs,
+         Uint64                     numJobs);
+
+/**
+ * @brief Widest multi-buffer kernel supported by the cpu, eReference if
+ * there is none
+ */
+DigestMbArch
+getDigestMbArch();
+
+} // namespace alcp::digest
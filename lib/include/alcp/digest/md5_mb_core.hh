@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/digest/digest_mb.hh"
+
+#include <utility>
+
+/*
+ * MD5 compression over the lanes of Md5MbLanes, shared by the arch kernels.
+ * Only to be included from lib/arch, with the 32 bit vector wrapper V of the
+ * SHA-256 kernel (see sha2_mb_core.hh) and in addition
+ *   V::loadBlockLe(p, w)       as V::loadBlockBe, little endian words
+ *   V::md5I                    MD5 function I, c ^ (b | ~d)
+ */
+namespace alcp::digest::md5mb {
+
+// RFC 1321 3.4, floor(abs(sin(i + 1)) * 2^32)
+static constexpr Uint32 cMd5RoundConstants[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a,
+    0xa8304613, 0xfd469501, 0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821, 0xf61e2562, 0xc040b340,
+    0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8,
+    0x676f02d9, 0x8d2a4c8a, 0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70, 0x289b7ec6, 0xeaa127fa,
+    0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92,
+    0xffeff47d, 0x85845dd1, 0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+// left rotate amounts, four per group of 16 rounds
+static constexpr int cMd5Shifts[4][4] = {
+    { 7, 12, 17, 22 }, { 5, 9, 14, 20 }, { 4, 11, 16, 23 }, { 6, 10, 15, 21 }
+};
+
+// message word of round r
+constexpr int
+md5MsgIndex(int r)
+{
+    switch (r / 16) {
+        case 0:
+            return r;
+        case 1:
+            return (5 * r + 1) % 16;
+        case 2:
+            return (3 * r + 5) % 16;
+        default:
+            return (7 * r) % 16;
+    }
+}
+
+// one round, the rounds are unrolled so that the rotate is an immediate
+template<class V, int R>
+inline void
+md5Round(typename V::T s[4], const typename V::T w[16])
+{
+    using T = typename V::T;
+
+    constexpr int cGroup = R / 16;
+    constexpr int cShift = cMd5Shifts[cGroup][R % 4];
+
+    // a, b, c, d of this round, the roles move by one word every round
+    T& a = s[(64 - R) % 4];
+    T  b = s[(65 - R) % 4];
+    T  c = s[(66 - R) % 4];
+    T  d = s[(67 - R) % 4];
+    T  f;
+
+    if constexpr (cGroup == 0) {
+        f = V::ch(b, c, d);
+    } else if constexpr (cGroup == 1) {
+        f = V::ch(d, b, c);
+    } else if constexpr (cGroup == 2) {
+        f = V::xor3(b, c, d);
+    } else {
+        f = V::md5I(b, c, d);
+    }
+
+    T x = V::add(V::add(a, f),
+                 V::add(w[md5MsgIndex(R)], V::set1(cMd5RoundConstants[R])));
+    a   = V::add(b, V::template rotr<32 - cShift>(x));
+}
+
+template<class V, int... R>
+inline void
+md5Rounds(typename V::T s[4],
+          const typename V::T w[16],
+          std::integer_sequence<int, R...>)
+{
+    (md5Round<V, R>(s, w), ...);
+}
+
+template<class V>
+inline void
+Blocks(Md5MbLanes& lanes, Uint64 blocks)
+{
+    using T = typename V::T;
+
+    constexpr Uint32 cNumLanes = V::cLanes;
+
+    T s[4];
+    for (int i = 0; i < 4; i++) {
+        s[i] = V::load(lanes.m_state[i]);
+    }
+
+    const Uint8* p[cNumLanes];
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        p[l] = lanes.m_pData[l];
+    }
+
+    for (Uint64 blk = 0; blk < blocks; blk++) {
+        T w[16];
+        V::loadBlockLe(p, w);
+
+        T v[4] = { s[0], s[1], s[2], s[3] };
+        md5Rounds<V>(v, w, std::make_integer_sequence<int, 64>{});
+
+        for (int i = 0; i < 4; i++) {
+            s[i] = V::add(s[i], v[i]);
+        }
+
+        for (Uint32 l = 0; l < cNumLanes; l++) {
+            p[l] += lanes.m_step[l];
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        V::store(lanes.m_state[i], s[i]);
+    }
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        lanes.m_pData[l] = p[l];
+    }
+}
+
+} // namespace alcp::digest::md5mb
@@ -33,9 +33,21 @@ namespace alcp::digest {
 class ALCP_API_EXPORT Sha1 final : public IDigest
 {
 
+  public:
+    static constexpr Uint64 cChunkSize     = 64,
+                            cChunkSizeMask = cChunkSize - 1,
+                            cHashSizeWords = 5;
+
   private:
-    EVP_MD_CTX* m_ctx = nullptr;
-    EVP_MD*     m_md  = nullptr;
+    /* SHA-NI is used when available, OpenSSL otherwise */
+    bool        m_use_shani = false;
+    EVP_MD_CTX* m_ctx       = nullptr;
+    EVP_MD*     m_md        = nullptr;
+    alignas(16) Uint32 m_hash[cHashSizeWords];
+    /* two chunks for the length encoding */
+    Uint8 m_buffer[2 * cChunkSize];
+
+    alc_error_t processChunk(const Uint8* pSrc, Uint64 len);
 
   public:
     Sha1();
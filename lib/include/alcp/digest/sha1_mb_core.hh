@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/digest/digest_mb.hh"
+
+/*
+ * SHA-1 compression over the lanes of Sha1MbLanes, shared by the arch
+ * kernels. Only to be included from lib/arch, with the 32 bit vector wrapper
+ * V of the SHA-256 kernel (see sha2_mb_core.hh) and in addition
+ *   V::xor2                    lane xor of two vectors
+ */
+namespace alcp::digest::sha1mb {
+
+// FIPS 180-4 4.2.1, one per group of 20 rounds
+static constexpr Uint32 cSha1RoundConstants[4] = {
+    0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6
+};
+
+template<class V>
+inline void
+Blocks(Sha1MbLanes& lanes, Uint64 blocks)
+{
+    using T = typename V::T;
+
+    constexpr Uint32 cNumLanes = V::cLanes;
+
+    T s[5];
+    for (int i = 0; i < 5; i++) {
+        s[i] = V::load(lanes.m_state[i]);
+    }
+
+    const Uint8* p[cNumLanes];
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        p[l] = lanes.m_pData[l];
+    }
+
+    for (Uint64 blk = 0; blk < blocks; blk++) {
+        T w[16];
+        V::loadBlockBe(p, w);
+
+        T a = s[0], b = s[1], c = s[2], d = s[3], e = s[4];
+
+        for (int t = 0; t < 80; t++) {
+            // message schedule kept in a ring of 16 words, rotl 1
+            if (t >= 16) {
+                T x = V::xor3(
+                    w[(t - 3) & 15], w[(t - 8) & 15], w[(t - 14) & 15]);
+                w[t & 15] = V::template rotr<31>(V::xor2(x, w[t & 15]));
+            }
+
+            T f;
+            if (t < 20) {
+                f = V::ch(b, c, d);
+            } else if (t < 40 || t >= 60) {
+                f = V::xor3(b, c, d);
+            } else {
+                f = V::maj(b, c, d);
+            }
+
+            T tmp = V::add(V::add(V::template rotr<27>(a), f),
+                           V::add(e, w[t & 15]));
+            tmp   = V::add(tmp, V::set1(cSha1RoundConstants[t / 20]));
+
+            e = d;
+            d = c;
+            c = V::template rotr<2>(b);
+            b = a;
+            a = tmp;
+        }
+
+        s[0] = V::add(s[0], a);
+        s[1] = V::add(s[1], b);
+        s[2] = V::add(s[2], c);
+        s[3] = V::add(s[3], d);
+        s[4] = V::add(s[4], e);
+
+        for (Uint32 l = 0; l < cNumLanes; l++) {
+            p[l] += lanes.m_step[l];
+        }
+    }
+
+    for (int i = 0; i < 5; i++) {
+        V::store(lanes.m_state[i], s[i]);
+    }
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        lanes.m_pData[l] = p[l];
+    }
+}
+
+} // namespace alcp::digest::sha1mb
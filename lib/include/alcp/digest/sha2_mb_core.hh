@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/digest/digest_mb.hh"
+#include "alcp/digest/sha512.hh"
+
+/*
+ * SHA-2 compression over the lanes of Sha256MbLanes or Sha512MbLanes, shared
+ * by the arch kernels. Only to be included from lib/arch, every arch
+ * instantiates it with its own vector wrapper V of 32 bit (SHA-256) or 64 bit
+ * (SHA-512) slots, one slot per lane:
+ *   V::T                       vector type
+ *   V::cLanes                  lanes per vector
+ *   V::load / V::store         unaligned load and store of cLanes words
+ *   V::loadBlockBe(p, w)       the blocks at p[0..cLanes) as 16 big endian
+ *                              words, w[i] holds word i of every lane
+ *   V::add / V::xor3           lane ops
+ *   V::ch / V::maj             SHA-2 choose and majority functions
+ *   V::rotr<N> / V::srli<N>    lane rotate and shift
+ *   V::set1                    broadcast of a word
+ */
+namespace alcp::digest::sha2mb {
+
+static constexpr Uint32 cSha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+// rotate and shift amounts of FIPS 180-4 4.1.2 and 4.1.3
+struct Sha256Params
+{
+    using Word = Uint32;
+
+    static constexpr int cRounds    = 64;
+    static constexpr int cSum0[3]   = { 2, 13, 22 };
+    static constexpr int cSum1[3]   = { 6, 11, 25 };
+    static constexpr int cSigma0[3] = { 7, 18, 3 };
+    static constexpr int cSigma1[3] = { 17, 19, 10 };
+
+    static constexpr const Word* cK = cSha256RoundConstants;
+};
+
+struct Sha512Params
+{
+    using Word = Uint64;
+
+    static constexpr int cRounds    = 80;
+    static constexpr int cSum0[3]   = { 28, 34, 39 };
+    static constexpr int cSum1[3]   = { 14, 18, 41 };
+    static constexpr int cSigma0[3] = { 1, 8, 7 };
+    static constexpr int cSigma1[3] = { 19, 61, 6 };
+
+    static constexpr const Word* cK = digest::cRoundConstants;
+};
+
+template<class V, class P>
+inline void
+Blocks(DigestMbLanes<typename P::Word, 8>& lanes, Uint64 blocks)
+{
+    using T = typename V::T;
+
+    constexpr Uint32 cNumLanes = V::cLanes;
+
+    T s[8];
+    for (int i = 0; i < 8; i++) {
+        s[i] = V::load(lanes.m_state[i]);
+    }
+
+    const Uint8* p[cNumLanes];
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        p[l] = lanes.m_pData[l];
+    }
+
+    for (Uint64 blk = 0; blk < blocks; blk++) {
+        T w[16];
+        V::loadBlockBe(p, w);
+
+        T a = s[0], b = s[1], c = s[2], d = s[3];
+        T e = s[4], f = s[5], g = s[6], h = s[7];
+
+        for (int t = 0; t < P::cRounds; t++) {
+            // message schedule kept in a ring of 16 words
+            if (t >= 16) {
+                T w2  = w[(t - 2) & 15];
+                T w15 = w[(t - 15) & 15];
+                T s0  = V::xor3(V::template rotr<P::cSigma0[0]>(w15),
+                               V::template rotr<P::cSigma0[1]>(w15),
+                               V::template srli<P::cSigma0[2]>(w15));
+                T s1  = V::xor3(V::template rotr<P::cSigma1[0]>(w2),
+                               V::template rotr<P::cSigma1[1]>(w2),
+                               V::template srli<P::cSigma1[2]>(w2));
+                w[t & 15] =
+                    V::add(V::add(w[t & 15], s0), V::add(w[(t - 7) & 15], s1));
+            }
+
+            T s1 = V::xor3(V::template rotr<P::cSum1[0]>(e),
+                           V::template rotr<P::cSum1[1]>(e),
+                           V::template rotr<P::cSum1[2]>(e));
+            T t1 = V::add(V::add(h, s1), V::add(V::ch(e, f, g), w[t & 15]));
+            t1   = V::add(t1, V::set1(P::cK[t]));
+            T s0 = V::xor3(V::template rotr<P::cSum0[0]>(a),
+                           V::template rotr<P::cSum0[1]>(a),
+                           V::template rotr<P::cSum0[2]>(a));
+            T t2 = V::add(s0, V::maj(a, b, c));
+
+            h = g;
+            g = f;
+            f = e;
+            e = V::add(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = V::add(t1, t2);
+        }
+
+        s[0] = V::add(s[0], a);
+        s[1] = V::add(s[1], b);
+        s[2] = V::add(s[2], c);
+        s[3] = V::add(s[3], d);
+        s[4] = V::add(s[4], e);
+        s[5] = V::add(s[5], f);
+        s[6] = V::add(s[6], g);
+        s[7] = V::add(s[7], h);
+
+        for (Uint32 l = 0; l < cNumLanes; l++) {
+            p[l] += lanes.m_step[l];
+        }
+    }
+
+    for (int i = 0; i < 8; i++) {
+        V::store(lanes.m_state[i], s[i]);
+    }
+    for (Uint32 l = 0; l < cNumLanes; l++) {
+        lanes.m_pData[l] = p[l];
+    }
+}
+
+} // namespace alcp::digest::sha2mb
@@ -33,4 +33,5 @@
 namespace alcp::digest { namespace shani {
 
     alc_error_t ShaUpdate256(Uint32* pHash, const Uint8* pSrc, Uint64 src_len);
+    alc_error_t ShaUpdate1(Uint32* pHash, const Uint8* pSrc, Uint64 src_len);
 }} // namespace alcp::digest::shani
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/base.hh"
+#include "alcp/error.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace alcp::utils {
+
+/*
+ * Process wide pool of worker threads owned by the library, the workers are
+ * started on first use and live until the library is unloaded. A forked
+ * child starts over with no workers, the parent's do not exist there.
+ */
+class ALCP_API_EXPORT ThreadPool
+{
+  public:
+    using TaskT = std::function<alc_error_t(Uint64)>;
+
+    static ThreadPool& getInstance();
+
+    // threads available to run(), the number of online cpus
+    static Uint32 getMaxThreads();
+
+    /*
+     * Runs task(0) .. task(numTasks - 1) on the calling thread and at most
+     * numThreads - 1 workers, returns once all of them have finished with
+     * the first error a task reported.
+     */
+    alc_error_t run(Uint64 numTasks, Uint32 numThreads, const TaskT& task);
+
+  private:
+    struct Job;
+    struct Workers;
+
+    ThreadPool();
+    ~ThreadPool();
+
+    void worker(Workers* pWorkers);
+
+    static void forkPrepare();
+    static void forkParent();
+    static void forkChild();
+
+    std::mutex m_lock;
+    // guarded by m_lock, created with the first worker
+    std::unique_ptr<Workers> m_pWorkers;
+};
+
+} // namespace alcp::utils
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/utils/thread_pool.hh"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace alcp::utils;
+
+TEST(ThreadPool, RunsEveryTaskOnce)
+{
+    std::vector<std::atomic<int>> hits(1000);
+
+    auto task = [&](Uint64 i) {
+        hits[i]++;
+        return ALC_ERROR_NONE;
+    };
+
+    for (Uint32 threads : { 1, 2, 4, 16 }) {
+        for (auto& h : hits) {
+            h = 0;
+        }
+        EXPECT_EQ(ThreadPool::getInstance().run(hits.size(), threads, task),
+                  ALC_ERROR_NONE);
+        for (auto& h : hits) {
+            EXPECT_EQ(h, 1);
+        }
+    }
+}
+
+TEST(ThreadPool, ReportsTaskError)
+{
+    auto task = [](Uint64 i) {
+        return i == 7 ? ALC_ERROR_INVALID_DATA : ALC_ERROR_NONE;
+    };
+
+    EXPECT_EQ(ThreadPool::getInstance().run(64, 4, task),
+              ALC_ERROR_INVALID_DATA);
+    EXPECT_EQ(ThreadPool::getInstance().run(0, 4, task), ALC_ERROR_NONE);
+}
+
+TEST(ThreadPool, ConcurrentCallers)
+{
+    std::atomic<Uint64> sum{ 0 };
+
+    auto task = [&](Uint64 i) {
+        sum += i;
+        return ALC_ERROR_NONE;
+    };
+
+    std::vector<std::thread> callers;
+    for (int c = 0; c < 4; c++) {
+        callers.emplace_back(
+            [&] { ThreadPool::getInstance().run(100, 4, task); });
+    }
+    for (auto& t : callers) {
+        t.join();
+    }
+    EXPECT_EQ(sum, 4 * (99 * 100 / 2));
+}
+
+#ifdef __linux__
+// Tasks of a run() in a forked child still reach the pool's workers
+TEST(ThreadPool, WorksAfterFork)
+{
+    auto helped = [](Uint32 threads) {
+        std::thread::id     caller = std::this_thread::get_id();
+        std::atomic<Uint64> others{ 0 };
+
+        auto task = [&](Uint64 i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (std::this_thread::get_id() != caller) {
+                others++;
+            }
+            return ALC_ERROR_NONE;
+        };
+        alc_error_t err = ThreadPool::getInstance().run(64, threads, task);
+        return err == ALC_ERROR_NONE
+               && (ThreadPool::getMaxThreads() == 1 || others > 0);
+    };
+
+    // workers of the parent are started before the fork
+    ASSERT_TRUE(helped(4));
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        _exit(helped(4) && helped(4) ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    EXPECT_TRUE(helped(4));
+}
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/utils/thread_pool.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+
+#ifndef WIN32
+#include <pthread.h>
+#endif
+
+namespace alcp::utils {
+
+// Tasks are handed out by index so a job queued for several workers is
+// drained by whoever gets there first
+struct ThreadPool::Job
+{
+    const TaskT*             m_pTask    = nullptr;
+    Uint64                   m_numTasks = 0;
+    std::atomic<Uint64>      m_next{ 0 };
+    std::atomic<Uint64>      m_pending{ 0 };
+    std::atomic<alc_error_t> m_err{ ALC_ERROR_NONE };
+    std::mutex               m_lock;
+    std::condition_variable  m_done;
+
+    void drain()
+    {
+        Uint64 i;
+        while ((i = m_next.fetch_add(1)) < m_numTasks) {
+            alc_error_t err = (*m_pTask)(i);
+            if (err != ALC_ERROR_NONE) {
+                alc_error_t none = ALC_ERROR_NONE;
+                m_err.compare_exchange_strong(none, err);
+            }
+            if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> guard(m_lock);
+                m_done.notify_all();
+            }
+        }
+    }
+};
+
+// The worker threads and the queue they wait on
+struct ThreadPool::Workers
+{
+    std::condition_variable          m_wake;
+    std::deque<std::shared_ptr<Job>> m_queue;
+    std::vector<std::thread>         m_threads;
+    bool                             m_stop = false;
+};
+
+ThreadPool&
+ThreadPool::getInstance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+Uint32
+ThreadPool::getMaxThreads()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool()
+{
+#ifndef WIN32
+    pthread_atfork(forkPrepare, forkParent, forkChild);
+#endif
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (!m_pWorkers) {
+            return;
+        }
+        m_pWorkers->m_stop = true;
+    }
+    m_pWorkers->m_wake.notify_all();
+    for (auto& t : m_pWorkers->m_threads) {
+        t.join();
+    }
+}
+
+// m_lock is held across fork() so that the child gets it in a known state
+void
+ThreadPool::forkPrepare()
+{
+    getInstance().m_lock.lock();
+}
+
+void
+ThreadPool::forkParent()
+{
+    getInstance().m_lock.unlock();
+}
+
+/*
+ * Only the forking thread lives on in the child. The workers' bookkeeping is
+ * abandoned rather than destroyed: joining or destroying threads and a
+ * condition variable with waiters that do not exist would never return. The
+ * next run() spawns new workers.
+ */
+void
+ThreadPool::forkChild()
+{
+    ThreadPool& pool = getInstance();
+
+    static_cast<void>(pool.m_pWorkers.release());
+    pool.m_lock.unlock();
+}
+
+void
+ThreadPool::worker(Workers* pWorkers)
+{
+    for (;;) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            pWorkers->m_wake.wait(guard, [pWorkers] {
+                return pWorkers->m_stop || !pWorkers->m_queue.empty();
+            });
+            if (pWorkers->m_stop) {
+                return;
+            }
+            job = std::move(pWorkers->m_queue.front());
+            pWorkers->m_queue.pop_front();
+        }
+        job->drain();
+    }
+}
+
+alc_error_t
+ThreadPool::run(Uint64 numTasks, Uint32 numThreads, const TaskT& task)
+{
+    Uint64 helpers = std::min<Uint64>(
+        std::min(numThreads, getMaxThreads()), numTasks);
+    if (helpers > 0) {
+        helpers--; // the calling thread takes part
+    }
+
+    if (helpers == 0) {
+        for (Uint64 i = 0; i < numTasks; i++) {
+            alc_error_t err = task(i);
+            if (err != ALC_ERROR_NONE) {
+                return err;
+            }
+        }
+        return ALC_ERROR_NONE;
+    }
+
+    auto job        = std::make_shared<Job>();
+    job->m_pTask    = &task;
+    job->m_numTasks = numTasks;
+    job->m_pending  = numTasks;
+
+    Workers* p_workers;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (!m_pWorkers) {
+            m_pWorkers = std::make_unique<Workers>();
+        }
+        p_workers = m_pWorkers.get();
+
+        auto& threads = p_workers->m_threads;
+        try {
+            while (threads.size() < helpers) {
+                threads.emplace_back(&ThreadPool::worker, this, p_workers);
+            }
+        } catch (const std::system_error&) {
+            // Out of threads, go on with the workers there are
+        }
+        // A reference no live worker would pop is never released
+        helpers = std::min<Uint64>(helpers, threads.size());
+        for (Uint64 i = 0; i < helpers; i++) {
+            p_workers->m_queue.push_back(job);
+        }
+    }
+    p_workers->m_wake.notify_all();
+
+    job->drain();
+
+    std::unique_lock<std::mutex> guard(job->m_lock);
+    job->m_done.wait(guard, [&job] { return job->m_pending == 0; });
+
+    return job->m_err;
+}
+
+} // namespace alcp::utils
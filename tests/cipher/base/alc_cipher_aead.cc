@@ -178,6 +178,11 @@ AlcpCipherAeadBase::encrypt(alcp_dc_ex_t& data)
 
     switch (m_mode) {
         case ALC_AES_MODE_GCM:
+        case ALC_AES_MODE_OCB:
+        case ALC_AEGIS128L:
+        case ALC_AEGIS256:
+        case ALC_AEGIS128X2:
+        case ALC_AEGIS128X4:
             return alcpGCMModeToFuncCall<cEnc>(aead_data);
         case ALC_AES_MODE_CCM:
             return alcpCCMModeToFuncCall<cEnc>(aead_data);
@@ -197,6 +202,11 @@ AlcpCipherAeadBase::decrypt(alcp_dc_ex_t& data)
     constexpr bool cEnc      = false;
     switch (m_mode) {
         case ALC_AES_MODE_GCM:
+        case ALC_AES_MODE_OCB:
+        case ALC_AEGIS128L:
+        case ALC_AEGIS256:
+        case ALC_AEGIS128X2:
+        case ALC_AEGIS128X4:
             return alcpGCMModeToFuncCall<cEnc>(aead_data);
         case ALC_AES_MODE_CCM:
             return alcpCCMModeToFuncCall<cEnc>(aead_data);
@@ -283,6 +293,15 @@ AlcpCipherAeadBase::alcpGCMModeToFuncCall(alcp_dc_ex_t& aead_data)
         return false;
     }
 
+    // OCB folds the tag length into the nonce, so it goes before any data
+    if (m_mode == ALC_AES_MODE_OCB) {
+        err = alcp_cipher_aead_set_tag_length(m_handle, aead_data.m_tagl);
+        if (alcp_is_error(err)) {
+            printf("Err:setting tagl\n");
+            return false;
+        }
+    }
+
     if (aead_data.m_adl > 0) {
         err =
             alcp_cipher_aead_set_aad(m_handle, aead_data.m_ad, aead_data.m_adl);
@@ -350,14 +369,12 @@ AlcpCipherAeadBase::alcpCCMModeToFuncCall(alcp_dc_ex_t& aead_data)
         return false;
     }
 
-#ifdef CCM_MULTI_UPDATE
     // set plaintext length
     err = alcp_cipher_aead_set_ccm_plaintext_length(m_handle, aead_data.m_inl);
     if (err != ALC_ERROR_NONE) {
         printf("Error: Setting the plaintext Length\n");
         return -1;
     }
-#endif
 
     err =
         alcp_cipher_aead_init(m_handle, m_key, m_keyLen, m_iv, aead_data.m_ivl);
@@ -77,6 +77,16 @@ GetModeSTR(alc_cipher_mode_t mode)
             return "CCM";
         case ALC_AES_MODE_SIV:
             return "SIV";
+        case ALC_AES_MODE_OCB:
+            return "OCB";
+        case ALC_AEGIS128L:
+            return "AEGIS128L";
+        case ALC_AEGIS256:
+            return "AEGIS256";
+        case ALC_AEGIS128X2:
+            return "AEGIS128X2";
+        case ALC_AEGIS128X4:
+            return "AEGIS128X4";
         case ALC_CHACHA20:
             return "Chacha20";
         case ALC_CHACHA20_POLY1305:
@@ -102,6 +112,11 @@ CheckCipherIsAEAD(alc_cipher_mode_t mode)
         case ALC_AES_MODE_GCM:
         case ALC_AES_MODE_CCM:
         case ALC_AES_MODE_SIV:
+        case ALC_AES_MODE_OCB:
+        case ALC_AEGIS128L:
+        case ALC_AEGIS256:
+        case ALC_AEGIS128X2:
+        case ALC_AEGIS128X4:
         case ALC_CHACHA20_POLY1305:
             return true;
         default:
@@ -170,6 +185,11 @@ CipherAeadBase::isAead(const alc_cipher_mode_t& mode)
         case ALC_AES_MODE_GCM:
         case ALC_AES_MODE_SIV:
         case ALC_AES_MODE_CCM:
+        case ALC_AES_MODE_OCB:
+        case ALC_AEGIS128L:
+        case ALC_AEGIS256:
+        case ALC_AEGIS128X2:
+        case ALC_AEGIS128X4:
         case ALC_CHACHA20_POLY1305:
             return true;
         default:
@@ -57,6 +57,19 @@ OpenSSLCipherAeadBase::alcpModeKeyLenToCipher(alc_cipher_mode_t mode,
                     break;
             }
             break;
+        case ALC_AES_MODE_OCB:
+            switch (keylen) {
+                case 128:
+                    p_mode = EVP_aes_128_ocb();
+                    break;
+                case 192:
+                    p_mode = EVP_aes_192_ocb();
+                    break;
+                case 256:
+                    p_mode = EVP_aes_256_ocb();
+                    break;
+            }
+            break;
         case ALC_AES_MODE_CCM:
             switch (keylen) {
                 case 128:
@@ -216,6 +229,7 @@ OpenSSLCipherAeadBase::init(const Uint8* key, const Uint32 cKeyLen)
 
     switch (m_mode) {
         case ALC_AES_MODE_GCM:
+        case ALC_AES_MODE_OCB:
             if (1
                 != EVP_EncryptInit_ex(m_ctx_enc,
                                       alcpModeKeyLenToCipher(m_mode, m_key_len),
@@ -302,6 +316,7 @@ OpenSSLCipherAeadBase::init(const Uint8* key, const Uint32 cKeyLen)
 
     switch (m_mode) {
         case ALC_AES_MODE_GCM:
+        case ALC_AES_MODE_OCB:
             if (1
                 != EVP_DecryptInit_ex(m_ctx_dec,
                                       alcpModeKeyLenToCipher(m_mode, m_key_len),
@@ -402,7 +417,16 @@ OpenSSLCipherAeadBase::encrypt(alcp_dc_ex_t& data_in)
     std::vector<Uint8> temp   = std::vector<Uint8>(1);
     alcp_dc_ex_t       data   = *reinterpret_cast<alcp_dc_ex_t*>(&data_in);
 #if 1
-    if (m_mode == ALC_AES_MODE_GCM) {
+    if (m_mode == ALC_AES_MODE_GCM || m_mode == ALC_AES_MODE_OCB) {
+        /* OCB encodes the tag length into the initial offset */
+        if (m_mode == ALC_AES_MODE_OCB && data.m_tagl != 0)
+            if (1
+                != EVP_CIPHER_CTX_ctrl(
+                    m_ctx_enc, EVP_CTRL_AEAD_SET_TAG, data.m_tagl, NULL)) {
+                std::cout << "Error: Tag Length Setting Failed" << std::endl;
+                handleErrors();
+                return false;
+            }
         if (data.m_adl > 0)
             if (1
                 != EVP_EncryptUpdate(
@@ -596,7 +620,18 @@ OpenSSLCipherAeadBase::decrypt(alcp_dc_ex_t& data_in)
     static Uint8 temp;
     alcp_dc_ex_t data = *reinterpret_cast<alcp_dc_ex_t*>(&data_in);
 #if 1
-    if (m_mode == ALC_AES_MODE_GCM) {
+    if (m_mode == ALC_AES_MODE_GCM || m_mode == ALC_AES_MODE_OCB) {
+        /* OCB encodes the tag length into the initial offset */
+        if (m_mode == ALC_AES_MODE_OCB && data.m_tagl > 0)
+            if (1
+                != EVP_CIPHER_CTX_ctrl(m_ctx_dec,
+                                       EVP_CTRL_AEAD_SET_TAG,
+                                       data.m_tagl,
+                                       data.m_tag)) {
+                std::cout << "Error: Tag Setting Failed" << std::endl;
+                handleErrors();
+                return false;
+            }
         if (data.m_adl > 0)
             if (1
                 != EVP_DecryptUpdate(
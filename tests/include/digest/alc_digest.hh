@@ -43,9 +43,16 @@ GetDigestLen(alc_digest_mode_t mode)
 {
     Uint64 len = 0;
     switch (mode) {
+        case ALC_MD5:
         case ALC_SHAKE_128:
             len = ALC_DIGEST_LEN_128;
             break;
+        case ALC_SHA1:
+            len = ALC_DIGEST_LEN_160;
+            break;
+        case ALC_MD5_SHA1:
+            len = ALC_DIGEST_LEN_288;
+            break;
         case ALC_SHA2_224:
         case ALC_SHA3_224:
         case ALC_SHA2_512_224: